@@ -0,0 +1,5082 @@
+/*
+ * Generated by tuner-host gen-fft 16384; do not edit.
+ *
+ * Radix-2 FFT of exactly 16384 points, included by tuner.c, which
+ * uses it in place of the generic kernels when N matches. The
+ * twiddles are exact to float rather than computed per group, so
+ * results differ from the generic path in the last bits.
+ */
+
+#ifndef FFT_16384_H
+#define FFT_16384_H
+
+#define TUNER_FFT_FIXED_N 16384
+
+// exp(-2 pi i k / 16384)
+static const float fft_fixed_twiddle_re[8192] = {
+    1.0f, 0.99999994f, 0.999999702f, 0.999999344f, 0.999998808f, 0.999998152f,
+    0.999997377f, 0.999996424f, 0.999995291f, 0.99999404f, 0.999992669f,
+    0.999991119f, 0.99998939f, 0.999987602f, 0.999985576f, 0.99998343f,
+    0.999981165f, 0.999978721f, 0.999976158f, 0.999973476f, 0.999970615f,
+    0.999967575f, 0.999964416f, 0.999961078f, 0.999957621f, 0.999954045f,
+    0.99995029f, 0.999946415f, 0.999942362f, 0.99993813f, 0.999933839f,
+    0.999929309f, 0.999924719f, 0.999919951f, 0.999915004f, 0.999909937f,
+    0.999904692f, 0.999899328f, 0.999893844f, 0.999888182f, 0.99988234f,
+    0.99987638f, 0.9998703f, 0.999864042f, 0.999857664f, 0.999851108f,
+    0.999844432f, 0.999837577f, 0.999830604f, 0.999823451f, 0.999816179f,
+    0.999808729f, 0.999801159f, 0.99979347f, 0.999785602f, 0.999777555f,
+    0.99976939f, 0.999761105f, 0.999752641f, 0.999744058f, 0.999735296f,
+    0.999726415f, 0.999717355f, 0.999708176f, 0.999698818f, 0.999689341f,
+    0.999679685f, 0.999669909f, 0.999660015f, 0.999649942f, 0.99963969f,
+    0.999629319f, 0.999618828f, 0.999608159f, 0.999597371f, 0.999586403f,
+    0.999575317f, 0.999564052f, 0.999552667f, 0.999541104f, 0.999529421f,
+    0.99951756f, 0.999505579f, 0.99949348f, 0.999481201f, 0.999468744f,
+    0.999456167f, 0.999443471f, 0.999430597f, 0.999417603f, 0.99940443f,
+    0.999391139f, 0.999377668f, 0.999364078f, 0.999350309f, 0.999336421f,
+    0.999322355f, 0.999308169f, 0.999293864f, 0.99927938f, 0.999264777f,
+    0.999249995f, 0.999235034f, 0.999219954f, 0.999204755f, 0.999189377f,
+    0.99917388f, 0.999158204f, 0.999142408f, 0.999126494f, 0.999110341f,
+    0.999094129f, 0.999077737f, 0.999061167f, 0.999044478f, 0.999027669f,
+    0.999010682f, 0.998993576f, 0.99897629f, 0.998958886f, 0.998941302f,
+    0.9989236f, 0.998905718f, 0.998887718f, 0.998869538f, 0.99885124f,
+    0.998832822f, 0.998814225f, 0.99879545f, 0.998776555f, 0.998757541f,
+    0.998738348f, 0.998719037f, 0.998699546f, 0.998679936f, 0.998660147f,
+    0.998640239f, 0.998620152f, 0.998599946f, 0.998579562f, 0.998559058f,
+    0.998538435f, 0.998517632f, 0.998496652f, 0.998475552f, 0.998454332f,
+    0.998432934f, 0.998411417f, 0.998389721f, 0.998367906f, 0.998345912f,
+    0.998323798f, 0.998301566f, 0.998279154f, 0.998256564f, 0.998233855f,
+    0.998211026f, 0.998188019f, 0.998164833f, 0.998141527f, 0.998118103f,
+    0.998094499f, 0.998070776f, 0.998046875f, 0.998022854f, 0.997998714f,
+    0.997974396f, 0.997949898f, 0.997925282f, 0.997900546f, 0.997875631f,
+    0.997850537f, 0.997825325f, 0.997799993f, 0.997774482f, 0.997748852f,
+    0.997723043f, 0.997697115f, 0.997671068f, 0.997644842f, 0.997618437f,
+    0.997591913f, 0.99756521f, 0.997538447f, 0.997511446f, 0.997484326f,
+    0.997457087f, 0.997429669f, 0.997402132f, 0.997374415f, 0.99734658f,
+    0.997318566f, 0.997290432f, 0.99726218f, 0.997233748f, 0.997205138f,
+    0.997176409f, 0.99714756f, 0.997118533f, 0.997089386f, 0.997060061f,
+    0.997030616f, 0.997000992f, 0.99697125f, 0.996941328f, 0.996911287f,
+    0.996881127f, 0.996850789f, 0.996820271f, 0.996789694f, 0.996758878f,
+    0.996727943f, 0.996696889f, 0.996665657f, 0.996634305f, 0.996602774f,
+    0.996571124f, 0.996539354f, 0.996507406f, 0.996475279f, 0.996443033f,
+    0.996410668f, 0.996378124f, 0.99634546f, 0.996312618f, 0.996279657f,
+    0.996246517f, 0.996213257f, 0.996179819f, 0.996146262f, 0.996112585f,
+    0.99607873f, 0.996044695f, 0.996010542f, 0.995976269f, 0.995941818f,
+    0.995907247f, 0.995872498f, 0.995837629f, 0.995802581f, 0.995767415f,
+    0.995732069f, 0.995696604f, 0.99566102f, 0.995625257f, 0.995589375f,
+    0.995553315f, 0.995517075f, 0.995480776f, 0.995444238f, 0.995407641f,
+    0.995370865f, 0.99533391f, 0.995296836f, 0.995259583f, 0.99522227f,
+    0.99518472f, 0.995147049f, 0.99510926f, 0.995071292f, 0.995033205f,
+    0.994994938f, 0.994956553f, 0.994917989f, 0.994879305f, 0.994840503f,
+    0.994801521f, 0.994762421f, 0.994723141f, 0.994683683f, 0.994644165f,
+    0.994604409f, 0.994564593f, 0.994524539f, 0.994484425f, 0.994444132f,
+    0.99440366f, 0.99436307f, 0.99432236f, 0.994281471f, 0.994240463f,
+    0.994199276f, 0.99415797f, 0.994116485f, 0.994074881f, 0.994033098f,
+    0.993991196f, 0.993949175f, 0.993906975f, 0.993864655f, 0.993822157f,
+    0.99377948f, 0.993736744f, 0.993693769f, 0.993650734f, 0.993607521f,
+    0.993564129f, 0.993520617f, 0.993476987f, 0.993433177f, 0.993389189f,
+    0.993345141f, 0.993300855f, 0.993256509f, 0.993211925f, 0.993167281f,
+    0.993122458f, 0.993077457f, 0.993032336f, 0.992987096f, 0.992941678f,
+    0.99289614f, 0.992850423f, 0.992804587f, 0.992758572f, 0.992712438f,
+    0.992666125f, 0.992619693f, 0.992573142f, 0.992526412f, 0.992479563f,
+    0.992432535f, 0.992385328f, 0.992338061f, 0.992290616f, 0.992242992f,
+    0.992195249f, 0.992147326f, 0.992099285f, 0.992051125f, 0.992002785f,
+    0.991954327f, 0.991905689f, 0.991856933f, 0.991807997f, 0.991758943f,
+    0.991709769f, 0.991660416f, 0.991610885f, 0.991561234f, 0.991511464f,
+    0.991461515f, 0.991411448f, 0.99136126f, 0.991310835f, 0.99126035f,
+    0.991209686f, 0.991158843f, 0.991107941f, 0.9910568f, 0.99100554f,
+    0.990954161f, 0.990902662f, 0.990850925f, 0.990799129f, 0.990747154f,
+    0.990695f, 0.990642786f, 0.990590334f, 0.990537763f, 0.990485072f,
+    0.990432262f, 0.990379214f, 0.990326107f, 0.99027282f, 0.990219355f,
+    0.99016583f, 0.990112066f, 0.990058184f, 0.990004182f, 0.989950061f,
+    0.989895701f, 0.989841282f, 0.989786685f, 0.989731967f, 0.989677072f,
+    0.989621997f, 0.989566863f, 0.98951149f, 0.989456058f, 0.989400446f,
+    0.989344656f, 0.989288747f, 0.989232719f, 0.989176512f, 0.989120185f,
+    0.98906368f, 0.989007056f, 0.988950253f, 0.98889333f, 0.988836288f,
+    0.988779068f, 0.988721669f, 0.98866421f, 0.988606513f, 0.988548756f,
+    0.98849082f, 0.988432705f, 0.988374472f, 0.988316119f, 0.988257587f,
+    0.988198876f, 0.988140106f, 0.988081098f, 0.988022029f, 0.987962782f,
+    0.987903357f, 0.987843812f, 0.987784147f, 0.987724304f, 0.987664342f,
+    0.987604201f, 0.987543941f, 0.987483501f, 0.987422943f, 0.987362266f,
+    0.987301409f, 0.987240434f, 0.987179279f, 0.987118006f, 0.987056553f,
+    0.986994982f, 0.986933291f, 0.986871421f, 0.986809373f, 0.986747265f,
+    0.986684918f, 0.986622512f, 0.986559927f, 0.986497164f, 0.986434281f,
+    0.986371279f, 0.986308098f, 0.986244798f, 0.986181319f, 0.986117721f,
+    0.986053944f, 0.985990047f, 0.985926032f, 0.985861838f, 0.985797524f,
+    0.985733032f, 0.985668421f, 0.985603631f, 0.985538721f, 0.985473692f,
+    0.985408485f, 0.985343158f, 0.985277653f, 0.985212028f, 0.985146224f,
+    0.985080302f, 0.98501426f, 0.984948039f, 0.984881639f, 0.98481518f,
+    0.984748483f, 0.984681726f, 0.984614789f, 0.984547675f, 0.984480441f,
+    0.984413087f, 0.984345555f, 0.984277904f, 0.984210074f, 0.984142125f,
+    0.984074056f, 0.984005809f, 0.983937442f, 0.983868897f, 0.983800232f,
+    0.983731389f, 0.983662426f, 0.983593285f, 0.983524024f, 0.983454645f,
+    0.983385086f, 0.983315408f, 0.983245611f, 0.983175635f, 0.983105481f,
+    0.983035207f, 0.982964814f, 0.982894242f, 0.982823551f, 0.982752681f,
+    0.982681692f, 0.982610583f, 0.982539296f, 0.98246789f, 0.982396305f,
+    0.9823246f, 0.982252717f, 0.982180715f, 0.982108593f, 0.982036293f,
+    0.981963873f, 0.981891274f, 0.981818557f, 0.98174572f, 0.981672704f,
+    0.98159951f, 0.981526256f, 0.981452763f, 0.981379211f, 0.98130548f,
+    0.98123157f, 0.981157541f, 0.981083393f, 0.981009066f, 0.98093462f,
+    0.980859995f, 0.980785251f, 0.980710387f, 0.980635345f, 0.980560184f,
+    0.980484843f, 0.980409384f, 0.980333805f, 0.980258048f, 0.980182111f,
+    0.980106115f, 0.980029881f, 0.979953587f, 0.979877114f, 0.979800463f,
+    0.979723752f, 0.979646802f, 0.979569793f, 0.979492545f, 0.979415238f,
+    0.979337752f, 0.979260147f, 0.979182363f, 0.979104459f, 0.979026377f,
+    0.978948176f, 0.978869855f, 0.978791356f, 0.978712678f, 0.97863394f,
+    0.978555024f, 0.978475928f, 0.978396714f, 0.97831738f, 0.978237867f,
+    0.978158236f, 0.978078425f, 0.977998495f, 0.977918446f, 0.977838218f,
+    0.977757871f, 0.977677345f, 0.9775967f, 0.977515936f, 0.977434993f,
+    0.977353871f, 0.977272689f, 0.977191329f, 0.97710979f, 0.977028131f,
+    0.976946354f, 0.976864398f, 0.976782322f, 0.976700068f, 0.976617694f,
+    0.976535201f, 0.976452529f, 0.976369739f, 0.976286769f, 0.97620368f,
+    0.976120472f, 0.976037085f, 0.975953579f, 0.975869894f, 0.97578609f,
+    0.975702107f, 0.975618005f, 0.975533783f, 0.975449383f, 0.975364864f,
+    0.975280225f, 0.975195408f, 0.975110471f, 0.975025356f, 0.974940121f,
+    0.974854708f, 0.974769175f, 0.974683523f, 0.974597692f, 0.974511743f,
+    0.974425614f, 0.974339366f, 0.974252999f, 0.974166453f, 0.974079788f,
+    0.973992944f, 0.973905981f, 0.973818898f, 0.973731637f, 0.973644257f,
+    0.973556697f, 0.973469019f, 0.973381221f, 0.973293245f, 0.973205149f,
+    0.973116875f, 0.973028481f, 0.972939968f, 0.972851276f, 0.972762465f,
+    0.972673476f, 0.972584367f, 0.972495139f, 0.972405732f, 0.972316206f,
+    0.972226501f, 0.972136676f, 0.972046733f, 0.971956611f, 0.97186631f,
+    0.971775949f, 0.97168541f, 0.971594691f, 0.971503913f, 0.971412897f,
+    0.971321821f, 0.971230567f, 0.971139133f, 0.97104764f, 0.970955908f,
+    0.970864117f, 0.970772147f, 0.970680058f, 0.97058779f, 0.970495403f,
+    0.970402837f, 0.970310152f, 0.970217347f, 0.970124364f, 0.970031261f,
+    0.96993798f, 0.96984458f, 0.96975106f, 0.969657362f, 0.969563544f,
+    0.969469607f, 0.969375491f, 0.969281256f, 0.969186842f, 0.969092309f,
+    0.968997598f, 0.968902826f, 0.968807817f, 0.968712747f, 0.968617499f,
+    0.968522072f, 0.968426585f, 0.96833086f, 0.968235075f, 0.968139112f,
+    0.968043029f, 0.967946768f, 0.967850387f, 0.967753828f, 0.967657149f,
+    0.967560351f, 0.967463374f, 0.967366278f, 0.967269063f, 0.967171669f,
+    0.967074156f, 0.966976464f, 0.966878653f, 0.966780722f, 0.966682613f,
+    0.966584384f, 0.966485977f, 0.966387451f, 0.966288805f, 0.966189981f,
+    0.966091037f, 0.965991974f, 0.965892732f, 0.965793371f, 0.965693831f,
+    0.965594172f, 0.965494394f, 0.965394437f, 0.965294361f, 0.965194106f,
+    0.965093791f, 0.964993238f, 0.964892626f, 0.964791834f, 0.964690864f,
+    0.964589775f, 0.964488566f, 0.964387238f, 0.964285731f, 0.964184046f,
+    0.964082301f, 0.963980377f, 0.963878274f, 0.963776052f, 0.963673711f,
+    0.963571191f, 0.963468552f, 0.963365793f, 0.963262856f, 0.9631598f,
+    0.963056624f, 0.962953269f, 0.962849796f, 0.962746143f, 0.962642372f,
+    0.962538481f, 0.962434411f, 0.962330222f, 0.962225854f, 0.962121427f,
+    0.962016761f, 0.961912036f, 0.961807132f, 0.961702049f, 0.961596906f,
+    0.961491585f, 0.961386085f, 0.961280465f, 0.961174726f, 0.961068869f,
+    0.960962832f, 0.960856616f, 0.960750341f, 0.960643888f, 0.960537255f,
+    0.960430503f, 0.960323632f, 0.960216641f, 0.960109472f, 0.960002124f,
+    0.959894717f, 0.95978713f, 0.959679365f, 0.95957154f, 0.959463477f,
+    0.959355354f, 0.959247053f, 0.959138632f, 0.959030032f, 0.958921313f,
+    0.958812475f, 0.958703458f, 0.958594322f, 0.958485067f, 0.958375633f,
+    0.958266079f, 0.958156347f, 0.958046496f, 0.957936525f, 0.957826436f,
+    0.957716167f, 0.95760572f, 0.957495213f, 0.957384527f, 0.957273662f,
+    0.957162678f, 0.957051575f, 0.956940353f, 0.956828952f, 0.956717432f,
+    0.956605732f, 0.956493914f, 0.956381977f, 0.95626986f, 0.956157625f,
+    0.95604527f, 0.955932736f, 0.955820084f, 0.955707252f, 0.955594361f,
+    0.955481231f, 0.955368042f, 0.955254674f, 0.955141187f, 0.955027521f,
+    0.954913735f, 0.954799831f, 0.954685748f, 0.954571545f, 0.954457223f,
+    0.954342723f, 0.954228103f, 0.954113305f, 0.953998446f, 0.95388335f,
+    0.953768194f, 0.953652859f, 0.953537405f, 0.953421772f, 0.953306019f,
+    0.953190148f, 0.953074098f, 0.952957928f, 0.95284164f, 0.952725172f,
+    0.952608585f, 0.952491879f, 0.952374995f, 0.952257991f, 0.952140868f,
+    0.952023566f, 0.951906145f, 0.951788545f, 0.951670885f, 0.951552987f,
+    0.95143503f, 0.951316893f, 0.951198637f, 0.951080203f, 0.950961649f,
+    0.950842977f, 0.950724125f, 0.950605154f, 0.950486064f, 0.950366855f,
+    0.950247467f, 0.9501279f, 0.950008273f, 0.949888468f, 0.949768484f,
+    0.94964838f, 0.949528158f, 0.949407816f, 0.949287295f, 0.949166656f,
+    0.949045897f, 0.948924959f, 0.948803902f, 0.948682666f, 0.94856137f,
+    0.948439896f, 0.948318243f, 0.948196471f, 0.948074579f, 0.947952569f,
+    0.947830379f, 0.94770807f, 0.947585583f, 0.947462976f, 0.94734025f,
+    0.947217405f, 0.947094381f, 0.946971238f, 0.946847916f, 0.946724474f,
+    0.946600914f, 0.946477175f, 0.946353376f, 0.946229339f, 0.946105242f,
+    0.945980966f, 0.945856571f, 0.945731997f, 0.945607305f, 0.945482492f,
+    0.945357561f, 0.945232451f, 0.945107222f, 0.944981813f, 0.944856286f,
+    0.944730639f, 0.944604814f, 0.944478929f, 0.944352806f, 0.944226623f,
+    0.944100261f, 0.94397378f, 0.94384712f, 0.943720341f, 0.943593442f,
+    0.943466425f, 0.943339229f, 0.943211913f, 0.943084419f, 0.942956865f,
+    0.942829072f, 0.942701221f, 0.94257319f, 0.94244504f, 0.942316771f,
+    0.942188323f, 0.942059755f, 0.941931009f, 0.941802204f, 0.941673219f,
+    0.941544056f, 0.941414773f, 0.941285372f, 0.941155851f, 0.941026151f,
+    0.940896332f, 0.940766394f, 0.940636277f, 0.940506041f, 0.940375686f,
+    0.940245211f, 0.940114558f, 0.939983726f, 0.939852834f, 0.939721763f,
+    0.939590573f, 0.939459205f, 0.939327717f, 0.93919611f, 0.939064384f,
+    0.938932478f, 0.938800454f, 0.938668311f, 0.938535988f, 0.938403547f,
+    0.938270926f, 0.938138247f, 0.938005388f, 0.93787235f, 0.937739253f,
+    0.937605977f, 0.937472582f, 0.937339008f, 0.937205315f, 0.937071502f,
+    0.936937571f, 0.93680346f, 0.93666923f, 0.936534822f, 0.936400294f,
+    0.936265647f, 0.936130881f, 0.935995936f, 0.935860872f, 0.935725689f,
+    0.935590327f, 0.935454845f, 0.935319245f, 0.935183525f, 0.935047626f,
+    0.934911609f, 0.934775412f, 0.934639156f, 0.934502721f, 0.934366107f,
+    0.934229374f, 0.934092522f, 0.93395555f, 0.93381846f, 0.93368119f,
+    0.933543801f, 0.933406234f, 0.933268547f, 0.933130741f, 0.932992816f,
+    0.932854712f, 0.932716489f, 0.932578146f, 0.932439625f, 0.932300985f,
+    0.932162225f, 0.932023287f, 0.931884289f, 0.931745052f, 0.931605756f,
+    0.931466281f, 0.931326687f, 0.931186974f, 0.931047082f, 0.93090713f,
+    0.93076694f, 0.93062669f, 0.930486262f, 0.930345714f, 0.930205047f,
+    0.930064201f, 0.929923236f, 0.929782152f, 0.929640889f, 0.929499507f,
+    0.929358006f, 0.929216385f, 0.929074585f, 0.928932667f, 0.928790629f,
+    0.928648412f, 0.928506076f, 0.928363621f, 0.928220987f, 0.928078294f,
+    0.927935421f, 0.92779237f, 0.92764926f, 0.92750597f, 0.927362502f,
+    0.927218974f, 0.927075267f, 0.926931441f, 0.926787496f, 0.926643372f,
+    0.926499128f, 0.926354766f, 0.926210225f, 0.926065564f, 0.925920784f,
+    0.925775886f, 0.925630808f, 0.925485611f, 0.925340295f, 0.92519486f,
+    0.925049245f, 0.924903512f, 0.9247576f, 0.924611628f, 0.924465477f,
+    0.924319208f, 0.924172759f, 0.924026251f, 0.923879504f, 0.923732698f,
+    0.923585773f, 0.923438668f, 0.923291445f, 0.923144042f, 0.922996521f,
+    0.92284888f, 0.92270112f, 0.922553241f, 0.922405183f, 0.922257006f,
+    0.92210865f, 0.921960235f, 0.92181164f, 0.921662927f, 0.921514034f,
+    0.921365023f, 0.921215892f, 0.921066642f, 0.920917213f, 0.920767725f,
+    0.920618057f, 0.920468211f, 0.920318305f, 0.920168221f, 0.920017958f,
+    0.919867635f, 0.919717133f, 0.919566512f, 0.919415772f, 0.919264853f,
+    0.919113874f, 0.918962717f, 0.918811381f, 0.918659985f, 0.91850841f,
+    0.918356717f, 0.918204844f, 0.918052912f, 0.917900801f, 0.917748511f,
+    0.917596161f, 0.917443633f, 0.917290986f, 0.917138219f, 0.916985273f,
+    0.916832268f, 0.916679084f, 0.916525722f, 0.916372299f, 0.916218698f,
+    0.916064978f, 0.915911078f, 0.91575712f, 0.915602982f, 0.915448725f,
+    0.91529429f, 0.915139794f, 0.91498512f, 0.914830327f, 0.914675355f,
+    0.914520323f, 0.914365113f, 0.914209783f, 0.914054275f, 0.913898647f,
+    0.9137429f, 0.913587034f, 0.913431048f, 0.913274884f, 0.913118601f,
+    0.912962198f, 0.912805617f, 0.912648976f, 0.912492156f, 0.912335157f,
+    0.912178099f, 0.912020862f, 0.911863506f, 0.91170603f, 0.911548436f,
+    0.911390662f, 0.911232769f, 0.911074758f, 0.910916567f, 0.910758257f,
+    0.910599828f, 0.910441279f, 0.910282612f, 0.910123765f, 0.9099648f,
+    0.909805715f, 0.909646451f, 0.909487128f, 0.909327626f, 0.909168005f,
+    0.909008205f, 0.908848345f, 0.908688307f, 0.90852809f, 0.908367813f,
+    0.908207357f, 0.908046842f, 0.907886088f, 0.907725275f, 0.907564342f,
+    0.907403231f, 0.907242f, 0.907080591f, 0.906919122f, 0.906757474f,
+    0.906595707f, 0.906433821f, 0.906271756f, 0.906109571f, 0.905947268f,
+    0.905784845f, 0.905622303f, 0.905459583f, 0.905296743f, 0.905133784f,
+    0.904970706f, 0.904807448f, 0.904644072f, 0.904480577f, 0.904316962f,
+    0.904153168f, 0.903989315f, 0.903825283f, 0.903661072f, 0.903496802f,
+    0.903332353f, 0.903167784f, 0.903003097f, 0.90283829f, 0.902673304f,
+    0.902508199f, 0.902342975f, 0.902177632f, 0.902012169f, 0.901846528f,
+    0.901680768f, 0.901514888f, 0.901348829f, 0.901182711f, 0.901016414f,
+    0.900849998f, 0.900683403f, 0.900516748f, 0.900349915f, 0.900182962f,
+    0.900015891f, 0.8998487f, 0.89968133f, 0.899513841f, 0.899346232f,
+    0.899178505f, 0.899010599f, 0.898842633f, 0.898674488f, 0.898506165f,
+    0.898337781f, 0.898169279f, 0.898000598f, 0.897831798f, 0.897662818f,
+    0.89749378f, 0.897324562f, 0.897155225f, 0.896985769f, 0.896816194f,
+    0.8966465f, 0.896476626f, 0.896306634f, 0.896136522f, 0.895966232f,
+    0.895795882f, 0.895625353f, 0.895454705f, 0.895283937f, 0.895112991f,
+    0.894941986f, 0.894770801f, 0.894599497f, 0.894428074f, 0.894256473f,
+    0.894084752f, 0.893912971f, 0.893740952f, 0.893568873f, 0.893396676f,
+    0.893224299f, 0.893051803f, 0.892879188f, 0.892706454f, 0.892533541f,
+    0.892360568f, 0.892187417f, 0.892014146f, 0.891840696f, 0.891667187f,
+    0.891493499f, 0.891319692f, 0.891145766f, 0.89097172f, 0.890797496f,
+    0.890623152f, 0.890448749f, 0.890274107f, 0.890099406f, 0.889924586f,
+    0.889749587f, 0.889574468f, 0.88939923f, 0.889223874f, 0.889048338f,
+    0.888872743f, 0.888696969f, 0.888521075f, 0.888345063f, 0.888168871f,
+    0.887992561f, 0.887816191f, 0.887639642f, 0.887462914f, 0.887286127f,
+    0.88710916f, 0.886932135f, 0.88675493f, 0.886577606f, 0.886400104f,
+    0.886222541f, 0.8860448f, 0.88586694f, 0.885688961f, 0.885510862f,
+    0.885332584f, 0.885154247f, 0.884975731f, 0.884797096f, 0.884618342f,
+    0.884439468f, 0.884260416f, 0.884081244f, 0.883901954f, 0.883722544f,
+    0.883543015f, 0.883363366f, 0.883183539f, 0.883003592f, 0.882823527f,
+    0.882643342f, 0.882463038f, 0.882282555f, 0.882101953f, 0.881921291f,
+    0.881740451f, 0.881559432f, 0.881378353f, 0.881197095f, 0.881015778f,
+    0.880834281f, 0.880652666f, 0.880470872f, 0.880289018f, 0.880106986f,
+    0.879924834f, 0.879742622f, 0.879560173f, 0.879377663f, 0.879195035f,
+    0.879012227f, 0.8788293f, 0.878646255f, 0.878463089f, 0.878279805f,
+    0.878096342f, 0.877912819f, 0.877729118f, 0.877545297f, 0.877361357f,
+    0.877177238f, 0.87699306f, 0.876808703f, 0.876624286f, 0.876439691f,
+    0.876254916f, 0.876070082f, 0.875885129f, 0.875699997f, 0.875514746f,
+    0.875329375f, 0.875143886f, 0.874958277f, 0.874772549f, 0.874586642f,
+    0.874400616f, 0.87421453f, 0.874028265f, 0.873841822f, 0.873655319f,
+    0.873468697f, 0.873281896f, 0.873094976f, 0.872907937f, 0.872720778f,
+    0.8725335f, 0.872346044f, 0.872158527f, 0.871970832f, 0.871783018f,
+    0.871595085f, 0.871407032f, 0.87121886f, 0.871030509f, 0.87084204f,
+    0.87065351f, 0.870464802f, 0.870275974f, 0.870086968f, 0.869897902f,
+    0.869708657f, 0.869519353f, 0.86932987f, 0.869140267f, 0.868950546f,
+    0.868760705f, 0.868570685f, 0.868380606f, 0.868190348f, 0.867999971f,
+    0.867809474f, 0.867618859f, 0.867428124f, 0.86723727f, 0.867046237f,
+    0.866855085f, 0.866663873f, 0.866472483f, 0.866280973f, 0.866089284f,
+    0.865897536f, 0.865705669f, 0.865513623f, 0.865321457f, 0.865129173f,
+    0.864936769f, 0.864744246f, 0.864551604f, 0.864358783f, 0.864165902f,
+    0.863972843f, 0.863779664f, 0.863586366f, 0.863392949f, 0.863199413f,
+    0.863005757f, 0.862811923f, 0.862618029f, 0.862423956f, 0.862229764f,
+    0.862035453f, 0.861841023f, 0.861646473f, 0.861451745f, 0.861256957f,
+    0.86106199f, 0.860866964f, 0.860671759f, 0.860476434f, 0.860280991f,
+    0.860085368f, 0.859889686f, 0.859693885f, 0.859497905f, 0.859301805f,
+    0.859105587f, 0.858909249f, 0.858712792f, 0.858516216f, 0.858319521f,
+    0.858122647f, 0.857925713f, 0.857728601f, 0.857531369f, 0.857334018f,
+    0.857136548f, 0.856938958f, 0.85674125f, 0.856543422f, 0.856345415f,
+    0.856147349f, 0.855949104f, 0.85575074f, 0.855552256f, 0.855353653f,
+    0.855154932f, 0.85495609f, 0.854757071f, 0.854557991f, 0.854358733f,
+    0.854159415f, 0.853959918f, 0.853760302f, 0.853560567f, 0.853360713f,
+    0.853160739f, 0.852960587f, 0.852760375f, 0.852559984f, 0.852359533f,
+    0.852158904f, 0.851958156f, 0.851757288f, 0.851556301f, 0.851355195f,
+    0.85115397f, 0.850952566f, 0.850751102f, 0.850549459f, 0.850347757f,
+    0.850145876f, 0.849943876f, 0.849741757f, 0.849539518f, 0.849337161f,
+    0.849134684f, 0.848932028f, 0.848729312f, 0.848526478f, 0.848323464f,
+    0.848120332f, 0.84791708f, 0.847713768f, 0.847510278f, 0.847306609f,
+    0.84710288f, 0.846899033f, 0.846695065f, 0.84649092f, 0.846286714f,
+    0.84608233f, 0.845877886f, 0.845673263f, 0.845468521f, 0.84526366f,
+    0.84505868f, 0.84485358f, 0.844648361f, 0.844442964f, 0.844237506f,
+    0.84403187f, 0.843826175f, 0.8436203f, 0.843414366f, 0.843208253f,
+    0.843002021f, 0.84279567f, 0.8425892f, 0.84238261f, 0.842175901f,
+    0.841969013f, 0.841762066f, 0.841554999f, 0.841347754f, 0.841140449f,
+    0.840932965f, 0.840725362f, 0.84051764f, 0.840309858f, 0.840101898f,
+    0.839893818f, 0.839685619f, 0.839477241f, 0.839268804f, 0.839060247f,
+    0.838851511f, 0.838642716f, 0.838433802f, 0.838224709f, 0.838015497f,
+    0.837806225f, 0.837596774f, 0.837387204f, 0.837177515f, 0.836967707f,
+    0.836757779f, 0.836547732f, 0.836337566f, 0.836127281f, 0.835916817f,
+    0.835706294f, 0.835495591f, 0.835284829f, 0.835073888f, 0.834862888f,
+    0.834651709f, 0.83444041f, 0.834229052f, 0.834017515f, 0.833805859f,
+    0.833594084f, 0.833382189f, 0.833170176f, 0.832958043f, 0.83274579f,
+    0.83253336f, 0.832320869f, 0.832108259f, 0.831895471f, 0.831682622f,
+    0.831469595f, 0.831256509f, 0.831043243f, 0.830829859f, 0.830616415f,
+    0.830402792f, 0.830189049f, 0.829975188f, 0.829761207f, 0.829547107f,
+    0.829332948f, 0.82911855f, 0.828904092f, 0.828689516f, 0.82847482f,
+    0.828260005f, 0.82804507f, 0.827829957f, 0.827614784f, 0.827399492f,
+    0.827184021f, 0.826968491f, 0.826752782f, 0.826537013f, 0.826321065f,
+    0.826104999f, 0.825888872f, 0.825672567f, 0.825456142f, 0.825239599f,
+    0.825022995f, 0.824806213f, 0.824589312f, 0.824372292f, 0.824155152f,
+    0.823937893f, 0.823720515f, 0.823503017f, 0.823285401f, 0.823067665f,
+    0.82284981f, 0.822631776f, 0.822413683f, 0.82219547f, 0.821977139f,
+    0.821758628f, 0.821540058f, 0.821321368f, 0.8211025f, 0.820883572f,
+    0.820664465f, 0.820445299f, 0.820225954f, 0.820006549f, 0.819786966f,
+    0.819567323f, 0.819347501f, 0.819127619f, 0.818907559f, 0.818687379f,
+    0.81846714f, 0.818246722f, 0.818026185f, 0.817805588f, 0.817584813f,
+    0.817363918f, 0.817142904f, 0.81692183f, 0.816700578f, 0.816479206f,
+    0.816257715f, 0.816036105f, 0.815814435f, 0.815592587f, 0.815370619f,
+    0.815148532f, 0.814926326f, 0.814704001f, 0.814481556f, 0.814258993f,
+    0.81403631f, 0.813813508f, 0.813590586f, 0.813367546f, 0.813144386f,
+    0.812921166f, 0.812697768f, 0.812474251f, 0.812250614f, 0.812026858f,
+    0.811802983f, 0.811578989f, 0.811354876f, 0.811130643f, 0.810906231f,
+    0.81068176f, 0.81045717f, 0.81023246f, 0.810007632f, 0.809782684f,
+    0.809557617f, 0.80933243f, 0.809107125f, 0.8088817f, 0.808656156f,
+    0.808430493f, 0.80820471f, 0.807978809f, 0.807752848f, 0.807526708f,
+    0.807300448f, 0.80707407f, 0.806847572f, 0.806620955f, 0.806394219f,
+    0.806167364f, 0.80594039f, 0.805713296f, 0.805486083f, 0.805258751f,
+    0.805031359f, 0.804803789f, 0.804576099f, 0.80434829f, 0.804120362f,
+    0.803892314f, 0.803664207f, 0.803435922f, 0.803207517f, 0.802979052f,
+    0.802750409f, 0.802521646f, 0.802292824f, 0.802063823f, 0.801834702f,
+    0.801605523f, 0.801376164f, 0.801146746f, 0.800917149f, 0.800687492f,
+    0.800457656f, 0.800227761f, 0.799997687f, 0.799767554f, 0.799537241f,
+    0.79930687f, 0.799076378f, 0.798845768f, 0.798614979f, 0.79838413f,
+    0.798153162f, 0.797922075f, 0.797690868f, 0.797459483f, 0.797228038f,
+    0.796996474f, 0.796764791f, 0.796532989f, 0.796301067f, 0.796069086f,
+    0.795836926f, 0.795604646f, 0.795372248f, 0.79513973f, 0.794907153f,
+    0.794674397f, 0.794441521f, 0.794208586f, 0.793975472f, 0.793742299f,
+    0.793508947f, 0.793275535f, 0.793041945f, 0.792808294f, 0.792574525f,
+    0.792340577f, 0.792106569f, 0.791872442f, 0.791638196f, 0.79140383f,
+    0.791169345f, 0.790934741f, 0.790700018f, 0.790465176f, 0.790230215f,
+    0.789995134f, 0.789759994f, 0.789524674f, 0.789289236f, 0.789053738f,
+    0.788818061f, 0.788582325f, 0.78834641f, 0.788110435f, 0.787874341f,
+    0.787638068f, 0.787401736f, 0.787165284f, 0.786928713f, 0.786692023f,
+    0.786455214f, 0.786218286f, 0.785981238f, 0.785744071f, 0.785506845f,
+    0.785269439f, 0.785031915f, 0.784794331f, 0.784556568f, 0.784318745f,
+    0.784080803f, 0.783842683f, 0.783604503f, 0.783366203f, 0.783127785f,
+    0.782889247f, 0.78265059f, 0.782411814f, 0.782172918f, 0.781933963f,
+    0.781694829f, 0.781455576f, 0.781216264f, 0.780976772f, 0.780737221f,
+    0.780497551f, 0.780257761f, 0.780017793f, 0.779777765f, 0.779537618f,
+    0.779297352f, 0.779057026f, 0.778816521f, 0.778575897f, 0.778335214f,
+    0.778094351f, 0.777853429f, 0.777612329f, 0.777371168f, 0.777129889f,
+    0.77688849f, 0.776646972f, 0.776405334f, 0.776163578f, 0.775921702f,
+    0.775679708f, 0.775437653f, 0.77519542f, 0.774953127f, 0.774710655f,
+    0.774468124f, 0.774225473f, 0.773982704f, 0.773739815f, 0.773496807f,
+    0.773253679f, 0.773010433f, 0.772767127f, 0.772523642f, 0.772280097f,
+    0.772036374f, 0.771792591f, 0.771548688f, 0.771304667f, 0.771060526f,
+    0.770816267f, 0.770571887f, 0.770327449f, 0.770082831f, 0.769838154f,
+    0.769593298f, 0.769348383f, 0.769103348f, 0.768858194f, 0.768612921f,
+    0.768367529f, 0.768122017f, 0.767876446f, 0.767630696f, 0.767384887f,
+    0.767138898f, 0.76689285f, 0.766646683f, 0.766400397f, 0.766153991f,
+    0.765907466f, 0.765660882f, 0.765414119f, 0.765167236f, 0.764920294f,
+    0.764673233f, 0.764426053f, 0.764178753f, 0.763931334f, 0.763683796f,
+    0.763436139f, 0.763188422f, 0.762940526f, 0.762692571f, 0.762444496f,
+    0.762196302f, 0.761947989f, 0.761699557f, 0.761451006f, 0.761202395f,
+    0.760953605f, 0.760704756f, 0.760455787f, 0.760206699f, 0.759957492f,
+    0.759708166f, 0.759458721f, 0.759209216f, 0.758959532f, 0.758709788f,
+    0.758459926f, 0.758209884f, 0.757959783f, 0.757709622f, 0.757459283f,
+    0.757208824f, 0.756958306f, 0.756707668f, 0.756456852f, 0.756205976f,
+    0.75595504f, 0.755703926f, 0.755452693f, 0.755201399f, 0.754949927f,
+    0.754698396f, 0.754446745f, 0.754194975f, 0.753943086f, 0.753691137f,
+    0.753439009f, 0.753186822f, 0.752934456f, 0.75268203f, 0.752429485f,
+    0.752176821f, 0.751924098f, 0.751671195f, 0.751418233f, 0.751165152f,
+    0.750911951f, 0.750658631f, 0.750405192f, 0.750151634f, 0.749898016f,
+    0.74964422f, 0.749390364f, 0.749136388f, 0.748882294f, 0.74862808f,
+    0.748373806f, 0.748119354f, 0.747864842f, 0.747610211f, 0.747355461f,
+    0.747100592f, 0.746845663f, 0.746590555f, 0.746335387f, 0.746080101f,
+    0.745824695f, 0.74556917f, 0.745313525f, 0.745057762f, 0.744801939f,
+    0.744545996f, 0.744289935f, 0.744033754f, 0.743777454f, 0.743521094f,
+    0.743264556f, 0.743007958f, 0.742751241f, 0.742494404f, 0.742237449f,
+    0.741980433f, 0.741723239f, 0.741465986f, 0.741208613f, 0.740951121f,
+    0.74069351f, 0.740435839f, 0.740177989f, 0.73992008f, 0.739662051f,
+    0.739403903f, 0.739145696f, 0.73888731f, 0.738628864f, 0.738370299f,
+    0.738111615f, 0.737852812f, 0.737593889f, 0.737334907f, 0.737075806f,
+    0.736816585f, 0.736557245f, 0.736297786f, 0.736038268f, 0.73577857f,
+    0.735518813f, 0.735258937f, 0.734998941f, 0.734738886f, 0.734478652f,
+    0.734218359f, 0.733957946f, 0.733697414f, 0.733436823f, 0.733176053f,
+    0.732915223f, 0.732654274f, 0.732393205f, 0.732132018f, 0.73187077f,
+    0.731609404f, 0.731347919f, 0.731086314f, 0.73082459f, 0.730562747f,
+    0.730300844f, 0.730038822f, 0.72977668f, 0.72951442f, 0.7292521f,
+    0.728989601f, 0.728727043f, 0.728464365f, 0.728201628f, 0.727938712f,
+    0.727675736f, 0.727412641f, 0.727149427f, 0.726886094f, 0.726622701f,
+    0.726359129f, 0.726095498f, 0.725831807f, 0.725567937f, 0.725303948f,
+    0.725039899f, 0.724775732f, 0.724511445f, 0.724247098f, 0.723982573f,
+    0.723717988f, 0.723453283f, 0.72318846f, 0.722923577f, 0.722658575f,
+    0.722393453f, 0.722128212f, 0.721862853f, 0.721597433f, 0.721331835f,
+    0.721066177f, 0.720800459f, 0.720534563f, 0.720268607f, 0.720002532f,
+    0.719736338f, 0.719470024f, 0.719203651f, 0.718937099f, 0.718670487f,
+    0.718403816f, 0.718136966f, 0.717870057f, 0.717603028f, 0.71733588f,
+    0.717068613f, 0.716801286f, 0.71653384f, 0.716266274f, 0.71599859f,
+    0.715730846f, 0.715462923f, 0.715194941f, 0.714926898f, 0.714658678f,
+    0.714390397f, 0.714121997f, 0.713853478f, 0.71358484f, 0.713316143f,
+    0.713047326f, 0.712778389f, 0.712509394f, 0.712240219f, 0.711970985f,
+    0.711701632f, 0.711432219f, 0.711162627f, 0.710892975f, 0.710623205f,
+    0.710353374f, 0.710083365f, 0.709813297f, 0.709543109f, 0.709272802f,
+    0.709002435f, 0.708731949f, 0.708461344f, 0.70819062f, 0.707919836f,
+    0.707648933f, 0.707377911f, 0.707106769f, 0.706835568f, 0.706564248f,
+    0.706292808f, 0.706021249f, 0.705749631f, 0.705477893f, 0.705206037f,
+    0.704934061f, 0.704662025f, 0.70438987f, 0.704117596f, 0.703845263f,
+    0.70357275f, 0.703300178f, 0.703027546f, 0.702754736f, 0.702481866f,
+    0.702208877f, 0.701935768f, 0.7016626f, 0.701389313f, 0.701115906f,
+    0.700842381f, 0.700568795f, 0.700295091f, 0.700021267f, 0.699747384f,
+    0.699473321f, 0.6991992f, 0.698925018f, 0.698650658f, 0.698376238f,
+    0.698101699f, 0.697827101f, 0.697552323f, 0.697277486f, 0.69700259f,
+    0.696727514f, 0.696452379f, 0.696177125f, 0.695901752f, 0.695626318f,
+    0.695350766f, 0.695075095f, 0.694799364f, 0.694523513f, 0.694247544f,
+    0.693971455f, 0.693695307f, 0.693419039f, 0.693142653f, 0.692866147f,
+    0.692589581f, 0.692312896f, 0.692036152f, 0.691759229f, 0.691482246f,
+    0.691205204f, 0.690927982f, 0.690650702f, 0.690373302f, 0.690095842f,
+    0.689818263f, 0.689540565f, 0.689262748f, 0.688984871f, 0.688706875f,
+    0.68842876f, 0.688150525f, 0.687872231f, 0.687593818f, 0.687315345f,
+    0.687036753f, 0.686758041f, 0.686479211f, 0.686200321f, 0.685921311f,
+    0.685642183f, 0.685362995f, 0.685083687f, 0.684804261f, 0.684524715f,
+    0.68424511f, 0.683965385f, 0.683685601f, 0.683405697f, 0.683125675f,
+    0.682845533f, 0.682565331f, 0.682285011f, 0.682004571f, 0.681724072f,
+    0.681443453f, 0.681162715f, 0.680881917f, 0.680601001f, 0.680319965f,
+    0.680038869f, 0.679757655f, 0.679476321f, 0.679194927f, 0.678913355f,
+    0.678631783f, 0.678350031f, 0.678068221f, 0.677786291f, 0.677504301f,
+    0.677222192f, 0.676939964f, 0.676657617f, 0.67637521f, 0.676092684f,
+    0.675810099f, 0.675527394f, 0.67524457f, 0.674961627f, 0.674678624f,
+    0.674395502f, 0.67411232f, 0.673829019f, 0.673545599f, 0.67326206f,
+    0.672978461f, 0.672694743f, 0.672410965f, 0.672127068f, 0.671843052f,
+    0.671558976f, 0.671274781f, 0.670990467f, 0.670706034f, 0.670421541f,
+    0.670136988f, 0.669852257f, 0.669567466f, 0.669282615f, 0.668997586f,
+    0.668712497f, 0.668427348f, 0.668142021f, 0.667856634f, 0.667571187f,
+    0.667285621f, 0.666999936f, 0.666714132f, 0.666428268f, 0.666142285f,
+    0.665856242f, 0.66557008f, 0.665283799f, 0.664997458f, 0.664710999f,
+    0.664424419f, 0.664137781f, 0.663851023f, 0.663564146f, 0.663277209f,
+    0.662990153f, 0.662703037f, 0.662415802f, 0.662128448f, 0.661840975f,
+    0.661553442f, 0.66126585f, 0.660978138f, 0.660690308f, 0.660402358f,
+    0.660114348f, 0.659826219f, 0.659538031f, 0.659249723f, 0.658961296f,
+    0.65867281f, 0.658384204f, 0.658095479f, 0.657806695f, 0.657517791f,
+    0.657228827f, 0.656939745f, 0.656650543f, 0.656361282f, 0.656071901f,
+    0.655782402f, 0.655492842f, 0.655203164f, 0.654913425f, 0.654623568f,
+    0.654333591f, 0.654043555f, 0.6537534f, 0.653463185f, 0.653172851f,
+    0.652882397f, 0.652591884f, 0.652301252f, 0.65201056f, 0.651719689f,
+    0.651428819f, 0.651137769f, 0.65084666f, 0.650555491f, 0.650264204f,
+    0.649972796f, 0.64968133f, 0.649389744f, 0.649098039f, 0.648806274f,
+    0.64851439f, 0.648222446f, 0.647930384f, 0.647638202f, 0.64734596f,
+    0.647053599f, 0.646761179f, 0.646468639f, 0.64617604f, 0.645883262f,
+    0.645590484f, 0.645297527f, 0.645004511f, 0.644711435f, 0.64441824f,
+    0.644124925f, 0.643831551f, 0.643538058f, 0.643244505f, 0.642950833f,
+    0.642657042f, 0.642363191f, 0.642069221f, 0.641775131f, 0.641481042f,
+    0.641186774f, 0.640892446f, 0.640597999f, 0.640303493f, 0.640008867f,
+    0.639714181f, 0.639419317f, 0.639124453f, 0.63882947f, 0.638534367f,
+    0.638239205f, 0.637943923f, 0.637648523f, 0.637353063f, 0.637057483f,
+    0.636761844f, 0.636466146f, 0.636170268f, 0.635874331f, 0.635578334f,
+    0.635282218f, 0.634985983f, 0.634689689f, 0.634393275f, 0.634096801f,
+    0.633800209f, 0.633503556f, 0.633206785f, 0.632909894f, 0.632612944f,
+    0.632315874f, 0.632018745f, 0.631721497f, 0.631424189f, 0.631126761f,
+    0.630829215f, 0.630531609f, 0.630233943f, 0.629936099f, 0.629638255f,
+    0.629340231f, 0.629042208f, 0.628744006f, 0.628445745f, 0.628147423f,
+    0.627848983f, 0.627550423f, 0.627251804f, 0.626953125f, 0.626654267f,
+    0.62635541f, 0.626056373f, 0.625757277f, 0.625458121f, 0.625158846f,
+    0.624859512f, 0.624560058f, 0.624260485f, 0.623960853f, 0.623661101f,
+    0.62336129f, 0.623061359f, 0.622761369f, 0.622461259f, 0.62216109f,
+    0.621860802f, 0.621560454f, 0.621259987f, 0.620959401f, 0.620658755f,
+    0.62035805f, 0.620057225f, 0.619756281f, 0.619455278f, 0.619154155f,
+    0.618852973f, 0.618551731f, 0.61825031f, 0.61794889f, 0.61764729f,
+    0.617345631f, 0.617043912f, 0.616742074f, 0.616440177f, 0.61613816f,
+    0.615836084f, 0.615533888f, 0.615231574f, 0.614929199f, 0.614626765f,
+    0.614324212f, 0.61402154f, 0.613718808f, 0.613416016f, 0.613113105f,
+    0.612810075f, 0.612506986f, 0.612203777f, 0.611900508f, 0.61159718f,
+    0.611293733f, 0.610990167f, 0.610686541f, 0.610382795f, 0.61007899f,
+    0.609775066f, 0.609471083f, 0.609167039f, 0.608862817f, 0.608558595f,
+    0.608254254f, 0.607949793f, 0.607645273f, 0.607340634f, 0.607035935f,
+    0.606731117f, 0.606426239f, 0.606121242f, 0.605816185f, 0.605511069f,
+    0.605205774f, 0.604900479f, 0.604595065f, 0.604289532f, 0.603983939f,
+    0.603678226f, 0.603372455f, 0.603066623f, 0.602760673f, 0.602454603f,
+    0.602148473f, 0.601842225f, 0.601535916f, 0.601229548f, 0.600923061f,
+    0.600616455f, 0.600309789f, 0.600003064f, 0.599696219f, 0.599389315f,
+    0.599082291f, 0.598775208f, 0.598468006f, 0.598160684f, 0.597853363f,
+    0.597545862f, 0.597238362f, 0.596930683f, 0.596623003f, 0.596315205f,
+    0.596007288f, 0.59569931f, 0.595391214f, 0.595083058f, 0.594774842f,
+    0.594466507f, 0.594158053f, 0.593849599f, 0.593540967f, 0.593232274f,
+    0.592923522f, 0.592614651f, 0.59230572f, 0.59199667f, 0.59168756f,
+    0.591378391f, 0.591069102f, 0.590759695f, 0.590450227f, 0.5901407f,
+    0.589831054f, 0.589521289f, 0.589211524f, 0.588901579f, 0.588591635f,
+    0.588281572f, 0.587971389f, 0.587661147f, 0.587350786f, 0.587040365f,
+    0.586729884f, 0.586419284f, 0.586108625f, 0.585797846f, 0.585487008f,
+    0.585176051f, 0.584865034f, 0.584553957f, 0.584242761f, 0.583931446f,
+    0.583620131f, 0.583308637f, 0.582997143f, 0.582685471f, 0.582373798f,
+    0.582062006f, 0.581750095f, 0.581438124f, 0.581126094f, 0.580813944f,
+    0.580501735f, 0.580189407f, 0.579877019f, 0.579564571f, 0.579252005f,
+    0.578939319f, 0.578626633f, 0.578313768f, 0.578000903f, 0.577687919f,
+    0.577374816f, 0.577061653f, 0.576748431f, 0.576435089f, 0.576121688f,
+    0.575808167f, 0.575494587f, 0.575180948f, 0.574867189f, 0.57455337f,
+    0.574239433f, 0.573925436f, 0.573611319f, 0.573297143f, 0.572982907f,
+    0.572668552f, 0.572354138f, 0.572039604f, 0.571725011f, 0.571410358f,
+    0.571095586f, 0.570780754f, 0.570465803f, 0.570150793f, 0.569835722f,
+    0.569520533f, 0.569205225f, 0.568889916f, 0.568574488f, 0.568258941f,
+    0.567943335f, 0.567627668f, 0.567311883f, 0.566996038f, 0.566680133f,
+    0.56636411f, 0.566047966f, 0.565731823f, 0.565415561f, 0.56509918f,
+    0.564782739f, 0.564466238f, 0.564149618f, 0.563832939f, 0.5635162f,
+    0.563199341f, 0.562882423f, 0.562565386f, 0.56224829f, 0.561931133f,
+    0.561613858f, 0.561296523f, 0.560979068f, 0.560661554f, 0.560343981f,
+    0.560026288f, 0.559708536f, 0.559390724f, 0.559072793f, 0.558754802f,
+    0.558436692f, 0.558118522f, 0.557800293f, 0.557481945f, 0.557163537f,
+    0.556845009f, 0.556526482f, 0.556207776f, 0.55588907f, 0.555570245f,
+    0.5552513f, 0.554932356f, 0.554613292f, 0.554294109f, 0.553974867f,
+    0.553655565f, 0.553336203f, 0.553016722f, 0.552697122f, 0.552377522f,
+    0.552057803f, 0.551737964f, 0.551418126f, 0.551098168f, 0.550778091f,
+    0.550457954f, 0.550137758f, 0.549817502f, 0.549497128f, 0.549176633f,
+    0.548856139f, 0.548535526f, 0.548214853f, 0.547894061f, 0.547573209f,
+    0.547252297f, 0.546931267f, 0.546610177f, 0.546288967f, 0.545967758f,
+    0.545646429f, 0.545324981f, 0.545003474f, 0.544681907f, 0.54436028f,
+    0.544038534f, 0.543716729f, 0.543394804f, 0.54307282f, 0.542750776f,
+    0.542428672f, 0.54210645f, 0.541784167f, 0.541461766f, 0.541139305f,
+    0.540816784f, 0.540494144f, 0.540171444f, 0.539848685f, 0.539525867f,
+    0.539202929f, 0.538879931f, 0.538556814f, 0.538233638f, 0.537910402f,
+    0.537587047f, 0.537263691f, 0.536940157f, 0.536616623f, 0.53629297f,
+    0.535969257f, 0.535645485f, 0.535321593f, 0.534997642f, 0.534673572f,
+    0.534349442f, 0.534025252f, 0.533701003f, 0.533376634f, 0.533052206f,
+    0.532727718f, 0.532403111f, 0.532078445f, 0.531753719f, 0.531428874f,
+    0.531104028f, 0.530779004f, 0.53045398f, 0.530128837f, 0.529803634f,
+    0.529478312f, 0.529152989f, 0.528827548f, 0.528501987f, 0.528176427f,
+    0.527850747f, 0.527524948f, 0.527199149f, 0.526873231f, 0.526547253f,
+    0.526221156f, 0.525895f, 0.525568783f, 0.525242507f, 0.524916112f,
+    0.524589658f, 0.524263144f, 0.52393657f, 0.523609877f, 0.523283124f,
+    0.522956252f, 0.52262938f, 0.522302389f, 0.521975279f, 0.521648169f,
+    0.521320939f, 0.52099365f, 0.520666242f, 0.520338774f, 0.520011246f,
+    0.519683659f, 0.519356012f, 0.519028246f, 0.518700421f, 0.518372476f,
+    0.518044531f, 0.517716467f, 0.517388284f, 0.517060101f, 0.516731799f,
+    0.516403437f, 0.516075015f, 0.515746474f, 0.515417874f, 0.515089214f,
+    0.514760435f, 0.514431655f, 0.514102757f, 0.513773799f, 0.513444722f,
+    0.513115585f, 0.512786388f, 0.512457132f, 0.512127757f, 0.511798322f,
+    0.511468828f, 0.511139274f, 0.5108096f, 0.510479927f, 0.510150075f,
+    0.509820223f, 0.509490252f, 0.509160221f, 0.50883013f, 0.50849998f,
+    0.508169711f, 0.507839382f, 0.507508993f, 0.507178545f, 0.506847978f,
+    0.506517351f, 0.506186664f, 0.505855858f, 0.505525053f, 0.505194128f,
+    0.504863083f, 0.504532039f, 0.504200876f, 0.503869653f, 0.50353837f,
+    0.503207028f, 0.502875566f, 0.502544045f, 0.502212465f, 0.501880825f,
+    0.501549065f, 0.501217246f, 0.500885367f, 0.500553429f, 0.500221372f,
+    0.499889284f, 0.499557108f, 0.499224871f, 0.498892546f, 0.498560131f,
+    0.498227656f, 0.497895122f, 0.497562498f, 0.497229815f, 0.496897042f,
+    0.496564209f, 0.496231288f, 0.495898306f, 0.495565265f, 0.495232135f,
+    0.494898945f, 0.494565666f, 0.494232297f, 0.493898898f, 0.49356541f,
+    0.493231833f, 0.492898196f, 0.49256447f, 0.492230713f, 0.491896838f,
+    0.491562903f, 0.491228908f, 0.490894854f, 0.49056071f, 0.490226477f,
+    0.489892185f, 0.489557832f, 0.489223391f, 0.48888889f, 0.488554329f,
+    0.488219678f, 0.487884939f, 0.487550169f, 0.48721531f, 0.486880362f,
+    0.486545354f, 0.486210287f, 0.48587513f, 0.485539913f, 0.485204607f,
+    0.484869242f, 0.484533817f, 0.484198302f, 0.483862728f, 0.483527064f,
+    0.483191371f, 0.482855558f, 0.482519716f, 0.482183784f, 0.481847763f,
+    0.481511682f, 0.481175542f, 0.480839342f, 0.480503052f, 0.480166674f,
+    0.479830265f, 0.479493767f, 0.47915718f, 0.478820562f, 0.478483826f,
+    0.47814706f, 0.477810204f, 0.477473289f, 0.477136284f, 0.47679922f,
+    0.476462096f, 0.476124883f, 0.47578761f, 0.475450277f, 0.475112855f,
+    0.474775374f, 0.474437833f, 0.474100202f, 0.473762512f, 0.473424762f,
+    0.473086923f, 0.472749025f, 0.472411066f, 0.472073019f, 0.471734911f,
+    0.471396744f, 0.471058488f, 0.470720172f, 0.470381796f, 0.470043331f,
+    0.469704807f, 0.469366223f, 0.469027549f, 0.468688816f, 0.468350023f,
+    0.468011141f, 0.467672229f, 0.467333198f, 0.466994137f, 0.466654986f,
+    0.466315776f, 0.465976506f, 0.465637147f, 0.465297729f, 0.464958251f,
+    0.464618683f, 0.464279056f, 0.463939369f, 0.463599622f, 0.463259786f,
+    0.462919891f, 0.462579936f, 0.462239891f, 0.461899787f, 0.461559623f,
+    0.4612194f, 0.460879087f, 0.460538715f, 0.460198283f, 0.459857762f,
+    0.459517181f, 0.45917654f, 0.45883584f, 0.458495051f, 0.458154202f,
+    0.457813293f, 0.457472324f, 0.457131267f, 0.456790149f, 0.456448972f,
+    0.456107736f, 0.45576641f, 0.455425024f, 0.455083579f, 0.454742074f,
+    0.45440048f, 0.454058826f, 0.453717113f, 0.45337534f, 0.453033477f,
+    0.452691585f, 0.452349573f, 0.452007532f, 0.451665431f, 0.451323241f,
+    0.450980991f, 0.450638682f, 0.450296283f, 0.449953854f, 0.449611336f,
+    0.449268758f, 0.448926091f, 0.448583394f, 0.448240608f, 0.447897762f,
+    0.447554857f, 0.447211891f, 0.446868837f, 0.446525723f, 0.446182549f,
+    0.445839316f, 0.445496023f, 0.44515264f, 0.444809198f, 0.444465697f,
+    0.444122136f, 0.443778515f, 0.443434805f, 0.443091065f, 0.442747235f,
+    0.442403346f, 0.442059368f, 0.44171536f, 0.441371262f, 0.441027105f,
+    0.440682888f, 0.440338612f, 0.439994276f, 0.43964985f, 0.439305395f,
+    0.43896085f, 0.438616246f, 0.438271582f, 0.437926829f, 0.437582046f,
+    0.437237173f, 0.436892241f, 0.43654725f, 0.436202198f, 0.435857087f,
+    0.435511887f, 0.435166657f, 0.434821337f, 0.434475958f, 0.43413052f,
+    0.433785021f, 0.433439463f, 0.433093816f, 0.432748139f, 0.432402372f,
+    0.432056546f, 0.43171066f, 0.431364715f, 0.43101871f, 0.430672616f,
+    0.430326492f, 0.429980278f, 0.429634005f, 0.429287672f, 0.42894128f,
+    0.428594828f, 0.428248316f, 0.427901745f, 0.427555084f, 0.427208394f,
+    0.426861614f, 0.426514775f, 0.426167876f, 0.425820917f, 0.425473899f,
+    0.425126821f, 0.424779683f, 0.424432486f, 0.4240852f, 0.423737884f,
+    0.423390478f, 0.423043013f, 0.422695488f, 0.422347903f, 0.422000259f,
+    0.421652555f, 0.421304792f, 0.420956969f, 0.420609087f, 0.420261115f,
+    0.419913113f, 0.419565022f, 0.419216901f, 0.418868691f, 0.418520421f,
+    0.418172091f, 0.417823702f, 0.417475283f, 0.417126775f, 0.416778177f,
+    0.416429549f, 0.416080862f, 0.415732116f, 0.415383309f, 0.415034413f,
+    0.414685488f, 0.414336503f, 0.413987428f, 0.413638324f, 0.41328913f,
+    0.412939876f, 0.412590593f, 0.41224122f, 0.411891818f, 0.411542326f,
+    0.411192775f, 0.410843164f, 0.410493493f, 0.410143793f, 0.409794003f,
+    0.409444153f, 0.409094244f, 0.408744276f, 0.408394247f, 0.408044159f,
+    0.407694012f, 0.407343805f, 0.406993538f, 0.406643212f, 0.406292826f,
+    0.40594238f, 0.405591875f, 0.405241311f, 0.404890686f, 0.404540002f,
+    0.404189259f, 0.403838456f, 0.403487593f, 0.403136671f, 0.402785689f,
+    0.402434647f, 0.402083546f, 0.401732385f, 0.401381165f, 0.401029885f,
+    0.400678575f, 0.400327176f, 0.399975717f, 0.399624199f, 0.399272621f,
+    0.398921013f, 0.398569316f, 0.398217559f, 0.397865742f, 0.397513896f,
+    0.397161961f, 0.396809995f, 0.39645794f, 0.396105856f, 0.395753682f,
+    0.395401478f, 0.395049214f, 0.394696862f, 0.394344479f, 0.393992037f,
+    0.393639535f, 0.393286973f, 0.392934352f, 0.392581671f, 0.392228931f,
+    0.391876131f, 0.391523302f, 0.391170382f, 0.390817404f, 0.390464395f,
+    0.390111327f, 0.38975817f, 0.389404982f, 0.389051735f, 0.388698429f,
+    0.388345033f, 0.387991607f, 0.387638152f, 0.387284607f, 0.386931002f,
+    0.386577338f, 0.386223644f, 0.38586989f, 0.385516047f, 0.385162175f,
+    0.384808242f, 0.38445425f, 0.384100199f, 0.383746088f, 0.383391917f,
+    0.383037716f, 0.382683426f, 0.382329106f, 0.381974727f, 0.381620258f,
+    0.381265759f, 0.380911201f, 0.380556613f, 0.380201936f, 0.379847199f,
+    0.379492432f, 0.379137605f, 0.37878269f, 0.378427744f, 0.378072739f,
+    0.377717704f, 0.377362579f, 0.377007425f, 0.376652181f, 0.376296908f,
+    0.375941575f, 0.375586182f, 0.37523073f, 0.374875218f, 0.374519676f,
+    0.374164075f, 0.373808384f, 0.373452663f, 0.373096913f, 0.372741073f,
+    0.372385174f, 0.372029245f, 0.371673256f, 0.371317208f, 0.3709611f,
+    0.370604932f, 0.370248705f, 0.369892448f, 0.369536132f, 0.369179755f,
+    0.36882332f, 0.368466824f, 0.368110299f, 0.367753685f, 0.36739704f,
+    0.367040336f, 0.366683602f, 0.366326779f, 0.365969926f, 0.365612984f,
+    0.365256011f, 0.364899009f, 0.364541918f, 0.364184797f, 0.363827616f,
+    0.363470376f, 0.363113075f, 0.362755716f, 0.362398326f, 0.362040877f,
+    0.361683369f, 0.3613258f, 0.360968202f, 0.360610515f, 0.360252798f,
+    0.359895051f, 0.359537214f, 0.359179348f, 0.358821392f, 0.358463407f,
+    0.358105391f, 0.357747287f, 0.357389152f, 0.357030958f, 0.356672704f,
+    0.356314421f, 0.355956078f, 0.355597675f, 0.355239213f, 0.354880691f,
+    0.354522139f, 0.354163527f, 0.353804857f, 0.353446156f, 0.353087366f,
+    0.352728546f, 0.352369696f, 0.352010757f, 0.351651788f, 0.351292759f,
+    0.350933671f, 0.350574553f, 0.350215375f, 0.349856138f, 0.349496841f,
+    0.349137515f, 0.348778129f, 0.348418683f, 0.348059177f, 0.347699642f,
+    0.347340047f, 0.346980423f, 0.346620709f, 0.346260965f, 0.345901161f,
+    0.345541328f, 0.345181435f, 0.344821483f, 0.344461471f, 0.344101429f,
+    0.343741328f, 0.343381166f, 0.343020976f, 0.342660725f, 0.342300415f,
+    0.341940075f, 0.341579646f, 0.341219217f, 0.340858698f, 0.340498149f,
+    0.340137541f, 0.339776874f, 0.339416176f, 0.339055419f, 0.338694632f,
+    0.338333756f, 0.33797285f, 0.337611914f, 0.337250918f, 0.336889863f,
+    0.336528748f, 0.336167604f, 0.3358064f, 0.335445136f, 0.335083842f,
+    0.334722489f, 0.334361106f, 0.333999664f, 0.333638161f, 0.3332766f,
+    0.332915008f, 0.332553357f, 0.332191676f, 0.331829935f, 0.331468135f,
+    0.331106305f, 0.330744416f, 0.330382496f, 0.330020487f, 0.329658449f,
+    0.32929638f, 0.328934252f, 0.328572065f, 0.328209847f, 0.32784757f,
+    0.327485234f, 0.327122867f, 0.326760441f, 0.326397985f, 0.32603547f,
+    0.325672895f, 0.32531029f, 0.324947625f, 0.324584931f, 0.324222177f,
+    0.323859364f, 0.323496521f, 0.323133618f, 0.322770685f, 0.322407693f,
+    0.322044641f, 0.321681559f, 0.321318418f, 0.320955247f, 0.320592016f,
+    0.320228726f, 0.319865406f, 0.319502026f, 0.319138616f, 0.318775147f,
+    0.318411648f, 0.31804809f, 0.317684472f, 0.317320824f, 0.316957116f,
+    0.316593379f, 0.316229582f, 0.315865755f, 0.315501869f, 0.315137923f,
+    0.314773947f, 0.314409941f, 0.314045846f, 0.313681751f, 0.313317567f,
+    0.312953383f, 0.312589109f, 0.312224805f, 0.311860472f, 0.311496079f,
+    0.311131626f, 0.310767144f, 0.310402632f, 0.31003806f, 0.309673429f,
+    0.309308767f, 0.308944046f, 0.308579296f, 0.308214486f, 0.307849646f,
+    0.307484746f, 0.307119817f, 0.306754827f, 0.306389809f, 0.30602473f,
+    0.305659592f, 0.305294424f, 0.304929227f, 0.304563969f, 0.304198682f,
+    0.303833336f, 0.303467959f, 0.303102523f, 0.302737027f, 0.302371502f,
+    0.302005947f, 0.301640332f, 0.301274687f, 0.300908983f, 0.300543249f,
+    0.300177455f, 0.299811631f, 0.299445748f, 0.299079835f, 0.298713863f,
+    0.298347861f, 0.297981799f, 0.297615707f, 0.297249556f, 0.296883374f,
+    0.296517164f, 0.296150893f, 0.295784563f, 0.295418203f, 0.295051813f,
+    0.294685364f, 0.294318885f, 0.293952346f, 0.293585777f, 0.293219149f,
+    0.292852491f, 0.292485803f, 0.292119056f, 0.291752249f, 0.291385442f,
+    0.291018546f, 0.290651649f, 0.290284663f, 0.289917678f, 0.289550632f,
+    0.289183527f, 0.288816422f, 0.288449228f, 0.288082033f, 0.28771475f,
+    0.287347466f, 0.286980122f, 0.286612719f, 0.286245316f, 0.285877824f,
+    0.285510331f, 0.285142779f, 0.284775168f, 0.284407526f, 0.284039855f,
+    0.283672124f, 0.283304363f, 0.282936573f, 0.282568723f, 0.282200843f,
+    0.281832904f, 0.281464934f, 0.281096935f, 0.280728877f, 0.280360788f,
+    0.27999264f, 0.279624462f, 0.279256254f, 0.278887987f, 0.27851969f,
+    0.278151363f, 0.277782977f, 0.277414531f, 0.277046084f, 0.276677579f,
+    0.276309043f, 0.275940448f, 0.275571823f, 0.275203139f, 0.274834454f,
+    0.27446571f, 0.274096906f, 0.273728073f, 0.273359209f, 0.272990316f,
+    0.272621363f, 0.272252381f, 0.271883339f, 0.271514267f, 0.271145165f,
+    0.270776004f, 0.270406812f, 0.270037591f, 0.269668311f, 0.26929903f,
+    0.26892966f, 0.26856029f, 0.268190861f, 0.267821401f, 0.267451882f,
+    0.267082334f, 0.266712755f, 0.266343147f, 0.265973479f, 0.265603781f,
+    0.265234023f, 0.264864236f, 0.264494419f, 0.264124572f, 0.263754666f,
+    0.26338473f, 0.263014764f, 0.262644768f, 0.262274712f, 0.261904627f,
+    0.261534482f, 0.261164337f, 0.260794103f, 0.260423869f, 0.260053605f,
+    0.259683281f, 0.259312928f, 0.258942515f, 0.258572072f, 0.258201599f,
+    0.257831097f, 0.257460564f, 0.257089972f, 0.256719351f, 0.25634867f,
+    0.255977988f, 0.255607247f, 0.255236477f, 0.254865646f, 0.254494816f,
+    0.254123926f, 0.253753006f, 0.253382027f, 0.253011048f, 0.252640009f,
+    0.25226894f, 0.251897812f, 0.251526684f, 0.251155496f, 0.250784278f,
+    0.250413001f, 0.250041723f, 0.249670386f, 0.249299005f, 0.248927608f,
+    0.248556167f, 0.248184681f, 0.247813165f, 0.24744162f, 0.247070029f,
+    0.246698409f, 0.246326745f, 0.24595505f, 0.245583311f, 0.245211542f,
+    0.244839743f, 0.244467899f, 0.244096026f, 0.243724108f, 0.24335216f,
+    0.242980182f, 0.24260816f, 0.242236108f, 0.241864011f, 0.241491884f,
+    0.241119727f, 0.240747526f, 0.240375295f, 0.24000302f, 0.239630714f,
+    0.239258379f, 0.238885999f, 0.238513589f, 0.238141149f, 0.237768665f,
+    0.237396151f, 0.237023607f, 0.236651018f, 0.2362784f, 0.235905752f,
+    0.235533059f, 0.235160336f, 0.234787583f, 0.234414786f, 0.234041959f,
+    0.233669102f, 0.233296201f, 0.232923269f, 0.232550308f, 0.232177302f,
+    0.231804281f, 0.231431216f, 0.231058106f, 0.230684981f, 0.230311811f,
+    0.229938596f, 0.229565367f, 0.229192093f, 0.228818789f, 0.228445455f,
+    0.228072077f, 0.227698684f, 0.227325246f, 0.226951763f, 0.226578265f,
+    0.226204723f, 0.225831151f, 0.225457549f, 0.225083917f, 0.224710241f,
+    0.224336535f, 0.223962799f, 0.223589033f, 0.223215222f, 0.222841397f,
+    0.222467527f, 0.222093627f, 0.221719682f, 0.221345723f, 0.220971718f,
+    0.220597684f, 0.220223621f, 0.219849527f, 0.219475403f, 0.219101235f,
+    0.218727052f, 0.218352824f, 0.217978567f, 0.21760428f, 0.217229947f,
+    0.2168556f, 0.216481209f, 0.216106802f, 0.215732351f, 0.21535787f,
+    0.214983359f, 0.214608818f, 0.214234233f, 0.213859633f, 0.213484988f,
+    0.213110313f, 0.212735623f, 0.212360889f, 0.211986125f, 0.211611331f,
+    0.211236507f, 0.210861638f, 0.210486755f, 0.210111842f, 0.209736884f,
+    0.209361911f, 0.208986893f, 0.208611846f, 0.208236784f, 0.207861677f,
+    0.20748654f, 0.207111374f, 0.206736177f, 0.206360951f, 0.205985695f,
+    0.205610409f, 0.205235094f, 0.204859748f, 0.204484373f, 0.204108968f,
+    0.203733534f, 0.203358069f, 0.20298256f, 0.202607036f, 0.202231482f,
+    0.201855898f, 0.201480284f, 0.201104641f, 0.200728953f, 0.20035325f,
+    0.199977517f, 0.199601755f, 0.199225962f, 0.19885014f, 0.198474288f,
+    0.198098406f, 0.197722495f, 0.197346568f, 0.196970597f, 0.196594596f,
+    0.196218565f, 0.195842519f, 0.195466429f, 0.195090324f, 0.194714189f,
+    0.194338009f, 0.193961814f, 0.19358559f, 0.193209335f, 0.192833051f,
+    0.192456737f, 0.192080393f, 0.191704035f, 0.191327631f, 0.190951213f,
+    0.19057475f, 0.190198272f, 0.189821765f, 0.189445227f, 0.18906866f,
+    0.188692078f, 0.188315451f, 0.187938809f, 0.187562123f, 0.187185422f,
+    0.18680869f, 0.186431944f, 0.186055154f, 0.185678333f, 0.185301498f,
+    0.184924632f, 0.184547737f, 0.184170812f, 0.183793873f, 0.183416888f,
+    0.183039889f, 0.18266286f, 0.182285801f, 0.181908712f, 0.181531608f,
+    0.181154475f, 0.180777311f, 0.180400118f, 0.180022895f, 0.179645658f,
+    0.17926839f, 0.178891093f, 0.178513765f, 0.178136423f, 0.177759051f,
+    0.17738165f, 0.177004218f, 0.176626772f, 0.176249295f, 0.175871789f,
+    0.175494254f, 0.175116703f, 0.174739107f, 0.174361512f, 0.173983872f,
+    0.173606217f, 0.173228532f, 0.172850817f, 0.172473088f, 0.172095329f,
+    0.171717539f, 0.17133972f, 0.170961887f, 0.170584023f, 0.170206144f,
+    0.169828221f, 0.169450298f, 0.16907233f, 0.168694347f, 0.168316334f,
+    0.167938292f, 0.167560235f, 0.167182148f, 0.166804045f, 0.166425899f,
+    0.166047737f, 0.16566956f, 0.165291354f, 0.164913118f, 0.164534867f,
+    0.164156586f, 0.163778275f, 0.16339995f, 0.163021594f, 0.162643224f,
+    0.162264824f, 0.161886394f, 0.161507949f, 0.161129475f, 0.16075097f,
+    0.160372451f, 0.159993917f, 0.159615353f, 0.159236759f, 0.15885815f,
+    0.158479512f, 0.158100843f, 0.15772216f, 0.157343462f, 0.156964719f,
+    0.156585976f, 0.156207204f, 0.155828401f, 0.155449569f, 0.155070737f,
+    0.15469186f, 0.154312968f, 0.153934062f, 0.153555125f, 0.153176159f,
+    0.152797192f, 0.152418181f, 0.152039155f, 0.151660115f, 0.151281044f,
+    0.150901943f, 0.150522828f, 0.150143698f, 0.149764538f, 0.149385348f,
+    0.149006143f, 0.148626924f, 0.148247674f, 0.14786841f, 0.147489116f,
+    0.147109807f, 0.146730468f, 0.146351114f, 0.145971745f, 0.145592347f,
+    0.145212919f, 0.14483349f, 0.144454017f, 0.144074544f, 0.143695027f,
+    0.143315509f, 0.142935961f, 0.142556399f, 0.142176807f, 0.1417972f,
+    0.141417563f, 0.141037911f, 0.140658244f, 0.140278548f, 0.139898837f,
+    0.139519095f, 0.139139339f, 0.138759568f, 0.138379768f, 0.137999952f,
+    0.137620121f, 0.137240261f, 0.136860386f, 0.136480495f, 0.136100575f,
+    0.13572064f, 0.135340676f, 0.134960711f, 0.134580702f, 0.134200692f,
+    0.133820653f, 0.133440599f, 0.13306053f, 0.132680431f, 0.132300317f,
+    0.131920189f, 0.13154003f, 0.131159857f, 0.130779669f, 0.130399451f,
+    0.130019218f, 0.12963897f, 0.129258707f, 0.128878415f, 0.128498107f,
+    0.128117785f, 0.127737448f, 0.127357081f, 0.126976699f, 0.126596302f,
+    0.126215875f, 0.125835434f, 0.125454977f, 0.125074506f, 0.12469402f,
+    0.124313504f, 0.123932973f, 0.123552427f, 0.123171858f, 0.122791275f,
+    0.122410677f, 0.122030057f, 0.121649414f, 0.121268764f, 0.120888084f,
+    0.120507397f, 0.120126687f, 0.119745962f, 0.119365215f, 0.118984453f,
+    0.118603677f, 0.118222877f, 0.117842063f, 0.117461227f, 0.117080383f,
+    0.116699517f, 0.116318628f, 0.115937732f, 0.115556814f, 0.11517588f,
+    0.114794925f, 0.114413962f, 0.114032976f, 0.113651969f, 0.113270953f,
+    0.112889916f, 0.112508863f, 0.112127796f, 0.111746714f, 0.111365609f,
+    0.110984489f, 0.110603355f, 0.110222206f, 0.109841041f, 0.109459855f,
+    0.109078661f, 0.108697444f, 0.108316213f, 0.107934967f, 0.107553706f,
+    0.107172422f, 0.106791131f, 0.106409818f, 0.106028497f, 0.105647154f,
+    0.105265796f, 0.104884423f, 0.104503036f, 0.104121633f, 0.103740215f,
+    0.103358783f, 0.102977335f, 0.102595866f, 0.102214389f, 0.101832896f,
+    0.101451389f, 0.10106986f, 0.100688323f, 0.100306772f, 0.0999252051f,
+    0.0995436162f, 0.0991620198f, 0.0987804085f, 0.0983987823f, 0.0980171412f,
+    0.0976354852f, 0.0972538143f, 0.0968721285f, 0.0964904279f, 0.0961087197f,
+    0.0957269892f, 0.0953452513f, 0.0949634984f, 0.0945817232f, 0.0941999406f,
+    0.093818143f, 0.093436338f, 0.0930545107f, 0.0926726758f, 0.0922908187f,
+    0.0919089541f, 0.0915270746f, 0.0911451876f, 0.0907632783f, 0.0903813615f,
+    0.0899994299f, 0.0896174833f, 0.0892355219f, 0.0888535529f, 0.0884715691f,
+    0.0880895704f, 0.0877075568f, 0.0873255357f, 0.0869434997f, 0.0865614489f,
+    0.0861793905f, 0.0857973099f, 0.0854152218f, 0.0850331262f, 0.0846510157f,
+    0.0842688903f, 0.08388675f, 0.0835046023f, 0.0831224397f, 0.0827402622f,
+    0.0823580772f, 0.0819758773f, 0.08159367f, 0.0812114477f, 0.0808292106f,
+    0.080446966f, 0.0800647065f, 0.0796824396f, 0.0793001577f, 0.078917861f,
+    0.0785355568f, 0.0781532452f, 0.0777709112f, 0.0773885772f, 0.0770062208f,
+    0.0766238645f, 0.0762414858f, 0.0758591071f, 0.075476706f, 0.0750942975f,
+    0.0747118816f, 0.0743294507f, 0.0739470124f, 0.0735645667f, 0.0731820986f,
+    0.0727996305f, 0.0724171475f, 0.0720346496f, 0.0716521516f, 0.0712696314f,
+    0.0708871111f, 0.070504576f, 0.0701220259f, 0.0697394684f, 0.0693569034f,
+    0.068974331f, 0.0685917437f, 0.0682091415f, 0.0678265393f, 0.0674439222f,
+    0.0670612901f, 0.0666786581f, 0.0662960112f, 0.0659133494f, 0.0655306876f,
+    0.0651480108f, 0.0647653267f, 0.0643826276f, 0.0639999285f, 0.0636172146f,
+    0.0632344931f, 0.0628517568f, 0.0624690168f, 0.0620862655f, 0.0617035069f,
+    0.061320737f, 0.0609379597f, 0.0605551712f, 0.0601723753f, 0.0597895719f,
+    0.0594067574f, 0.0590239353f, 0.0586411059f, 0.0582582653f, 0.0578754172f,
+    0.0574925579f, 0.0571096949f, 0.0567268208f, 0.0563439392f, 0.0559610501f,
+    0.0555781499f, 0.0551952459f, 0.0548123308f, 0.0544294082f, 0.0540464781f,
+    0.0536635369f, 0.053280592f, 0.0528976358f, 0.052514676f, 0.052131705f,
+    0.0517487265f, 0.0513657406f, 0.050982751f, 0.0505997501f, 0.0502167419f,
+    0.0498337261f, 0.049450703f, 0.0490676761f, 0.048684638f, 0.0483015925f,
+    0.0479185432f, 0.0475354828f, 0.0471524186f, 0.046769347f, 0.046386268f,
+    0.0460031815f, 0.0456200913f, 0.0452369899f, 0.0448538847f, 0.0444707721f,
+    0.0440876521f, 0.0437045284f, 0.0433213934f, 0.0429382585f, 0.0425551124f,
+    0.0421719626f, 0.0417888053f, 0.0414056405f, 0.0410224721f, 0.0406392962f,
+    0.0402561165f, 0.0398729257f, 0.0394897349f, 0.0391065367f, 0.0387233309f,
+    0.0383401215f, 0.0379569046f, 0.037573684f, 0.0371904559f, 0.0368072242f,
+    0.0364239849f, 0.036040742f, 0.0356574915f, 0.0352742374f, 0.0348909795f,
+    0.0345077142f, 0.0341244452f, 0.0337411724f, 0.0333578922f, 0.0329746082f,
+    0.0325913206f, 0.0322080255f, 0.0318247266f, 0.031441424f, 0.0310581159f,
+    0.030674804f, 0.0302914865f, 0.0299081653f, 0.0295248386f, 0.029141508f,
+    0.0287581738f, 0.0283748358f, 0.0279914923f, 0.027608145f, 0.027224794f,
+    0.0268414393f, 0.0264580809f, 0.0260747187f, 0.0256913509f, 0.0253079813f,
+    0.0249246061f, 0.024541229f, 0.0241578463f, 0.0237744618f, 0.0233910736f,
+    0.0230076816f, 0.0226242859f, 0.0222408883f, 0.0218574852f, 0.0214740802f,
+    0.0210906714f, 0.0207072608f, 0.0203238465f, 0.0199404284f, 0.0195570085f,
+    0.0191735849f, 0.0187901594f, 0.0184067301f, 0.0180232991f, 0.0176398642f,
+    0.0172564276f, 0.0168729872f, 0.0164895467f, 0.0161061026f, 0.0157226548f,
+    0.015339206f, 0.0149557553f, 0.0145723019f, 0.0141888466f, 0.0138053885f,
+    0.0134219285f, 0.0130384676f, 0.0126550039f, 0.0122715384f, 0.011888071f,
+    0.0115046017f, 0.0111211315f, 0.0107376594f, 0.0103541855f, 0.00997070968f,
+    0.00958723295f, 0.00920375437f, 0.00882027484f, 0.00843679439f,
+    0.00805331208f, 0.00766982883f, 0.00728634419f, 0.00690285861f,
+    0.00651937211f, 0.00613588467f, 0.0057523963f, 0.005368907f, 0.00498541677f,
+    0.00460192608f, 0.00421843445f, 0.00383494259f, 0.00345145003f,
+    0.00306795677f, 0.00268446305f, 0.00230096909f, 0.00191747479f,
+    0.00153398013f, 0.00115048536f, 0.000766990299f, 0.000383495179f,
+    6.12323426e-17f, -0.000383495179f, -0.000766990299f, -0.00115048536f,
+    -0.00153398013f, -0.00191747479f, -0.00230096909f, -0.00268446305f,
+    -0.00306795677f, -0.00345145003f, -0.00383494259f, -0.00421843445f,
+    -0.00460192608f, -0.00498541677f, -0.005368907f, -0.0057523963f,
+    -0.00613588467f, -0.00651937211f, -0.00690285861f, -0.00728634419f,
+    -0.00766982883f, -0.00805331208f, -0.00843679439f, -0.00882027484f,
+    -0.00920375437f, -0.00958723295f, -0.00997070968f, -0.0103541855f,
+    -0.0107376594f, -0.0111211315f, -0.0115046017f, -0.011888071f,
+    -0.0122715384f, -0.0126550039f, -0.0130384676f, -0.0134219285f,
+    -0.0138053885f, -0.0141888466f, -0.0145723019f, -0.0149557553f,
+    -0.015339206f, -0.0157226548f, -0.0161061026f, -0.0164895467f,
+    -0.0168729872f, -0.0172564276f, -0.0176398642f, -0.0180232991f,
+    -0.0184067301f, -0.0187901594f, -0.0191735849f, -0.0195570085f,
+    -0.0199404284f, -0.0203238465f, -0.0207072608f, -0.0210906714f,
+    -0.0214740802f, -0.0218574852f, -0.0222408883f, -0.0226242859f,
+    -0.0230076816f, -0.0233910736f, -0.0237744618f, -0.0241578463f,
+    -0.024541229f, -0.0249246061f, -0.0253079813f, -0.0256913509f,
+    -0.0260747187f, -0.0264580809f, -0.0268414393f, -0.027224794f,
+    -0.027608145f, -0.0279914923f, -0.0283748358f, -0.0287581738f,
+    -0.029141508f, -0.0295248386f, -0.0299081653f, -0.0302914865f,
+    -0.030674804f, -0.0310581159f, -0.031441424f, -0.0318247266f,
+    -0.0322080255f, -0.0325913206f, -0.0329746082f, -0.0333578922f,
+    -0.0337411724f, -0.0341244452f, -0.0345077142f, -0.0348909795f,
+    -0.0352742374f, -0.0356574915f, -0.036040742f, -0.0364239849f,
+    -0.0368072242f, -0.0371904559f, -0.037573684f, -0.0379569046f,
+    -0.0383401215f, -0.0387233309f, -0.0391065367f, -0.0394897349f,
+    -0.0398729257f, -0.0402561165f, -0.0406392962f, -0.0410224721f,
+    -0.0414056405f, -0.0417888053f, -0.0421719626f, -0.0425551124f,
+    -0.0429382585f, -0.0433213934f, -0.0437045284f, -0.0440876521f,
+    -0.0444707721f, -0.0448538847f, -0.0452369899f, -0.0456200913f,
+    -0.0460031815f, -0.046386268f, -0.046769347f, -0.0471524186f,
+    -0.0475354828f, -0.0479185432f, -0.0483015925f, -0.048684638f,
+    -0.0490676761f, -0.049450703f, -0.0498337261f, -0.0502167419f,
+    -0.0505997501f, -0.050982751f, -0.0513657406f, -0.0517487265f,
+    -0.052131705f, -0.052514676f, -0.0528976358f, -0.053280592f, -0.0536635369f,
+    -0.0540464781f, -0.0544294082f, -0.0548123308f, -0.0551952459f,
+    -0.0555781499f, -0.0559610501f, -0.0563439392f, -0.0567268208f,
+    -0.0571096949f, -0.0574925579f, -0.0578754172f, -0.0582582653f,
+    -0.0586411059f, -0.0590239353f, -0.0594067574f, -0.0597895719f,
+    -0.0601723753f, -0.0605551712f, -0.0609379597f, -0.061320737f,
+    -0.0617035069f, -0.0620862655f, -0.0624690168f, -0.0628517568f,
+    -0.0632344931f, -0.0636172146f, -0.0639999285f, -0.0643826276f,
+    -0.0647653267f, -0.0651480108f, -0.0655306876f, -0.0659133494f,
+    -0.0662960112f, -0.0666786581f, -0.0670612901f, -0.0674439222f,
+    -0.0678265393f, -0.0682091415f, -0.0685917437f, -0.068974331f,
+    -0.0693569034f, -0.0697394684f, -0.0701220259f, -0.070504576f,
+    -0.0708871111f, -0.0712696314f, -0.0716521516f, -0.0720346496f,
+    -0.0724171475f, -0.0727996305f, -0.0731820986f, -0.0735645667f,
+    -0.0739470124f, -0.0743294507f, -0.0747118816f, -0.0750942975f,
+    -0.075476706f, -0.0758591071f, -0.0762414858f, -0.0766238645f,
+    -0.0770062208f, -0.0773885772f, -0.0777709112f, -0.0781532452f,
+    -0.0785355568f, -0.078917861f, -0.0793001577f, -0.0796824396f,
+    -0.0800647065f, -0.080446966f, -0.0808292106f, -0.0812114477f, -0.08159367f,
+    -0.0819758773f, -0.0823580772f, -0.0827402622f, -0.0831224397f,
+    -0.0835046023f, -0.08388675f, -0.0842688903f, -0.0846510157f,
+    -0.0850331262f, -0.0854152218f, -0.0857973099f, -0.0861793905f,
+    -0.0865614489f, -0.0869434997f, -0.0873255357f, -0.0877075568f,
+    -0.0880895704f, -0.0884715691f, -0.0888535529f, -0.0892355219f,
+    -0.0896174833f, -0.0899994299f, -0.0903813615f, -0.0907632783f,
+    -0.0911451876f, -0.0915270746f, -0.0919089541f, -0.0922908187f,
+    -0.0926726758f, -0.0930545107f, -0.093436338f, -0.093818143f,
+    -0.0941999406f, -0.0945817232f, -0.0949634984f, -0.0953452513f,
+    -0.0957269892f, -0.0961087197f, -0.0964904279f, -0.0968721285f,
+    -0.0972538143f, -0.0976354852f, -0.0980171412f, -0.0983987823f,
+    -0.0987804085f, -0.0991620198f, -0.0995436162f, -0.0999252051f,
+    -0.100306772f, -0.100688323f, -0.10106986f, -0.101451389f, -0.101832896f,
+    -0.102214389f, -0.102595866f, -0.102977335f, -0.103358783f, -0.103740215f,
+    -0.104121633f, -0.104503036f, -0.104884423f, -0.105265796f, -0.105647154f,
+    -0.106028497f, -0.106409818f, -0.106791131f, -0.107172422f, -0.107553706f,
+    -0.107934967f, -0.108316213f, -0.108697444f, -0.109078661f, -0.109459855f,
+    -0.109841041f, -0.110222206f, -0.110603355f, -0.110984489f, -0.111365609f,
+    -0.111746714f, -0.112127796f, -0.112508863f, -0.112889916f, -0.113270953f,
+    -0.113651969f, -0.114032976f, -0.114413962f, -0.114794925f, -0.11517588f,
+    -0.115556814f, -0.115937732f, -0.116318628f, -0.116699517f, -0.117080383f,
+    -0.117461227f, -0.117842063f, -0.118222877f, -0.118603677f, -0.118984453f,
+    -0.119365215f, -0.119745962f, -0.120126687f, -0.120507397f, -0.120888084f,
+    -0.121268764f, -0.121649414f, -0.122030057f, -0.122410677f, -0.122791275f,
+    -0.123171858f, -0.123552427f, -0.123932973f, -0.124313504f, -0.12469402f,
+    -0.125074506f, -0.125454977f, -0.125835434f, -0.126215875f, -0.126596302f,
+    -0.126976699f, -0.127357081f, -0.127737448f, -0.128117785f, -0.128498107f,
+    -0.128878415f, -0.129258707f, -0.12963897f, -0.130019218f, -0.130399451f,
+    -0.130779669f, -0.131159857f, -0.13154003f, -0.131920189f, -0.132300317f,
+    -0.132680431f, -0.13306053f, -0.133440599f, -0.133820653f, -0.134200692f,
+    -0.134580702f, -0.134960711f, -0.135340676f, -0.13572064f, -0.136100575f,
+    -0.136480495f, -0.136860386f, -0.137240261f, -0.137620121f, -0.137999952f,
+    -0.138379768f, -0.138759568f, -0.139139339f, -0.139519095f, -0.139898837f,
+    -0.140278548f, -0.140658244f, -0.141037911f, -0.141417563f, -0.1417972f,
+    -0.142176807f, -0.142556399f, -0.142935961f, -0.143315509f, -0.143695027f,
+    -0.144074544f, -0.144454017f, -0.14483349f, -0.145212919f, -0.145592347f,
+    -0.145971745f, -0.146351114f, -0.146730468f, -0.147109807f, -0.147489116f,
+    -0.14786841f, -0.148247674f, -0.148626924f, -0.149006143f, -0.149385348f,
+    -0.149764538f, -0.150143698f, -0.150522828f, -0.150901943f, -0.151281044f,
+    -0.151660115f, -0.152039155f, -0.152418181f, -0.152797192f, -0.153176159f,
+    -0.153555125f, -0.153934062f, -0.154312968f, -0.15469186f, -0.155070737f,
+    -0.155449569f, -0.155828401f, -0.156207204f, -0.156585976f, -0.156964719f,
+    -0.157343462f, -0.15772216f, -0.158100843f, -0.158479512f, -0.15885815f,
+    -0.159236759f, -0.159615353f, -0.159993917f, -0.160372451f, -0.16075097f,
+    -0.161129475f, -0.161507949f, -0.161886394f, -0.162264824f, -0.162643224f,
+    -0.163021594f, -0.16339995f, -0.163778275f, -0.164156586f, -0.164534867f,
+    -0.164913118f, -0.165291354f, -0.16566956f, -0.166047737f, -0.166425899f,
+    -0.166804045f, -0.167182148f, -0.167560235f, -0.167938292f, -0.168316334f,
+    -0.168694347f, -0.16907233f, -0.169450298f, -0.169828221f, -0.170206144f,
+    -0.170584023f, -0.170961887f, -0.17133972f, -0.171717539f, -0.172095329f,
+    -0.172473088f, -0.172850817f, -0.173228532f, -0.173606217f, -0.173983872f,
+    -0.174361512f, -0.174739107f, -0.175116703f, -0.175494254f, -0.175871789f,
+    -0.176249295f, -0.176626772f, -0.177004218f, -0.17738165f, -0.177759051f,
+    -0.178136423f, -0.178513765f, -0.178891093f, -0.17926839f, -0.179645658f,
+    -0.180022895f, -0.180400118f, -0.180777311f, -0.181154475f, -0.181531608f,
+    -0.181908712f, -0.182285801f, -0.18266286f, -0.183039889f, -0.183416888f,
+    -0.183793873f, -0.184170812f, -0.184547737f, -0.184924632f, -0.185301498f,
+    -0.185678333f, -0.186055154f, -0.186431944f, -0.18680869f, -0.187185422f,
+    -0.187562123f, -0.187938809f, -0.188315451f, -0.188692078f, -0.18906866f,
+    -0.189445227f, -0.189821765f, -0.190198272f, -0.19057475f, -0.190951213f,
+    -0.191327631f, -0.191704035f, -0.192080393f, -0.192456737f, -0.192833051f,
+    -0.193209335f, -0.19358559f, -0.193961814f, -0.194338009f, -0.194714189f,
+    -0.195090324f, -0.195466429f, -0.195842519f, -0.196218565f, -0.196594596f,
+    -0.196970597f, -0.197346568f, -0.197722495f, -0.198098406f, -0.198474288f,
+    -0.19885014f, -0.199225962f, -0.199601755f, -0.199977517f, -0.20035325f,
+    -0.200728953f, -0.201104641f, -0.201480284f, -0.201855898f, -0.202231482f,
+    -0.202607036f, -0.20298256f, -0.203358069f, -0.203733534f, -0.204108968f,
+    -0.204484373f, -0.204859748f, -0.205235094f, -0.205610409f, -0.205985695f,
+    -0.206360951f, -0.206736177f, -0.207111374f, -0.20748654f, -0.207861677f,
+    -0.208236784f, -0.208611846f, -0.208986893f, -0.209361911f, -0.209736884f,
+    -0.210111842f, -0.210486755f, -0.210861638f, -0.211236507f, -0.211611331f,
+    -0.211986125f, -0.212360889f, -0.212735623f, -0.213110313f, -0.213484988f,
+    -0.213859633f, -0.214234233f, -0.214608818f, -0.214983359f, -0.21535787f,
+    -0.215732351f, -0.216106802f, -0.216481209f, -0.2168556f, -0.217229947f,
+    -0.21760428f, -0.217978567f, -0.218352824f, -0.218727052f, -0.219101235f,
+    -0.219475403f, -0.219849527f, -0.220223621f, -0.220597684f, -0.220971718f,
+    -0.221345723f, -0.221719682f, -0.222093627f, -0.222467527f, -0.222841397f,
+    -0.223215222f, -0.223589033f, -0.223962799f, -0.224336535f, -0.224710241f,
+    -0.225083917f, -0.225457549f, -0.225831151f, -0.226204723f, -0.226578265f,
+    -0.226951763f, -0.227325246f, -0.227698684f, -0.228072077f, -0.228445455f,
+    -0.228818789f, -0.229192093f, -0.229565367f, -0.229938596f, -0.230311811f,
+    -0.230684981f, -0.231058106f, -0.231431216f, -0.231804281f, -0.232177302f,
+    -0.232550308f, -0.232923269f, -0.233296201f, -0.233669102f, -0.234041959f,
+    -0.234414786f, -0.234787583f, -0.235160336f, -0.235533059f, -0.235905752f,
+    -0.2362784f, -0.236651018f, -0.237023607f, -0.237396151f, -0.237768665f,
+    -0.238141149f, -0.238513589f, -0.238885999f, -0.239258379f, -0.239630714f,
+    -0.24000302f, -0.240375295f, -0.240747526f, -0.241119727f, -0.241491884f,
+    -0.241864011f, -0.242236108f, -0.24260816f, -0.242980182f, -0.24335216f,
+    -0.243724108f, -0.244096026f, -0.244467899f, -0.244839743f, -0.245211542f,
+    -0.245583311f, -0.24595505f, -0.246326745f, -0.246698409f, -0.247070029f,
+    -0.24744162f, -0.247813165f, -0.248184681f, -0.248556167f, -0.248927608f,
+    -0.249299005f, -0.249670386f, -0.250041723f, -0.250413001f, -0.250784278f,
+    -0.251155496f, -0.251526684f, -0.251897812f, -0.25226894f, -0.252640009f,
+    -0.253011048f, -0.253382027f, -0.253753006f, -0.254123926f, -0.254494816f,
+    -0.254865646f, -0.255236477f, -0.255607247f, -0.255977988f, -0.25634867f,
+    -0.256719351f, -0.257089972f, -0.257460564f, -0.257831097f, -0.258201599f,
+    -0.258572072f, -0.258942515f, -0.259312928f, -0.259683281f, -0.260053605f,
+    -0.260423869f, -0.260794103f, -0.261164337f, -0.261534482f, -0.261904627f,
+    -0.262274712f, -0.262644768f, -0.263014764f, -0.26338473f, -0.263754666f,
+    -0.264124572f, -0.264494419f, -0.264864236f, -0.265234023f, -0.265603781f,
+    -0.265973479f, -0.266343147f, -0.266712755f, -0.267082334f, -0.267451882f,
+    -0.267821401f, -0.268190861f, -0.26856029f, -0.26892966f, -0.26929903f,
+    -0.269668311f, -0.270037591f, -0.270406812f, -0.270776004f, -0.271145165f,
+    -0.271514267f, -0.271883339f, -0.272252381f, -0.272621363f, -0.272990316f,
+    -0.273359209f, -0.273728073f, -0.274096906f, -0.27446571f, -0.274834454f,
+    -0.275203139f, -0.275571823f, -0.275940448f, -0.276309043f, -0.276677579f,
+    -0.277046084f, -0.277414531f, -0.277782977f, -0.278151363f, -0.27851969f,
+    -0.278887987f, -0.279256254f, -0.279624462f, -0.27999264f, -0.280360788f,
+    -0.280728877f, -0.281096935f, -0.281464934f, -0.281832904f, -0.282200843f,
+    -0.282568723f, -0.282936573f, -0.283304363f, -0.283672124f, -0.284039855f,
+    -0.284407526f, -0.284775168f, -0.285142779f, -0.285510331f, -0.285877824f,
+    -0.286245316f, -0.286612719f, -0.286980122f, -0.287347466f, -0.28771475f,
+    -0.288082033f, -0.288449228f, -0.288816422f, -0.289183527f, -0.289550632f,
+    -0.289917678f, -0.290284663f, -0.290651649f, -0.291018546f, -0.291385442f,
+    -0.291752249f, -0.292119056f, -0.292485803f, -0.292852491f, -0.293219149f,
+    -0.293585777f, -0.293952346f, -0.294318885f, -0.294685364f, -0.295051813f,
+    -0.295418203f, -0.295784563f, -0.296150893f, -0.296517164f, -0.296883374f,
+    -0.297249556f, -0.297615707f, -0.297981799f, -0.298347861f, -0.298713863f,
+    -0.299079835f, -0.299445748f, -0.299811631f, -0.300177455f, -0.300543249f,
+    -0.300908983f, -0.301274687f, -0.301640332f, -0.302005947f, -0.302371502f,
+    -0.302737027f, -0.303102523f, -0.303467959f, -0.303833336f, -0.304198682f,
+    -0.304563969f, -0.304929227f, -0.305294424f, -0.305659592f, -0.30602473f,
+    -0.306389809f, -0.306754827f, -0.307119817f, -0.307484746f, -0.307849646f,
+    -0.308214486f, -0.308579296f, -0.308944046f, -0.309308767f, -0.309673429f,
+    -0.31003806f, -0.310402632f, -0.310767144f, -0.311131626f, -0.311496079f,
+    -0.311860472f, -0.312224805f, -0.312589109f, -0.312953383f, -0.313317567f,
+    -0.313681751f, -0.314045846f, -0.314409941f, -0.314773947f, -0.315137923f,
+    -0.315501869f, -0.315865755f, -0.316229582f, -0.316593379f, -0.316957116f,
+    -0.317320824f, -0.317684472f, -0.31804809f, -0.318411648f, -0.318775147f,
+    -0.319138616f, -0.319502026f, -0.319865406f, -0.320228726f, -0.320592016f,
+    -0.320955247f, -0.321318418f, -0.321681559f, -0.322044641f, -0.322407693f,
+    -0.322770685f, -0.323133618f, -0.323496521f, -0.323859364f, -0.324222177f,
+    -0.324584931f, -0.324947625f, -0.32531029f, -0.325672895f, -0.32603547f,
+    -0.326397985f, -0.326760441f, -0.327122867f, -0.327485234f, -0.32784757f,
+    -0.328209847f, -0.328572065f, -0.328934252f, -0.32929638f, -0.329658449f,
+    -0.330020487f, -0.330382496f, -0.330744416f, -0.331106305f, -0.331468135f,
+    -0.331829935f, -0.332191676f, -0.332553357f, -0.332915008f, -0.3332766f,
+    -0.333638161f, -0.333999664f, -0.334361106f, -0.334722489f, -0.335083842f,
+    -0.335445136f, -0.3358064f, -0.336167604f, -0.336528748f, -0.336889863f,
+    -0.337250918f, -0.337611914f, -0.33797285f, -0.338333756f, -0.338694632f,
+    -0.339055419f, -0.339416176f, -0.339776874f, -0.340137541f, -0.340498149f,
+    -0.340858698f, -0.341219217f, -0.341579646f, -0.341940075f, -0.342300415f,
+    -0.342660725f, -0.343020976f, -0.343381166f, -0.343741328f, -0.344101429f,
+    -0.344461471f, -0.344821483f, -0.345181435f, -0.345541328f, -0.345901161f,
+    -0.346260965f, -0.346620709f, -0.346980423f, -0.347340047f, -0.347699642f,
+    -0.348059177f, -0.348418683f, -0.348778129f, -0.349137515f, -0.349496841f,
+    -0.349856138f, -0.350215375f, -0.350574553f, -0.350933671f, -0.351292759f,
+    -0.351651788f, -0.352010757f, -0.352369696f, -0.352728546f, -0.353087366f,
+    -0.353446156f, -0.353804857f, -0.354163527f, -0.354522139f, -0.354880691f,
+    -0.355239213f, -0.355597675f, -0.355956078f, -0.356314421f, -0.356672704f,
+    -0.357030958f, -0.357389152f, -0.357747287f, -0.358105391f, -0.358463407f,
+    -0.358821392f, -0.359179348f, -0.359537214f, -0.359895051f, -0.360252798f,
+    -0.360610515f, -0.360968202f, -0.3613258f, -0.361683369f, -0.362040877f,
+    -0.362398326f, -0.362755716f, -0.363113075f, -0.363470376f, -0.363827616f,
+    -0.364184797f, -0.364541918f, -0.364899009f, -0.365256011f, -0.365612984f,
+    -0.365969926f, -0.366326779f, -0.366683602f, -0.367040336f, -0.36739704f,
+    -0.367753685f, -0.368110299f, -0.368466824f, -0.36882332f, -0.369179755f,
+    -0.369536132f, -0.369892448f, -0.370248705f, -0.370604932f, -0.3709611f,
+    -0.371317208f, -0.371673256f, -0.372029245f, -0.372385174f, -0.372741073f,
+    -0.373096913f, -0.373452663f, -0.373808384f, -0.374164075f, -0.374519676f,
+    -0.374875218f, -0.37523073f, -0.375586182f, -0.375941575f, -0.376296908f,
+    -0.376652181f, -0.377007425f, -0.377362579f, -0.377717704f, -0.378072739f,
+    -0.378427744f, -0.37878269f, -0.379137605f, -0.379492432f, -0.379847199f,
+    -0.380201936f, -0.380556613f, -0.380911201f, -0.381265759f, -0.381620258f,
+    -0.381974727f, -0.382329106f, -0.382683426f, -0.383037716f, -0.383391917f,
+    -0.383746088f, -0.384100199f, -0.38445425f, -0.384808242f, -0.385162175f,
+    -0.385516047f, -0.38586989f, -0.386223644f, -0.386577338f, -0.386931002f,
+    -0.387284607f, -0.387638152f, -0.387991607f, -0.388345033f, -0.388698429f,
+    -0.389051735f, -0.389404982f, -0.38975817f, -0.390111327f, -0.390464395f,
+    -0.390817404f, -0.391170382f, -0.391523302f, -0.391876131f, -0.392228931f,
+    -0.392581671f, -0.392934352f, -0.393286973f, -0.393639535f, -0.393992037f,
+    -0.394344479f, -0.394696862f, -0.395049214f, -0.395401478f, -0.395753682f,
+    -0.396105856f, -0.39645794f, -0.396809995f, -0.397161961f, -0.397513896f,
+    -0.397865742f, -0.398217559f, -0.398569316f, -0.398921013f, -0.399272621f,
+    -0.399624199f, -0.399975717f, -0.400327176f, -0.400678575f, -0.401029885f,
+    -0.401381165f, -0.401732385f, -0.402083546f, -0.402434647f, -0.402785689f,
+    -0.403136671f, -0.403487593f, -0.403838456f, -0.404189259f, -0.404540002f,
+    -0.404890686f, -0.405241311f, -0.405591875f, -0.40594238f, -0.406292826f,
+    -0.406643212f, -0.406993538f, -0.407343805f, -0.407694012f, -0.408044159f,
+    -0.408394247f, -0.408744276f, -0.409094244f, -0.409444153f, -0.409794003f,
+    -0.410143793f, -0.410493493f, -0.410843164f, -0.411192775f, -0.411542326f,
+    -0.411891818f, -0.41224122f, -0.412590593f, -0.412939876f, -0.41328913f,
+    -0.413638324f, -0.413987428f, -0.414336503f, -0.414685488f, -0.415034413f,
+    -0.415383309f, -0.415732116f, -0.416080862f, -0.416429549f, -0.416778177f,
+    -0.417126775f, -0.417475283f, -0.417823702f, -0.418172091f, -0.418520421f,
+    -0.418868691f, -0.419216901f, -0.419565022f, -0.419913113f, -0.420261115f,
+    -0.420609087f, -0.420956969f, -0.421304792f, -0.421652555f, -0.422000259f,
+    -0.422347903f, -0.422695488f, -0.423043013f, -0.423390478f, -0.423737884f,
+    -0.4240852f, -0.424432486f, -0.424779683f, -0.425126821f, -0.425473899f,
+    -0.425820917f, -0.426167876f, -0.426514775f, -0.426861614f, -0.427208394f,
+    -0.427555084f, -0.427901745f, -0.428248316f, -0.428594828f, -0.42894128f,
+    -0.429287672f, -0.429634005f, -0.429980278f, -0.430326492f, -0.430672616f,
+    -0.43101871f, -0.431364715f, -0.43171066f, -0.432056546f, -0.432402372f,
+    -0.432748139f, -0.433093816f, -0.433439463f, -0.433785021f, -0.43413052f,
+    -0.434475958f, -0.434821337f, -0.435166657f, -0.435511887f, -0.435857087f,
+    -0.436202198f, -0.43654725f, -0.436892241f, -0.437237173f, -0.437582046f,
+    -0.437926829f, -0.438271582f, -0.438616246f, -0.43896085f, -0.439305395f,
+    -0.43964985f, -0.439994276f, -0.440338612f, -0.440682888f, -0.441027105f,
+    -0.441371262f, -0.44171536f, -0.442059368f, -0.442403346f, -0.442747235f,
+    -0.443091065f, -0.443434805f, -0.443778515f, -0.444122136f, -0.444465697f,
+    -0.444809198f, -0.44515264f, -0.445496023f, -0.445839316f, -0.446182549f,
+    -0.446525723f, -0.446868837f, -0.447211891f, -0.447554857f, -0.447897762f,
+    -0.448240608f, -0.448583394f, -0.448926091f, -0.449268758f, -0.449611336f,
+    -0.449953854f, -0.450296283f, -0.450638682f, -0.450980991f, -0.451323241f,
+    -0.451665431f, -0.452007532f, -0.452349573f, -0.452691585f, -0.453033477f,
+    -0.45337534f, -0.453717113f, -0.454058826f, -0.45440048f, -0.454742074f,
+    -0.455083579f, -0.455425024f, -0.45576641f, -0.456107736f, -0.456448972f,
+    -0.456790149f, -0.457131267f, -0.457472324f, -0.457813293f, -0.458154202f,
+    -0.458495051f, -0.45883584f, -0.45917654f, -0.459517181f, -0.459857762f,
+    -0.460198283f, -0.460538715f, -0.460879087f, -0.4612194f, -0.461559623f,
+    -0.461899787f, -0.462239891f, -0.462579936f, -0.462919891f, -0.463259786f,
+    -0.463599622f, -0.463939369f, -0.464279056f, -0.464618683f, -0.464958251f,
+    -0.465297729f, -0.465637147f, -0.465976506f, -0.466315776f, -0.466654986f,
+    -0.466994137f, -0.467333198f, -0.467672229f, -0.468011141f, -0.468350023f,
+    -0.468688816f, -0.469027549f, -0.469366223f, -0.469704807f, -0.470043331f,
+    -0.470381796f, -0.470720172f, -0.471058488f, -0.471396744f, -0.471734911f,
+    -0.472073019f, -0.472411066f, -0.472749025f, -0.473086923f, -0.473424762f,
+    -0.473762512f, -0.474100202f, -0.474437833f, -0.474775374f, -0.475112855f,
+    -0.475450277f, -0.47578761f, -0.476124883f, -0.476462096f, -0.47679922f,
+    -0.477136284f, -0.477473289f, -0.477810204f, -0.47814706f, -0.478483826f,
+    -0.478820562f, -0.47915718f, -0.479493767f, -0.479830265f, -0.480166674f,
+    -0.480503052f, -0.480839342f, -0.481175542f, -0.481511682f, -0.481847763f,
+    -0.482183784f, -0.482519716f, -0.482855558f, -0.483191371f, -0.483527064f,
+    -0.483862728f, -0.484198302f, -0.484533817f, -0.484869242f, -0.485204607f,
+    -0.485539913f, -0.48587513f, -0.486210287f, -0.486545354f, -0.486880362f,
+    -0.48721531f, -0.487550169f, -0.487884939f, -0.488219678f, -0.488554329f,
+    -0.48888889f, -0.489223391f, -0.489557832f, -0.489892185f, -0.490226477f,
+    -0.49056071f, -0.490894854f, -0.491228908f, -0.491562903f, -0.491896838f,
+    -0.492230713f, -0.49256447f, -0.492898196f, -0.493231833f, -0.49356541f,
+    -0.493898898f, -0.494232297f, -0.494565666f, -0.494898945f, -0.495232135f,
+    -0.495565265f, -0.495898306f, -0.496231288f, -0.496564209f, -0.496897042f,
+    -0.497229815f, -0.497562498f, -0.497895122f, -0.498227656f, -0.498560131f,
+    -0.498892546f, -0.499224871f, -0.499557108f, -0.499889284f, -0.500221372f,
+    -0.500553429f, -0.500885367f, -0.501217246f, -0.501549065f, -0.501880825f,
+    -0.502212465f, -0.502544045f, -0.502875566f, -0.503207028f, -0.50353837f,
+    -0.503869653f, -0.504200876f, -0.504532039f, -0.504863083f, -0.505194128f,
+    -0.505525053f, -0.505855858f, -0.506186664f, -0.506517351f, -0.506847978f,
+    -0.507178545f, -0.507508993f, -0.507839382f, -0.508169711f, -0.50849998f,
+    -0.50883013f, -0.509160221f, -0.509490252f, -0.509820223f, -0.510150075f,
+    -0.510479927f, -0.5108096f, -0.511139274f, -0.511468828f, -0.511798322f,
+    -0.512127757f, -0.512457132f, -0.512786388f, -0.513115585f, -0.513444722f,
+    -0.513773799f, -0.514102757f, -0.514431655f, -0.514760435f, -0.515089214f,
+    -0.515417874f, -0.515746474f, -0.516075015f, -0.516403437f, -0.516731799f,
+    -0.517060101f, -0.517388284f, -0.517716467f, -0.518044531f, -0.518372476f,
+    -0.518700421f, -0.519028246f, -0.519356012f, -0.519683659f, -0.520011246f,
+    -0.520338774f, -0.520666242f, -0.52099365f, -0.521320939f, -0.521648169f,
+    -0.521975279f, -0.522302389f, -0.52262938f, -0.522956252f, -0.523283124f,
+    -0.523609877f, -0.52393657f, -0.524263144f, -0.524589658f, -0.524916112f,
+    -0.525242507f, -0.525568783f, -0.525895f, -0.526221156f, -0.526547253f,
+    -0.526873231f, -0.527199149f, -0.527524948f, -0.527850747f, -0.528176427f,
+    -0.528501987f, -0.528827548f, -0.529152989f, -0.529478312f, -0.529803634f,
+    -0.530128837f, -0.53045398f, -0.530779004f, -0.531104028f, -0.531428874f,
+    -0.531753719f, -0.532078445f, -0.532403111f, -0.532727718f, -0.533052206f,
+    -0.533376634f, -0.533701003f, -0.534025252f, -0.534349442f, -0.534673572f,
+    -0.534997642f, -0.535321593f, -0.535645485f, -0.535969257f, -0.53629297f,
+    -0.536616623f, -0.536940157f, -0.537263691f, -0.537587047f, -0.537910402f,
+    -0.538233638f, -0.538556814f, -0.538879931f, -0.539202929f, -0.539525867f,
+    -0.539848685f, -0.540171444f, -0.540494144f, -0.540816784f, -0.541139305f,
+    -0.541461766f, -0.541784167f, -0.54210645f, -0.542428672f, -0.542750776f,
+    -0.54307282f, -0.543394804f, -0.543716729f, -0.544038534f, -0.54436028f,
+    -0.544681907f, -0.545003474f, -0.545324981f, -0.545646429f, -0.545967758f,
+    -0.546288967f, -0.546610177f, -0.546931267f, -0.547252297f, -0.547573209f,
+    -0.547894061f, -0.548214853f, -0.548535526f, -0.548856139f, -0.549176633f,
+    -0.549497128f, -0.549817502f, -0.550137758f, -0.550457954f, -0.550778091f,
+    -0.551098168f, -0.551418126f, -0.551737964f, -0.552057803f, -0.552377522f,
+    -0.552697122f, -0.553016722f, -0.553336203f, -0.553655565f, -0.553974867f,
+    -0.554294109f, -0.554613292f, -0.554932356f, -0.5552513f, -0.555570245f,
+    -0.55588907f, -0.556207776f, -0.556526482f, -0.556845009f, -0.557163537f,
+    -0.557481945f, -0.557800293f, -0.558118522f, -0.558436692f, -0.558754802f,
+    -0.559072793f, -0.559390724f, -0.559708536f, -0.560026288f, -0.560343981f,
+    -0.560661554f, -0.560979068f, -0.561296523f, -0.561613858f, -0.561931133f,
+    -0.56224829f, -0.562565386f, -0.562882423f, -0.563199341f, -0.5635162f,
+    -0.563832939f, -0.564149618f, -0.564466238f, -0.564782739f, -0.56509918f,
+    -0.565415561f, -0.565731823f, -0.566047966f, -0.56636411f, -0.566680133f,
+    -0.566996038f, -0.567311883f, -0.567627668f, -0.567943335f, -0.568258941f,
+    -0.568574488f, -0.568889916f, -0.569205225f, -0.569520533f, -0.569835722f,
+    -0.570150793f, -0.570465803f, -0.570780754f, -0.571095586f, -0.571410358f,
+    -0.571725011f, -0.572039604f, -0.572354138f, -0.572668552f, -0.572982907f,
+    -0.573297143f, -0.573611319f, -0.573925436f, -0.574239433f, -0.57455337f,
+    -0.574867189f, -0.575180948f, -0.575494587f, -0.575808167f, -0.576121688f,
+    -0.576435089f, -0.576748431f, -0.577061653f, -0.577374816f, -0.577687919f,
+    -0.578000903f, -0.578313768f, -0.578626633f, -0.578939319f, -0.579252005f,
+    -0.579564571f, -0.579877019f, -0.580189407f, -0.580501735f, -0.580813944f,
+    -0.581126094f, -0.581438124f, -0.581750095f, -0.582062006f, -0.582373798f,
+    -0.582685471f, -0.582997143f, -0.583308637f, -0.583620131f, -0.583931446f,
+    -0.584242761f, -0.584553957f, -0.584865034f, -0.585176051f, -0.585487008f,
+    -0.585797846f, -0.586108625f, -0.586419284f, -0.586729884f, -0.587040365f,
+    -0.587350786f, -0.587661147f, -0.587971389f, -0.588281572f, -0.588591635f,
+    -0.588901579f, -0.589211524f, -0.589521289f, -0.589831054f, -0.5901407f,
+    -0.590450227f, -0.590759695f, -0.591069102f, -0.591378391f, -0.59168756f,
+    -0.59199667f, -0.59230572f, -0.592614651f, -0.592923522f, -0.593232274f,
+    -0.593540967f, -0.593849599f, -0.594158053f, -0.594466507f, -0.594774842f,
+    -0.595083058f, -0.595391214f, -0.59569931f, -0.596007288f, -0.596315205f,
+    -0.596623003f, -0.596930683f, -0.597238362f, -0.597545862f, -0.597853363f,
+    -0.598160684f, -0.598468006f, -0.598775208f, -0.599082291f, -0.599389315f,
+    -0.599696219f, -0.600003064f, -0.600309789f, -0.600616455f, -0.600923061f,
+    -0.601229548f, -0.601535916f, -0.601842225f, -0.602148473f, -0.602454603f,
+    -0.602760673f, -0.603066623f, -0.603372455f, -0.603678226f, -0.603983939f,
+    -0.604289532f, -0.604595065f, -0.604900479f, -0.605205774f, -0.605511069f,
+    -0.605816185f, -0.606121242f, -0.606426239f, -0.606731117f, -0.607035935f,
+    -0.607340634f, -0.607645273f, -0.607949793f, -0.608254254f, -0.608558595f,
+    -0.608862817f, -0.609167039f, -0.609471083f, -0.609775066f, -0.61007899f,
+    -0.610382795f, -0.610686541f, -0.610990167f, -0.611293733f, -0.61159718f,
+    -0.611900508f, -0.612203777f, -0.612506986f, -0.612810075f, -0.613113105f,
+    -0.613416016f, -0.613718808f, -0.61402154f, -0.614324212f, -0.614626765f,
+    -0.614929199f, -0.615231574f, -0.615533888f, -0.615836084f, -0.61613816f,
+    -0.616440177f, -0.616742074f, -0.617043912f, -0.617345631f, -0.61764729f,
+    -0.61794889f, -0.61825031f, -0.618551731f, -0.618852973f, -0.619154155f,
+    -0.619455278f, -0.619756281f, -0.620057225f, -0.62035805f, -0.620658755f,
+    -0.620959401f, -0.621259987f, -0.621560454f, -0.621860802f, -0.62216109f,
+    -0.622461259f, -0.622761369f, -0.623061359f, -0.62336129f, -0.623661101f,
+    -0.623960853f, -0.624260485f, -0.624560058f, -0.624859512f, -0.625158846f,
+    -0.625458121f, -0.625757277f, -0.626056373f, -0.62635541f, -0.626654267f,
+    -0.626953125f, -0.627251804f, -0.627550423f, -0.627848983f, -0.628147423f,
+    -0.628445745f, -0.628744006f, -0.629042208f, -0.629340231f, -0.629638255f,
+    -0.629936099f, -0.630233943f, -0.630531609f, -0.630829215f, -0.631126761f,
+    -0.631424189f, -0.631721497f, -0.632018745f, -0.632315874f, -0.632612944f,
+    -0.632909894f, -0.633206785f, -0.633503556f, -0.633800209f, -0.634096801f,
+    -0.634393275f, -0.634689689f, -0.634985983f, -0.635282218f, -0.635578334f,
+    -0.635874331f, -0.636170268f, -0.636466146f, -0.636761844f, -0.637057483f,
+    -0.637353063f, -0.637648523f, -0.637943923f, -0.638239205f, -0.638534367f,
+    -0.63882947f, -0.639124453f, -0.639419317f, -0.639714181f, -0.640008867f,
+    -0.640303493f, -0.640597999f, -0.640892446f, -0.641186774f, -0.641481042f,
+    -0.641775131f, -0.642069221f, -0.642363191f, -0.642657042f, -0.642950833f,
+    -0.643244505f, -0.643538058f, -0.643831551f, -0.644124925f, -0.64441824f,
+    -0.644711435f, -0.645004511f, -0.645297527f, -0.645590484f, -0.645883262f,
+    -0.64617604f, -0.646468639f, -0.646761179f, -0.647053599f, -0.64734596f,
+    -0.647638202f, -0.647930384f, -0.648222446f, -0.64851439f, -0.648806274f,
+    -0.649098039f, -0.649389744f, -0.64968133f, -0.649972796f, -0.650264204f,
+    -0.650555491f, -0.65084666f, -0.651137769f, -0.651428819f, -0.651719689f,
+    -0.65201056f, -0.652301252f, -0.652591884f, -0.652882397f, -0.653172851f,
+    -0.653463185f, -0.6537534f, -0.654043555f, -0.654333591f, -0.654623568f,
+    -0.654913425f, -0.655203164f, -0.655492842f, -0.655782402f, -0.656071901f,
+    -0.656361282f, -0.656650543f, -0.656939745f, -0.657228827f, -0.657517791f,
+    -0.657806695f, -0.658095479f, -0.658384204f, -0.65867281f, -0.658961296f,
+    -0.659249723f, -0.659538031f, -0.659826219f, -0.660114348f, -0.660402358f,
+    -0.660690308f, -0.660978138f, -0.66126585f, -0.661553442f, -0.661840975f,
+    -0.662128448f, -0.662415802f, -0.662703037f, -0.662990153f, -0.663277209f,
+    -0.663564146f, -0.663851023f, -0.664137781f, -0.664424419f, -0.664710999f,
+    -0.664997458f, -0.665283799f, -0.66557008f, -0.665856242f, -0.666142285f,
+    -0.666428268f, -0.666714132f, -0.666999936f, -0.667285621f, -0.667571187f,
+    -0.667856634f, -0.668142021f, -0.668427348f, -0.668712497f, -0.668997586f,
+    -0.669282615f, -0.669567466f, -0.669852257f, -0.670136988f, -0.670421541f,
+    -0.670706034f, -0.670990467f, -0.671274781f, -0.671558976f, -0.671843052f,
+    -0.672127068f, -0.672410965f, -0.672694743f, -0.672978461f, -0.67326206f,
+    -0.673545599f, -0.673829019f, -0.67411232f, -0.674395502f, -0.674678624f,
+    -0.674961627f, -0.67524457f, -0.675527394f, -0.675810099f, -0.676092684f,
+    -0.67637521f, -0.676657617f, -0.676939964f, -0.677222192f, -0.677504301f,
+    -0.677786291f, -0.678068221f, -0.678350031f, -0.678631783f, -0.678913355f,
+    -0.679194927f, -0.679476321f, -0.679757655f, -0.680038869f, -0.680319965f,
+    -0.680601001f, -0.680881917f, -0.681162715f, -0.681443453f, -0.681724072f,
+    -0.682004571f, -0.682285011f, -0.682565331f, -0.682845533f, -0.683125675f,
+    -0.683405697f, -0.683685601f, -0.683965385f, -0.68424511f, -0.684524715f,
+    -0.684804261f, -0.685083687f, -0.685362995f, -0.685642183f, -0.685921311f,
+    -0.686200321f, -0.686479211f, -0.686758041f, -0.687036753f, -0.687315345f,
+    -0.687593818f, -0.687872231f, -0.688150525f, -0.68842876f, -0.688706875f,
+    -0.688984871f, -0.689262748f, -0.689540565f, -0.689818263f, -0.690095842f,
+    -0.690373302f, -0.690650702f, -0.690927982f, -0.691205204f, -0.691482246f,
+    -0.691759229f, -0.692036152f, -0.692312896f, -0.692589581f, -0.692866147f,
+    -0.693142653f, -0.693419039f, -0.693695307f, -0.693971455f, -0.694247544f,
+    -0.694523513f, -0.694799364f, -0.695075095f, -0.695350766f, -0.695626318f,
+    -0.695901752f, -0.696177125f, -0.696452379f, -0.696727514f, -0.69700259f,
+    -0.697277486f, -0.697552323f, -0.697827101f, -0.698101699f, -0.698376238f,
+    -0.698650658f, -0.698925018f, -0.6991992f, -0.699473321f, -0.699747384f,
+    -0.700021267f, -0.700295091f, -0.700568795f, -0.700842381f, -0.701115906f,
+    -0.701389313f, -0.7016626f, -0.701935768f, -0.702208877f, -0.702481866f,
+    -0.702754736f, -0.703027546f, -0.703300178f, -0.70357275f, -0.703845263f,
+    -0.704117596f, -0.70438987f, -0.704662025f, -0.704934061f, -0.705206037f,
+    -0.705477893f, -0.705749631f, -0.706021249f, -0.706292808f, -0.706564248f,
+    -0.706835568f, -0.707106769f, -0.707377911f, -0.707648933f, -0.707919836f,
+    -0.70819062f, -0.708461344f, -0.708731949f, -0.709002435f, -0.709272802f,
+    -0.709543109f, -0.709813297f, -0.710083365f, -0.710353374f, -0.710623205f,
+    -0.710892975f, -0.711162627f, -0.711432219f, -0.711701632f, -0.711970985f,
+    -0.712240219f, -0.712509394f, -0.712778389f, -0.713047326f, -0.713316143f,
+    -0.71358484f, -0.713853478f, -0.714121997f, -0.714390397f, -0.714658678f,
+    -0.714926898f, -0.715194941f, -0.715462923f, -0.715730846f, -0.71599859f,
+    -0.716266274f, -0.71653384f, -0.716801286f, -0.717068613f, -0.71733588f,
+    -0.717603028f, -0.717870057f, -0.718136966f, -0.718403816f, -0.718670487f,
+    -0.718937099f, -0.719203651f, -0.719470024f, -0.719736338f, -0.720002532f,
+    -0.720268607f, -0.720534563f, -0.720800459f, -0.721066177f, -0.721331835f,
+    -0.721597433f, -0.721862853f, -0.722128212f, -0.722393453f, -0.722658575f,
+    -0.722923577f, -0.72318846f, -0.723453283f, -0.723717988f, -0.723982573f,
+    -0.724247098f, -0.724511445f, -0.724775732f, -0.725039899f, -0.725303948f,
+    -0.725567937f, -0.725831807f, -0.726095498f, -0.726359129f, -0.726622701f,
+    -0.726886094f, -0.727149427f, -0.727412641f, -0.727675736f, -0.727938712f,
+    -0.728201628f, -0.728464365f, -0.728727043f, -0.728989601f, -0.7292521f,
+    -0.72951442f, -0.72977668f, -0.730038822f, -0.730300844f, -0.730562747f,
+    -0.73082459f, -0.731086314f, -0.731347919f, -0.731609404f, -0.73187077f,
+    -0.732132018f, -0.732393205f, -0.732654274f, -0.732915223f, -0.733176053f,
+    -0.733436823f, -0.733697414f, -0.733957946f, -0.734218359f, -0.734478652f,
+    -0.734738886f, -0.734998941f, -0.735258937f, -0.735518813f, -0.73577857f,
+    -0.736038268f, -0.736297786f, -0.736557245f, -0.736816585f, -0.737075806f,
+    -0.737334907f, -0.737593889f, -0.737852812f, -0.738111615f, -0.738370299f,
+    -0.738628864f, -0.73888731f, -0.739145696f, -0.739403903f, -0.739662051f,
+    -0.73992008f, -0.740177989f, -0.740435839f, -0.74069351f, -0.740951121f,
+    -0.741208613f, -0.741465986f, -0.741723239f, -0.741980433f, -0.742237449f,
+    -0.742494404f, -0.742751241f, -0.743007958f, -0.743264556f, -0.743521094f,
+    -0.743777454f, -0.744033754f, -0.744289935f, -0.744545996f, -0.744801939f,
+    -0.745057762f, -0.745313525f, -0.74556917f, -0.745824695f, -0.746080101f,
+    -0.746335387f, -0.746590555f, -0.746845663f, -0.747100592f, -0.747355461f,
+    -0.747610211f, -0.747864842f, -0.748119354f, -0.748373806f, -0.74862808f,
+    -0.748882294f, -0.749136388f, -0.749390364f, -0.74964422f, -0.749898016f,
+    -0.750151634f, -0.750405192f, -0.750658631f, -0.750911951f, -0.751165152f,
+    -0.751418233f, -0.751671195f, -0.751924098f, -0.752176821f, -0.752429485f,
+    -0.75268203f, -0.752934456f, -0.753186822f, -0.753439009f, -0.753691137f,
+    -0.753943086f, -0.754194975f, -0.754446745f, -0.754698396f, -0.754949927f,
+    -0.755201399f, -0.755452693f, -0.755703926f, -0.75595504f, -0.756205976f,
+    -0.756456852f, -0.756707668f, -0.756958306f, -0.757208824f, -0.757459283f,
+    -0.757709622f, -0.757959783f, -0.758209884f, -0.758459926f, -0.758709788f,
+    -0.758959532f, -0.759209216f, -0.759458721f, -0.759708166f, -0.759957492f,
+    -0.760206699f, -0.760455787f, -0.760704756f, -0.760953605f, -0.761202395f,
+    -0.761451006f, -0.761699557f, -0.761947989f, -0.762196302f, -0.762444496f,
+    -0.762692571f, -0.762940526f, -0.763188422f, -0.763436139f, -0.763683796f,
+    -0.763931334f, -0.764178753f, -0.764426053f, -0.764673233f, -0.764920294f,
+    -0.765167236f, -0.765414119f, -0.765660882f, -0.765907466f, -0.766153991f,
+    -0.766400397f, -0.766646683f, -0.76689285f, -0.767138898f, -0.767384887f,
+    -0.767630696f, -0.767876446f, -0.768122017f, -0.768367529f, -0.768612921f,
+    -0.768858194f, -0.769103348f, -0.769348383f, -0.769593298f, -0.769838154f,
+    -0.770082831f, -0.770327449f, -0.770571887f, -0.770816267f, -0.771060526f,
+    -0.771304667f, -0.771548688f, -0.771792591f, -0.772036374f, -0.772280097f,
+    -0.772523642f, -0.772767127f, -0.773010433f, -0.773253679f, -0.773496807f,
+    -0.773739815f, -0.773982704f, -0.774225473f, -0.774468124f, -0.774710655f,
+    -0.774953127f, -0.77519542f, -0.775437653f, -0.775679708f, -0.775921702f,
+    -0.776163578f, -0.776405334f, -0.776646972f, -0.77688849f, -0.777129889f,
+    -0.777371168f, -0.777612329f, -0.777853429f, -0.778094351f, -0.778335214f,
+    -0.778575897f, -0.778816521f, -0.779057026f, -0.779297352f, -0.779537618f,
+    -0.779777765f, -0.780017793f, -0.780257761f, -0.780497551f, -0.780737221f,
+    -0.780976772f, -0.781216264f, -0.781455576f, -0.781694829f, -0.781933963f,
+    -0.782172918f, -0.782411814f, -0.78265059f, -0.782889247f, -0.783127785f,
+    -0.783366203f, -0.783604503f, -0.783842683f, -0.784080803f, -0.784318745f,
+    -0.784556568f, -0.784794331f, -0.785031915f, -0.785269439f, -0.785506845f,
+    -0.785744071f, -0.785981238f, -0.786218286f, -0.786455214f, -0.786692023f,
+    -0.786928713f, -0.787165284f, -0.787401736f, -0.787638068f, -0.787874341f,
+    -0.788110435f, -0.78834641f, -0.788582325f, -0.788818061f, -0.789053738f,
+    -0.789289236f, -0.789524674f, -0.789759994f, -0.789995134f, -0.790230215f,
+    -0.790465176f, -0.790700018f, -0.790934741f, -0.791169345f, -0.79140383f,
+    -0.791638196f, -0.791872442f, -0.792106569f, -0.792340577f, -0.792574525f,
+    -0.792808294f, -0.793041945f, -0.793275535f, -0.793508947f, -0.793742299f,
+    -0.793975472f, -0.794208586f, -0.794441521f, -0.794674397f, -0.794907153f,
+    -0.79513973f, -0.795372248f, -0.795604646f, -0.795836926f, -0.796069086f,
+    -0.796301067f, -0.796532989f, -0.796764791f, -0.796996474f, -0.797228038f,
+    -0.797459483f, -0.797690868f, -0.797922075f, -0.798153162f, -0.79838413f,
+    -0.798614979f, -0.798845768f, -0.799076378f, -0.79930687f, -0.799537241f,
+    -0.799767554f, -0.799997687f, -0.800227761f, -0.800457656f, -0.800687492f,
+    -0.800917149f, -0.801146746f, -0.801376164f, -0.801605523f, -0.801834702f,
+    -0.802063823f, -0.802292824f, -0.802521646f, -0.802750409f, -0.802979052f,
+    -0.803207517f, -0.803435922f, -0.803664207f, -0.803892314f, -0.804120362f,
+    -0.80434829f, -0.804576099f, -0.804803789f, -0.805031359f, -0.805258751f,
+    -0.805486083f, -0.805713296f, -0.80594039f, -0.806167364f, -0.806394219f,
+    -0.806620955f, -0.806847572f, -0.80707407f, -0.807300448f, -0.807526708f,
+    -0.807752848f, -0.807978809f, -0.80820471f, -0.808430493f, -0.808656156f,
+    -0.8088817f, -0.809107125f, -0.80933243f, -0.809557617f, -0.809782684f,
+    -0.810007632f, -0.81023246f, -0.81045717f, -0.81068176f, -0.810906231f,
+    -0.811130643f, -0.811354876f, -0.811578989f, -0.811802983f, -0.812026858f,
+    -0.812250614f, -0.812474251f, -0.812697768f, -0.812921166f, -0.813144386f,
+    -0.813367546f, -0.813590586f, -0.813813508f, -0.81403631f, -0.814258993f,
+    -0.814481556f, -0.814704001f, -0.814926326f, -0.815148532f, -0.815370619f,
+    -0.815592587f, -0.815814435f, -0.816036105f, -0.816257715f, -0.816479206f,
+    -0.816700578f, -0.81692183f, -0.817142904f, -0.817363918f, -0.817584813f,
+    -0.817805588f, -0.818026185f, -0.818246722f, -0.81846714f, -0.818687379f,
+    -0.818907559f, -0.819127619f, -0.819347501f, -0.819567323f, -0.819786966f,
+    -0.820006549f, -0.820225954f, -0.820445299f, -0.820664465f, -0.820883572f,
+    -0.8211025f, -0.821321368f, -0.821540058f, -0.821758628f, -0.821977139f,
+    -0.82219547f, -0.822413683f, -0.822631776f, -0.82284981f, -0.823067665f,
+    -0.823285401f, -0.823503017f, -0.823720515f, -0.823937893f, -0.824155152f,
+    -0.824372292f, -0.824589312f, -0.824806213f, -0.825022995f, -0.825239599f,
+    -0.825456142f, -0.825672567f, -0.825888872f, -0.826104999f, -0.826321065f,
+    -0.826537013f, -0.826752782f, -0.826968491f, -0.827184021f, -0.827399492f,
+    -0.827614784f, -0.827829957f, -0.82804507f, -0.828260005f, -0.82847482f,
+    -0.828689516f, -0.828904092f, -0.82911855f, -0.829332948f, -0.829547107f,
+    -0.829761207f, -0.829975188f, -0.830189049f, -0.830402792f, -0.830616415f,
+    -0.830829859f, -0.831043243f, -0.831256509f, -0.831469595f, -0.831682622f,
+    -0.831895471f, -0.832108259f, -0.832320869f, -0.83253336f, -0.83274579f,
+    -0.832958043f, -0.833170176f, -0.833382189f, -0.833594084f, -0.833805859f,
+    -0.834017515f, -0.834229052f, -0.83444041f, -0.834651709f, -0.834862888f,
+    -0.835073888f, -0.835284829f, -0.835495591f, -0.835706294f, -0.835916817f,
+    -0.836127281f, -0.836337566f, -0.836547732f, -0.836757779f, -0.836967707f,
+    -0.837177515f, -0.837387204f, -0.837596774f, -0.837806225f, -0.838015497f,
+    -0.838224709f, -0.838433802f, -0.838642716f, -0.838851511f, -0.839060247f,
+    -0.839268804f, -0.839477241f, -0.839685619f, -0.839893818f, -0.840101898f,
+    -0.840309858f, -0.84051764f, -0.840725362f, -0.840932965f, -0.841140449f,
+    -0.841347754f, -0.841554999f, -0.841762066f, -0.841969013f, -0.842175901f,
+    -0.84238261f, -0.8425892f, -0.84279567f, -0.843002021f, -0.843208253f,
+    -0.843414366f, -0.8436203f, -0.843826175f, -0.84403187f, -0.844237506f,
+    -0.844442964f, -0.844648361f, -0.84485358f, -0.84505868f, -0.84526366f,
+    -0.845468521f, -0.845673263f, -0.845877886f, -0.84608233f, -0.846286714f,
+    -0.84649092f, -0.846695065f, -0.846899033f, -0.84710288f, -0.847306609f,
+    -0.847510278f, -0.847713768f, -0.84791708f, -0.848120332f, -0.848323464f,
+    -0.848526478f, -0.848729312f, -0.848932028f, -0.849134684f, -0.849337161f,
+    -0.849539518f, -0.849741757f, -0.849943876f, -0.850145876f, -0.850347757f,
+    -0.850549459f, -0.850751102f, -0.850952566f, -0.85115397f, -0.851355195f,
+    -0.851556301f, -0.851757288f, -0.851958156f, -0.852158904f, -0.852359533f,
+    -0.852559984f, -0.852760375f, -0.852960587f, -0.853160739f, -0.853360713f,
+    -0.853560567f, -0.853760302f, -0.853959918f, -0.854159415f, -0.854358733f,
+    -0.854557991f, -0.854757071f, -0.85495609f, -0.855154932f, -0.855353653f,
+    -0.855552256f, -0.85575074f, -0.855949104f, -0.856147349f, -0.856345415f,
+    -0.856543422f, -0.85674125f, -0.856938958f, -0.857136548f, -0.857334018f,
+    -0.857531369f, -0.857728601f, -0.857925713f, -0.858122647f, -0.858319521f,
+    -0.858516216f, -0.858712792f, -0.858909249f, -0.859105587f, -0.859301805f,
+    -0.859497905f, -0.859693885f, -0.859889686f, -0.860085368f, -0.860280991f,
+    -0.860476434f, -0.860671759f, -0.860866964f, -0.86106199f, -0.861256957f,
+    -0.861451745f, -0.861646473f, -0.861841023f, -0.862035453f, -0.862229764f,
+    -0.862423956f, -0.862618029f, -0.862811923f, -0.863005757f, -0.863199413f,
+    -0.863392949f, -0.863586366f, -0.863779664f, -0.863972843f, -0.864165902f,
+    -0.864358783f, -0.864551604f, -0.864744246f, -0.864936769f, -0.865129173f,
+    -0.865321457f, -0.865513623f, -0.865705669f, -0.865897536f, -0.866089284f,
+    -0.866280973f, -0.866472483f, -0.866663873f, -0.866855085f, -0.867046237f,
+    -0.86723727f, -0.867428124f, -0.867618859f, -0.867809474f, -0.867999971f,
+    -0.868190348f, -0.868380606f, -0.868570685f, -0.868760705f, -0.868950546f,
+    -0.869140267f, -0.86932987f, -0.869519353f, -0.869708657f, -0.869897902f,
+    -0.870086968f, -0.870275974f, -0.870464802f, -0.87065351f, -0.87084204f,
+    -0.871030509f, -0.87121886f, -0.871407032f, -0.871595085f, -0.871783018f,
+    -0.871970832f, -0.872158527f, -0.872346044f, -0.8725335f, -0.872720778f,
+    -0.872907937f, -0.873094976f, -0.873281896f, -0.873468697f, -0.873655319f,
+    -0.873841822f, -0.874028265f, -0.87421453f, -0.874400616f, -0.874586642f,
+    -0.874772549f, -0.874958277f, -0.875143886f, -0.875329375f, -0.875514746f,
+    -0.875699997f, -0.875885129f, -0.876070082f, -0.876254916f, -0.876439691f,
+    -0.876624286f, -0.876808703f, -0.87699306f, -0.877177238f, -0.877361357f,
+    -0.877545297f, -0.877729118f, -0.877912819f, -0.878096342f, -0.878279805f,
+    -0.878463089f, -0.878646255f, -0.8788293f, -0.879012227f, -0.879195035f,
+    -0.879377663f, -0.879560173f, -0.879742622f, -0.879924834f, -0.880106986f,
+    -0.880289018f, -0.880470872f, -0.880652666f, -0.880834281f, -0.881015778f,
+    -0.881197095f, -0.881378353f, -0.881559432f, -0.881740451f, -0.881921291f,
+    -0.882101953f, -0.882282555f, -0.882463038f, -0.882643342f, -0.882823527f,
+    -0.883003592f, -0.883183539f, -0.883363366f, -0.883543015f, -0.883722544f,
+    -0.883901954f, -0.884081244f, -0.884260416f, -0.884439468f, -0.884618342f,
+    -0.884797096f, -0.884975731f, -0.885154247f, -0.885332584f, -0.885510862f,
+    -0.885688961f, -0.88586694f, -0.8860448f, -0.886222541f, -0.886400104f,
+    -0.886577606f, -0.88675493f, -0.886932135f, -0.88710916f, -0.887286127f,
+    -0.887462914f, -0.887639642f, -0.887816191f, -0.887992561f, -0.888168871f,
+    -0.888345063f, -0.888521075f, -0.888696969f, -0.888872743f, -0.889048338f,
+    -0.889223874f, -0.88939923f, -0.889574468f, -0.889749587f, -0.889924586f,
+    -0.890099406f, -0.890274107f, -0.890448749f, -0.890623152f, -0.890797496f,
+    -0.89097172f, -0.891145766f, -0.891319692f, -0.891493499f, -0.891667187f,
+    -0.891840696f, -0.892014146f, -0.892187417f, -0.892360568f, -0.892533541f,
+    -0.892706454f, -0.892879188f, -0.893051803f, -0.893224299f, -0.893396676f,
+    -0.893568873f, -0.893740952f, -0.893912971f, -0.894084752f, -0.894256473f,
+    -0.894428074f, -0.894599497f, -0.894770801f, -0.894941986f, -0.895112991f,
+    -0.895283937f, -0.895454705f, -0.895625353f, -0.895795882f, -0.895966232f,
+    -0.896136522f, -0.896306634f, -0.896476626f, -0.8966465f, -0.896816194f,
+    -0.896985769f, -0.897155225f, -0.897324562f, -0.89749378f, -0.897662818f,
+    -0.897831798f, -0.898000598f, -0.898169279f, -0.898337781f, -0.898506165f,
+    -0.898674488f, -0.898842633f, -0.899010599f, -0.899178505f, -0.899346232f,
+    -0.899513841f, -0.89968133f, -0.8998487f, -0.900015891f, -0.900182962f,
+    -0.900349915f, -0.900516748f, -0.900683403f, -0.900849998f, -0.901016414f,
+    -0.901182711f, -0.901348829f, -0.901514888f, -0.901680768f, -0.901846528f,
+    -0.902012169f, -0.902177632f, -0.902342975f, -0.902508199f, -0.902673304f,
+    -0.90283829f, -0.903003097f, -0.903167784f, -0.903332353f, -0.903496802f,
+    -0.903661072f, -0.903825283f, -0.903989315f, -0.904153168f, -0.904316962f,
+    -0.904480577f, -0.904644072f, -0.904807448f, -0.904970706f, -0.905133784f,
+    -0.905296743f, -0.905459583f, -0.905622303f, -0.905784845f, -0.905947268f,
+    -0.906109571f, -0.906271756f, -0.906433821f, -0.906595707f, -0.906757474f,
+    -0.906919122f, -0.907080591f, -0.907242f, -0.907403231f, -0.907564342f,
+    -0.907725275f, -0.907886088f, -0.908046842f, -0.908207357f, -0.908367813f,
+    -0.90852809f, -0.908688307f, -0.908848345f, -0.909008205f, -0.909168005f,
+    -0.909327626f, -0.909487128f, -0.909646451f, -0.909805715f, -0.9099648f,
+    -0.910123765f, -0.910282612f, -0.910441279f, -0.910599828f, -0.910758257f,
+    -0.910916567f, -0.911074758f, -0.911232769f, -0.911390662f, -0.911548436f,
+    -0.91170603f, -0.911863506f, -0.912020862f, -0.912178099f, -0.912335157f,
+    -0.912492156f, -0.912648976f, -0.912805617f, -0.912962198f, -0.913118601f,
+    -0.913274884f, -0.913431048f, -0.913587034f, -0.9137429f, -0.913898647f,
+    -0.914054275f, -0.914209783f, -0.914365113f, -0.914520323f, -0.914675355f,
+    -0.914830327f, -0.91498512f, -0.915139794f, -0.91529429f, -0.915448725f,
+    -0.915602982f, -0.91575712f, -0.915911078f, -0.916064978f, -0.916218698f,
+    -0.916372299f, -0.916525722f, -0.916679084f, -0.916832268f, -0.916985273f,
+    -0.917138219f, -0.917290986f, -0.917443633f, -0.917596161f, -0.917748511f,
+    -0.917900801f, -0.918052912f, -0.918204844f, -0.918356717f, -0.91850841f,
+    -0.918659985f, -0.918811381f, -0.918962717f, -0.919113874f, -0.919264853f,
+    -0.919415772f, -0.919566512f, -0.919717133f, -0.919867635f, -0.920017958f,
+    -0.920168221f, -0.920318305f, -0.920468211f, -0.920618057f, -0.920767725f,
+    -0.920917213f, -0.921066642f, -0.921215892f, -0.921365023f, -0.921514034f,
+    -0.921662927f, -0.92181164f, -0.921960235f, -0.92210865f, -0.922257006f,
+    -0.922405183f, -0.922553241f, -0.92270112f, -0.92284888f, -0.922996521f,
+    -0.923144042f, -0.923291445f, -0.923438668f, -0.923585773f, -0.923732698f,
+    -0.923879504f, -0.924026251f, -0.924172759f, -0.924319208f, -0.924465477f,
+    -0.924611628f, -0.9247576f, -0.924903512f, -0.925049245f, -0.92519486f,
+    -0.925340295f, -0.925485611f, -0.925630808f, -0.925775886f, -0.925920784f,
+    -0.926065564f, -0.926210225f, -0.926354766f, -0.926499128f, -0.926643372f,
+    -0.926787496f, -0.926931441f, -0.927075267f, -0.927218974f, -0.927362502f,
+    -0.92750597f, -0.92764926f, -0.92779237f, -0.927935421f, -0.928078294f,
+    -0.928220987f, -0.928363621f, -0.928506076f, -0.928648412f, -0.928790629f,
+    -0.928932667f, -0.929074585f, -0.929216385f, -0.929358006f, -0.929499507f,
+    -0.929640889f, -0.929782152f, -0.929923236f, -0.930064201f, -0.930205047f,
+    -0.930345714f, -0.930486262f, -0.93062669f, -0.93076694f, -0.93090713f,
+    -0.931047082f, -0.931186974f, -0.931326687f, -0.931466281f, -0.931605756f,
+    -0.931745052f, -0.931884289f, -0.932023287f, -0.932162225f, -0.932300985f,
+    -0.932439625f, -0.932578146f, -0.932716489f, -0.932854712f, -0.932992816f,
+    -0.933130741f, -0.933268547f, -0.933406234f, -0.933543801f, -0.93368119f,
+    -0.93381846f, -0.93395555f, -0.934092522f, -0.934229374f, -0.934366107f,
+    -0.934502721f, -0.934639156f, -0.934775412f, -0.934911609f, -0.935047626f,
+    -0.935183525f, -0.935319245f, -0.935454845f, -0.935590327f, -0.935725689f,
+    -0.935860872f, -0.935995936f, -0.936130881f, -0.936265647f, -0.936400294f,
+    -0.936534822f, -0.93666923f, -0.93680346f, -0.936937571f, -0.937071502f,
+    -0.937205315f, -0.937339008f, -0.937472582f, -0.937605977f, -0.937739253f,
+    -0.93787235f, -0.938005388f, -0.938138247f, -0.938270926f, -0.938403547f,
+    -0.938535988f, -0.938668311f, -0.938800454f, -0.938932478f, -0.939064384f,
+    -0.93919611f, -0.939327717f, -0.939459205f, -0.939590573f, -0.939721763f,
+    -0.939852834f, -0.939983726f, -0.940114558f, -0.940245211f, -0.940375686f,
+    -0.940506041f, -0.940636277f, -0.940766394f, -0.940896332f, -0.941026151f,
+    -0.941155851f, -0.941285372f, -0.941414773f, -0.941544056f, -0.941673219f,
+    -0.941802204f, -0.941931009f, -0.942059755f, -0.942188323f, -0.942316771f,
+    -0.94244504f, -0.94257319f, -0.942701221f, -0.942829072f, -0.942956865f,
+    -0.943084419f, -0.943211913f, -0.943339229f, -0.943466425f, -0.943593442f,
+    -0.943720341f, -0.94384712f, -0.94397378f, -0.944100261f, -0.944226623f,
+    -0.944352806f, -0.944478929f, -0.944604814f, -0.944730639f, -0.944856286f,
+    -0.944981813f, -0.945107222f, -0.945232451f, -0.945357561f, -0.945482492f,
+    -0.945607305f, -0.945731997f, -0.945856571f, -0.945980966f, -0.946105242f,
+    -0.946229339f, -0.946353376f, -0.946477175f, -0.946600914f, -0.946724474f,
+    -0.946847916f, -0.946971238f, -0.947094381f, -0.947217405f, -0.94734025f,
+    -0.947462976f, -0.947585583f, -0.94770807f, -0.947830379f, -0.947952569f,
+    -0.948074579f, -0.948196471f, -0.948318243f, -0.948439896f, -0.94856137f,
+    -0.948682666f, -0.948803902f, -0.948924959f, -0.949045897f, -0.949166656f,
+    -0.949287295f, -0.949407816f, -0.949528158f, -0.94964838f, -0.949768484f,
+    -0.949888468f, -0.950008273f, -0.9501279f, -0.950247467f, -0.950366855f,
+    -0.950486064f, -0.950605154f, -0.950724125f, -0.950842977f, -0.950961649f,
+    -0.951080203f, -0.951198637f, -0.951316893f, -0.95143503f, -0.951552987f,
+    -0.951670885f, -0.951788545f, -0.951906145f, -0.952023566f, -0.952140868f,
+    -0.952257991f, -0.952374995f, -0.952491879f, -0.952608585f, -0.952725172f,
+    -0.95284164f, -0.952957928f, -0.953074098f, -0.953190148f, -0.953306019f,
+    -0.953421772f, -0.953537405f, -0.953652859f, -0.953768194f, -0.95388335f,
+    -0.953998446f, -0.954113305f, -0.954228103f, -0.954342723f, -0.954457223f,
+    -0.954571545f, -0.954685748f, -0.954799831f, -0.954913735f, -0.955027521f,
+    -0.955141187f, -0.955254674f, -0.955368042f, -0.955481231f, -0.955594361f,
+    -0.955707252f, -0.955820084f, -0.955932736f, -0.95604527f, -0.956157625f,
+    -0.95626986f, -0.956381977f, -0.956493914f, -0.956605732f, -0.956717432f,
+    -0.956828952f, -0.956940353f, -0.957051575f, -0.957162678f, -0.957273662f,
+    -0.957384527f, -0.957495213f, -0.95760572f, -0.957716167f, -0.957826436f,
+    -0.957936525f, -0.958046496f, -0.958156347f, -0.958266079f, -0.958375633f,
+    -0.958485067f, -0.958594322f, -0.958703458f, -0.958812475f, -0.958921313f,
+    -0.959030032f, -0.959138632f, -0.959247053f, -0.959355354f, -0.959463477f,
+    -0.95957154f, -0.959679365f, -0.95978713f, -0.959894717f, -0.960002124f,
+    -0.960109472f, -0.960216641f, -0.960323632f, -0.960430503f, -0.960537255f,
+    -0.960643888f, -0.960750341f, -0.960856616f, -0.960962832f, -0.961068869f,
+    -0.961174726f, -0.961280465f, -0.961386085f, -0.961491585f, -0.961596906f,
+    -0.961702049f, -0.961807132f, -0.961912036f, -0.962016761f, -0.962121427f,
+    -0.962225854f, -0.962330222f, -0.962434411f, -0.962538481f, -0.962642372f,
+    -0.962746143f, -0.962849796f, -0.962953269f, -0.963056624f, -0.9631598f,
+    -0.963262856f, -0.963365793f, -0.963468552f, -0.963571191f, -0.963673711f,
+    -0.963776052f, -0.963878274f, -0.963980377f, -0.964082301f, -0.964184046f,
+    -0.964285731f, -0.964387238f, -0.964488566f, -0.964589775f, -0.964690864f,
+    -0.964791834f, -0.964892626f, -0.964993238f, -0.965093791f, -0.965194106f,
+    -0.965294361f, -0.965394437f, -0.965494394f, -0.965594172f, -0.965693831f,
+    -0.965793371f, -0.965892732f, -0.965991974f, -0.966091037f, -0.966189981f,
+    -0.966288805f, -0.966387451f, -0.966485977f, -0.966584384f, -0.966682613f,
+    -0.966780722f, -0.966878653f, -0.966976464f, -0.967074156f, -0.967171669f,
+    -0.967269063f, -0.967366278f, -0.967463374f, -0.967560351f, -0.967657149f,
+    -0.967753828f, -0.967850387f, -0.967946768f, -0.968043029f, -0.968139112f,
+    -0.968235075f, -0.96833086f, -0.968426585f, -0.968522072f, -0.968617499f,
+    -0.968712747f, -0.968807817f, -0.968902826f, -0.968997598f, -0.969092309f,
+    -0.969186842f, -0.969281256f, -0.969375491f, -0.969469607f, -0.969563544f,
+    -0.969657362f, -0.96975106f, -0.96984458f, -0.96993798f, -0.970031261f,
+    -0.970124364f, -0.970217347f, -0.970310152f, -0.970402837f, -0.970495403f,
+    -0.97058779f, -0.970680058f, -0.970772147f, -0.970864117f, -0.970955908f,
+    -0.97104764f, -0.971139133f, -0.971230567f, -0.971321821f, -0.971412897f,
+    -0.971503913f, -0.971594691f, -0.97168541f, -0.971775949f, -0.97186631f,
+    -0.971956611f, -0.972046733f, -0.972136676f, -0.972226501f, -0.972316206f,
+    -0.972405732f, -0.972495139f, -0.972584367f, -0.972673476f, -0.972762465f,
+    -0.972851276f, -0.972939968f, -0.973028481f, -0.973116875f, -0.973205149f,
+    -0.973293245f, -0.973381221f, -0.973469019f, -0.973556697f, -0.973644257f,
+    -0.973731637f, -0.973818898f, -0.973905981f, -0.973992944f, -0.974079788f,
+    -0.974166453f, -0.974252999f, -0.974339366f, -0.974425614f, -0.974511743f,
+    -0.974597692f, -0.974683523f, -0.974769175f, -0.974854708f, -0.974940121f,
+    -0.975025356f, -0.975110471f, -0.975195408f, -0.975280225f, -0.975364864f,
+    -0.975449383f, -0.975533783f, -0.975618005f, -0.975702107f, -0.97578609f,
+    -0.975869894f, -0.975953579f, -0.976037085f, -0.976120472f, -0.97620368f,
+    -0.976286769f, -0.976369739f, -0.976452529f, -0.976535201f, -0.976617694f,
+    -0.976700068f, -0.976782322f, -0.976864398f, -0.976946354f, -0.977028131f,
+    -0.97710979f, -0.977191329f, -0.977272689f, -0.977353871f, -0.977434993f,
+    -0.977515936f, -0.9775967f, -0.977677345f, -0.977757871f, -0.977838218f,
+    -0.977918446f, -0.977998495f, -0.978078425f, -0.978158236f, -0.978237867f,
+    -0.97831738f, -0.978396714f, -0.978475928f, -0.978555024f, -0.97863394f,
+    -0.978712678f, -0.978791356f, -0.978869855f, -0.978948176f, -0.979026377f,
+    -0.979104459f, -0.979182363f, -0.979260147f, -0.979337752f, -0.979415238f,
+    -0.979492545f, -0.979569793f, -0.979646802f, -0.979723752f, -0.979800463f,
+    -0.979877114f, -0.979953587f, -0.980029881f, -0.980106115f, -0.980182111f,
+    -0.980258048f, -0.980333805f, -0.980409384f, -0.980484843f, -0.980560184f,
+    -0.980635345f, -0.980710387f, -0.980785251f, -0.980859995f, -0.98093462f,
+    -0.981009066f, -0.981083393f, -0.981157541f, -0.98123157f, -0.98130548f,
+    -0.981379211f, -0.981452763f, -0.981526256f, -0.98159951f, -0.981672704f,
+    -0.98174572f, -0.981818557f, -0.981891274f, -0.981963873f, -0.982036293f,
+    -0.982108593f, -0.982180715f, -0.982252717f, -0.9823246f, -0.982396305f,
+    -0.98246789f, -0.982539296f, -0.982610583f, -0.982681692f, -0.982752681f,
+    -0.982823551f, -0.982894242f, -0.982964814f, -0.983035207f, -0.983105481f,
+    -0.983175635f, -0.983245611f, -0.983315408f, -0.983385086f, -0.983454645f,
+    -0.983524024f, -0.983593285f, -0.983662426f, -0.983731389f, -0.983800232f,
+    -0.983868897f, -0.983937442f, -0.984005809f, -0.984074056f, -0.984142125f,
+    -0.984210074f, -0.984277904f, -0.984345555f, -0.984413087f, -0.984480441f,
+    -0.984547675f, -0.984614789f, -0.984681726f, -0.984748483f, -0.98481518f,
+    -0.984881639f, -0.984948039f, -0.98501426f, -0.985080302f, -0.985146224f,
+    -0.985212028f, -0.985277653f, -0.985343158f, -0.985408485f, -0.985473692f,
+    -0.985538721f, -0.985603631f, -0.985668421f, -0.985733032f, -0.985797524f,
+    -0.985861838f, -0.985926032f, -0.985990047f, -0.986053944f, -0.986117721f,
+    -0.986181319f, -0.986244798f, -0.986308098f, -0.986371279f, -0.986434281f,
+    -0.986497164f, -0.986559927f, -0.986622512f, -0.986684918f, -0.986747265f,
+    -0.986809373f, -0.986871421f, -0.986933291f, -0.986994982f, -0.987056553f,
+    -0.987118006f, -0.987179279f, -0.987240434f, -0.987301409f, -0.987362266f,
+    -0.987422943f, -0.987483501f, -0.987543941f, -0.987604201f, -0.987664342f,
+    -0.987724304f, -0.987784147f, -0.987843812f, -0.987903357f, -0.987962782f,
+    -0.988022029f, -0.988081098f, -0.988140106f, -0.988198876f, -0.988257587f,
+    -0.988316119f, -0.988374472f, -0.988432705f, -0.98849082f, -0.988548756f,
+    -0.988606513f, -0.98866421f, -0.988721669f, -0.988779068f, -0.988836288f,
+    -0.98889333f, -0.988950253f, -0.989007056f, -0.98906368f, -0.989120185f,
+    -0.989176512f, -0.989232719f, -0.989288747f, -0.989344656f, -0.989400446f,
+    -0.989456058f, -0.98951149f, -0.989566863f, -0.989621997f, -0.989677072f,
+    -0.989731967f, -0.989786685f, -0.989841282f, -0.989895701f, -0.989950061f,
+    -0.990004182f, -0.990058184f, -0.990112066f, -0.99016583f, -0.990219355f,
+    -0.99027282f, -0.990326107f, -0.990379214f, -0.990432262f, -0.990485072f,
+    -0.990537763f, -0.990590334f, -0.990642786f, -0.990695f, -0.990747154f,
+    -0.990799129f, -0.990850925f, -0.990902662f, -0.990954161f, -0.99100554f,
+    -0.9910568f, -0.991107941f, -0.991158843f, -0.991209686f, -0.99126035f,
+    -0.991310835f, -0.99136126f, -0.991411448f, -0.991461515f, -0.991511464f,
+    -0.991561234f, -0.991610885f, -0.991660416f, -0.991709769f, -0.991758943f,
+    -0.991807997f, -0.991856933f, -0.991905689f, -0.991954327f, -0.992002785f,
+    -0.992051125f, -0.992099285f, -0.992147326f, -0.992195249f, -0.992242992f,
+    -0.992290616f, -0.992338061f, -0.992385328f, -0.992432535f, -0.992479563f,
+    -0.992526412f, -0.992573142f, -0.992619693f, -0.992666125f, -0.992712438f,
+    -0.992758572f, -0.992804587f, -0.992850423f, -0.99289614f, -0.992941678f,
+    -0.992987096f, -0.993032336f, -0.993077457f, -0.993122458f, -0.993167281f,
+    -0.993211925f, -0.993256509f, -0.993300855f, -0.993345141f, -0.993389189f,
+    -0.993433177f, -0.993476987f, -0.993520617f, -0.993564129f, -0.993607521f,
+    -0.993650734f, -0.993693769f, -0.993736744f, -0.99377948f, -0.993822157f,
+    -0.993864655f, -0.993906975f, -0.993949175f, -0.993991196f, -0.994033098f,
+    -0.994074881f, -0.994116485f, -0.99415797f, -0.994199276f, -0.994240463f,
+    -0.994281471f, -0.99432236f, -0.99436307f, -0.99440366f, -0.994444132f,
+    -0.994484425f, -0.994524539f, -0.994564593f, -0.994604409f, -0.994644165f,
+    -0.994683683f, -0.994723141f, -0.994762421f, -0.994801521f, -0.994840503f,
+    -0.994879305f, -0.994917989f, -0.994956553f, -0.994994938f, -0.995033205f,
+    -0.995071292f, -0.99510926f, -0.995147049f, -0.99518472f, -0.99522227f,
+    -0.995259583f, -0.995296836f, -0.99533391f, -0.995370865f, -0.995407641f,
+    -0.995444238f, -0.995480776f, -0.995517075f, -0.995553315f, -0.995589375f,
+    -0.995625257f, -0.99566102f, -0.995696604f, -0.995732069f, -0.995767415f,
+    -0.995802581f, -0.995837629f, -0.995872498f, -0.995907247f, -0.995941818f,
+    -0.995976269f, -0.996010542f, -0.996044695f, -0.99607873f, -0.996112585f,
+    -0.996146262f, -0.996179819f, -0.996213257f, -0.996246517f, -0.996279657f,
+    -0.996312618f, -0.99634546f, -0.996378124f, -0.996410668f, -0.996443033f,
+    -0.996475279f, -0.996507406f, -0.996539354f, -0.996571124f, -0.996602774f,
+    -0.996634305f, -0.996665657f, -0.996696889f, -0.996727943f, -0.996758878f,
+    -0.996789694f, -0.996820271f, -0.996850789f, -0.996881127f, -0.996911287f,
+    -0.996941328f, -0.99697125f, -0.997000992f, -0.997030616f, -0.997060061f,
+    -0.997089386f, -0.997118533f, -0.99714756f, -0.997176409f, -0.997205138f,
+    -0.997233748f, -0.99726218f, -0.997290432f, -0.997318566f, -0.99734658f,
+    -0.997374415f, -0.997402132f, -0.997429669f, -0.997457087f, -0.997484326f,
+    -0.997511446f, -0.997538447f, -0.99756521f, -0.997591913f, -0.997618437f,
+    -0.997644842f, -0.997671068f, -0.997697115f, -0.997723043f, -0.997748852f,
+    -0.997774482f, -0.997799993f, -0.997825325f, -0.997850537f, -0.997875631f,
+    -0.997900546f, -0.997925282f, -0.997949898f, -0.997974396f, -0.997998714f,
+    -0.998022854f, -0.998046875f, -0.998070776f, -0.998094499f, -0.998118103f,
+    -0.998141527f, -0.998164833f, -0.998188019f, -0.998211026f, -0.998233855f,
+    -0.998256564f, -0.998279154f, -0.998301566f, -0.998323798f, -0.998345912f,
+    -0.998367906f, -0.998389721f, -0.998411417f, -0.998432934f, -0.998454332f,
+    -0.998475552f, -0.998496652f, -0.998517632f, -0.998538435f, -0.998559058f,
+    -0.998579562f, -0.998599946f, -0.998620152f, -0.998640239f, -0.998660147f,
+    -0.998679936f, -0.998699546f, -0.998719037f, -0.998738348f, -0.998757541f,
+    -0.998776555f, -0.99879545f, -0.998814225f, -0.998832822f, -0.99885124f,
+    -0.998869538f, -0.998887718f, -0.998905718f, -0.9989236f, -0.998941302f,
+    -0.998958886f, -0.99897629f, -0.998993576f, -0.999010682f, -0.999027669f,
+    -0.999044478f, -0.999061167f, -0.999077737f, -0.999094129f, -0.999110341f,
+    -0.999126494f, -0.999142408f, -0.999158204f, -0.99917388f, -0.999189377f,
+    -0.999204755f, -0.999219954f, -0.999235034f, -0.999249995f, -0.999264777f,
+    -0.99927938f, -0.999293864f, -0.999308169f, -0.999322355f, -0.999336421f,
+    -0.999350309f, -0.999364078f, -0.999377668f, -0.999391139f, -0.99940443f,
+    -0.999417603f, -0.999430597f, -0.999443471f, -0.999456167f, -0.999468744f,
+    -0.999481201f, -0.99949348f, -0.999505579f, -0.99951756f, -0.999529421f,
+    -0.999541104f, -0.999552667f, -0.999564052f, -0.999575317f, -0.999586403f,
+    -0.999597371f, -0.999608159f, -0.999618828f, -0.999629319f, -0.99963969f,
+    -0.999649942f, -0.999660015f, -0.999669909f, -0.999679685f, -0.999689341f,
+    -0.999698818f, -0.999708176f, -0.999717355f, -0.999726415f, -0.999735296f,
+    -0.999744058f, -0.999752641f, -0.999761105f, -0.99976939f, -0.999777555f,
+    -0.999785602f, -0.99979347f, -0.999801159f, -0.999808729f, -0.999816179f,
+    -0.999823451f, -0.999830604f, -0.999837577f, -0.999844432f, -0.999851108f,
+    -0.999857664f, -0.999864042f, -0.9998703f, -0.99987638f, -0.99988234f,
+    -0.999888182f, -0.999893844f, -0.999899328f, -0.999904692f, -0.999909937f,
+    -0.999915004f, -0.999919951f, -0.999924719f, -0.999929309f, -0.999933839f,
+    -0.99993813f, -0.999942362f, -0.999946415f, -0.99995029f, -0.999954045f,
+    -0.999957621f, -0.999961078f, -0.999964416f, -0.999967575f, -0.999970615f,
+    -0.999973476f, -0.999976158f, -0.999978721f, -0.999981165f, -0.99998343f,
+    -0.999985576f, -0.999987602f, -0.99998939f, -0.999991119f, -0.999992669f,
+    -0.99999404f, -0.999995291f, -0.999996424f, -0.999997377f, -0.999998152f,
+    -0.999998808f, -0.999999344f, -0.999999702f, -0.99999994f
+};
+
+static const float fft_fixed_twiddle_im[8192] = {
+    -0.0f, -0.000383495179f, -0.000766990299f, -0.00115048536f, -0.00153398013f,
+    -0.00191747479f, -0.00230096909f, -0.00268446305f, -0.00306795677f,
+    -0.00345145003f, -0.00383494259f, -0.00421843445f, -0.00460192608f,
+    -0.00498541677f, -0.005368907f, -0.0057523963f, -0.00613588467f,
+    -0.00651937211f, -0.00690285861f, -0.00728634419f, -0.00766982883f,
+    -0.00805331208f, -0.00843679439f, -0.00882027484f, -0.00920375437f,
+    -0.00958723295f, -0.00997070968f, -0.0103541855f, -0.0107376594f,
+    -0.0111211315f, -0.0115046017f, -0.011888071f, -0.0122715384f,
+    -0.0126550039f, -0.0130384676f, -0.0134219285f, -0.0138053885f,
+    -0.0141888466f, -0.0145723019f, -0.0149557553f, -0.015339206f,
+    -0.0157226548f, -0.0161061026f, -0.0164895467f, -0.0168729872f,
+    -0.0172564276f, -0.0176398642f, -0.0180232991f, -0.0184067301f,
+    -0.0187901594f, -0.0191735849f, -0.0195570085f, -0.0199404284f,
+    -0.0203238465f, -0.0207072608f, -0.0210906714f, -0.0214740802f,
+    -0.0218574852f, -0.0222408883f, -0.0226242859f, -0.0230076816f,
+    -0.0233910736f, -0.0237744618f, -0.0241578463f, -0.024541229f,
+    -0.0249246061f, -0.0253079813f, -0.0256913509f, -0.0260747187f,
+    -0.0264580809f, -0.0268414393f, -0.027224794f, -0.027608145f,
+    -0.0279914923f, -0.0283748358f, -0.0287581738f, -0.029141508f,
+    -0.0295248386f, -0.0299081653f, -0.0302914865f, -0.030674804f,
+    -0.0310581159f, -0.031441424f, -0.0318247266f, -0.0322080255f,
+    -0.0325913206f, -0.0329746082f, -0.0333578922f, -0.0337411724f,
+    -0.0341244452f, -0.0345077142f, -0.0348909795f, -0.0352742374f,
+    -0.0356574915f, -0.036040742f, -0.0364239849f, -0.0368072242f,
+    -0.0371904559f, -0.037573684f, -0.0379569046f, -0.0383401215f,
+    -0.0387233309f, -0.0391065367f, -0.0394897349f, -0.0398729257f,
+    -0.0402561165f, -0.0406392962f, -0.0410224721f, -0.0414056405f,
+    -0.0417888053f, -0.0421719626f, -0.0425551124f, -0.0429382585f,
+    -0.0433213934f, -0.0437045284f, -0.0440876521f, -0.0444707721f,
+    -0.0448538847f, -0.0452369899f, -0.0456200913f, -0.0460031815f,
+    -0.046386268f, -0.046769347f, -0.0471524186f, -0.0475354828f,
+    -0.0479185432f, -0.0483015925f, -0.048684638f, -0.0490676761f,
+    -0.049450703f, -0.0498337261f, -0.0502167419f, -0.0505997501f,
+    -0.050982751f, -0.0513657406f, -0.0517487265f, -0.052131705f, -0.052514676f,
+    -0.0528976358f, -0.053280592f, -0.0536635369f, -0.0540464781f,
+    -0.0544294082f, -0.0548123308f, -0.0551952459f, -0.0555781499f,
+    -0.0559610501f, -0.0563439392f, -0.0567268208f, -0.0571096949f,
+    -0.0574925579f, -0.0578754172f, -0.0582582653f, -0.0586411059f,
+    -0.0590239353f, -0.0594067574f, -0.0597895719f, -0.0601723753f,
+    -0.0605551712f, -0.0609379597f, -0.061320737f, -0.0617035069f,
+    -0.0620862655f, -0.0624690168f, -0.0628517568f, -0.0632344931f,
+    -0.0636172146f, -0.0639999285f, -0.0643826276f, -0.0647653267f,
+    -0.0651480108f, -0.0655306876f, -0.0659133494f, -0.0662960112f,
+    -0.0666786581f, -0.0670612901f, -0.0674439222f, -0.0678265393f,
+    -0.0682091415f, -0.0685917437f, -0.068974331f, -0.0693569034f,
+    -0.0697394684f, -0.0701220259f, -0.070504576f, -0.0708871111f,
+    -0.0712696314f, -0.0716521516f, -0.0720346496f, -0.0724171475f,
+    -0.0727996305f, -0.0731820986f, -0.0735645667f, -0.0739470124f,
+    -0.0743294507f, -0.0747118816f, -0.0750942975f, -0.075476706f,
+    -0.0758591071f, -0.0762414858f, -0.0766238645f, -0.0770062208f,
+    -0.0773885772f, -0.0777709112f, -0.0781532452f, -0.0785355568f,
+    -0.078917861f, -0.0793001577f, -0.0796824396f, -0.0800647065f,
+    -0.080446966f, -0.0808292106f, -0.0812114477f, -0.08159367f, -0.0819758773f,
+    -0.0823580772f, -0.0827402622f, -0.0831224397f, -0.0835046023f,
+    -0.08388675f, -0.0842688903f, -0.0846510157f, -0.0850331262f,
+    -0.0854152218f, -0.0857973099f, -0.0861793905f, -0.0865614489f,
+    -0.0869434997f, -0.0873255357f, -0.0877075568f, -0.0880895704f,
+    -0.0884715691f, -0.0888535529f, -0.0892355219f, -0.0896174833f,
+    -0.0899994299f, -0.0903813615f, -0.0907632783f, -0.0911451876f,
+    -0.0915270746f, -0.0919089541f, -0.0922908187f, -0.0926726758f,
+    -0.0930545107f, -0.093436338f, -0.093818143f, -0.0941999406f,
+    -0.0945817232f, -0.0949634984f, -0.0953452513f, -0.0957269892f,
+    -0.0961087197f, -0.0964904279f, -0.0968721285f, -0.0972538143f,
+    -0.0976354852f, -0.0980171412f, -0.0983987823f, -0.0987804085f,
+    -0.0991620198f, -0.0995436162f, -0.0999252051f, -0.100306772f,
+    -0.100688323f, -0.10106986f, -0.101451389f, -0.101832896f, -0.102214389f,
+    -0.102595866f, -0.102977335f, -0.103358783f, -0.103740215f, -0.104121633f,
+    -0.104503036f, -0.104884423f, -0.105265796f, -0.105647154f, -0.106028497f,
+    -0.106409818f, -0.106791131f, -0.107172422f, -0.107553706f, -0.107934967f,
+    -0.108316213f, -0.108697444f, -0.109078661f, -0.109459855f, -0.109841041f,
+    -0.110222206f, -0.110603355f, -0.110984489f, -0.111365609f, -0.111746714f,
+    -0.112127796f, -0.112508863f, -0.112889916f, -0.113270953f, -0.113651969f,
+    -0.114032976f, -0.114413962f, -0.114794925f, -0.11517588f, -0.115556814f,
+    -0.115937732f, -0.116318628f, -0.116699517f, -0.117080383f, -0.117461227f,
+    -0.117842063f, -0.118222877f, -0.118603677f, -0.118984453f, -0.119365215f,
+    -0.119745962f, -0.120126687f, -0.120507397f, -0.120888084f, -0.121268764f,
+    -0.121649414f, -0.122030057f, -0.122410677f, -0.122791275f, -0.123171858f,
+    -0.123552427f, -0.123932973f, -0.124313504f, -0.12469402f, -0.125074506f,
+    -0.125454977f, -0.125835434f, -0.126215875f, -0.126596302f, -0.126976699f,
+    -0.127357081f, -0.127737448f, -0.128117785f, -0.128498107f, -0.128878415f,
+    -0.129258707f, -0.12963897f, -0.130019218f, -0.130399451f, -0.130779669f,
+    -0.131159857f, -0.13154003f, -0.131920189f, -0.132300317f, -0.132680431f,
+    -0.13306053f, -0.133440599f, -0.133820653f, -0.134200692f, -0.134580702f,
+    -0.134960711f, -0.135340676f, -0.13572064f, -0.136100575f, -0.136480495f,
+    -0.136860386f, -0.137240261f, -0.137620121f, -0.137999952f, -0.138379768f,
+    -0.138759568f, -0.139139339f, -0.139519095f, -0.139898837f, -0.140278548f,
+    -0.140658244f, -0.141037911f, -0.141417563f, -0.1417972f, -0.142176807f,
+    -0.142556399f, -0.142935961f, -0.143315509f, -0.143695027f, -0.144074544f,
+    -0.144454017f, -0.14483349f, -0.145212919f, -0.145592347f, -0.145971745f,
+    -0.146351114f, -0.146730468f, -0.147109807f, -0.147489116f, -0.14786841f,
+    -0.148247674f, -0.148626924f, -0.149006143f, -0.149385348f, -0.149764538f,
+    -0.150143698f, -0.150522828f, -0.150901943f, -0.151281044f, -0.151660115f,
+    -0.152039155f, -0.152418181f, -0.152797192f, -0.153176159f, -0.153555125f,
+    -0.153934062f, -0.154312968f, -0.15469186f, -0.155070737f, -0.155449569f,
+    -0.155828401f, -0.156207204f, -0.156585976f, -0.156964719f, -0.157343462f,
+    -0.15772216f, -0.158100843f, -0.158479512f, -0.15885815f, -0.159236759f,
+    -0.159615353f, -0.159993917f, -0.160372451f, -0.16075097f, -0.161129475f,
+    -0.161507949f, -0.161886394f, -0.162264824f, -0.162643224f, -0.163021594f,
+    -0.16339995f, -0.163778275f, -0.164156586f, -0.164534867f, -0.164913118f,
+    -0.165291354f, -0.16566956f, -0.166047737f, -0.166425899f, -0.166804045f,
+    -0.167182148f, -0.167560235f, -0.167938292f, -0.168316334f, -0.168694347f,
+    -0.16907233f, -0.169450298f, -0.169828221f, -0.170206144f, -0.170584023f,
+    -0.170961887f, -0.17133972f, -0.171717539f, -0.172095329f, -0.172473088f,
+    -0.172850817f, -0.173228532f, -0.173606217f, -0.173983872f, -0.174361512f,
+    -0.174739107f, -0.175116703f, -0.175494254f, -0.175871789f, -0.176249295f,
+    -0.176626772f, -0.177004218f, -0.17738165f, -0.177759051f, -0.178136423f,
+    -0.178513765f, -0.178891093f, -0.17926839f, -0.179645658f, -0.180022895f,
+    -0.180400118f, -0.180777311f, -0.181154475f, -0.181531608f, -0.181908712f,
+    -0.182285801f, -0.18266286f, -0.183039889f, -0.183416888f, -0.183793873f,
+    -0.184170812f, -0.184547737f, -0.184924632f, -0.185301498f, -0.185678333f,
+    -0.186055154f, -0.186431944f, -0.18680869f, -0.187185422f, -0.187562123f,
+    -0.187938809f, -0.188315451f, -0.188692078f, -0.18906866f, -0.189445227f,
+    -0.189821765f, -0.190198272f, -0.19057475f, -0.190951213f, -0.191327631f,
+    -0.191704035f, -0.192080393f, -0.192456737f, -0.192833051f, -0.193209335f,
+    -0.19358559f, -0.193961814f, -0.194338009f, -0.194714189f, -0.195090324f,
+    -0.195466429f, -0.195842519f, -0.196218565f, -0.196594596f, -0.196970597f,
+    -0.197346568f, -0.197722495f, -0.198098406f, -0.198474288f, -0.19885014f,
+    -0.199225962f, -0.199601755f, -0.199977517f, -0.20035325f, -0.200728953f,
+    -0.201104641f, -0.201480284f, -0.201855898f, -0.202231482f, -0.202607036f,
+    -0.20298256f, -0.203358069f, -0.203733534f, -0.204108968f, -0.204484373f,
+    -0.204859748f, -0.205235094f, -0.205610409f, -0.205985695f, -0.206360951f,
+    -0.206736177f, -0.207111374f, -0.20748654f, -0.207861677f, -0.208236784f,
+    -0.208611846f, -0.208986893f, -0.209361911f, -0.209736884f, -0.210111842f,
+    -0.210486755f, -0.210861638f, -0.211236507f, -0.211611331f, -0.211986125f,
+    -0.212360889f, -0.212735623f, -0.213110313f, -0.213484988f, -0.213859633f,
+    -0.214234233f, -0.214608818f, -0.214983359f, -0.21535787f, -0.215732351f,
+    -0.216106802f, -0.216481209f, -0.2168556f, -0.217229947f, -0.21760428f,
+    -0.217978567f, -0.218352824f, -0.218727052f, -0.219101235f, -0.219475403f,
+    -0.219849527f, -0.220223621f, -0.220597684f, -0.220971718f, -0.221345723f,
+    -0.221719682f, -0.222093627f, -0.222467527f, -0.222841397f, -0.223215222f,
+    -0.223589033f, -0.223962799f, -0.224336535f, -0.224710241f, -0.225083917f,
+    -0.225457549f, -0.225831151f, -0.226204723f, -0.226578265f, -0.226951763f,
+    -0.227325246f, -0.227698684f, -0.228072077f, -0.228445455f, -0.228818789f,
+    -0.229192093f, -0.229565367f, -0.229938596f, -0.230311811f, -0.230684981f,
+    -0.231058106f, -0.231431216f, -0.231804281f, -0.232177302f, -0.232550308f,
+    -0.232923269f, -0.233296201f, -0.233669102f, -0.234041959f, -0.234414786f,
+    -0.234787583f, -0.235160336f, -0.235533059f, -0.235905752f, -0.2362784f,
+    -0.236651018f, -0.237023607f, -0.237396151f, -0.237768665f, -0.238141149f,
+    -0.238513589f, -0.238885999f, -0.239258379f, -0.239630714f, -0.24000302f,
+    -0.240375295f, -0.240747526f, -0.241119727f, -0.241491884f, -0.241864011f,
+    -0.242236108f, -0.24260816f, -0.242980182f, -0.24335216f, -0.243724108f,
+    -0.244096026f, -0.244467899f, -0.244839743f, -0.245211542f, -0.245583311f,
+    -0.24595505f, -0.246326745f, -0.246698409f, -0.247070029f, -0.24744162f,
+    -0.247813165f, -0.248184681f, -0.248556167f, -0.248927608f, -0.249299005f,
+    -0.249670386f, -0.250041723f, -0.250413001f, -0.250784278f, -0.251155496f,
+    -0.251526684f, -0.251897812f, -0.25226894f, -0.252640009f, -0.253011048f,
+    -0.253382027f, -0.253753006f, -0.254123926f, -0.254494816f, -0.254865646f,
+    -0.255236477f, -0.255607247f, -0.255977988f, -0.25634867f, -0.256719351f,
+    -0.257089972f, -0.257460564f, -0.257831097f, -0.258201599f, -0.258572072f,
+    -0.258942515f, -0.259312928f, -0.259683281f, -0.260053605f, -0.260423869f,
+    -0.260794103f, -0.261164337f, -0.261534482f, -0.261904627f, -0.262274712f,
+    -0.262644768f, -0.263014764f, -0.26338473f, -0.263754666f, -0.264124572f,
+    -0.264494419f, -0.264864236f, -0.265234023f, -0.265603781f, -0.265973479f,
+    -0.266343147f, -0.266712755f, -0.267082334f, -0.267451882f, -0.267821401f,
+    -0.268190861f, -0.26856029f, -0.26892966f, -0.26929903f, -0.269668311f,
+    -0.270037591f, -0.270406812f, -0.270776004f, -0.271145165f, -0.271514267f,
+    -0.271883339f, -0.272252381f, -0.272621363f, -0.272990316f, -0.273359209f,
+    -0.273728073f, -0.274096906f, -0.27446571f, -0.274834454f, -0.275203139f,
+    -0.275571823f, -0.275940448f, -0.276309043f, -0.276677579f, -0.277046084f,
+    -0.277414531f, -0.277782977f, -0.278151363f, -0.27851969f, -0.278887987f,
+    -0.279256254f, -0.279624462f, -0.27999264f, -0.280360788f, -0.280728877f,
+    -0.281096935f, -0.281464934f, -0.281832904f, -0.282200843f, -0.282568723f,
+    -0.282936573f, -0.283304363f, -0.283672124f, -0.284039855f, -0.284407526f,
+    -0.284775168f, -0.285142779f, -0.285510331f, -0.285877824f, -0.286245316f,
+    -0.286612719f, -0.286980122f, -0.287347466f, -0.28771475f, -0.288082033f,
+    -0.288449228f, -0.288816422f, -0.289183527f, -0.289550632f, -0.289917678f,
+    -0.290284663f, -0.290651649f, -0.291018546f, -0.291385442f, -0.291752249f,
+    -0.292119056f, -0.292485803f, -0.292852491f, -0.293219149f, -0.293585777f,
+    -0.293952346f, -0.294318885f, -0.294685364f, -0.295051813f, -0.295418203f,
+    -0.295784563f, -0.296150893f, -0.296517164f, -0.296883374f, -0.297249556f,
+    -0.297615707f, -0.297981799f, -0.298347861f, -0.298713863f, -0.299079835f,
+    -0.299445748f, -0.299811631f, -0.300177455f, -0.300543249f, -0.300908983f,
+    -0.301274687f, -0.301640332f, -0.302005947f, -0.302371502f, -0.302737027f,
+    -0.303102523f, -0.303467959f, -0.303833336f, -0.304198682f, -0.304563969f,
+    -0.304929227f, -0.305294424f, -0.305659592f, -0.30602473f, -0.306389809f,
+    -0.306754827f, -0.307119817f, -0.307484746f, -0.307849646f, -0.308214486f,
+    -0.308579296f, -0.308944046f, -0.309308767f, -0.309673429f, -0.31003806f,
+    -0.310402632f, -0.310767144f, -0.311131626f, -0.311496079f, -0.311860472f,
+    -0.312224805f, -0.312589109f, -0.312953383f, -0.313317567f, -0.313681751f,
+    -0.314045846f, -0.314409941f, -0.314773947f, -0.315137923f, -0.315501869f,
+    -0.315865755f, -0.316229582f, -0.316593379f, -0.316957116f, -0.317320824f,
+    -0.317684472f, -0.31804809f, -0.318411648f, -0.318775147f, -0.319138616f,
+    -0.319502026f, -0.319865406f, -0.320228726f, -0.320592016f, -0.320955247f,
+    -0.321318418f, -0.321681559f, -0.322044641f, -0.322407693f, -0.322770685f,
+    -0.323133618f, -0.323496521f, -0.323859364f, -0.324222177f, -0.324584931f,
+    -0.324947625f, -0.32531029f, -0.325672895f, -0.32603547f, -0.326397985f,
+    -0.326760441f, -0.327122867f, -0.327485234f, -0.32784757f, -0.328209847f,
+    -0.328572065f, -0.328934252f, -0.32929638f, -0.329658449f, -0.330020487f,
+    -0.330382496f, -0.330744416f, -0.331106305f, -0.331468135f, -0.331829935f,
+    -0.332191676f, -0.332553357f, -0.332915008f, -0.3332766f, -0.333638161f,
+    -0.333999664f, -0.334361106f, -0.334722489f, -0.335083842f, -0.335445136f,
+    -0.3358064f, -0.336167604f, -0.336528748f, -0.336889863f, -0.337250918f,
+    -0.337611914f, -0.33797285f, -0.338333756f, -0.338694632f, -0.339055419f,
+    -0.339416176f, -0.339776874f, -0.340137541f, -0.340498149f, -0.340858698f,
+    -0.341219217f, -0.341579646f, -0.341940075f, -0.342300415f, -0.342660725f,
+    -0.343020976f, -0.343381166f, -0.343741328f, -0.344101429f, -0.344461471f,
+    -0.344821483f, -0.345181435f, -0.345541328f, -0.345901161f, -0.346260965f,
+    -0.346620709f, -0.346980423f, -0.347340047f, -0.347699642f, -0.348059177f,
+    -0.348418683f, -0.348778129f, -0.349137515f, -0.349496841f, -0.349856138f,
+    -0.350215375f, -0.350574553f, -0.350933671f, -0.351292759f, -0.351651788f,
+    -0.352010757f, -0.352369696f, -0.352728546f, -0.353087366f, -0.353446156f,
+    -0.353804857f, -0.354163527f, -0.354522139f, -0.354880691f, -0.355239213f,
+    -0.355597675f, -0.355956078f, -0.356314421f, -0.356672704f, -0.357030958f,
+    -0.357389152f, -0.357747287f, -0.358105391f, -0.358463407f, -0.358821392f,
+    -0.359179348f, -0.359537214f, -0.359895051f, -0.360252798f, -0.360610515f,
+    -0.360968202f, -0.3613258f, -0.361683369f, -0.362040877f, -0.362398326f,
+    -0.362755716f, -0.363113075f, -0.363470376f, -0.363827616f, -0.364184797f,
+    -0.364541918f, -0.364899009f, -0.365256011f, -0.365612984f, -0.365969926f,
+    -0.366326779f, -0.366683602f, -0.367040336f, -0.36739704f, -0.367753685f,
+    -0.368110299f, -0.368466824f, -0.36882332f, -0.369179755f, -0.369536132f,
+    -0.369892448f, -0.370248705f, -0.370604932f, -0.3709611f, -0.371317208f,
+    -0.371673256f, -0.372029245f, -0.372385174f, -0.372741073f, -0.373096913f,
+    -0.373452663f, -0.373808384f, -0.374164075f, -0.374519676f, -0.374875218f,
+    -0.37523073f, -0.375586182f, -0.375941575f, -0.376296908f, -0.376652181f,
+    -0.377007425f, -0.377362579f, -0.377717704f, -0.378072739f, -0.378427744f,
+    -0.37878269f, -0.379137605f, -0.379492432f, -0.379847199f, -0.380201936f,
+    -0.380556613f, -0.380911201f, -0.381265759f, -0.381620258f, -0.381974727f,
+    -0.382329106f, -0.382683426f, -0.383037716f, -0.383391917f, -0.383746088f,
+    -0.384100199f, -0.38445425f, -0.384808242f, -0.385162175f, -0.385516047f,
+    -0.38586989f, -0.386223644f, -0.386577338f, -0.386931002f, -0.387284607f,
+    -0.387638152f, -0.387991607f, -0.388345033f, -0.388698429f, -0.389051735f,
+    -0.389404982f, -0.38975817f, -0.390111327f, -0.390464395f, -0.390817404f,
+    -0.391170382f, -0.391523302f, -0.391876131f, -0.392228931f, -0.392581671f,
+    -0.392934352f, -0.393286973f, -0.393639535f, -0.393992037f, -0.394344479f,
+    -0.394696862f, -0.395049214f, -0.395401478f, -0.395753682f, -0.396105856f,
+    -0.39645794f, -0.396809995f, -0.397161961f, -0.397513896f, -0.397865742f,
+    -0.398217559f, -0.398569316f, -0.398921013f, -0.399272621f, -0.399624199f,
+    -0.399975717f, -0.400327176f, -0.400678575f, -0.401029885f, -0.401381165f,
+    -0.401732385f, -0.402083546f, -0.402434647f, -0.402785689f, -0.403136671f,
+    -0.403487593f, -0.403838456f, -0.404189259f, -0.404540002f, -0.404890686f,
+    -0.405241311f, -0.405591875f, -0.40594238f, -0.406292826f, -0.406643212f,
+    -0.406993538f, -0.407343805f, -0.407694012f, -0.408044159f, -0.408394247f,
+    -0.408744276f, -0.409094244f, -0.409444153f, -0.409794003f, -0.410143793f,
+    -0.410493493f, -0.410843164f, -0.411192775f, -0.411542326f, -0.411891818f,
+    -0.41224122f, -0.412590593f, -0.412939876f, -0.41328913f, -0.413638324f,
+    -0.413987428f, -0.414336503f, -0.414685488f, -0.415034413f, -0.415383309f,
+    -0.415732116f, -0.416080862f, -0.416429549f, -0.416778177f, -0.417126775f,
+    -0.417475283f, -0.417823702f, -0.418172091f, -0.418520421f, -0.418868691f,
+    -0.419216901f, -0.419565022f, -0.419913113f, -0.420261115f, -0.420609087f,
+    -0.420956969f, -0.421304792f, -0.421652555f, -0.422000259f, -0.422347903f,
+    -0.422695488f, -0.423043013f, -0.423390478f, -0.423737884f, -0.4240852f,
+    -0.424432486f, -0.424779683f, -0.425126821f, -0.425473899f, -0.425820917f,
+    -0.426167876f, -0.426514775f, -0.426861614f, -0.427208394f, -0.427555084f,
+    -0.427901745f, -0.428248316f, -0.428594828f, -0.42894128f, -0.429287672f,
+    -0.429634005f, -0.429980278f, -0.430326492f, -0.430672616f, -0.43101871f,
+    -0.431364715f, -0.43171066f, -0.432056546f, -0.432402372f, -0.432748139f,
+    -0.433093816f, -0.433439463f, -0.433785021f, -0.43413052f, -0.434475958f,
+    -0.434821337f, -0.435166657f, -0.435511887f, -0.435857087f, -0.436202198f,
+    -0.43654725f, -0.436892241f, -0.437237173f, -0.437582046f, -0.437926829f,
+    -0.438271582f, -0.438616246f, -0.43896085f, -0.439305395f, -0.43964985f,
+    -0.439994276f, -0.440338612f, -0.440682888f, -0.441027105f, -0.441371262f,
+    -0.44171536f, -0.442059368f, -0.442403346f, -0.442747235f, -0.443091065f,
+    -0.443434805f, -0.443778515f, -0.444122136f, -0.444465697f, -0.444809198f,
+    -0.44515264f, -0.445496023f, -0.445839316f, -0.446182549f, -0.446525723f,
+    -0.446868837f, -0.447211891f, -0.447554857f, -0.447897762f, -0.448240608f,
+    -0.448583394f, -0.448926091f, -0.449268758f, -0.449611336f, -0.449953854f,
+    -0.450296283f, -0.450638682f, -0.450980991f, -0.451323241f, -0.451665431f,
+    -0.452007532f, -0.452349573f, -0.452691585f, -0.453033477f, -0.45337534f,
+    -0.453717113f, -0.454058826f, -0.45440048f, -0.454742074f, -0.455083579f,
+    -0.455425024f, -0.45576641f, -0.456107736f, -0.456448972f, -0.456790149f,
+    -0.457131267f, -0.457472324f, -0.457813293f, -0.458154202f, -0.458495051f,
+    -0.45883584f, -0.45917654f, -0.459517181f, -0.459857762f, -0.460198283f,
+    -0.460538715f, -0.460879087f, -0.4612194f, -0.461559623f, -0.461899787f,
+    -0.462239891f, -0.462579936f, -0.462919891f, -0.463259786f, -0.463599622f,
+    -0.463939369f, -0.464279056f, -0.464618683f, -0.464958251f, -0.465297729f,
+    -0.465637147f, -0.465976506f, -0.466315776f, -0.466654986f, -0.466994137f,
+    -0.467333198f, -0.467672229f, -0.468011141f, -0.468350023f, -0.468688816f,
+    -0.469027549f, -0.469366223f, -0.469704807f, -0.470043331f, -0.470381796f,
+    -0.470720172f, -0.471058488f, -0.471396744f, -0.471734911f, -0.472073019f,
+    -0.472411066f, -0.472749025f, -0.473086923f, -0.473424762f, -0.473762512f,
+    -0.474100202f, -0.474437833f, -0.474775374f, -0.475112855f, -0.475450277f,
+    -0.47578761f, -0.476124883f, -0.476462096f, -0.47679922f, -0.477136284f,
+    -0.477473289f, -0.477810204f, -0.47814706f, -0.478483826f, -0.478820562f,
+    -0.47915718f, -0.479493767f, -0.479830265f, -0.480166674f, -0.480503052f,
+    -0.480839342f, -0.481175542f, -0.481511682f, -0.481847763f, -0.482183784f,
+    -0.482519716f, -0.482855558f, -0.483191371f, -0.483527064f, -0.483862728f,
+    -0.484198302f, -0.484533817f, -0.484869242f, -0.485204607f, -0.485539913f,
+    -0.48587513f, -0.486210287f, -0.486545354f, -0.486880362f, -0.48721531f,
+    -0.487550169f, -0.487884939f, -0.488219678f, -0.488554329f, -0.48888889f,
+    -0.489223391f, -0.489557832f, -0.489892185f, -0.490226477f, -0.49056071f,
+    -0.490894854f, -0.491228908f, -0.491562903f, -0.491896838f, -0.492230713f,
+    -0.49256447f, -0.492898196f, -0.493231833f, -0.49356541f, -0.493898898f,
+    -0.494232297f, -0.494565666f, -0.494898945f, -0.495232135f, -0.495565265f,
+    -0.495898306f, -0.496231288f, -0.496564209f, -0.496897042f, -0.497229815f,
+    -0.497562498f, -0.497895122f, -0.498227656f, -0.498560131f, -0.498892546f,
+    -0.499224871f, -0.499557108f, -0.499889284f, -0.500221372f, -0.500553429f,
+    -0.500885367f, -0.501217246f, -0.501549065f, -0.501880825f, -0.502212465f,
+    -0.502544045f, -0.502875566f, -0.503207028f, -0.50353837f, -0.503869653f,
+    -0.504200876f, -0.504532039f, -0.504863083f, -0.505194128f, -0.505525053f,
+    -0.505855858f, -0.506186664f, -0.506517351f, -0.506847978f, -0.507178545f,
+    -0.507508993f, -0.507839382f, -0.508169711f, -0.50849998f, -0.50883013f,
+    -0.509160221f, -0.509490252f, -0.509820223f, -0.510150075f, -0.510479927f,
+    -0.5108096f, -0.511139274f, -0.511468828f, -0.511798322f, -0.512127757f,
+    -0.512457132f, -0.512786388f, -0.513115585f, -0.513444722f, -0.513773799f,
+    -0.514102757f, -0.514431655f, -0.514760435f, -0.515089214f, -0.515417874f,
+    -0.515746474f, -0.516075015f, -0.516403437f, -0.516731799f, -0.517060101f,
+    -0.517388284f, -0.517716467f, -0.518044531f, -0.518372476f, -0.518700421f,
+    -0.519028246f, -0.519356012f, -0.519683659f, -0.520011246f, -0.520338774f,
+    -0.520666242f, -0.52099365f, -0.521320939f, -0.521648169f, -0.521975279f,
+    -0.522302389f, -0.52262938f, -0.522956252f, -0.523283124f, -0.523609877f,
+    -0.52393657f, -0.524263144f, -0.524589658f, -0.524916112f, -0.525242507f,
+    -0.525568783f, -0.525895f, -0.526221156f, -0.526547253f, -0.526873231f,
+    -0.527199149f, -0.527524948f, -0.527850747f, -0.528176427f, -0.528501987f,
+    -0.528827548f, -0.529152989f, -0.529478312f, -0.529803634f, -0.530128837f,
+    -0.53045398f, -0.530779004f, -0.531104028f, -0.531428874f, -0.531753719f,
+    -0.532078445f, -0.532403111f, -0.532727718f, -0.533052206f, -0.533376634f,
+    -0.533701003f, -0.534025252f, -0.534349442f, -0.534673572f, -0.534997642f,
+    -0.535321593f, -0.535645485f, -0.535969257f, -0.53629297f, -0.536616623f,
+    -0.536940157f, -0.537263691f, -0.537587047f, -0.537910402f, -0.538233638f,
+    -0.538556814f, -0.538879931f, -0.539202929f, -0.539525867f, -0.539848685f,
+    -0.540171444f, -0.540494144f, -0.540816784f, -0.541139305f, -0.541461766f,
+    -0.541784167f, -0.54210645f, -0.542428672f, -0.542750776f, -0.54307282f,
+    -0.543394804f, -0.543716729f, -0.544038534f, -0.54436028f, -0.544681907f,
+    -0.545003474f, -0.545324981f, -0.545646429f, -0.545967758f, -0.546288967f,
+    -0.546610177f, -0.546931267f, -0.547252297f, -0.547573209f, -0.547894061f,
+    -0.548214853f, -0.548535526f, -0.548856139f, -0.549176633f, -0.549497128f,
+    -0.549817502f, -0.550137758f, -0.550457954f, -0.550778091f, -0.551098168f,
+    -0.551418126f, -0.551737964f, -0.552057803f, -0.552377522f, -0.552697122f,
+    -0.553016722f, -0.553336203f, -0.553655565f, -0.553974867f, -0.554294109f,
+    -0.554613292f, -0.554932356f, -0.5552513f, -0.555570245f, -0.55588907f,
+    -0.556207776f, -0.556526482f, -0.556845009f, -0.557163537f, -0.557481945f,
+    -0.557800293f, -0.558118522f, -0.558436692f, -0.558754802f, -0.559072793f,
+    -0.559390724f, -0.559708536f, -0.560026288f, -0.560343981f, -0.560661554f,
+    -0.560979068f, -0.561296523f, -0.561613858f, -0.561931133f, -0.56224829f,
+    -0.562565386f, -0.562882423f, -0.563199341f, -0.5635162f, -0.563832939f,
+    -0.564149618f, -0.564466238f, -0.564782739f, -0.56509918f, -0.565415561f,
+    -0.565731823f, -0.566047966f, -0.56636411f, -0.566680133f, -0.566996038f,
+    -0.567311883f, -0.567627668f, -0.567943335f, -0.568258941f, -0.568574488f,
+    -0.568889916f, -0.569205225f, -0.569520533f, -0.569835722f, -0.570150793f,
+    -0.570465803f, -0.570780754f, -0.571095586f, -0.571410358f, -0.571725011f,
+    -0.572039604f, -0.572354138f, -0.572668552f, -0.572982907f, -0.573297143f,
+    -0.573611319f, -0.573925436f, -0.574239433f, -0.57455337f, -0.574867189f,
+    -0.575180948f, -0.575494587f, -0.575808167f, -0.576121688f, -0.576435089f,
+    -0.576748431f, -0.577061653f, -0.577374816f, -0.577687919f, -0.578000903f,
+    -0.578313768f, -0.578626633f, -0.578939319f, -0.579252005f, -0.579564571f,
+    -0.579877019f, -0.580189407f, -0.580501735f, -0.580813944f, -0.581126094f,
+    -0.581438124f, -0.581750095f, -0.582062006f, -0.582373798f, -0.582685471f,
+    -0.582997143f, -0.583308637f, -0.583620131f, -0.583931446f, -0.584242761f,
+    -0.584553957f, -0.584865034f, -0.585176051f, -0.585487008f, -0.585797846f,
+    -0.586108625f, -0.586419284f, -0.586729884f, -0.587040365f, -0.587350786f,
+    -0.587661147f, -0.587971389f, -0.588281572f, -0.588591635f, -0.588901579f,
+    -0.589211524f, -0.589521289f, -0.589831054f, -0.5901407f, -0.590450227f,
+    -0.590759695f, -0.591069102f, -0.591378391f, -0.59168756f, -0.59199667f,
+    -0.59230572f, -0.592614651f, -0.592923522f, -0.593232274f, -0.593540967f,
+    -0.593849599f, -0.594158053f, -0.594466507f, -0.594774842f, -0.595083058f,
+    -0.595391214f, -0.59569931f, -0.596007288f, -0.596315205f, -0.596623003f,
+    -0.596930683f, -0.597238362f, -0.597545862f, -0.597853363f, -0.598160684f,
+    -0.598468006f, -0.598775208f, -0.599082291f, -0.599389315f, -0.599696219f,
+    -0.600003064f, -0.600309789f, -0.600616455f, -0.600923061f, -0.601229548f,
+    -0.601535916f, -0.601842225f, -0.602148473f, -0.602454603f, -0.602760673f,
+    -0.603066623f, -0.603372455f, -0.603678226f, -0.603983939f, -0.604289532f,
+    -0.604595065f, -0.604900479f, -0.605205774f, -0.605511069f, -0.605816185f,
+    -0.606121242f, -0.606426239f, -0.606731117f, -0.607035935f, -0.607340634f,
+    -0.607645273f, -0.607949793f, -0.608254254f, -0.608558595f, -0.608862817f,
+    -0.609167039f, -0.609471083f, -0.609775066f, -0.61007899f, -0.610382795f,
+    -0.610686541f, -0.610990167f, -0.611293733f, -0.61159718f, -0.611900508f,
+    -0.612203777f, -0.612506986f, -0.612810075f, -0.613113105f, -0.613416016f,
+    -0.613718808f, -0.61402154f, -0.614324212f, -0.614626765f, -0.614929199f,
+    -0.615231574f, -0.615533888f, -0.615836084f, -0.61613816f, -0.616440177f,
+    -0.616742074f, -0.617043912f, -0.617345631f, -0.61764729f, -0.61794889f,
+    -0.61825031f, -0.618551731f, -0.618852973f, -0.619154155f, -0.619455278f,
+    -0.619756281f, -0.620057225f, -0.62035805f, -0.620658755f, -0.620959401f,
+    -0.621259987f, -0.621560454f, -0.621860802f, -0.62216109f, -0.622461259f,
+    -0.622761369f, -0.623061359f, -0.62336129f, -0.623661101f, -0.623960853f,
+    -0.624260485f, -0.624560058f, -0.624859512f, -0.625158846f, -0.625458121f,
+    -0.625757277f, -0.626056373f, -0.62635541f, -0.626654267f, -0.626953125f,
+    -0.627251804f, -0.627550423f, -0.627848983f, -0.628147423f, -0.628445745f,
+    -0.628744006f, -0.629042208f, -0.629340231f, -0.629638255f, -0.629936099f,
+    -0.630233943f, -0.630531609f, -0.630829215f, -0.631126761f, -0.631424189f,
+    -0.631721497f, -0.632018745f, -0.632315874f, -0.632612944f, -0.632909894f,
+    -0.633206785f, -0.633503556f, -0.633800209f, -0.634096801f, -0.634393275f,
+    -0.634689689f, -0.634985983f, -0.635282218f, -0.635578334f, -0.635874331f,
+    -0.636170268f, -0.636466146f, -0.636761844f, -0.637057483f, -0.637353063f,
+    -0.637648523f, -0.637943923f, -0.638239205f, -0.638534367f, -0.63882947f,
+    -0.639124453f, -0.639419317f, -0.639714181f, -0.640008867f, -0.640303493f,
+    -0.640597999f, -0.640892446f, -0.641186774f, -0.641481042f, -0.641775131f,
+    -0.642069221f, -0.642363191f, -0.642657042f, -0.642950833f, -0.643244505f,
+    -0.643538058f, -0.643831551f, -0.644124925f, -0.64441824f, -0.644711435f,
+    -0.645004511f, -0.645297527f, -0.645590484f, -0.645883262f, -0.64617604f,
+    -0.646468639f, -0.646761179f, -0.647053599f, -0.64734596f, -0.647638202f,
+    -0.647930384f, -0.648222446f, -0.64851439f, -0.648806274f, -0.649098039f,
+    -0.649389744f, -0.64968133f, -0.649972796f, -0.650264204f, -0.650555491f,
+    -0.65084666f, -0.651137769f, -0.651428819f, -0.651719689f, -0.65201056f,
+    -0.652301252f, -0.652591884f, -0.652882397f, -0.653172851f, -0.653463185f,
+    -0.6537534f, -0.654043555f, -0.654333591f, -0.654623568f, -0.654913425f,
+    -0.655203164f, -0.655492842f, -0.655782402f, -0.656071901f, -0.656361282f,
+    -0.656650543f, -0.656939745f, -0.657228827f, -0.657517791f, -0.657806695f,
+    -0.658095479f, -0.658384204f, -0.65867281f, -0.658961296f, -0.659249723f,
+    -0.659538031f, -0.659826219f, -0.660114348f, -0.660402358f, -0.660690308f,
+    -0.660978138f, -0.66126585f, -0.661553442f, -0.661840975f, -0.662128448f,
+    -0.662415802f, -0.662703037f, -0.662990153f, -0.663277209f, -0.663564146f,
+    -0.663851023f, -0.664137781f, -0.664424419f, -0.664710999f, -0.664997458f,
+    -0.665283799f, -0.66557008f, -0.665856242f, -0.666142285f, -0.666428268f,
+    -0.666714132f, -0.666999936f, -0.667285621f, -0.667571187f, -0.667856634f,
+    -0.668142021f, -0.668427348f, -0.668712497f, -0.668997586f, -0.669282615f,
+    -0.669567466f, -0.669852257f, -0.670136988f, -0.670421541f, -0.670706034f,
+    -0.670990467f, -0.671274781f, -0.671558976f, -0.671843052f, -0.672127068f,
+    -0.672410965f, -0.672694743f, -0.672978461f, -0.67326206f, -0.673545599f,
+    -0.673829019f, -0.67411232f, -0.674395502f, -0.674678624f, -0.674961627f,
+    -0.67524457f, -0.675527394f, -0.675810099f, -0.676092684f, -0.67637521f,
+    -0.676657617f, -0.676939964f, -0.677222192f, -0.677504301f, -0.677786291f,
+    -0.678068221f, -0.678350031f, -0.678631783f, -0.678913355f, -0.679194927f,
+    -0.679476321f, -0.679757655f, -0.680038869f, -0.680319965f, -0.680601001f,
+    -0.680881917f, -0.681162715f, -0.681443453f, -0.681724072f, -0.682004571f,
+    -0.682285011f, -0.682565331f, -0.682845533f, -0.683125675f, -0.683405697f,
+    -0.683685601f, -0.683965385f, -0.68424511f, -0.684524715f, -0.684804261f,
+    -0.685083687f, -0.685362995f, -0.685642183f, -0.685921311f, -0.686200321f,
+    -0.686479211f, -0.686758041f, -0.687036753f, -0.687315345f, -0.687593818f,
+    -0.687872231f, -0.688150525f, -0.68842876f, -0.688706875f, -0.688984871f,
+    -0.689262748f, -0.689540565f, -0.689818263f, -0.690095842f, -0.690373302f,
+    -0.690650702f, -0.690927982f, -0.691205204f, -0.691482246f, -0.691759229f,
+    -0.692036152f, -0.692312896f, -0.692589581f, -0.692866147f, -0.693142653f,
+    -0.693419039f, -0.693695307f, -0.693971455f, -0.694247544f, -0.694523513f,
+    -0.694799364f, -0.695075095f, -0.695350766f, -0.695626318f, -0.695901752f,
+    -0.696177125f, -0.696452379f, -0.696727514f, -0.69700259f, -0.697277486f,
+    -0.697552323f, -0.697827101f, -0.698101699f, -0.698376238f, -0.698650658f,
+    -0.698925018f, -0.6991992f, -0.699473321f, -0.699747384f, -0.700021267f,
+    -0.700295091f, -0.700568795f, -0.700842381f, -0.701115906f, -0.701389313f,
+    -0.7016626f, -0.701935768f, -0.702208877f, -0.702481866f, -0.702754736f,
+    -0.703027546f, -0.703300178f, -0.70357275f, -0.703845263f, -0.704117596f,
+    -0.70438987f, -0.704662025f, -0.704934061f, -0.705206037f, -0.705477893f,
+    -0.705749631f, -0.706021249f, -0.706292808f, -0.706564248f, -0.706835568f,
+    -0.707106769f, -0.707377911f, -0.707648933f, -0.707919836f, -0.70819062f,
+    -0.708461344f, -0.708731949f, -0.709002435f, -0.709272802f, -0.709543109f,
+    -0.709813297f, -0.710083365f, -0.710353374f, -0.710623205f, -0.710892975f,
+    -0.711162627f, -0.711432219f, -0.711701632f, -0.711970985f, -0.712240219f,
+    -0.712509394f, -0.712778389f, -0.713047326f, -0.713316143f, -0.71358484f,
+    -0.713853478f, -0.714121997f, -0.714390397f, -0.714658678f, -0.714926898f,
+    -0.715194941f, -0.715462923f, -0.715730846f, -0.71599859f, -0.716266274f,
+    -0.71653384f, -0.716801286f, -0.717068613f, -0.71733588f, -0.717603028f,
+    -0.717870057f, -0.718136966f, -0.718403816f, -0.718670487f, -0.718937099f,
+    -0.719203651f, -0.719470024f, -0.719736338f, -0.720002532f, -0.720268607f,
+    -0.720534563f, -0.720800459f, -0.721066177f, -0.721331835f, -0.721597433f,
+    -0.721862853f, -0.722128212f, -0.722393453f, -0.722658575f, -0.722923577f,
+    -0.72318846f, -0.723453283f, -0.723717988f, -0.723982573f, -0.724247098f,
+    -0.724511445f, -0.724775732f, -0.725039899f, -0.725303948f, -0.725567937f,
+    -0.725831807f, -0.726095498f, -0.726359129f, -0.726622701f, -0.726886094f,
+    -0.727149427f, -0.727412641f, -0.727675736f, -0.727938712f, -0.728201628f,
+    -0.728464365f, -0.728727043f, -0.728989601f, -0.7292521f, -0.72951442f,
+    -0.72977668f, -0.730038822f, -0.730300844f, -0.730562747f, -0.73082459f,
+    -0.731086314f, -0.731347919f, -0.731609404f, -0.73187077f, -0.732132018f,
+    -0.732393205f, -0.732654274f, -0.732915223f, -0.733176053f, -0.733436823f,
+    -0.733697414f, -0.733957946f, -0.734218359f, -0.734478652f, -0.734738886f,
+    -0.734998941f, -0.735258937f, -0.735518813f, -0.73577857f, -0.736038268f,
+    -0.736297786f, -0.736557245f, -0.736816585f, -0.737075806f, -0.737334907f,
+    -0.737593889f, -0.737852812f, -0.738111615f, -0.738370299f, -0.738628864f,
+    -0.73888731f, -0.739145696f, -0.739403903f, -0.739662051f, -0.73992008f,
+    -0.740177989f, -0.740435839f, -0.74069351f, -0.740951121f, -0.741208613f,
+    -0.741465986f, -0.741723239f, -0.741980433f, -0.742237449f, -0.742494404f,
+    -0.742751241f, -0.743007958f, -0.743264556f, -0.743521094f, -0.743777454f,
+    -0.744033754f, -0.744289935f, -0.744545996f, -0.744801939f, -0.745057762f,
+    -0.745313525f, -0.74556917f, -0.745824695f, -0.746080101f, -0.746335387f,
+    -0.746590555f, -0.746845663f, -0.747100592f, -0.747355461f, -0.747610211f,
+    -0.747864842f, -0.748119354f, -0.748373806f, -0.74862808f, -0.748882294f,
+    -0.749136388f, -0.749390364f, -0.74964422f, -0.749898016f, -0.750151634f,
+    -0.750405192f, -0.750658631f, -0.750911951f, -0.751165152f, -0.751418233f,
+    -0.751671195f, -0.751924098f, -0.752176821f, -0.752429485f, -0.75268203f,
+    -0.752934456f, -0.753186822f, -0.753439009f, -0.753691137f, -0.753943086f,
+    -0.754194975f, -0.754446745f, -0.754698396f, -0.754949927f, -0.755201399f,
+    -0.755452693f, -0.755703926f, -0.75595504f, -0.756205976f, -0.756456852f,
+    -0.756707668f, -0.756958306f, -0.757208824f, -0.757459283f, -0.757709622f,
+    -0.757959783f, -0.758209884f, -0.758459926f, -0.758709788f, -0.758959532f,
+    -0.759209216f, -0.759458721f, -0.759708166f, -0.759957492f, -0.760206699f,
+    -0.760455787f, -0.760704756f, -0.760953605f, -0.761202395f, -0.761451006f,
+    -0.761699557f, -0.761947989f, -0.762196302f, -0.762444496f, -0.762692571f,
+    -0.762940526f, -0.763188422f, -0.763436139f, -0.763683796f, -0.763931334f,
+    -0.764178753f, -0.764426053f, -0.764673233f, -0.764920294f, -0.765167236f,
+    -0.765414119f, -0.765660882f, -0.765907466f, -0.766153991f, -0.766400397f,
+    -0.766646683f, -0.76689285f, -0.767138898f, -0.767384887f, -0.767630696f,
+    -0.767876446f, -0.768122017f, -0.768367529f, -0.768612921f, -0.768858194f,
+    -0.769103348f, -0.769348383f, -0.769593298f, -0.769838154f, -0.770082831f,
+    -0.770327449f, -0.770571887f, -0.770816267f, -0.771060526f, -0.771304667f,
+    -0.771548688f, -0.771792591f, -0.772036374f, -0.772280097f, -0.772523642f,
+    -0.772767127f, -0.773010433f, -0.773253679f, -0.773496807f, -0.773739815f,
+    -0.773982704f, -0.774225473f, -0.774468124f, -0.774710655f, -0.774953127f,
+    -0.77519542f, -0.775437653f, -0.775679708f, -0.775921702f, -0.776163578f,
+    -0.776405334f, -0.776646972f, -0.77688849f, -0.777129889f, -0.777371168f,
+    -0.777612329f, -0.777853429f, -0.778094351f, -0.778335214f, -0.778575897f,
+    -0.778816521f, -0.779057026f, -0.779297352f, -0.779537618f, -0.779777765f,
+    -0.780017793f, -0.780257761f, -0.780497551f, -0.780737221f, -0.780976772f,
+    -0.781216264f, -0.781455576f, -0.781694829f, -0.781933963f, -0.782172918f,
+    -0.782411814f, -0.78265059f, -0.782889247f, -0.783127785f, -0.783366203f,
+    -0.783604503f, -0.783842683f, -0.784080803f, -0.784318745f, -0.784556568f,
+    -0.784794331f, -0.785031915f, -0.785269439f, -0.785506845f, -0.785744071f,
+    -0.785981238f, -0.786218286f, -0.786455214f, -0.786692023f, -0.786928713f,
+    -0.787165284f, -0.787401736f, -0.787638068f, -0.787874341f, -0.788110435f,
+    -0.78834641f, -0.788582325f, -0.788818061f, -0.789053738f, -0.789289236f,
+    -0.789524674f, -0.789759994f, -0.789995134f, -0.790230215f, -0.790465176f,
+    -0.790700018f, -0.790934741f, -0.791169345f, -0.79140383f, -0.791638196f,
+    -0.791872442f, -0.792106569f, -0.792340577f, -0.792574525f, -0.792808294f,
+    -0.793041945f, -0.793275535f, -0.793508947f, -0.793742299f, -0.793975472f,
+    -0.794208586f, -0.794441521f, -0.794674397f, -0.794907153f, -0.79513973f,
+    -0.795372248f, -0.795604646f, -0.795836926f, -0.796069086f, -0.796301067f,
+    -0.796532989f, -0.796764791f, -0.796996474f, -0.797228038f, -0.797459483f,
+    -0.797690868f, -0.797922075f, -0.798153162f, -0.79838413f, -0.798614979f,
+    -0.798845768f, -0.799076378f, -0.79930687f, -0.799537241f, -0.799767554f,
+    -0.799997687f, -0.800227761f, -0.800457656f, -0.800687492f, -0.800917149f,
+    -0.801146746f, -0.801376164f, -0.801605523f, -0.801834702f, -0.802063823f,
+    -0.802292824f, -0.802521646f, -0.802750409f, -0.802979052f, -0.803207517f,
+    -0.803435922f, -0.803664207f, -0.803892314f, -0.804120362f, -0.80434829f,
+    -0.804576099f, -0.804803789f, -0.805031359f, -0.805258751f, -0.805486083f,
+    -0.805713296f, -0.80594039f, -0.806167364f, -0.806394219f, -0.806620955f,
+    -0.806847572f, -0.80707407f, -0.807300448f, -0.807526708f, -0.807752848f,
+    -0.807978809f, -0.80820471f, -0.808430493f, -0.808656156f, -0.8088817f,
+    -0.809107125f, -0.80933243f, -0.809557617f, -0.809782684f, -0.810007632f,
+    -0.81023246f, -0.81045717f, -0.81068176f, -0.810906231f, -0.811130643f,
+    -0.811354876f, -0.811578989f, -0.811802983f, -0.812026858f, -0.812250614f,
+    -0.812474251f, -0.812697768f, -0.812921166f, -0.813144386f, -0.813367546f,
+    -0.813590586f, -0.813813508f, -0.81403631f, -0.814258993f, -0.814481556f,
+    -0.814704001f, -0.814926326f, -0.815148532f, -0.815370619f, -0.815592587f,
+    -0.815814435f, -0.816036105f, -0.816257715f, -0.816479206f, -0.816700578f,
+    -0.81692183f, -0.817142904f, -0.817363918f, -0.817584813f, -0.817805588f,
+    -0.818026185f, -0.818246722f, -0.81846714f, -0.818687379f, -0.818907559f,
+    -0.819127619f, -0.819347501f, -0.819567323f, -0.819786966f, -0.820006549f,
+    -0.820225954f, -0.820445299f, -0.820664465f, -0.820883572f, -0.8211025f,
+    -0.821321368f, -0.821540058f, -0.821758628f, -0.821977139f, -0.82219547f,
+    -0.822413683f, -0.822631776f, -0.82284981f, -0.823067665f, -0.823285401f,
+    -0.823503017f, -0.823720515f, -0.823937893f, -0.824155152f, -0.824372292f,
+    -0.824589312f, -0.824806213f, -0.825022995f, -0.825239599f, -0.825456142f,
+    -0.825672567f, -0.825888872f, -0.826104999f, -0.826321065f, -0.826537013f,
+    -0.826752782f, -0.826968491f, -0.827184021f, -0.827399492f, -0.827614784f,
+    -0.827829957f, -0.82804507f, -0.828260005f, -0.82847482f, -0.828689516f,
+    -0.828904092f, -0.82911855f, -0.829332948f, -0.829547107f, -0.829761207f,
+    -0.829975188f, -0.830189049f, -0.830402792f, -0.830616415f, -0.830829859f,
+    -0.831043243f, -0.831256509f, -0.831469595f, -0.831682622f, -0.831895471f,
+    -0.832108259f, -0.832320869f, -0.83253336f, -0.83274579f, -0.832958043f,
+    -0.833170176f, -0.833382189f, -0.833594084f, -0.833805859f, -0.834017515f,
+    -0.834229052f, -0.83444041f, -0.834651709f, -0.834862888f, -0.835073888f,
+    -0.835284829f, -0.835495591f, -0.835706294f, -0.835916817f, -0.836127281f,
+    -0.836337566f, -0.836547732f, -0.836757779f, -0.836967707f, -0.837177515f,
+    -0.837387204f, -0.837596774f, -0.837806225f, -0.838015497f, -0.838224709f,
+    -0.838433802f, -0.838642716f, -0.838851511f, -0.839060247f, -0.839268804f,
+    -0.839477241f, -0.839685619f, -0.839893818f, -0.840101898f, -0.840309858f,
+    -0.84051764f, -0.840725362f, -0.840932965f, -0.841140449f, -0.841347754f,
+    -0.841554999f, -0.841762066f, -0.841969013f, -0.842175901f, -0.84238261f,
+    -0.8425892f, -0.84279567f, -0.843002021f, -0.843208253f, -0.843414366f,
+    -0.8436203f, -0.843826175f, -0.84403187f, -0.844237506f, -0.844442964f,
+    -0.844648361f, -0.84485358f, -0.84505868f, -0.84526366f, -0.845468521f,
+    -0.845673263f, -0.845877886f, -0.84608233f, -0.846286714f, -0.84649092f,
+    -0.846695065f, -0.846899033f, -0.84710288f, -0.847306609f, -0.847510278f,
+    -0.847713768f, -0.84791708f, -0.848120332f, -0.848323464f, -0.848526478f,
+    -0.848729312f, -0.848932028f, -0.849134684f, -0.849337161f, -0.849539518f,
+    -0.849741757f, -0.849943876f, -0.850145876f, -0.850347757f, -0.850549459f,
+    -0.850751102f, -0.850952566f, -0.85115397f, -0.851355195f, -0.851556301f,
+    -0.851757288f, -0.851958156f, -0.852158904f, -0.852359533f, -0.852559984f,
+    -0.852760375f, -0.852960587f, -0.853160739f, -0.853360713f, -0.853560567f,
+    -0.853760302f, -0.853959918f, -0.854159415f, -0.854358733f, -0.854557991f,
+    -0.854757071f, -0.85495609f, -0.855154932f, -0.855353653f, -0.855552256f,
+    -0.85575074f, -0.855949104f, -0.856147349f, -0.856345415f, -0.856543422f,
+    -0.85674125f, -0.856938958f, -0.857136548f, -0.857334018f, -0.857531369f,
+    -0.857728601f, -0.857925713f, -0.858122647f, -0.858319521f, -0.858516216f,
+    -0.858712792f, -0.858909249f, -0.859105587f, -0.859301805f, -0.859497905f,
+    -0.859693885f, -0.859889686f, -0.860085368f, -0.860280991f, -0.860476434f,
+    -0.860671759f, -0.860866964f, -0.86106199f, -0.861256957f, -0.861451745f,
+    -0.861646473f, -0.861841023f, -0.862035453f, -0.862229764f, -0.862423956f,
+    -0.862618029f, -0.862811923f, -0.863005757f, -0.863199413f, -0.863392949f,
+    -0.863586366f, -0.863779664f, -0.863972843f, -0.864165902f, -0.864358783f,
+    -0.864551604f, -0.864744246f, -0.864936769f, -0.865129173f, -0.865321457f,
+    -0.865513623f, -0.865705669f, -0.865897536f, -0.866089284f, -0.866280973f,
+    -0.866472483f, -0.866663873f, -0.866855085f, -0.867046237f, -0.86723727f,
+    -0.867428124f, -0.867618859f, -0.867809474f, -0.867999971f, -0.868190348f,
+    -0.868380606f, -0.868570685f, -0.868760705f, -0.868950546f, -0.869140267f,
+    -0.86932987f, -0.869519353f, -0.869708657f, -0.869897902f, -0.870086968f,
+    -0.870275974f, -0.870464802f, -0.87065351f, -0.87084204f, -0.871030509f,
+    -0.87121886f, -0.871407032f, -0.871595085f, -0.871783018f, -0.871970832f,
+    -0.872158527f, -0.872346044f, -0.8725335f, -0.872720778f, -0.872907937f,
+    -0.873094976f, -0.873281896f, -0.873468697f, -0.873655319f, -0.873841822f,
+    -0.874028265f, -0.87421453f, -0.874400616f, -0.874586642f, -0.874772549f,
+    -0.874958277f, -0.875143886f, -0.875329375f, -0.875514746f, -0.875699997f,
+    -0.875885129f, -0.876070082f, -0.876254916f, -0.876439691f, -0.876624286f,
+    -0.876808703f, -0.87699306f, -0.877177238f, -0.877361357f, -0.877545297f,
+    -0.877729118f, -0.877912819f, -0.878096342f, -0.878279805f, -0.878463089f,
+    -0.878646255f, -0.8788293f, -0.879012227f, -0.879195035f, -0.879377663f,
+    -0.879560173f, -0.879742622f, -0.879924834f, -0.880106986f, -0.880289018f,
+    -0.880470872f, -0.880652666f, -0.880834281f, -0.881015778f, -0.881197095f,
+    -0.881378353f, -0.881559432f, -0.881740451f, -0.881921291f, -0.882101953f,
+    -0.882282555f, -0.882463038f, -0.882643342f, -0.882823527f, -0.883003592f,
+    -0.883183539f, -0.883363366f, -0.883543015f, -0.883722544f, -0.883901954f,
+    -0.884081244f, -0.884260416f, -0.884439468f, -0.884618342f, -0.884797096f,
+    -0.884975731f, -0.885154247f, -0.885332584f, -0.885510862f, -0.885688961f,
+    -0.88586694f, -0.8860448f, -0.886222541f, -0.886400104f, -0.886577606f,
+    -0.88675493f, -0.886932135f, -0.88710916f, -0.887286127f, -0.887462914f,
+    -0.887639642f, -0.887816191f, -0.887992561f, -0.888168871f, -0.888345063f,
+    -0.888521075f, -0.888696969f, -0.888872743f, -0.889048338f, -0.889223874f,
+    -0.88939923f, -0.889574468f, -0.889749587f, -0.889924586f, -0.890099406f,
+    -0.890274107f, -0.890448749f, -0.890623152f, -0.890797496f, -0.89097172f,
+    -0.891145766f, -0.891319692f, -0.891493499f, -0.891667187f, -0.891840696f,
+    -0.892014146f, -0.892187417f, -0.892360568f, -0.892533541f, -0.892706454f,
+    -0.892879188f, -0.893051803f, -0.893224299f, -0.893396676f, -0.893568873f,
+    -0.893740952f, -0.893912971f, -0.894084752f, -0.894256473f, -0.894428074f,
+    -0.894599497f, -0.894770801f, -0.894941986f, -0.895112991f, -0.895283937f,
+    -0.895454705f, -0.895625353f, -0.895795882f, -0.895966232f, -0.896136522f,
+    -0.896306634f, -0.896476626f, -0.8966465f, -0.896816194f, -0.896985769f,
+    -0.897155225f, -0.897324562f, -0.89749378f, -0.897662818f, -0.897831798f,
+    -0.898000598f, -0.898169279f, -0.898337781f, -0.898506165f, -0.898674488f,
+    -0.898842633f, -0.899010599f, -0.899178505f, -0.899346232f, -0.899513841f,
+    -0.89968133f, -0.8998487f, -0.900015891f, -0.900182962f, -0.900349915f,
+    -0.900516748f, -0.900683403f, -0.900849998f, -0.901016414f, -0.901182711f,
+    -0.901348829f, -0.901514888f, -0.901680768f, -0.901846528f, -0.902012169f,
+    -0.902177632f, -0.902342975f, -0.902508199f, -0.902673304f, -0.90283829f,
+    -0.903003097f, -0.903167784f, -0.903332353f, -0.903496802f, -0.903661072f,
+    -0.903825283f, -0.903989315f, -0.904153168f, -0.904316962f, -0.904480577f,
+    -0.904644072f, -0.904807448f, -0.904970706f, -0.905133784f, -0.905296743f,
+    -0.905459583f, -0.905622303f, -0.905784845f, -0.905947268f, -0.906109571f,
+    -0.906271756f, -0.906433821f, -0.906595707f, -0.906757474f, -0.906919122f,
+    -0.907080591f, -0.907242f, -0.907403231f, -0.907564342f, -0.907725275f,
+    -0.907886088f, -0.908046842f, -0.908207357f, -0.908367813f, -0.90852809f,
+    -0.908688307f, -0.908848345f, -0.909008205f, -0.909168005f, -0.909327626f,
+    -0.909487128f, -0.909646451f, -0.909805715f, -0.9099648f, -0.910123765f,
+    -0.910282612f, -0.910441279f, -0.910599828f, -0.910758257f, -0.910916567f,
+    -0.911074758f, -0.911232769f, -0.911390662f, -0.911548436f, -0.91170603f,
+    -0.911863506f, -0.912020862f, -0.912178099f, -0.912335157f, -0.912492156f,
+    -0.912648976f, -0.912805617f, -0.912962198f, -0.913118601f, -0.913274884f,
+    -0.913431048f, -0.913587034f, -0.9137429f, -0.913898647f, -0.914054275f,
+    -0.914209783f, -0.914365113f, -0.914520323f, -0.914675355f, -0.914830327f,
+    -0.91498512f, -0.915139794f, -0.91529429f, -0.915448725f, -0.915602982f,
+    -0.91575712f, -0.915911078f, -0.916064978f, -0.916218698f, -0.916372299f,
+    -0.916525722f, -0.916679084f, -0.916832268f, -0.916985273f, -0.917138219f,
+    -0.917290986f, -0.917443633f, -0.917596161f, -0.917748511f, -0.917900801f,
+    -0.918052912f, -0.918204844f, -0.918356717f, -0.91850841f, -0.918659985f,
+    -0.918811381f, -0.918962717f, -0.919113874f, -0.919264853f, -0.919415772f,
+    -0.919566512f, -0.919717133f, -0.919867635f, -0.920017958f, -0.920168221f,
+    -0.920318305f, -0.920468211f, -0.920618057f, -0.920767725f, -0.920917213f,
+    -0.921066642f, -0.921215892f, -0.921365023f, -0.921514034f, -0.921662927f,
+    -0.92181164f, -0.921960235f, -0.92210865f, -0.922257006f, -0.922405183f,
+    -0.922553241f, -0.92270112f, -0.92284888f, -0.922996521f, -0.923144042f,
+    -0.923291445f, -0.923438668f, -0.923585773f, -0.923732698f, -0.923879504f,
+    -0.924026251f, -0.924172759f, -0.924319208f, -0.924465477f, -0.924611628f,
+    -0.9247576f, -0.924903512f, -0.925049245f, -0.92519486f, -0.925340295f,
+    -0.925485611f, -0.925630808f, -0.925775886f, -0.925920784f, -0.926065564f,
+    -0.926210225f, -0.926354766f, -0.926499128f, -0.926643372f, -0.926787496f,
+    -0.926931441f, -0.927075267f, -0.927218974f, -0.927362502f, -0.92750597f,
+    -0.92764926f, -0.92779237f, -0.927935421f, -0.928078294f, -0.928220987f,
+    -0.928363621f, -0.928506076f, -0.928648412f, -0.928790629f, -0.928932667f,
+    -0.929074585f, -0.929216385f, -0.929358006f, -0.929499507f, -0.929640889f,
+    -0.929782152f, -0.929923236f, -0.930064201f, -0.930205047f, -0.930345714f,
+    -0.930486262f, -0.93062669f, -0.93076694f, -0.93090713f, -0.931047082f,
+    -0.931186974f, -0.931326687f, -0.931466281f, -0.931605756f, -0.931745052f,
+    -0.931884289f, -0.932023287f, -0.932162225f, -0.932300985f, -0.932439625f,
+    -0.932578146f, -0.932716489f, -0.932854712f, -0.932992816f, -0.933130741f,
+    -0.933268547f, -0.933406234f, -0.933543801f, -0.93368119f, -0.93381846f,
+    -0.93395555f, -0.934092522f, -0.934229374f, -0.934366107f, -0.934502721f,
+    -0.934639156f, -0.934775412f, -0.934911609f, -0.935047626f, -0.935183525f,
+    -0.935319245f, -0.935454845f, -0.935590327f, -0.935725689f, -0.935860872f,
+    -0.935995936f, -0.936130881f, -0.936265647f, -0.936400294f, -0.936534822f,
+    -0.93666923f, -0.93680346f, -0.936937571f, -0.937071502f, -0.937205315f,
+    -0.937339008f, -0.937472582f, -0.937605977f, -0.937739253f, -0.93787235f,
+    -0.938005388f, -0.938138247f, -0.938270926f, -0.938403547f, -0.938535988f,
+    -0.938668311f, -0.938800454f, -0.938932478f, -0.939064384f, -0.93919611f,
+    -0.939327717f, -0.939459205f, -0.939590573f, -0.939721763f, -0.939852834f,
+    -0.939983726f, -0.940114558f, -0.940245211f, -0.940375686f, -0.940506041f,
+    -0.940636277f, -0.940766394f, -0.940896332f, -0.941026151f, -0.941155851f,
+    -0.941285372f, -0.941414773f, -0.941544056f, -0.941673219f, -0.941802204f,
+    -0.941931009f, -0.942059755f, -0.942188323f, -0.942316771f, -0.94244504f,
+    -0.94257319f, -0.942701221f, -0.942829072f, -0.942956865f, -0.943084419f,
+    -0.943211913f, -0.943339229f, -0.943466425f, -0.943593442f, -0.943720341f,
+    -0.94384712f, -0.94397378f, -0.944100261f, -0.944226623f, -0.944352806f,
+    -0.944478929f, -0.944604814f, -0.944730639f, -0.944856286f, -0.944981813f,
+    -0.945107222f, -0.945232451f, -0.945357561f, -0.945482492f, -0.945607305f,
+    -0.945731997f, -0.945856571f, -0.945980966f, -0.946105242f, -0.946229339f,
+    -0.946353376f, -0.946477175f, -0.946600914f, -0.946724474f, -0.946847916f,
+    -0.946971238f, -0.947094381f, -0.947217405f, -0.94734025f, -0.947462976f,
+    -0.947585583f, -0.94770807f, -0.947830379f, -0.947952569f, -0.948074579f,
+    -0.948196471f, -0.948318243f, -0.948439896f, -0.94856137f, -0.948682666f,
+    -0.948803902f, -0.948924959f, -0.949045897f, -0.949166656f, -0.949287295f,
+    -0.949407816f, -0.949528158f, -0.94964838f, -0.949768484f, -0.949888468f,
+    -0.950008273f, -0.9501279f, -0.950247467f, -0.950366855f, -0.950486064f,
+    -0.950605154f, -0.950724125f, -0.950842977f, -0.950961649f, -0.951080203f,
+    -0.951198637f, -0.951316893f, -0.95143503f, -0.951552987f, -0.951670885f,
+    -0.951788545f, -0.951906145f, -0.952023566f, -0.952140868f, -0.952257991f,
+    -0.952374995f, -0.952491879f, -0.952608585f, -0.952725172f, -0.95284164f,
+    -0.952957928f, -0.953074098f, -0.953190148f, -0.953306019f, -0.953421772f,
+    -0.953537405f, -0.953652859f, -0.953768194f, -0.95388335f, -0.953998446f,
+    -0.954113305f, -0.954228103f, -0.954342723f, -0.954457223f, -0.954571545f,
+    -0.954685748f, -0.954799831f, -0.954913735f, -0.955027521f, -0.955141187f,
+    -0.955254674f, -0.955368042f, -0.955481231f, -0.955594361f, -0.955707252f,
+    -0.955820084f, -0.955932736f, -0.95604527f, -0.956157625f, -0.95626986f,
+    -0.956381977f, -0.956493914f, -0.956605732f, -0.956717432f, -0.956828952f,
+    -0.956940353f, -0.957051575f, -0.957162678f, -0.957273662f, -0.957384527f,
+    -0.957495213f, -0.95760572f, -0.957716167f, -0.957826436f, -0.957936525f,
+    -0.958046496f, -0.958156347f, -0.958266079f, -0.958375633f, -0.958485067f,
+    -0.958594322f, -0.958703458f, -0.958812475f, -0.958921313f, -0.959030032f,
+    -0.959138632f, -0.959247053f, -0.959355354f, -0.959463477f, -0.95957154f,
+    -0.959679365f, -0.95978713f, -0.959894717f, -0.960002124f, -0.960109472f,
+    -0.960216641f, -0.960323632f, -0.960430503f, -0.960537255f, -0.960643888f,
+    -0.960750341f, -0.960856616f, -0.960962832f, -0.961068869f, -0.961174726f,
+    -0.961280465f, -0.961386085f, -0.961491585f, -0.961596906f, -0.961702049f,
+    -0.961807132f, -0.961912036f, -0.962016761f, -0.962121427f, -0.962225854f,
+    -0.962330222f, -0.962434411f, -0.962538481f, -0.962642372f, -0.962746143f,
+    -0.962849796f, -0.962953269f, -0.963056624f, -0.9631598f, -0.963262856f,
+    -0.963365793f, -0.963468552f, -0.963571191f, -0.963673711f, -0.963776052f,
+    -0.963878274f, -0.963980377f, -0.964082301f, -0.964184046f, -0.964285731f,
+    -0.964387238f, -0.964488566f, -0.964589775f, -0.964690864f, -0.964791834f,
+    -0.964892626f, -0.964993238f, -0.965093791f, -0.965194106f, -0.965294361f,
+    -0.965394437f, -0.965494394f, -0.965594172f, -0.965693831f, -0.965793371f,
+    -0.965892732f, -0.965991974f, -0.966091037f, -0.966189981f, -0.966288805f,
+    -0.966387451f, -0.966485977f, -0.966584384f, -0.966682613f, -0.966780722f,
+    -0.966878653f, -0.966976464f, -0.967074156f, -0.967171669f, -0.967269063f,
+    -0.967366278f, -0.967463374f, -0.967560351f, -0.967657149f, -0.967753828f,
+    -0.967850387f, -0.967946768f, -0.968043029f, -0.968139112f, -0.968235075f,
+    -0.96833086f, -0.968426585f, -0.968522072f, -0.968617499f, -0.968712747f,
+    -0.968807817f, -0.968902826f, -0.968997598f, -0.969092309f, -0.969186842f,
+    -0.969281256f, -0.969375491f, -0.969469607f, -0.969563544f, -0.969657362f,
+    -0.96975106f, -0.96984458f, -0.96993798f, -0.970031261f, -0.970124364f,
+    -0.970217347f, -0.970310152f, -0.970402837f, -0.970495403f, -0.97058779f,
+    -0.970680058f, -0.970772147f, -0.970864117f, -0.970955908f, -0.97104764f,
+    -0.971139133f, -0.971230567f, -0.971321821f, -0.971412897f, -0.971503913f,
+    -0.971594691f, -0.97168541f, -0.971775949f, -0.97186631f, -0.971956611f,
+    -0.972046733f, -0.972136676f, -0.972226501f, -0.972316206f, -0.972405732f,
+    -0.972495139f, -0.972584367f, -0.972673476f, -0.972762465f, -0.972851276f,
+    -0.972939968f, -0.973028481f, -0.973116875f, -0.973205149f, -0.973293245f,
+    -0.973381221f, -0.973469019f, -0.973556697f, -0.973644257f, -0.973731637f,
+    -0.973818898f, -0.973905981f, -0.973992944f, -0.974079788f, -0.974166453f,
+    -0.974252999f, -0.974339366f, -0.974425614f, -0.974511743f, -0.974597692f,
+    -0.974683523f, -0.974769175f, -0.974854708f, -0.974940121f, -0.975025356f,
+    -0.975110471f, -0.975195408f, -0.975280225f, -0.975364864f, -0.975449383f,
+    -0.975533783f, -0.975618005f, -0.975702107f, -0.97578609f, -0.975869894f,
+    -0.975953579f, -0.976037085f, -0.976120472f, -0.97620368f, -0.976286769f,
+    -0.976369739f, -0.976452529f, -0.976535201f, -0.976617694f, -0.976700068f,
+    -0.976782322f, -0.976864398f, -0.976946354f, -0.977028131f, -0.97710979f,
+    -0.977191329f, -0.977272689f, -0.977353871f, -0.977434993f, -0.977515936f,
+    -0.9775967f, -0.977677345f, -0.977757871f, -0.977838218f, -0.977918446f,
+    -0.977998495f, -0.978078425f, -0.978158236f, -0.978237867f, -0.97831738f,
+    -0.978396714f, -0.978475928f, -0.978555024f, -0.97863394f, -0.978712678f,
+    -0.978791356f, -0.978869855f, -0.978948176f, -0.979026377f, -0.979104459f,
+    -0.979182363f, -0.979260147f, -0.979337752f, -0.979415238f, -0.979492545f,
+    -0.979569793f, -0.979646802f, -0.979723752f, -0.979800463f, -0.979877114f,
+    -0.979953587f, -0.980029881f, -0.980106115f, -0.980182111f, -0.980258048f,
+    -0.980333805f, -0.980409384f, -0.980484843f, -0.980560184f, -0.980635345f,
+    -0.980710387f, -0.980785251f, -0.980859995f, -0.98093462f, -0.981009066f,
+    -0.981083393f, -0.981157541f, -0.98123157f, -0.98130548f, -0.981379211f,
+    -0.981452763f, -0.981526256f, -0.98159951f, -0.981672704f, -0.98174572f,
+    -0.981818557f, -0.981891274f, -0.981963873f, -0.982036293f, -0.982108593f,
+    -0.982180715f, -0.982252717f, -0.9823246f, -0.982396305f, -0.98246789f,
+    -0.982539296f, -0.982610583f, -0.982681692f, -0.982752681f, -0.982823551f,
+    -0.982894242f, -0.982964814f, -0.983035207f, -0.983105481f, -0.983175635f,
+    -0.983245611f, -0.983315408f, -0.983385086f, -0.983454645f, -0.983524024f,
+    -0.983593285f, -0.983662426f, -0.983731389f, -0.983800232f, -0.983868897f,
+    -0.983937442f, -0.984005809f, -0.984074056f, -0.984142125f, -0.984210074f,
+    -0.984277904f, -0.984345555f, -0.984413087f, -0.984480441f, -0.984547675f,
+    -0.984614789f, -0.984681726f, -0.984748483f, -0.98481518f, -0.984881639f,
+    -0.984948039f, -0.98501426f, -0.985080302f, -0.985146224f, -0.985212028f,
+    -0.985277653f, -0.985343158f, -0.985408485f, -0.985473692f, -0.985538721f,
+    -0.985603631f, -0.985668421f, -0.985733032f, -0.985797524f, -0.985861838f,
+    -0.985926032f, -0.985990047f, -0.986053944f, -0.986117721f, -0.986181319f,
+    -0.986244798f, -0.986308098f, -0.986371279f, -0.986434281f, -0.986497164f,
+    -0.986559927f, -0.986622512f, -0.986684918f, -0.986747265f, -0.986809373f,
+    -0.986871421f, -0.986933291f, -0.986994982f, -0.987056553f, -0.987118006f,
+    -0.987179279f, -0.987240434f, -0.987301409f, -0.987362266f, -0.987422943f,
+    -0.987483501f, -0.987543941f, -0.987604201f, -0.987664342f, -0.987724304f,
+    -0.987784147f, -0.987843812f, -0.987903357f, -0.987962782f, -0.988022029f,
+    -0.988081098f, -0.988140106f, -0.988198876f, -0.988257587f, -0.988316119f,
+    -0.988374472f, -0.988432705f, -0.98849082f, -0.988548756f, -0.988606513f,
+    -0.98866421f, -0.988721669f, -0.988779068f, -0.988836288f, -0.98889333f,
+    -0.988950253f, -0.989007056f, -0.98906368f, -0.989120185f, -0.989176512f,
+    -0.989232719f, -0.989288747f, -0.989344656f, -0.989400446f, -0.989456058f,
+    -0.98951149f, -0.989566863f, -0.989621997f, -0.989677072f, -0.989731967f,
+    -0.989786685f, -0.989841282f, -0.989895701f, -0.989950061f, -0.990004182f,
+    -0.990058184f, -0.990112066f, -0.99016583f, -0.990219355f, -0.99027282f,
+    -0.990326107f, -0.990379214f, -0.990432262f, -0.990485072f, -0.990537763f,
+    -0.990590334f, -0.990642786f, -0.990695f, -0.990747154f, -0.990799129f,
+    -0.990850925f, -0.990902662f, -0.990954161f, -0.99100554f, -0.9910568f,
+    -0.991107941f, -0.991158843f, -0.991209686f, -0.99126035f, -0.991310835f,
+    -0.99136126f, -0.991411448f, -0.991461515f, -0.991511464f, -0.991561234f,
+    -0.991610885f, -0.991660416f, -0.991709769f, -0.991758943f, -0.991807997f,
+    -0.991856933f, -0.991905689f, -0.991954327f, -0.992002785f, -0.992051125f,
+    -0.992099285f, -0.992147326f, -0.992195249f, -0.992242992f, -0.992290616f,
+    -0.992338061f, -0.992385328f, -0.992432535f, -0.992479563f, -0.992526412f,
+    -0.992573142f, -0.992619693f, -0.992666125f, -0.992712438f, -0.992758572f,
+    -0.992804587f, -0.992850423f, -0.99289614f, -0.992941678f, -0.992987096f,
+    -0.993032336f, -0.993077457f, -0.993122458f, -0.993167281f, -0.993211925f,
+    -0.993256509f, -0.993300855f, -0.993345141f, -0.993389189f, -0.993433177f,
+    -0.993476987f, -0.993520617f, -0.993564129f, -0.993607521f, -0.993650734f,
+    -0.993693769f, -0.993736744f, -0.99377948f, -0.993822157f, -0.993864655f,
+    -0.993906975f, -0.993949175f, -0.993991196f, -0.994033098f, -0.994074881f,
+    -0.994116485f, -0.99415797f, -0.994199276f, -0.994240463f, -0.994281471f,
+    -0.99432236f, -0.99436307f, -0.99440366f, -0.994444132f, -0.994484425f,
+    -0.994524539f, -0.994564593f, -0.994604409f, -0.994644165f, -0.994683683f,
+    -0.994723141f, -0.994762421f, -0.994801521f, -0.994840503f, -0.994879305f,
+    -0.994917989f, -0.994956553f, -0.994994938f, -0.995033205f, -0.995071292f,
+    -0.99510926f, -0.995147049f, -0.99518472f, -0.99522227f, -0.995259583f,
+    -0.995296836f, -0.99533391f, -0.995370865f, -0.995407641f, -0.995444238f,
+    -0.995480776f, -0.995517075f, -0.995553315f, -0.995589375f, -0.995625257f,
+    -0.99566102f, -0.995696604f, -0.995732069f, -0.995767415f, -0.995802581f,
+    -0.995837629f, -0.995872498f, -0.995907247f, -0.995941818f, -0.995976269f,
+    -0.996010542f, -0.996044695f, -0.99607873f, -0.996112585f, -0.996146262f,
+    -0.996179819f, -0.996213257f, -0.996246517f, -0.996279657f, -0.996312618f,
+    -0.99634546f, -0.996378124f, -0.996410668f, -0.996443033f, -0.996475279f,
+    -0.996507406f, -0.996539354f, -0.996571124f, -0.996602774f, -0.996634305f,
+    -0.996665657f, -0.996696889f, -0.996727943f, -0.996758878f, -0.996789694f,
+    -0.996820271f, -0.996850789f, -0.996881127f, -0.996911287f, -0.996941328f,
+    -0.99697125f, -0.997000992f, -0.997030616f, -0.997060061f, -0.997089386f,
+    -0.997118533f, -0.99714756f, -0.997176409f, -0.997205138f, -0.997233748f,
+    -0.99726218f, -0.997290432f, -0.997318566f, -0.99734658f, -0.997374415f,
+    -0.997402132f, -0.997429669f, -0.997457087f, -0.997484326f, -0.997511446f,
+    -0.997538447f, -0.99756521f, -0.997591913f, -0.997618437f, -0.997644842f,
+    -0.997671068f, -0.997697115f, -0.997723043f, -0.997748852f, -0.997774482f,
+    -0.997799993f, -0.997825325f, -0.997850537f, -0.997875631f, -0.997900546f,
+    -0.997925282f, -0.997949898f, -0.997974396f, -0.997998714f, -0.998022854f,
+    -0.998046875f, -0.998070776f, -0.998094499f, -0.998118103f, -0.998141527f,
+    -0.998164833f, -0.998188019f, -0.998211026f, -0.998233855f, -0.998256564f,
+    -0.998279154f, -0.998301566f, -0.998323798f, -0.998345912f, -0.998367906f,
+    -0.998389721f, -0.998411417f, -0.998432934f, -0.998454332f, -0.998475552f,
+    -0.998496652f, -0.998517632f, -0.998538435f, -0.998559058f, -0.998579562f,
+    -0.998599946f, -0.998620152f, -0.998640239f, -0.998660147f, -0.998679936f,
+    -0.998699546f, -0.998719037f, -0.998738348f, -0.998757541f, -0.998776555f,
+    -0.99879545f, -0.998814225f, -0.998832822f, -0.99885124f, -0.998869538f,
+    -0.998887718f, -0.998905718f, -0.9989236f, -0.998941302f, -0.998958886f,
+    -0.99897629f, -0.998993576f, -0.999010682f, -0.999027669f, -0.999044478f,
+    -0.999061167f, -0.999077737f, -0.999094129f, -0.999110341f, -0.999126494f,
+    -0.999142408f, -0.999158204f, -0.99917388f, -0.999189377f, -0.999204755f,
+    -0.999219954f, -0.999235034f, -0.999249995f, -0.999264777f, -0.99927938f,
+    -0.999293864f, -0.999308169f, -0.999322355f, -0.999336421f, -0.999350309f,
+    -0.999364078f, -0.999377668f, -0.999391139f, -0.99940443f, -0.999417603f,
+    -0.999430597f, -0.999443471f, -0.999456167f, -0.999468744f, -0.999481201f,
+    -0.99949348f, -0.999505579f, -0.99951756f, -0.999529421f, -0.999541104f,
+    -0.999552667f, -0.999564052f, -0.999575317f, -0.999586403f, -0.999597371f,
+    -0.999608159f, -0.999618828f, -0.999629319f, -0.99963969f, -0.999649942f,
+    -0.999660015f, -0.999669909f, -0.999679685f, -0.999689341f, -0.999698818f,
+    -0.999708176f, -0.999717355f, -0.999726415f, -0.999735296f, -0.999744058f,
+    -0.999752641f, -0.999761105f, -0.99976939f, -0.999777555f, -0.999785602f,
+    -0.99979347f, -0.999801159f, -0.999808729f, -0.999816179f, -0.999823451f,
+    -0.999830604f, -0.999837577f, -0.999844432f, -0.999851108f, -0.999857664f,
+    -0.999864042f, -0.9998703f, -0.99987638f, -0.99988234f, -0.999888182f,
+    -0.999893844f, -0.999899328f, -0.999904692f, -0.999909937f, -0.999915004f,
+    -0.999919951f, -0.999924719f, -0.999929309f, -0.999933839f, -0.99993813f,
+    -0.999942362f, -0.999946415f, -0.99995029f, -0.999954045f, -0.999957621f,
+    -0.999961078f, -0.999964416f, -0.999967575f, -0.999970615f, -0.999973476f,
+    -0.999976158f, -0.999978721f, -0.999981165f, -0.99998343f, -0.999985576f,
+    -0.999987602f, -0.99998939f, -0.999991119f, -0.999992669f, -0.99999404f,
+    -0.999995291f, -0.999996424f, -0.999997377f, -0.999998152f, -0.999998808f,
+    -0.999999344f, -0.999999702f, -0.99999994f, -1.0f, -0.99999994f,
+    -0.999999702f, -0.999999344f, -0.999998808f, -0.999998152f, -0.999997377f,
+    -0.999996424f, -0.999995291f, -0.99999404f, -0.999992669f, -0.999991119f,
+    -0.99998939f, -0.999987602f, -0.999985576f, -0.99998343f, -0.999981165f,
+    -0.999978721f, -0.999976158f, -0.999973476f, -0.999970615f, -0.999967575f,
+    -0.999964416f, -0.999961078f, -0.999957621f, -0.999954045f, -0.99995029f,
+    -0.999946415f, -0.999942362f, -0.99993813f, -0.999933839f, -0.999929309f,
+    -0.999924719f, -0.999919951f, -0.999915004f, -0.999909937f, -0.999904692f,
+    -0.999899328f, -0.999893844f, -0.999888182f, -0.99988234f, -0.99987638f,
+    -0.9998703f, -0.999864042f, -0.999857664f, -0.999851108f, -0.999844432f,
+    -0.999837577f, -0.999830604f, -0.999823451f, -0.999816179f, -0.999808729f,
+    -0.999801159f, -0.99979347f, -0.999785602f, -0.999777555f, -0.99976939f,
+    -0.999761105f, -0.999752641f, -0.999744058f, -0.999735296f, -0.999726415f,
+    -0.999717355f, -0.999708176f, -0.999698818f, -0.999689341f, -0.999679685f,
+    -0.999669909f, -0.999660015f, -0.999649942f, -0.99963969f, -0.999629319f,
+    -0.999618828f, -0.999608159f, -0.999597371f, -0.999586403f, -0.999575317f,
+    -0.999564052f, -0.999552667f, -0.999541104f, -0.999529421f, -0.99951756f,
+    -0.999505579f, -0.99949348f, -0.999481201f, -0.999468744f, -0.999456167f,
+    -0.999443471f, -0.999430597f, -0.999417603f, -0.99940443f, -0.999391139f,
+    -0.999377668f, -0.999364078f, -0.999350309f, -0.999336421f, -0.999322355f,
+    -0.999308169f, -0.999293864f, -0.99927938f, -0.999264777f, -0.999249995f,
+    -0.999235034f, -0.999219954f, -0.999204755f, -0.999189377f, -0.99917388f,
+    -0.999158204f, -0.999142408f, -0.999126494f, -0.999110341f, -0.999094129f,
+    -0.999077737f, -0.999061167f, -0.999044478f, -0.999027669f, -0.999010682f,
+    -0.998993576f, -0.99897629f, -0.998958886f, -0.998941302f, -0.9989236f,
+    -0.998905718f, -0.998887718f, -0.998869538f, -0.99885124f, -0.998832822f,
+    -0.998814225f, -0.99879545f, -0.998776555f, -0.998757541f, -0.998738348f,
+    -0.998719037f, -0.998699546f, -0.998679936f, -0.998660147f, -0.998640239f,
+    -0.998620152f, -0.998599946f, -0.998579562f, -0.998559058f, -0.998538435f,
+    -0.998517632f, -0.998496652f, -0.998475552f, -0.998454332f, -0.998432934f,
+    -0.998411417f, -0.998389721f, -0.998367906f, -0.998345912f, -0.998323798f,
+    -0.998301566f, -0.998279154f, -0.998256564f, -0.998233855f, -0.998211026f,
+    -0.998188019f, -0.998164833f, -0.998141527f, -0.998118103f, -0.998094499f,
+    -0.998070776f, -0.998046875f, -0.998022854f, -0.997998714f, -0.997974396f,
+    -0.997949898f, -0.997925282f, -0.997900546f, -0.997875631f, -0.997850537f,
+    -0.997825325f, -0.997799993f, -0.997774482f, -0.997748852f, -0.997723043f,
+    -0.997697115f, -0.997671068f, -0.997644842f, -0.997618437f, -0.997591913f,
+    -0.99756521f, -0.997538447f, -0.997511446f, -0.997484326f, -0.997457087f,
+    -0.997429669f, -0.997402132f, -0.997374415f, -0.99734658f, -0.997318566f,
+    -0.997290432f, -0.99726218f, -0.997233748f, -0.997205138f, -0.997176409f,
+    -0.99714756f, -0.997118533f, -0.997089386f, -0.997060061f, -0.997030616f,
+    -0.997000992f, -0.99697125f, -0.996941328f, -0.996911287f, -0.996881127f,
+    -0.996850789f, -0.996820271f, -0.996789694f, -0.996758878f, -0.996727943f,
+    -0.996696889f, -0.996665657f, -0.996634305f, -0.996602774f, -0.996571124f,
+    -0.996539354f, -0.996507406f, -0.996475279f, -0.996443033f, -0.996410668f,
+    -0.996378124f, -0.99634546f, -0.996312618f, -0.996279657f, -0.996246517f,
+    -0.996213257f, -0.996179819f, -0.996146262f, -0.996112585f, -0.99607873f,
+    -0.996044695f, -0.996010542f, -0.995976269f, -0.995941818f, -0.995907247f,
+    -0.995872498f, -0.995837629f, -0.995802581f, -0.995767415f, -0.995732069f,
+    -0.995696604f, -0.99566102f, -0.995625257f, -0.995589375f, -0.995553315f,
+    -0.995517075f, -0.995480776f, -0.995444238f, -0.995407641f, -0.995370865f,
+    -0.99533391f, -0.995296836f, -0.995259583f, -0.99522227f, -0.99518472f,
+    -0.995147049f, -0.99510926f, -0.995071292f, -0.995033205f, -0.994994938f,
+    -0.994956553f, -0.994917989f, -0.994879305f, -0.994840503f, -0.994801521f,
+    -0.994762421f, -0.994723141f, -0.994683683f, -0.994644165f, -0.994604409f,
+    -0.994564593f, -0.994524539f, -0.994484425f, -0.994444132f, -0.99440366f,
+    -0.99436307f, -0.99432236f, -0.994281471f, -0.994240463f, -0.994199276f,
+    -0.99415797f, -0.994116485f, -0.994074881f, -0.994033098f, -0.993991196f,
+    -0.993949175f, -0.993906975f, -0.993864655f, -0.993822157f, -0.99377948f,
+    -0.993736744f, -0.993693769f, -0.993650734f, -0.993607521f, -0.993564129f,
+    -0.993520617f, -0.993476987f, -0.993433177f, -0.993389189f, -0.993345141f,
+    -0.993300855f, -0.993256509f, -0.993211925f, -0.993167281f, -0.993122458f,
+    -0.993077457f, -0.993032336f, -0.992987096f, -0.992941678f, -0.99289614f,
+    -0.992850423f, -0.992804587f, -0.992758572f, -0.992712438f, -0.992666125f,
+    -0.992619693f, -0.992573142f, -0.992526412f, -0.992479563f, -0.992432535f,
+    -0.992385328f, -0.992338061f, -0.992290616f, -0.992242992f, -0.992195249f,
+    -0.992147326f, -0.992099285f, -0.992051125f, -0.992002785f, -0.991954327f,
+    -0.991905689f, -0.991856933f, -0.991807997f, -0.991758943f, -0.991709769f,
+    -0.991660416f, -0.991610885f, -0.991561234f, -0.991511464f, -0.991461515f,
+    -0.991411448f, -0.99136126f, -0.991310835f, -0.99126035f, -0.991209686f,
+    -0.991158843f, -0.991107941f, -0.9910568f, -0.99100554f, -0.990954161f,
+    -0.990902662f, -0.990850925f, -0.990799129f, -0.990747154f, -0.990695f,
+    -0.990642786f, -0.990590334f, -0.990537763f, -0.990485072f, -0.990432262f,
+    -0.990379214f, -0.990326107f, -0.99027282f, -0.990219355f, -0.99016583f,
+    -0.990112066f, -0.990058184f, -0.990004182f, -0.989950061f, -0.989895701f,
+    -0.989841282f, -0.989786685f, -0.989731967f, -0.989677072f, -0.989621997f,
+    -0.989566863f, -0.98951149f, -0.989456058f, -0.989400446f, -0.989344656f,
+    -0.989288747f, -0.989232719f, -0.989176512f, -0.989120185f, -0.98906368f,
+    -0.989007056f, -0.988950253f, -0.98889333f, -0.988836288f, -0.988779068f,
+    -0.988721669f, -0.98866421f, -0.988606513f, -0.988548756f, -0.98849082f,
+    -0.988432705f, -0.988374472f, -0.988316119f, -0.988257587f, -0.988198876f,
+    -0.988140106f, -0.988081098f, -0.988022029f, -0.987962782f, -0.987903357f,
+    -0.987843812f, -0.987784147f, -0.987724304f, -0.987664342f, -0.987604201f,
+    -0.987543941f, -0.987483501f, -0.987422943f, -0.987362266f, -0.987301409f,
+    -0.987240434f, -0.987179279f, -0.987118006f, -0.987056553f, -0.986994982f,
+    -0.986933291f, -0.986871421f, -0.986809373f, -0.986747265f, -0.986684918f,
+    -0.986622512f, -0.986559927f, -0.986497164f, -0.986434281f, -0.986371279f,
+    -0.986308098f, -0.986244798f, -0.986181319f, -0.986117721f, -0.986053944f,
+    -0.985990047f, -0.985926032f, -0.985861838f, -0.985797524f, -0.985733032f,
+    -0.985668421f, -0.985603631f, -0.985538721f, -0.985473692f, -0.985408485f,
+    -0.985343158f, -0.985277653f, -0.985212028f, -0.985146224f, -0.985080302f,
+    -0.98501426f, -0.984948039f, -0.984881639f, -0.98481518f, -0.984748483f,
+    -0.984681726f, -0.984614789f, -0.984547675f, -0.984480441f, -0.984413087f,
+    -0.984345555f, -0.984277904f, -0.984210074f, -0.984142125f, -0.984074056f,
+    -0.984005809f, -0.983937442f, -0.983868897f, -0.983800232f, -0.983731389f,
+    -0.983662426f, -0.983593285f, -0.983524024f, -0.983454645f, -0.983385086f,
+    -0.983315408f, -0.983245611f, -0.983175635f, -0.983105481f, -0.983035207f,
+    -0.982964814f, -0.982894242f, -0.982823551f, -0.982752681f, -0.982681692f,
+    -0.982610583f, -0.982539296f, -0.98246789f, -0.982396305f, -0.9823246f,
+    -0.982252717f, -0.982180715f, -0.982108593f, -0.982036293f, -0.981963873f,
+    -0.981891274f, -0.981818557f, -0.98174572f, -0.981672704f, -0.98159951f,
+    -0.981526256f, -0.981452763f, -0.981379211f, -0.98130548f, -0.98123157f,
+    -0.981157541f, -0.981083393f, -0.981009066f, -0.98093462f, -0.980859995f,
+    -0.980785251f, -0.980710387f, -0.980635345f, -0.980560184f, -0.980484843f,
+    -0.980409384f, -0.980333805f, -0.980258048f, -0.980182111f, -0.980106115f,
+    -0.980029881f, -0.979953587f, -0.979877114f, -0.979800463f, -0.979723752f,
+    -0.979646802f, -0.979569793f, -0.979492545f, -0.979415238f, -0.979337752f,
+    -0.979260147f, -0.979182363f, -0.979104459f, -0.979026377f, -0.978948176f,
+    -0.978869855f, -0.978791356f, -0.978712678f, -0.97863394f, -0.978555024f,
+    -0.978475928f, -0.978396714f, -0.97831738f, -0.978237867f, -0.978158236f,
+    -0.978078425f, -0.977998495f, -0.977918446f, -0.977838218f, -0.977757871f,
+    -0.977677345f, -0.9775967f, -0.977515936f, -0.977434993f, -0.977353871f,
+    -0.977272689f, -0.977191329f, -0.97710979f, -0.977028131f, -0.976946354f,
+    -0.976864398f, -0.976782322f, -0.976700068f, -0.976617694f, -0.976535201f,
+    -0.976452529f, -0.976369739f, -0.976286769f, -0.97620368f, -0.976120472f,
+    -0.976037085f, -0.975953579f, -0.975869894f, -0.97578609f, -0.975702107f,
+    -0.975618005f, -0.975533783f, -0.975449383f, -0.975364864f, -0.975280225f,
+    -0.975195408f, -0.975110471f, -0.975025356f, -0.974940121f, -0.974854708f,
+    -0.974769175f, -0.974683523f, -0.974597692f, -0.974511743f, -0.974425614f,
+    -0.974339366f, -0.974252999f, -0.974166453f, -0.974079788f, -0.973992944f,
+    -0.973905981f, -0.973818898f, -0.973731637f, -0.973644257f, -0.973556697f,
+    -0.973469019f, -0.973381221f, -0.973293245f, -0.973205149f, -0.973116875f,
+    -0.973028481f, -0.972939968f, -0.972851276f, -0.972762465f, -0.972673476f,
+    -0.972584367f, -0.972495139f, -0.972405732f, -0.972316206f, -0.972226501f,
+    -0.972136676f, -0.972046733f, -0.971956611f, -0.97186631f, -0.971775949f,
+    -0.97168541f, -0.971594691f, -0.971503913f, -0.971412897f, -0.971321821f,
+    -0.971230567f, -0.971139133f, -0.97104764f, -0.970955908f, -0.970864117f,
+    -0.970772147f, -0.970680058f, -0.97058779f, -0.970495403f, -0.970402837f,
+    -0.970310152f, -0.970217347f, -0.970124364f, -0.970031261f, -0.96993798f,
+    -0.96984458f, -0.96975106f, -0.969657362f, -0.969563544f, -0.969469607f,
+    -0.969375491f, -0.969281256f, -0.969186842f, -0.969092309f, -0.968997598f,
+    -0.968902826f, -0.968807817f, -0.968712747f, -0.968617499f, -0.968522072f,
+    -0.968426585f, -0.96833086f, -0.968235075f, -0.968139112f, -0.968043029f,
+    -0.967946768f, -0.967850387f, -0.967753828f, -0.967657149f, -0.967560351f,
+    -0.967463374f, -0.967366278f, -0.967269063f, -0.967171669f, -0.967074156f,
+    -0.966976464f, -0.966878653f, -0.966780722f, -0.966682613f, -0.966584384f,
+    -0.966485977f, -0.966387451f, -0.966288805f, -0.966189981f, -0.966091037f,
+    -0.965991974f, -0.965892732f, -0.965793371f, -0.965693831f, -0.965594172f,
+    -0.965494394f, -0.965394437f, -0.965294361f, -0.965194106f, -0.965093791f,
+    -0.964993238f, -0.964892626f, -0.964791834f, -0.964690864f, -0.964589775f,
+    -0.964488566f, -0.964387238f, -0.964285731f, -0.964184046f, -0.964082301f,
+    -0.963980377f, -0.963878274f, -0.963776052f, -0.963673711f, -0.963571191f,
+    -0.963468552f, -0.963365793f, -0.963262856f, -0.9631598f, -0.963056624f,
+    -0.962953269f, -0.962849796f, -0.962746143f, -0.962642372f, -0.962538481f,
+    -0.962434411f, -0.962330222f, -0.962225854f, -0.962121427f, -0.962016761f,
+    -0.961912036f, -0.961807132f, -0.961702049f, -0.961596906f, -0.961491585f,
+    -0.961386085f, -0.961280465f, -0.961174726f, -0.961068869f, -0.960962832f,
+    -0.960856616f, -0.960750341f, -0.960643888f, -0.960537255f, -0.960430503f,
+    -0.960323632f, -0.960216641f, -0.960109472f, -0.960002124f, -0.959894717f,
+    -0.95978713f, -0.959679365f, -0.95957154f, -0.959463477f, -0.959355354f,
+    -0.959247053f, -0.959138632f, -0.959030032f, -0.958921313f, -0.958812475f,
+    -0.958703458f, -0.958594322f, -0.958485067f, -0.958375633f, -0.958266079f,
+    -0.958156347f, -0.958046496f, -0.957936525f, -0.957826436f, -0.957716167f,
+    -0.95760572f, -0.957495213f, -0.957384527f, -0.957273662f, -0.957162678f,
+    -0.957051575f, -0.956940353f, -0.956828952f, -0.956717432f, -0.956605732f,
+    -0.956493914f, -0.956381977f, -0.95626986f, -0.956157625f, -0.95604527f,
+    -0.955932736f, -0.955820084f, -0.955707252f, -0.955594361f, -0.955481231f,
+    -0.955368042f, -0.955254674f, -0.955141187f, -0.955027521f, -0.954913735f,
+    -0.954799831f, -0.954685748f, -0.954571545f, -0.954457223f, -0.954342723f,
+    -0.954228103f, -0.954113305f, -0.953998446f, -0.95388335f, -0.953768194f,
+    -0.953652859f, -0.953537405f, -0.953421772f, -0.953306019f, -0.953190148f,
+    -0.953074098f, -0.952957928f, -0.95284164f, -0.952725172f, -0.952608585f,
+    -0.952491879f, -0.952374995f, -0.952257991f, -0.952140868f, -0.952023566f,
+    -0.951906145f, -0.951788545f, -0.951670885f, -0.951552987f, -0.95143503f,
+    -0.951316893f, -0.951198637f, -0.951080203f, -0.950961649f, -0.950842977f,
+    -0.950724125f, -0.950605154f, -0.950486064f, -0.950366855f, -0.950247467f,
+    -0.9501279f, -0.950008273f, -0.949888468f, -0.949768484f, -0.94964838f,
+    -0.949528158f, -0.949407816f, -0.949287295f, -0.949166656f, -0.949045897f,
+    -0.948924959f, -0.948803902f, -0.948682666f, -0.94856137f, -0.948439896f,
+    -0.948318243f, -0.948196471f, -0.948074579f, -0.947952569f, -0.947830379f,
+    -0.94770807f, -0.947585583f, -0.947462976f, -0.94734025f, -0.947217405f,
+    -0.947094381f, -0.946971238f, -0.946847916f, -0.946724474f, -0.946600914f,
+    -0.946477175f, -0.946353376f, -0.946229339f, -0.946105242f, -0.945980966f,
+    -0.945856571f, -0.945731997f, -0.945607305f, -0.945482492f, -0.945357561f,
+    -0.945232451f, -0.945107222f, -0.944981813f, -0.944856286f, -0.944730639f,
+    -0.944604814f, -0.944478929f, -0.944352806f, -0.944226623f, -0.944100261f,
+    -0.94397378f, -0.94384712f, -0.943720341f, -0.943593442f, -0.943466425f,
+    -0.943339229f, -0.943211913f, -0.943084419f, -0.942956865f, -0.942829072f,
+    -0.942701221f, -0.94257319f, -0.94244504f, -0.942316771f, -0.942188323f,
+    -0.942059755f, -0.941931009f, -0.941802204f, -0.941673219f, -0.941544056f,
+    -0.941414773f, -0.941285372f, -0.941155851f, -0.941026151f, -0.940896332f,
+    -0.940766394f, -0.940636277f, -0.940506041f, -0.940375686f, -0.940245211f,
+    -0.940114558f, -0.939983726f, -0.939852834f, -0.939721763f, -0.939590573f,
+    -0.939459205f, -0.939327717f, -0.93919611f, -0.939064384f, -0.938932478f,
+    -0.938800454f, -0.938668311f, -0.938535988f, -0.938403547f, -0.938270926f,
+    -0.938138247f, -0.938005388f, -0.93787235f, -0.937739253f, -0.937605977f,
+    -0.937472582f, -0.937339008f, -0.937205315f, -0.937071502f, -0.936937571f,
+    -0.93680346f, -0.93666923f, -0.936534822f, -0.936400294f, -0.936265647f,
+    -0.936130881f, -0.935995936f, -0.935860872f, -0.935725689f, -0.935590327f,
+    -0.935454845f, -0.935319245f, -0.935183525f, -0.935047626f, -0.934911609f,
+    -0.934775412f, -0.934639156f, -0.934502721f, -0.934366107f, -0.934229374f,
+    -0.934092522f, -0.93395555f, -0.93381846f, -0.93368119f, -0.933543801f,
+    -0.933406234f, -0.933268547f, -0.933130741f, -0.932992816f, -0.932854712f,
+    -0.932716489f, -0.932578146f, -0.932439625f, -0.932300985f, -0.932162225f,
+    -0.932023287f, -0.931884289f, -0.931745052f, -0.931605756f, -0.931466281f,
+    -0.931326687f, -0.931186974f, -0.931047082f, -0.93090713f, -0.93076694f,
+    -0.93062669f, -0.930486262f, -0.930345714f, -0.930205047f, -0.930064201f,
+    -0.929923236f, -0.929782152f, -0.929640889f, -0.929499507f, -0.929358006f,
+    -0.929216385f, -0.929074585f, -0.928932667f, -0.928790629f, -0.928648412f,
+    -0.928506076f, -0.928363621f, -0.928220987f, -0.928078294f, -0.927935421f,
+    -0.92779237f, -0.92764926f, -0.92750597f, -0.927362502f, -0.927218974f,
+    -0.927075267f, -0.926931441f, -0.926787496f, -0.926643372f, -0.926499128f,
+    -0.926354766f, -0.926210225f, -0.926065564f, -0.925920784f, -0.925775886f,
+    -0.925630808f, -0.925485611f, -0.925340295f, -0.92519486f, -0.925049245f,
+    -0.924903512f, -0.9247576f, -0.924611628f, -0.924465477f, -0.924319208f,
+    -0.924172759f, -0.924026251f, -0.923879504f, -0.923732698f, -0.923585773f,
+    -0.923438668f, -0.923291445f, -0.923144042f, -0.922996521f, -0.92284888f,
+    -0.92270112f, -0.922553241f, -0.922405183f, -0.922257006f, -0.92210865f,
+    -0.921960235f, -0.92181164f, -0.921662927f, -0.921514034f, -0.921365023f,
+    -0.921215892f, -0.921066642f, -0.920917213f, -0.920767725f, -0.920618057f,
+    -0.920468211f, -0.920318305f, -0.920168221f, -0.920017958f, -0.919867635f,
+    -0.919717133f, -0.919566512f, -0.919415772f, -0.919264853f, -0.919113874f,
+    -0.918962717f, -0.918811381f, -0.918659985f, -0.91850841f, -0.918356717f,
+    -0.918204844f, -0.918052912f, -0.917900801f, -0.917748511f, -0.917596161f,
+    -0.917443633f, -0.917290986f, -0.917138219f, -0.916985273f, -0.916832268f,
+    -0.916679084f, -0.916525722f, -0.916372299f, -0.916218698f, -0.916064978f,
+    -0.915911078f, -0.91575712f, -0.915602982f, -0.915448725f, -0.91529429f,
+    -0.915139794f, -0.91498512f, -0.914830327f, -0.914675355f, -0.914520323f,
+    -0.914365113f, -0.914209783f, -0.914054275f, -0.913898647f, -0.9137429f,
+    -0.913587034f, -0.913431048f, -0.913274884f, -0.913118601f, -0.912962198f,
+    -0.912805617f, -0.912648976f, -0.912492156f, -0.912335157f, -0.912178099f,
+    -0.912020862f, -0.911863506f, -0.91170603f, -0.911548436f, -0.911390662f,
+    -0.911232769f, -0.911074758f, -0.910916567f, -0.910758257f, -0.910599828f,
+    -0.910441279f, -0.910282612f, -0.910123765f, -0.9099648f, -0.909805715f,
+    -0.909646451f, -0.909487128f, -0.909327626f, -0.909168005f, -0.909008205f,
+    -0.908848345f, -0.908688307f, -0.90852809f, -0.908367813f, -0.908207357f,
+    -0.908046842f, -0.907886088f, -0.907725275f, -0.907564342f, -0.907403231f,
+    -0.907242f, -0.907080591f, -0.906919122f, -0.906757474f, -0.906595707f,
+    -0.906433821f, -0.906271756f, -0.906109571f, -0.905947268f, -0.905784845f,
+    -0.905622303f, -0.905459583f, -0.905296743f, -0.905133784f, -0.904970706f,
+    -0.904807448f, -0.904644072f, -0.904480577f, -0.904316962f, -0.904153168f,
+    -0.903989315f, -0.903825283f, -0.903661072f, -0.903496802f, -0.903332353f,
+    -0.903167784f, -0.903003097f, -0.90283829f, -0.902673304f, -0.902508199f,
+    -0.902342975f, -0.902177632f, -0.902012169f, -0.901846528f, -0.901680768f,
+    -0.901514888f, -0.901348829f, -0.901182711f, -0.901016414f, -0.900849998f,
+    -0.900683403f, -0.900516748f, -0.900349915f, -0.900182962f, -0.900015891f,
+    -0.8998487f, -0.89968133f, -0.899513841f, -0.899346232f, -0.899178505f,
+    -0.899010599f, -0.898842633f, -0.898674488f, -0.898506165f, -0.898337781f,
+    -0.898169279f, -0.898000598f, -0.897831798f, -0.897662818f, -0.89749378f,
+    -0.897324562f, -0.897155225f, -0.896985769f, -0.896816194f, -0.8966465f,
+    -0.896476626f, -0.896306634f, -0.896136522f, -0.895966232f, -0.895795882f,
+    -0.895625353f, -0.895454705f, -0.895283937f, -0.895112991f, -0.894941986f,
+    -0.894770801f, -0.894599497f, -0.894428074f, -0.894256473f, -0.894084752f,
+    -0.893912971f, -0.893740952f, -0.893568873f, -0.893396676f, -0.893224299f,
+    -0.893051803f, -0.892879188f, -0.892706454f, -0.892533541f, -0.892360568f,
+    -0.892187417f, -0.892014146f, -0.891840696f, -0.891667187f, -0.891493499f,
+    -0.891319692f, -0.891145766f, -0.89097172f, -0.890797496f, -0.890623152f,
+    -0.890448749f, -0.890274107f, -0.890099406f, -0.889924586f, -0.889749587f,
+    -0.889574468f, -0.88939923f, -0.889223874f, -0.889048338f, -0.888872743f,
+    -0.888696969f, -0.888521075f, -0.888345063f, -0.888168871f, -0.887992561f,
+    -0.887816191f, -0.887639642f, -0.887462914f, -0.887286127f, -0.88710916f,
+    -0.886932135f, -0.88675493f, -0.886577606f, -0.886400104f, -0.886222541f,
+    -0.8860448f, -0.88586694f, -0.885688961f, -0.885510862f, -0.885332584f,
+    -0.885154247f, -0.884975731f, -0.884797096f, -0.884618342f, -0.884439468f,
+    -0.884260416f, -0.884081244f, -0.883901954f, -0.883722544f, -0.883543015f,
+    -0.883363366f, -0.883183539f, -0.883003592f, -0.882823527f, -0.882643342f,
+    -0.882463038f, -0.882282555f, -0.882101953f, -0.881921291f, -0.881740451f,
+    -0.881559432f, -0.881378353f, -0.881197095f, -0.881015778f, -0.880834281f,
+    -0.880652666f, -0.880470872f, -0.880289018f, -0.880106986f, -0.879924834f,
+    -0.879742622f, -0.879560173f, -0.879377663f, -0.879195035f, -0.879012227f,
+    -0.8788293f, -0.878646255f, -0.878463089f, -0.878279805f, -0.878096342f,
+    -0.877912819f, -0.877729118f, -0.877545297f, -0.877361357f, -0.877177238f,
+    -0.87699306f, -0.876808703f, -0.876624286f, -0.876439691f, -0.876254916f,
+    -0.876070082f, -0.875885129f, -0.875699997f, -0.875514746f, -0.875329375f,
+    -0.875143886f, -0.874958277f, -0.874772549f, -0.874586642f, -0.874400616f,
+    -0.87421453f, -0.874028265f, -0.873841822f, -0.873655319f, -0.873468697f,
+    -0.873281896f, -0.873094976f, -0.872907937f, -0.872720778f, -0.8725335f,
+    -0.872346044f, -0.872158527f, -0.871970832f, -0.871783018f, -0.871595085f,
+    -0.871407032f, -0.87121886f, -0.871030509f, -0.87084204f, -0.87065351f,
+    -0.870464802f, -0.870275974f, -0.870086968f, -0.869897902f, -0.869708657f,
+    -0.869519353f, -0.86932987f, -0.869140267f, -0.868950546f, -0.868760705f,
+    -0.868570685f, -0.868380606f, -0.868190348f, -0.867999971f, -0.867809474f,
+    -0.867618859f, -0.867428124f, -0.86723727f, -0.867046237f, -0.866855085f,
+    -0.866663873f, -0.866472483f, -0.866280973f, -0.866089284f, -0.865897536f,
+    -0.865705669f, -0.865513623f, -0.865321457f, -0.865129173f, -0.864936769f,
+    -0.864744246f, -0.864551604f, -0.864358783f, -0.864165902f, -0.863972843f,
+    -0.863779664f, -0.863586366f, -0.863392949f, -0.863199413f, -0.863005757f,
+    -0.862811923f, -0.862618029f, -0.862423956f, -0.862229764f, -0.862035453f,
+    -0.861841023f, -0.861646473f, -0.861451745f, -0.861256957f, -0.86106199f,
+    -0.860866964f, -0.860671759f, -0.860476434f, -0.860280991f, -0.860085368f,
+    -0.859889686f, -0.859693885f, -0.859497905f, -0.859301805f, -0.859105587f,
+    -0.858909249f, -0.858712792f, -0.858516216f, -0.858319521f, -0.858122647f,
+    -0.857925713f, -0.857728601f, -0.857531369f, -0.857334018f, -0.857136548f,
+    -0.856938958f, -0.85674125f, -0.856543422f, -0.856345415f, -0.856147349f,
+    -0.855949104f, -0.85575074f, -0.855552256f, -0.855353653f, -0.855154932f,
+    -0.85495609f, -0.854757071f, -0.854557991f, -0.854358733f, -0.854159415f,
+    -0.853959918f, -0.853760302f, -0.853560567f, -0.853360713f, -0.853160739f,
+    -0.852960587f, -0.852760375f, -0.852559984f, -0.852359533f, -0.852158904f,
+    -0.851958156f, -0.851757288f, -0.851556301f, -0.851355195f, -0.85115397f,
+    -0.850952566f, -0.850751102f, -0.850549459f, -0.850347757f, -0.850145876f,
+    -0.849943876f, -0.849741757f, -0.849539518f, -0.849337161f, -0.849134684f,
+    -0.848932028f, -0.848729312f, -0.848526478f, -0.848323464f, -0.848120332f,
+    -0.84791708f, -0.847713768f, -0.847510278f, -0.847306609f, -0.84710288f,
+    -0.846899033f, -0.846695065f, -0.84649092f, -0.846286714f, -0.84608233f,
+    -0.845877886f, -0.845673263f, -0.845468521f, -0.84526366f, -0.84505868f,
+    -0.84485358f, -0.844648361f, -0.844442964f, -0.844237506f, -0.84403187f,
+    -0.843826175f, -0.8436203f, -0.843414366f, -0.843208253f, -0.843002021f,
+    -0.84279567f, -0.8425892f, -0.84238261f, -0.842175901f, -0.841969013f,
+    -0.841762066f, -0.841554999f, -0.841347754f, -0.841140449f, -0.840932965f,
+    -0.840725362f, -0.84051764f, -0.840309858f, -0.840101898f, -0.839893818f,
+    -0.839685619f, -0.839477241f, -0.839268804f, -0.839060247f, -0.838851511f,
+    -0.838642716f, -0.838433802f, -0.838224709f, -0.838015497f, -0.837806225f,
+    -0.837596774f, -0.837387204f, -0.837177515f, -0.836967707f, -0.836757779f,
+    -0.836547732f, -0.836337566f, -0.836127281f, -0.835916817f, -0.835706294f,
+    -0.835495591f, -0.835284829f, -0.835073888f, -0.834862888f, -0.834651709f,
+    -0.83444041f, -0.834229052f, -0.834017515f, -0.833805859f, -0.833594084f,
+    -0.833382189f, -0.833170176f, -0.832958043f, -0.83274579f, -0.83253336f,
+    -0.832320869f, -0.832108259f, -0.831895471f, -0.831682622f, -0.831469595f,
+    -0.831256509f, -0.831043243f, -0.830829859f, -0.830616415f, -0.830402792f,
+    -0.830189049f, -0.829975188f, -0.829761207f, -0.829547107f, -0.829332948f,
+    -0.82911855f, -0.828904092f, -0.828689516f, -0.82847482f, -0.828260005f,
+    -0.82804507f, -0.827829957f, -0.827614784f, -0.827399492f, -0.827184021f,
+    -0.826968491f, -0.826752782f, -0.826537013f, -0.826321065f, -0.826104999f,
+    -0.825888872f, -0.825672567f, -0.825456142f, -0.825239599f, -0.825022995f,
+    -0.824806213f, -0.824589312f, -0.824372292f, -0.824155152f, -0.823937893f,
+    -0.823720515f, -0.823503017f, -0.823285401f, -0.823067665f, -0.82284981f,
+    -0.822631776f, -0.822413683f, -0.82219547f, -0.821977139f, -0.821758628f,
+    -0.821540058f, -0.821321368f, -0.8211025f, -0.820883572f, -0.820664465f,
+    -0.820445299f, -0.820225954f, -0.820006549f, -0.819786966f, -0.819567323f,
+    -0.819347501f, -0.819127619f, -0.818907559f, -0.818687379f, -0.81846714f,
+    -0.818246722f, -0.818026185f, -0.817805588f, -0.817584813f, -0.817363918f,
+    -0.817142904f, -0.81692183f, -0.816700578f, -0.816479206f, -0.816257715f,
+    -0.816036105f, -0.815814435f, -0.815592587f, -0.815370619f, -0.815148532f,
+    -0.814926326f, -0.814704001f, -0.814481556f, -0.814258993f, -0.81403631f,
+    -0.813813508f, -0.813590586f, -0.813367546f, -0.813144386f, -0.812921166f,
+    -0.812697768f, -0.812474251f, -0.812250614f, -0.812026858f, -0.811802983f,
+    -0.811578989f, -0.811354876f, -0.811130643f, -0.810906231f, -0.81068176f,
+    -0.81045717f, -0.81023246f, -0.810007632f, -0.809782684f, -0.809557617f,
+    -0.80933243f, -0.809107125f, -0.8088817f, -0.808656156f, -0.808430493f,
+    -0.80820471f, -0.807978809f, -0.807752848f, -0.807526708f, -0.807300448f,
+    -0.80707407f, -0.806847572f, -0.806620955f, -0.806394219f, -0.806167364f,
+    -0.80594039f, -0.805713296f, -0.805486083f, -0.805258751f, -0.805031359f,
+    -0.804803789f, -0.804576099f, -0.80434829f, -0.804120362f, -0.803892314f,
+    -0.803664207f, -0.803435922f, -0.803207517f, -0.802979052f, -0.802750409f,
+    -0.802521646f, -0.802292824f, -0.802063823f, -0.801834702f, -0.801605523f,
+    -0.801376164f, -0.801146746f, -0.800917149f, -0.800687492f, -0.800457656f,
+    -0.800227761f, -0.799997687f, -0.799767554f, -0.799537241f, -0.79930687f,
+    -0.799076378f, -0.798845768f, -0.798614979f, -0.79838413f, -0.798153162f,
+    -0.797922075f, -0.797690868f, -0.797459483f, -0.797228038f, -0.796996474f,
+    -0.796764791f, -0.796532989f, -0.796301067f, -0.796069086f, -0.795836926f,
+    -0.795604646f, -0.795372248f, -0.79513973f, -0.794907153f, -0.794674397f,
+    -0.794441521f, -0.794208586f, -0.793975472f, -0.793742299f, -0.793508947f,
+    -0.793275535f, -0.793041945f, -0.792808294f, -0.792574525f, -0.792340577f,
+    -0.792106569f, -0.791872442f, -0.791638196f, -0.79140383f, -0.791169345f,
+    -0.790934741f, -0.790700018f, -0.790465176f, -0.790230215f, -0.789995134f,
+    -0.789759994f, -0.789524674f, -0.789289236f, -0.789053738f, -0.788818061f,
+    -0.788582325f, -0.78834641f, -0.788110435f, -0.787874341f, -0.787638068f,
+    -0.787401736f, -0.787165284f, -0.786928713f, -0.786692023f, -0.786455214f,
+    -0.786218286f, -0.785981238f, -0.785744071f, -0.785506845f, -0.785269439f,
+    -0.785031915f, -0.784794331f, -0.784556568f, -0.784318745f, -0.784080803f,
+    -0.783842683f, -0.783604503f, -0.783366203f, -0.783127785f, -0.782889247f,
+    -0.78265059f, -0.782411814f, -0.782172918f, -0.781933963f, -0.781694829f,
+    -0.781455576f, -0.781216264f, -0.780976772f, -0.780737221f, -0.780497551f,
+    -0.780257761f, -0.780017793f, -0.779777765f, -0.779537618f, -0.779297352f,
+    -0.779057026f, -0.778816521f, -0.778575897f, -0.778335214f, -0.778094351f,
+    -0.777853429f, -0.777612329f, -0.777371168f, -0.777129889f, -0.77688849f,
+    -0.776646972f, -0.776405334f, -0.776163578f, -0.775921702f, -0.775679708f,
+    -0.775437653f, -0.77519542f, -0.774953127f, -0.774710655f, -0.774468124f,
+    -0.774225473f, -0.773982704f, -0.773739815f, -0.773496807f, -0.773253679f,
+    -0.773010433f, -0.772767127f, -0.772523642f, -0.772280097f, -0.772036374f,
+    -0.771792591f, -0.771548688f, -0.771304667f, -0.771060526f, -0.770816267f,
+    -0.770571887f, -0.770327449f, -0.770082831f, -0.769838154f, -0.769593298f,
+    -0.769348383f, -0.769103348f, -0.768858194f, -0.768612921f, -0.768367529f,
+    -0.768122017f, -0.767876446f, -0.767630696f, -0.767384887f, -0.767138898f,
+    -0.76689285f, -0.766646683f, -0.766400397f, -0.766153991f, -0.765907466f,
+    -0.765660882f, -0.765414119f, -0.765167236f, -0.764920294f, -0.764673233f,
+    -0.764426053f, -0.764178753f, -0.763931334f, -0.763683796f, -0.763436139f,
+    -0.763188422f, -0.762940526f, -0.762692571f, -0.762444496f, -0.762196302f,
+    -0.761947989f, -0.761699557f, -0.761451006f, -0.761202395f, -0.760953605f,
+    -0.760704756f, -0.760455787f, -0.760206699f, -0.759957492f, -0.759708166f,
+    -0.759458721f, -0.759209216f, -0.758959532f, -0.758709788f, -0.758459926f,
+    -0.758209884f, -0.757959783f, -0.757709622f, -0.757459283f, -0.757208824f,
+    -0.756958306f, -0.756707668f, -0.756456852f, -0.756205976f, -0.75595504f,
+    -0.755703926f, -0.755452693f, -0.755201399f, -0.754949927f, -0.754698396f,
+    -0.754446745f, -0.754194975f, -0.753943086f, -0.753691137f, -0.753439009f,
+    -0.753186822f, -0.752934456f, -0.75268203f, -0.752429485f, -0.752176821f,
+    -0.751924098f, -0.751671195f, -0.751418233f, -0.751165152f, -0.750911951f,
+    -0.750658631f, -0.750405192f, -0.750151634f, -0.749898016f, -0.74964422f,
+    -0.749390364f, -0.749136388f, -0.748882294f, -0.74862808f, -0.748373806f,
+    -0.748119354f, -0.747864842f, -0.747610211f, -0.747355461f, -0.747100592f,
+    -0.746845663f, -0.746590555f, -0.746335387f, -0.746080101f, -0.745824695f,
+    -0.74556917f, -0.745313525f, -0.745057762f, -0.744801939f, -0.744545996f,
+    -0.744289935f, -0.744033754f, -0.743777454f, -0.743521094f, -0.743264556f,
+    -0.743007958f, -0.742751241f, -0.742494404f, -0.742237449f, -0.741980433f,
+    -0.741723239f, -0.741465986f, -0.741208613f, -0.740951121f, -0.74069351f,
+    -0.740435839f, -0.740177989f, -0.73992008f, -0.739662051f, -0.739403903f,
+    -0.739145696f, -0.73888731f, -0.738628864f, -0.738370299f, -0.738111615f,
+    -0.737852812f, -0.737593889f, -0.737334907f, -0.737075806f, -0.736816585f,
+    -0.736557245f, -0.736297786f, -0.736038268f, -0.73577857f, -0.735518813f,
+    -0.735258937f, -0.734998941f, -0.734738886f, -0.734478652f, -0.734218359f,
+    -0.733957946f, -0.733697414f, -0.733436823f, -0.733176053f, -0.732915223f,
+    -0.732654274f, -0.732393205f, -0.732132018f, -0.73187077f, -0.731609404f,
+    -0.731347919f, -0.731086314f, -0.73082459f, -0.730562747f, -0.730300844f,
+    -0.730038822f, -0.72977668f, -0.72951442f, -0.7292521f, -0.728989601f,
+    -0.728727043f, -0.728464365f, -0.728201628f, -0.727938712f, -0.727675736f,
+    -0.727412641f, -0.727149427f, -0.726886094f, -0.726622701f, -0.726359129f,
+    -0.726095498f, -0.725831807f, -0.725567937f, -0.725303948f, -0.725039899f,
+    -0.724775732f, -0.724511445f, -0.724247098f, -0.723982573f, -0.723717988f,
+    -0.723453283f, -0.72318846f, -0.722923577f, -0.722658575f, -0.722393453f,
+    -0.722128212f, -0.721862853f, -0.721597433f, -0.721331835f, -0.721066177f,
+    -0.720800459f, -0.720534563f, -0.720268607f, -0.720002532f, -0.719736338f,
+    -0.719470024f, -0.719203651f, -0.718937099f, -0.718670487f, -0.718403816f,
+    -0.718136966f, -0.717870057f, -0.717603028f, -0.71733588f, -0.717068613f,
+    -0.716801286f, -0.71653384f, -0.716266274f, -0.71599859f, -0.715730846f,
+    -0.715462923f, -0.715194941f, -0.714926898f, -0.714658678f, -0.714390397f,
+    -0.714121997f, -0.713853478f, -0.71358484f, -0.713316143f, -0.713047326f,
+    -0.712778389f, -0.712509394f, -0.712240219f, -0.711970985f, -0.711701632f,
+    -0.711432219f, -0.711162627f, -0.710892975f, -0.710623205f, -0.710353374f,
+    -0.710083365f, -0.709813297f, -0.709543109f, -0.709272802f, -0.709002435f,
+    -0.708731949f, -0.708461344f, -0.70819062f, -0.707919836f, -0.707648933f,
+    -0.707377911f, -0.707106769f, -0.706835568f, -0.706564248f, -0.706292808f,
+    -0.706021249f, -0.705749631f, -0.705477893f, -0.705206037f, -0.704934061f,
+    -0.704662025f, -0.70438987f, -0.704117596f, -0.703845263f, -0.70357275f,
+    -0.703300178f, -0.703027546f, -0.702754736f, -0.702481866f, -0.702208877f,
+    -0.701935768f, -0.7016626f, -0.701389313f, -0.701115906f, -0.700842381f,
+    -0.700568795f, -0.700295091f, -0.700021267f, -0.699747384f, -0.699473321f,
+    -0.6991992f, -0.698925018f, -0.698650658f, -0.698376238f, -0.698101699f,
+    -0.697827101f, -0.697552323f, -0.697277486f, -0.69700259f, -0.696727514f,
+    -0.696452379f, -0.696177125f, -0.695901752f, -0.695626318f, -0.695350766f,
+    -0.695075095f, -0.694799364f, -0.694523513f, -0.694247544f, -0.693971455f,
+    -0.693695307f, -0.693419039f, -0.693142653f, -0.692866147f, -0.692589581f,
+    -0.692312896f, -0.692036152f, -0.691759229f, -0.691482246f, -0.691205204f,
+    -0.690927982f, -0.690650702f, -0.690373302f, -0.690095842f, -0.689818263f,
+    -0.689540565f, -0.689262748f, -0.688984871f, -0.688706875f, -0.68842876f,
+    -0.688150525f, -0.687872231f, -0.687593818f, -0.687315345f, -0.687036753f,
+    -0.686758041f, -0.686479211f, -0.686200321f, -0.685921311f, -0.685642183f,
+    -0.685362995f, -0.685083687f, -0.684804261f, -0.684524715f, -0.68424511f,
+    -0.683965385f, -0.683685601f, -0.683405697f, -0.683125675f, -0.682845533f,
+    -0.682565331f, -0.682285011f, -0.682004571f, -0.681724072f, -0.681443453f,
+    -0.681162715f, -0.680881917f, -0.680601001f, -0.680319965f, -0.680038869f,
+    -0.679757655f, -0.679476321f, -0.679194927f, -0.678913355f, -0.678631783f,
+    -0.678350031f, -0.678068221f, -0.677786291f, -0.677504301f, -0.677222192f,
+    -0.676939964f, -0.676657617f, -0.67637521f, -0.676092684f, -0.675810099f,
+    -0.675527394f, -0.67524457f, -0.674961627f, -0.674678624f, -0.674395502f,
+    -0.67411232f, -0.673829019f, -0.673545599f, -0.67326206f, -0.672978461f,
+    -0.672694743f, -0.672410965f, -0.672127068f, -0.671843052f, -0.671558976f,
+    -0.671274781f, -0.670990467f, -0.670706034f, -0.670421541f, -0.670136988f,
+    -0.669852257f, -0.669567466f, -0.669282615f, -0.668997586f, -0.668712497f,
+    -0.668427348f, -0.668142021f, -0.667856634f, -0.667571187f, -0.667285621f,
+    -0.666999936f, -0.666714132f, -0.666428268f, -0.666142285f, -0.665856242f,
+    -0.66557008f, -0.665283799f, -0.664997458f, -0.664710999f, -0.664424419f,
+    -0.664137781f, -0.663851023f, -0.663564146f, -0.663277209f, -0.662990153f,
+    -0.662703037f, -0.662415802f, -0.662128448f, -0.661840975f, -0.661553442f,
+    -0.66126585f, -0.660978138f, -0.660690308f, -0.660402358f, -0.660114348f,
+    -0.659826219f, -0.659538031f, -0.659249723f, -0.658961296f, -0.65867281f,
+    -0.658384204f, -0.658095479f, -0.657806695f, -0.657517791f, -0.657228827f,
+    -0.656939745f, -0.656650543f, -0.656361282f, -0.656071901f, -0.655782402f,
+    -0.655492842f, -0.655203164f, -0.654913425f, -0.654623568f, -0.654333591f,
+    -0.654043555f, -0.6537534f, -0.653463185f, -0.653172851f, -0.652882397f,
+    -0.652591884f, -0.652301252f, -0.65201056f, -0.651719689f, -0.651428819f,
+    -0.651137769f, -0.65084666f, -0.650555491f, -0.650264204f, -0.649972796f,
+    -0.64968133f, -0.649389744f, -0.649098039f, -0.648806274f, -0.64851439f,
+    -0.648222446f, -0.647930384f, -0.647638202f, -0.64734596f, -0.647053599f,
+    -0.646761179f, -0.646468639f, -0.64617604f, -0.645883262f, -0.645590484f,
+    -0.645297527f, -0.645004511f, -0.644711435f, -0.64441824f, -0.644124925f,
+    -0.643831551f, -0.643538058f, -0.643244505f, -0.642950833f, -0.642657042f,
+    -0.642363191f, -0.642069221f, -0.641775131f, -0.641481042f, -0.641186774f,
+    -0.640892446f, -0.640597999f, -0.640303493f, -0.640008867f, -0.639714181f,
+    -0.639419317f, -0.639124453f, -0.63882947f, -0.638534367f, -0.638239205f,
+    -0.637943923f, -0.637648523f, -0.637353063f, -0.637057483f, -0.636761844f,
+    -0.636466146f, -0.636170268f, -0.635874331f, -0.635578334f, -0.635282218f,
+    -0.634985983f, -0.634689689f, -0.634393275f, -0.634096801f, -0.633800209f,
+    -0.633503556f, -0.633206785f, -0.632909894f, -0.632612944f, -0.632315874f,
+    -0.632018745f, -0.631721497f, -0.631424189f, -0.631126761f, -0.630829215f,
+    -0.630531609f, -0.630233943f, -0.629936099f, -0.629638255f, -0.629340231f,
+    -0.629042208f, -0.628744006f, -0.628445745f, -0.628147423f, -0.627848983f,
+    -0.627550423f, -0.627251804f, -0.626953125f, -0.626654267f, -0.62635541f,
+    -0.626056373f, -0.625757277f, -0.625458121f, -0.625158846f, -0.624859512f,
+    -0.624560058f, -0.624260485f, -0.623960853f, -0.623661101f, -0.62336129f,
+    -0.623061359f, -0.622761369f, -0.622461259f, -0.62216109f, -0.621860802f,
+    -0.621560454f, -0.621259987f, -0.620959401f, -0.620658755f, -0.62035805f,
+    -0.620057225f, -0.619756281f, -0.619455278f, -0.619154155f, -0.618852973f,
+    -0.618551731f, -0.61825031f, -0.61794889f, -0.61764729f, -0.617345631f,
+    -0.617043912f, -0.616742074f, -0.616440177f, -0.61613816f, -0.615836084f,
+    -0.615533888f, -0.615231574f, -0.614929199f, -0.614626765f, -0.614324212f,
+    -0.61402154f, -0.613718808f, -0.613416016f, -0.613113105f, -0.612810075f,
+    -0.612506986f, -0.612203777f, -0.611900508f, -0.61159718f, -0.611293733f,
+    -0.610990167f, -0.610686541f, -0.610382795f, -0.61007899f, -0.609775066f,
+    -0.609471083f, -0.609167039f, -0.608862817f, -0.608558595f, -0.608254254f,
+    -0.607949793f, -0.607645273f, -0.607340634f, -0.607035935f, -0.606731117f,
+    -0.606426239f, -0.606121242f, -0.605816185f, -0.605511069f, -0.605205774f,
+    -0.604900479f, -0.604595065f, -0.604289532f, -0.603983939f, -0.603678226f,
+    -0.603372455f, -0.603066623f, -0.602760673f, -0.602454603f, -0.602148473f,
+    -0.601842225f, -0.601535916f, -0.601229548f, -0.600923061f, -0.600616455f,
+    -0.600309789f, -0.600003064f, -0.599696219f, -0.599389315f, -0.599082291f,
+    -0.598775208f, -0.598468006f, -0.598160684f, -0.597853363f, -0.597545862f,
+    -0.597238362f, -0.596930683f, -0.596623003f, -0.596315205f, -0.596007288f,
+    -0.59569931f, -0.595391214f, -0.595083058f, -0.594774842f, -0.594466507f,
+    -0.594158053f, -0.593849599f, -0.593540967f, -0.593232274f, -0.592923522f,
+    -0.592614651f, -0.59230572f, -0.59199667f, -0.59168756f, -0.591378391f,
+    -0.591069102f, -0.590759695f, -0.590450227f, -0.5901407f, -0.589831054f,
+    -0.589521289f, -0.589211524f, -0.588901579f, -0.588591635f, -0.588281572f,
+    -0.587971389f, -0.587661147f, -0.587350786f, -0.587040365f, -0.586729884f,
+    -0.586419284f, -0.586108625f, -0.585797846f, -0.585487008f, -0.585176051f,
+    -0.584865034f, -0.584553957f, -0.584242761f, -0.583931446f, -0.583620131f,
+    -0.583308637f, -0.582997143f, -0.582685471f, -0.582373798f, -0.582062006f,
+    -0.581750095f, -0.581438124f, -0.581126094f, -0.580813944f, -0.580501735f,
+    -0.580189407f, -0.579877019f, -0.579564571f, -0.579252005f, -0.578939319f,
+    -0.578626633f, -0.578313768f, -0.578000903f, -0.577687919f, -0.577374816f,
+    -0.577061653f, -0.576748431f, -0.576435089f, -0.576121688f, -0.575808167f,
+    -0.575494587f, -0.575180948f, -0.574867189f, -0.57455337f, -0.574239433f,
+    -0.573925436f, -0.573611319f, -0.573297143f, -0.572982907f, -0.572668552f,
+    -0.572354138f, -0.572039604f, -0.571725011f, -0.571410358f, -0.571095586f,
+    -0.570780754f, -0.570465803f, -0.570150793f, -0.569835722f, -0.569520533f,
+    -0.569205225f, -0.568889916f, -0.568574488f, -0.568258941f, -0.567943335f,
+    -0.567627668f, -0.567311883f, -0.566996038f, -0.566680133f, -0.56636411f,
+    -0.566047966f, -0.565731823f, -0.565415561f, -0.56509918f, -0.564782739f,
+    -0.564466238f, -0.564149618f, -0.563832939f, -0.5635162f, -0.563199341f,
+    -0.562882423f, -0.562565386f, -0.56224829f, -0.561931133f, -0.561613858f,
+    -0.561296523f, -0.560979068f, -0.560661554f, -0.560343981f, -0.560026288f,
+    -0.559708536f, -0.559390724f, -0.559072793f, -0.558754802f, -0.558436692f,
+    -0.558118522f, -0.557800293f, -0.557481945f, -0.557163537f, -0.556845009f,
+    -0.556526482f, -0.556207776f, -0.55588907f, -0.555570245f, -0.5552513f,
+    -0.554932356f, -0.554613292f, -0.554294109f, -0.553974867f, -0.553655565f,
+    -0.553336203f, -0.553016722f, -0.552697122f, -0.552377522f, -0.552057803f,
+    -0.551737964f, -0.551418126f, -0.551098168f, -0.550778091f, -0.550457954f,
+    -0.550137758f, -0.549817502f, -0.549497128f, -0.549176633f, -0.548856139f,
+    -0.548535526f, -0.548214853f, -0.547894061f, -0.547573209f, -0.547252297f,
+    -0.546931267f, -0.546610177f, -0.546288967f, -0.545967758f, -0.545646429f,
+    -0.545324981f, -0.545003474f, -0.544681907f, -0.54436028f, -0.544038534f,
+    -0.543716729f, -0.543394804f, -0.54307282f, -0.542750776f, -0.542428672f,
+    -0.54210645f, -0.541784167f, -0.541461766f, -0.541139305f, -0.540816784f,
+    -0.540494144f, -0.540171444f, -0.539848685f, -0.539525867f, -0.539202929f,
+    -0.538879931f, -0.538556814f, -0.538233638f, -0.537910402f, -0.537587047f,
+    -0.537263691f, -0.536940157f, -0.536616623f, -0.53629297f, -0.535969257f,
+    -0.535645485f, -0.535321593f, -0.534997642f, -0.534673572f, -0.534349442f,
+    -0.534025252f, -0.533701003f, -0.533376634f, -0.533052206f, -0.532727718f,
+    -0.532403111f, -0.532078445f, -0.531753719f, -0.531428874f, -0.531104028f,
+    -0.530779004f, -0.53045398f, -0.530128837f, -0.529803634f, -0.529478312f,
+    -0.529152989f, -0.528827548f, -0.528501987f, -0.528176427f, -0.527850747f,
+    -0.527524948f, -0.527199149f, -0.526873231f, -0.526547253f, -0.526221156f,
+    -0.525895f, -0.525568783f, -0.525242507f, -0.524916112f, -0.524589658f,
+    -0.524263144f, -0.52393657f, -0.523609877f, -0.523283124f, -0.522956252f,
+    -0.52262938f, -0.522302389f, -0.521975279f, -0.521648169f, -0.521320939f,
+    -0.52099365f, -0.520666242f, -0.520338774f, -0.520011246f, -0.519683659f,
+    -0.519356012f, -0.519028246f, -0.518700421f, -0.518372476f, -0.518044531f,
+    -0.517716467f, -0.517388284f, -0.517060101f, -0.516731799f, -0.516403437f,
+    -0.516075015f, -0.515746474f, -0.515417874f, -0.515089214f, -0.514760435f,
+    -0.514431655f, -0.514102757f, -0.513773799f, -0.513444722f, -0.513115585f,
+    -0.512786388f, -0.512457132f, -0.512127757f, -0.511798322f, -0.511468828f,
+    -0.511139274f, -0.5108096f, -0.510479927f, -0.510150075f, -0.509820223f,
+    -0.509490252f, -0.509160221f, -0.50883013f, -0.50849998f, -0.508169711f,
+    -0.507839382f, -0.507508993f, -0.507178545f, -0.506847978f, -0.506517351f,
+    -0.506186664f, -0.505855858f, -0.505525053f, -0.505194128f, -0.504863083f,
+    -0.504532039f, -0.504200876f, -0.503869653f, -0.50353837f, -0.503207028f,
+    -0.502875566f, -0.502544045f, -0.502212465f, -0.501880825f, -0.501549065f,
+    -0.501217246f, -0.500885367f, -0.500553429f, -0.500221372f, -0.499889284f,
+    -0.499557108f, -0.499224871f, -0.498892546f, -0.498560131f, -0.498227656f,
+    -0.497895122f, -0.497562498f, -0.497229815f, -0.496897042f, -0.496564209f,
+    -0.496231288f, -0.495898306f, -0.495565265f, -0.495232135f, -0.494898945f,
+    -0.494565666f, -0.494232297f, -0.493898898f, -0.49356541f, -0.493231833f,
+    -0.492898196f, -0.49256447f, -0.492230713f, -0.491896838f, -0.491562903f,
+    -0.491228908f, -0.490894854f, -0.49056071f, -0.490226477f, -0.489892185f,
+    -0.489557832f, -0.489223391f, -0.48888889f, -0.488554329f, -0.488219678f,
+    -0.487884939f, -0.487550169f, -0.48721531f, -0.486880362f, -0.486545354f,
+    -0.486210287f, -0.48587513f, -0.485539913f, -0.485204607f, -0.484869242f,
+    -0.484533817f, -0.484198302f, -0.483862728f, -0.483527064f, -0.483191371f,
+    -0.482855558f, -0.482519716f, -0.482183784f, -0.481847763f, -0.481511682f,
+    -0.481175542f, -0.480839342f, -0.480503052f, -0.480166674f, -0.479830265f,
+    -0.479493767f, -0.47915718f, -0.478820562f, -0.478483826f, -0.47814706f,
+    -0.477810204f, -0.477473289f, -0.477136284f, -0.47679922f, -0.476462096f,
+    -0.476124883f, -0.47578761f, -0.475450277f, -0.475112855f, -0.474775374f,
+    -0.474437833f, -0.474100202f, -0.473762512f, -0.473424762f, -0.473086923f,
+    -0.472749025f, -0.472411066f, -0.472073019f, -0.471734911f, -0.471396744f,
+    -0.471058488f, -0.470720172f, -0.470381796f, -0.470043331f, -0.469704807f,
+    -0.469366223f, -0.469027549f, -0.468688816f, -0.468350023f, -0.468011141f,
+    -0.467672229f, -0.467333198f, -0.466994137f, -0.466654986f, -0.466315776f,
+    -0.465976506f, -0.465637147f, -0.465297729f, -0.464958251f, -0.464618683f,
+    -0.464279056f, -0.463939369f, -0.463599622f, -0.463259786f, -0.462919891f,
+    -0.462579936f, -0.462239891f, -0.461899787f, -0.461559623f, -0.4612194f,
+    -0.460879087f, -0.460538715f, -0.460198283f, -0.459857762f, -0.459517181f,
+    -0.45917654f, -0.45883584f, -0.458495051f, -0.458154202f, -0.457813293f,
+    -0.457472324f, -0.457131267f, -0.456790149f, -0.456448972f, -0.456107736f,
+    -0.45576641f, -0.455425024f, -0.455083579f, -0.454742074f, -0.45440048f,
+    -0.454058826f, -0.453717113f, -0.45337534f, -0.453033477f, -0.452691585f,
+    -0.452349573f, -0.452007532f, -0.451665431f, -0.451323241f, -0.450980991f,
+    -0.450638682f, -0.450296283f, -0.449953854f, -0.449611336f, -0.449268758f,
+    -0.448926091f, -0.448583394f, -0.448240608f, -0.447897762f, -0.447554857f,
+    -0.447211891f, -0.446868837f, -0.446525723f, -0.446182549f, -0.445839316f,
+    -0.445496023f, -0.44515264f, -0.444809198f, -0.444465697f, -0.444122136f,
+    -0.443778515f, -0.443434805f, -0.443091065f, -0.442747235f, -0.442403346f,
+    -0.442059368f, -0.44171536f, -0.441371262f, -0.441027105f, -0.440682888f,
+    -0.440338612f, -0.439994276f, -0.43964985f, -0.439305395f, -0.43896085f,
+    -0.438616246f, -0.438271582f, -0.437926829f, -0.437582046f, -0.437237173f,
+    -0.436892241f, -0.43654725f, -0.436202198f, -0.435857087f, -0.435511887f,
+    -0.435166657f, -0.434821337f, -0.434475958f, -0.43413052f, -0.433785021f,
+    -0.433439463f, -0.433093816f, -0.432748139f, -0.432402372f, -0.432056546f,
+    -0.43171066f, -0.431364715f, -0.43101871f, -0.430672616f, -0.430326492f,
+    -0.429980278f, -0.429634005f, -0.429287672f, -0.42894128f, -0.428594828f,
+    -0.428248316f, -0.427901745f, -0.427555084f, -0.427208394f, -0.426861614f,
+    -0.426514775f, -0.426167876f, -0.425820917f, -0.425473899f, -0.425126821f,
+    -0.424779683f, -0.424432486f, -0.4240852f, -0.423737884f, -0.423390478f,
+    -0.423043013f, -0.422695488f, -0.422347903f, -0.422000259f, -0.421652555f,
+    -0.421304792f, -0.420956969f, -0.420609087f, -0.420261115f, -0.419913113f,
+    -0.419565022f, -0.419216901f, -0.418868691f, -0.418520421f, -0.418172091f,
+    -0.417823702f, -0.417475283f, -0.417126775f, -0.416778177f, -0.416429549f,
+    -0.416080862f, -0.415732116f, -0.415383309f, -0.415034413f, -0.414685488f,
+    -0.414336503f, -0.413987428f, -0.413638324f, -0.41328913f, -0.412939876f,
+    -0.412590593f, -0.41224122f, -0.411891818f, -0.411542326f, -0.411192775f,
+    -0.410843164f, -0.410493493f, -0.410143793f, -0.409794003f, -0.409444153f,
+    -0.409094244f, -0.408744276f, -0.408394247f, -0.408044159f, -0.407694012f,
+    -0.407343805f, -0.406993538f, -0.406643212f, -0.406292826f, -0.40594238f,
+    -0.405591875f, -0.405241311f, -0.404890686f, -0.404540002f, -0.404189259f,
+    -0.403838456f, -0.403487593f, -0.403136671f, -0.402785689f, -0.402434647f,
+    -0.402083546f, -0.401732385f, -0.401381165f, -0.401029885f, -0.400678575f,
+    -0.400327176f, -0.399975717f, -0.399624199f, -0.399272621f, -0.398921013f,
+    -0.398569316f, -0.398217559f, -0.397865742f, -0.397513896f, -0.397161961f,
+    -0.396809995f, -0.39645794f, -0.396105856f, -0.395753682f, -0.395401478f,
+    -0.395049214f, -0.394696862f, -0.394344479f, -0.393992037f, -0.393639535f,
+    -0.393286973f, -0.392934352f, -0.392581671f, -0.392228931f, -0.391876131f,
+    -0.391523302f, -0.391170382f, -0.390817404f, -0.390464395f, -0.390111327f,
+    -0.38975817f, -0.389404982f, -0.389051735f, -0.388698429f, -0.388345033f,
+    -0.387991607f, -0.387638152f, -0.387284607f, -0.386931002f, -0.386577338f,
+    -0.386223644f, -0.38586989f, -0.385516047f, -0.385162175f, -0.384808242f,
+    -0.38445425f, -0.384100199f, -0.383746088f, -0.383391917f, -0.383037716f,
+    -0.382683426f, -0.382329106f, -0.381974727f, -0.381620258f, -0.381265759f,
+    -0.380911201f, -0.380556613f, -0.380201936f, -0.379847199f, -0.379492432f,
+    -0.379137605f, -0.37878269f, -0.378427744f, -0.378072739f, -0.377717704f,
+    -0.377362579f, -0.377007425f, -0.376652181f, -0.376296908f, -0.375941575f,
+    -0.375586182f, -0.37523073f, -0.374875218f, -0.374519676f, -0.374164075f,
+    -0.373808384f, -0.373452663f, -0.373096913f, -0.372741073f, -0.372385174f,
+    -0.372029245f, -0.371673256f, -0.371317208f, -0.3709611f, -0.370604932f,
+    -0.370248705f, -0.369892448f, -0.369536132f, -0.369179755f, -0.36882332f,
+    -0.368466824f, -0.368110299f, -0.367753685f, -0.36739704f, -0.367040336f,
+    -0.366683602f, -0.366326779f, -0.365969926f, -0.365612984f, -0.365256011f,
+    -0.364899009f, -0.364541918f, -0.364184797f, -0.363827616f, -0.363470376f,
+    -0.363113075f, -0.362755716f, -0.362398326f, -0.362040877f, -0.361683369f,
+    -0.3613258f, -0.360968202f, -0.360610515f, -0.360252798f, -0.359895051f,
+    -0.359537214f, -0.359179348f, -0.358821392f, -0.358463407f, -0.358105391f,
+    -0.357747287f, -0.357389152f, -0.357030958f, -0.356672704f, -0.356314421f,
+    -0.355956078f, -0.355597675f, -0.355239213f, -0.354880691f, -0.354522139f,
+    -0.354163527f, -0.353804857f, -0.353446156f, -0.353087366f, -0.352728546f,
+    -0.352369696f, -0.352010757f, -0.351651788f, -0.351292759f, -0.350933671f,
+    -0.350574553f, -0.350215375f, -0.349856138f, -0.349496841f, -0.349137515f,
+    -0.348778129f, -0.348418683f, -0.348059177f, -0.347699642f, -0.347340047f,
+    -0.346980423f, -0.346620709f, -0.346260965f, -0.345901161f, -0.345541328f,
+    -0.345181435f, -0.344821483f, -0.344461471f, -0.344101429f, -0.343741328f,
+    -0.343381166f, -0.343020976f, -0.342660725f, -0.342300415f, -0.341940075f,
+    -0.341579646f, -0.341219217f, -0.340858698f, -0.340498149f, -0.340137541f,
+    -0.339776874f, -0.339416176f, -0.339055419f, -0.338694632f, -0.338333756f,
+    -0.33797285f, -0.337611914f, -0.337250918f, -0.336889863f, -0.336528748f,
+    -0.336167604f, -0.3358064f, -0.335445136f, -0.335083842f, -0.334722489f,
+    -0.334361106f, -0.333999664f, -0.333638161f, -0.3332766f, -0.332915008f,
+    -0.332553357f, -0.332191676f, -0.331829935f, -0.331468135f, -0.331106305f,
+    -0.330744416f, -0.330382496f, -0.330020487f, -0.329658449f, -0.32929638f,
+    -0.328934252f, -0.328572065f, -0.328209847f, -0.32784757f, -0.327485234f,
+    -0.327122867f, -0.326760441f, -0.326397985f, -0.32603547f, -0.325672895f,
+    -0.32531029f, -0.324947625f, -0.324584931f, -0.324222177f, -0.323859364f,
+    -0.323496521f, -0.323133618f, -0.322770685f, -0.322407693f, -0.322044641f,
+    -0.321681559f, -0.321318418f, -0.320955247f, -0.320592016f, -0.320228726f,
+    -0.319865406f, -0.319502026f, -0.319138616f, -0.318775147f, -0.318411648f,
+    -0.31804809f, -0.317684472f, -0.317320824f, -0.316957116f, -0.316593379f,
+    -0.316229582f, -0.315865755f, -0.315501869f, -0.315137923f, -0.314773947f,
+    -0.314409941f, -0.314045846f, -0.313681751f, -0.313317567f, -0.312953383f,
+    -0.312589109f, -0.312224805f, -0.311860472f, -0.311496079f, -0.311131626f,
+    -0.310767144f, -0.310402632f, -0.31003806f, -0.309673429f, -0.309308767f,
+    -0.308944046f, -0.308579296f, -0.308214486f, -0.307849646f, -0.307484746f,
+    -0.307119817f, -0.306754827f, -0.306389809f, -0.30602473f, -0.305659592f,
+    -0.305294424f, -0.304929227f, -0.304563969f, -0.304198682f, -0.303833336f,
+    -0.303467959f, -0.303102523f, -0.302737027f, -0.302371502f, -0.302005947f,
+    -0.301640332f, -0.301274687f, -0.300908983f, -0.300543249f, -0.300177455f,
+    -0.299811631f, -0.299445748f, -0.299079835f, -0.298713863f, -0.298347861f,
+    -0.297981799f, -0.297615707f, -0.297249556f, -0.296883374f, -0.296517164f,
+    -0.296150893f, -0.295784563f, -0.295418203f, -0.295051813f, -0.294685364f,
+    -0.294318885f, -0.293952346f, -0.293585777f, -0.293219149f, -0.292852491f,
+    -0.292485803f, -0.292119056f, -0.291752249f, -0.291385442f, -0.291018546f,
+    -0.290651649f, -0.290284663f, -0.289917678f, -0.289550632f, -0.289183527f,
+    -0.288816422f, -0.288449228f, -0.288082033f, -0.28771475f, -0.287347466f,
+    -0.286980122f, -0.286612719f, -0.286245316f, -0.285877824f, -0.285510331f,
+    -0.285142779f, -0.284775168f, -0.284407526f, -0.284039855f, -0.283672124f,
+    -0.283304363f, -0.282936573f, -0.282568723f, -0.282200843f, -0.281832904f,
+    -0.281464934f, -0.281096935f, -0.280728877f, -0.280360788f, -0.27999264f,
+    -0.279624462f, -0.279256254f, -0.278887987f, -0.27851969f, -0.278151363f,
+    -0.277782977f, -0.277414531f, -0.277046084f, -0.276677579f, -0.276309043f,
+    -0.275940448f, -0.275571823f, -0.275203139f, -0.274834454f, -0.27446571f,
+    -0.274096906f, -0.273728073f, -0.273359209f, -0.272990316f, -0.272621363f,
+    -0.272252381f, -0.271883339f, -0.271514267f, -0.271145165f, -0.270776004f,
+    -0.270406812f, -0.270037591f, -0.269668311f, -0.26929903f, -0.26892966f,
+    -0.26856029f, -0.268190861f, -0.267821401f, -0.267451882f, -0.267082334f,
+    -0.266712755f, -0.266343147f, -0.265973479f, -0.265603781f, -0.265234023f,
+    -0.264864236f, -0.264494419f, -0.264124572f, -0.263754666f, -0.26338473f,
+    -0.263014764f, -0.262644768f, -0.262274712f, -0.261904627f, -0.261534482f,
+    -0.261164337f, -0.260794103f, -0.260423869f, -0.260053605f, -0.259683281f,
+    -0.259312928f, -0.258942515f, -0.258572072f, -0.258201599f, -0.257831097f,
+    -0.257460564f, -0.257089972f, -0.256719351f, -0.25634867f, -0.255977988f,
+    -0.255607247f, -0.255236477f, -0.254865646f, -0.254494816f, -0.254123926f,
+    -0.253753006f, -0.253382027f, -0.253011048f, -0.252640009f, -0.25226894f,
+    -0.251897812f, -0.251526684f, -0.251155496f, -0.250784278f, -0.250413001f,
+    -0.250041723f, -0.249670386f, -0.249299005f, -0.248927608f, -0.248556167f,
+    -0.248184681f, -0.247813165f, -0.24744162f, -0.247070029f, -0.246698409f,
+    -0.246326745f, -0.24595505f, -0.245583311f, -0.245211542f, -0.244839743f,
+    -0.244467899f, -0.244096026f, -0.243724108f, -0.24335216f, -0.242980182f,
+    -0.24260816f, -0.242236108f, -0.241864011f, -0.241491884f, -0.241119727f,
+    -0.240747526f, -0.240375295f, -0.24000302f, -0.239630714f, -0.239258379f,
+    -0.238885999f, -0.238513589f, -0.238141149f, -0.237768665f, -0.237396151f,
+    -0.237023607f, -0.236651018f, -0.2362784f, -0.235905752f, -0.235533059f,
+    -0.235160336f, -0.234787583f, -0.234414786f, -0.234041959f, -0.233669102f,
+    -0.233296201f, -0.232923269f, -0.232550308f, -0.232177302f, -0.231804281f,
+    -0.231431216f, -0.231058106f, -0.230684981f, -0.230311811f, -0.229938596f,
+    -0.229565367f, -0.229192093f, -0.228818789f, -0.228445455f, -0.228072077f,
+    -0.227698684f, -0.227325246f, -0.226951763f, -0.226578265f, -0.226204723f,
+    -0.225831151f, -0.225457549f, -0.225083917f, -0.224710241f, -0.224336535f,
+    -0.223962799f, -0.223589033f, -0.223215222f, -0.222841397f, -0.222467527f,
+    -0.222093627f, -0.221719682f, -0.221345723f, -0.220971718f, -0.220597684f,
+    -0.220223621f, -0.219849527f, -0.219475403f, -0.219101235f, -0.218727052f,
+    -0.218352824f, -0.217978567f, -0.21760428f, -0.217229947f, -0.2168556f,
+    -0.216481209f, -0.216106802f, -0.215732351f, -0.21535787f, -0.214983359f,
+    -0.214608818f, -0.214234233f, -0.213859633f, -0.213484988f, -0.213110313f,
+    -0.212735623f, -0.212360889f, -0.211986125f, -0.211611331f, -0.211236507f,
+    -0.210861638f, -0.210486755f, -0.210111842f, -0.209736884f, -0.209361911f,
+    -0.208986893f, -0.208611846f, -0.208236784f, -0.207861677f, -0.20748654f,
+    -0.207111374f, -0.206736177f, -0.206360951f, -0.205985695f, -0.205610409f,
+    -0.205235094f, -0.204859748f, -0.204484373f, -0.204108968f, -0.203733534f,
+    -0.203358069f, -0.20298256f, -0.202607036f, -0.202231482f, -0.201855898f,
+    -0.201480284f, -0.201104641f, -0.200728953f, -0.20035325f, -0.199977517f,
+    -0.199601755f, -0.199225962f, -0.19885014f, -0.198474288f, -0.198098406f,
+    -0.197722495f, -0.197346568f, -0.196970597f, -0.196594596f, -0.196218565f,
+    -0.195842519f, -0.195466429f, -0.195090324f, -0.194714189f, -0.194338009f,
+    -0.193961814f, -0.19358559f, -0.193209335f, -0.192833051f, -0.192456737f,
+    -0.192080393f, -0.191704035f, -0.191327631f, -0.190951213f, -0.19057475f,
+    -0.190198272f, -0.189821765f, -0.189445227f, -0.18906866f, -0.188692078f,
+    -0.188315451f, -0.187938809f, -0.187562123f, -0.187185422f, -0.18680869f,
+    -0.186431944f, -0.186055154f, -0.185678333f, -0.185301498f, -0.184924632f,
+    -0.184547737f, -0.184170812f, -0.183793873f, -0.183416888f, -0.183039889f,
+    -0.18266286f, -0.182285801f, -0.181908712f, -0.181531608f, -0.181154475f,
+    -0.180777311f, -0.180400118f, -0.180022895f, -0.179645658f, -0.17926839f,
+    -0.178891093f, -0.178513765f, -0.178136423f, -0.177759051f, -0.17738165f,
+    -0.177004218f, -0.176626772f, -0.176249295f, -0.175871789f, -0.175494254f,
+    -0.175116703f, -0.174739107f, -0.174361512f, -0.173983872f, -0.173606217f,
+    -0.173228532f, -0.172850817f, -0.172473088f, -0.172095329f, -0.171717539f,
+    -0.17133972f, -0.170961887f, -0.170584023f, -0.170206144f, -0.169828221f,
+    -0.169450298f, -0.16907233f, -0.168694347f, -0.168316334f, -0.167938292f,
+    -0.167560235f, -0.167182148f, -0.166804045f, -0.166425899f, -0.166047737f,
+    -0.16566956f, -0.165291354f, -0.164913118f, -0.164534867f, -0.164156586f,
+    -0.163778275f, -0.16339995f, -0.163021594f, -0.162643224f, -0.162264824f,
+    -0.161886394f, -0.161507949f, -0.161129475f, -0.16075097f, -0.160372451f,
+    -0.159993917f, -0.159615353f, -0.159236759f, -0.15885815f, -0.158479512f,
+    -0.158100843f, -0.15772216f, -0.157343462f, -0.156964719f, -0.156585976f,
+    -0.156207204f, -0.155828401f, -0.155449569f, -0.155070737f, -0.15469186f,
+    -0.154312968f, -0.153934062f, -0.153555125f, -0.153176159f, -0.152797192f,
+    -0.152418181f, -0.152039155f, -0.151660115f, -0.151281044f, -0.150901943f,
+    -0.150522828f, -0.150143698f, -0.149764538f, -0.149385348f, -0.149006143f,
+    -0.148626924f, -0.148247674f, -0.14786841f, -0.147489116f, -0.147109807f,
+    -0.146730468f, -0.146351114f, -0.145971745f, -0.145592347f, -0.145212919f,
+    -0.14483349f, -0.144454017f, -0.144074544f, -0.143695027f, -0.143315509f,
+    -0.142935961f, -0.142556399f, -0.142176807f, -0.1417972f, -0.141417563f,
+    -0.141037911f, -0.140658244f, -0.140278548f, -0.139898837f, -0.139519095f,
+    -0.139139339f, -0.138759568f, -0.138379768f, -0.137999952f, -0.137620121f,
+    -0.137240261f, -0.136860386f, -0.136480495f, -0.136100575f, -0.13572064f,
+    -0.135340676f, -0.134960711f, -0.134580702f, -0.134200692f, -0.133820653f,
+    -0.133440599f, -0.13306053f, -0.132680431f, -0.132300317f, -0.131920189f,
+    -0.13154003f, -0.131159857f, -0.130779669f, -0.130399451f, -0.130019218f,
+    -0.12963897f, -0.129258707f, -0.128878415f, -0.128498107f, -0.128117785f,
+    -0.127737448f, -0.127357081f, -0.126976699f, -0.126596302f, -0.126215875f,
+    -0.125835434f, -0.125454977f, -0.125074506f, -0.12469402f, -0.124313504f,
+    -0.123932973f, -0.123552427f, -0.123171858f, -0.122791275f, -0.122410677f,
+    -0.122030057f, -0.121649414f, -0.121268764f, -0.120888084f, -0.120507397f,
+    -0.120126687f, -0.119745962f, -0.119365215f, -0.118984453f, -0.118603677f,
+    -0.118222877f, -0.117842063f, -0.117461227f, -0.117080383f, -0.116699517f,
+    -0.116318628f, -0.115937732f, -0.115556814f, -0.11517588f, -0.114794925f,
+    -0.114413962f, -0.114032976f, -0.113651969f, -0.113270953f, -0.112889916f,
+    -0.112508863f, -0.112127796f, -0.111746714f, -0.111365609f, -0.110984489f,
+    -0.110603355f, -0.110222206f, -0.109841041f, -0.109459855f, -0.109078661f,
+    -0.108697444f, -0.108316213f, -0.107934967f, -0.107553706f, -0.107172422f,
+    -0.106791131f, -0.106409818f, -0.106028497f, -0.105647154f, -0.105265796f,
+    -0.104884423f, -0.104503036f, -0.104121633f, -0.103740215f, -0.103358783f,
+    -0.102977335f, -0.102595866f, -0.102214389f, -0.101832896f, -0.101451389f,
+    -0.10106986f, -0.100688323f, -0.100306772f, -0.0999252051f, -0.0995436162f,
+    -0.0991620198f, -0.0987804085f, -0.0983987823f, -0.0980171412f,
+    -0.0976354852f, -0.0972538143f, -0.0968721285f, -0.0964904279f,
+    -0.0961087197f, -0.0957269892f, -0.0953452513f, -0.0949634984f,
+    -0.0945817232f, -0.0941999406f, -0.093818143f, -0.093436338f,
+    -0.0930545107f, -0.0926726758f, -0.0922908187f, -0.0919089541f,
+    -0.0915270746f, -0.0911451876f, -0.0907632783f, -0.0903813615f,
+    -0.0899994299f, -0.0896174833f, -0.0892355219f, -0.0888535529f,
+    -0.0884715691f, -0.0880895704f, -0.0877075568f, -0.0873255357f,
+    -0.0869434997f, -0.0865614489f, -0.0861793905f, -0.0857973099f,
+    -0.0854152218f, -0.0850331262f, -0.0846510157f, -0.0842688903f,
+    -0.08388675f, -0.0835046023f, -0.0831224397f, -0.0827402622f,
+    -0.0823580772f, -0.0819758773f, -0.08159367f, -0.0812114477f,
+    -0.0808292106f, -0.080446966f, -0.0800647065f, -0.0796824396f,
+    -0.0793001577f, -0.078917861f, -0.0785355568f, -0.0781532452f,
+    -0.0777709112f, -0.0773885772f, -0.0770062208f, -0.0766238645f,
+    -0.0762414858f, -0.0758591071f, -0.075476706f, -0.0750942975f,
+    -0.0747118816f, -0.0743294507f, -0.0739470124f, -0.0735645667f,
+    -0.0731820986f, -0.0727996305f, -0.0724171475f, -0.0720346496f,
+    -0.0716521516f, -0.0712696314f, -0.0708871111f, -0.070504576f,
+    -0.0701220259f, -0.0697394684f, -0.0693569034f, -0.068974331f,
+    -0.0685917437f, -0.0682091415f, -0.0678265393f, -0.0674439222f,
+    -0.0670612901f, -0.0666786581f, -0.0662960112f, -0.0659133494f,
+    -0.0655306876f, -0.0651480108f, -0.0647653267f, -0.0643826276f,
+    -0.0639999285f, -0.0636172146f, -0.0632344931f, -0.0628517568f,
+    -0.0624690168f, -0.0620862655f, -0.0617035069f, -0.061320737f,
+    -0.0609379597f, -0.0605551712f, -0.0601723753f, -0.0597895719f,
+    -0.0594067574f, -0.0590239353f, -0.0586411059f, -0.0582582653f,
+    -0.0578754172f, -0.0574925579f, -0.0571096949f, -0.0567268208f,
+    -0.0563439392f, -0.0559610501f, -0.0555781499f, -0.0551952459f,
+    -0.0548123308f, -0.0544294082f, -0.0540464781f, -0.0536635369f,
+    -0.053280592f, -0.0528976358f, -0.052514676f, -0.052131705f, -0.0517487265f,
+    -0.0513657406f, -0.050982751f, -0.0505997501f, -0.0502167419f,
+    -0.0498337261f, -0.049450703f, -0.0490676761f, -0.048684638f,
+    -0.0483015925f, -0.0479185432f, -0.0475354828f, -0.0471524186f,
+    -0.046769347f, -0.046386268f, -0.0460031815f, -0.0456200913f,
+    -0.0452369899f, -0.0448538847f, -0.0444707721f, -0.0440876521f,
+    -0.0437045284f, -0.0433213934f, -0.0429382585f, -0.0425551124f,
+    -0.0421719626f, -0.0417888053f, -0.0414056405f, -0.0410224721f,
+    -0.0406392962f, -0.0402561165f, -0.0398729257f, -0.0394897349f,
+    -0.0391065367f, -0.0387233309f, -0.0383401215f, -0.0379569046f,
+    -0.037573684f, -0.0371904559f, -0.0368072242f, -0.0364239849f,
+    -0.036040742f, -0.0356574915f, -0.0352742374f, -0.0348909795f,
+    -0.0345077142f, -0.0341244452f, -0.0337411724f, -0.0333578922f,
+    -0.0329746082f, -0.0325913206f, -0.0322080255f, -0.0318247266f,
+    -0.031441424f, -0.0310581159f, -0.030674804f, -0.0302914865f,
+    -0.0299081653f, -0.0295248386f, -0.029141508f, -0.0287581738f,
+    -0.0283748358f, -0.0279914923f, -0.027608145f, -0.027224794f,
+    -0.0268414393f, -0.0264580809f, -0.0260747187f, -0.0256913509f,
+    -0.0253079813f, -0.0249246061f, -0.024541229f, -0.0241578463f,
+    -0.0237744618f, -0.0233910736f, -0.0230076816f, -0.0226242859f,
+    -0.0222408883f, -0.0218574852f, -0.0214740802f, -0.0210906714f,
+    -0.0207072608f, -0.0203238465f, -0.0199404284f, -0.0195570085f,
+    -0.0191735849f, -0.0187901594f, -0.0184067301f, -0.0180232991f,
+    -0.0176398642f, -0.0172564276f, -0.0168729872f, -0.0164895467f,
+    -0.0161061026f, -0.0157226548f, -0.015339206f, -0.0149557553f,
+    -0.0145723019f, -0.0141888466f, -0.0138053885f, -0.0134219285f,
+    -0.0130384676f, -0.0126550039f, -0.0122715384f, -0.011888071f,
+    -0.0115046017f, -0.0111211315f, -0.0107376594f, -0.0103541855f,
+    -0.00997070968f, -0.00958723295f, -0.00920375437f, -0.00882027484f,
+    -0.00843679439f, -0.00805331208f, -0.00766982883f, -0.00728634419f,
+    -0.00690285861f, -0.00651937211f, -0.00613588467f, -0.0057523963f,
+    -0.005368907f, -0.00498541677f, -0.00460192608f, -0.00421843445f,
+    -0.00383494259f, -0.00345145003f, -0.00306795677f, -0.00268446305f,
+    -0.00230096909f, -0.00191747479f, -0.00153398013f, -0.00115048536f,
+    -0.000766990299f, -0.000383495179f
+};
+
+// bit reversal as the pairs of positions to swap
+static const uint16_t fft_fixed_swaps[8128][2] = {
+    {1, 8192}, {2, 4096}, {3, 12288}, {4, 2048}, {5, 10240}, {6, 6144},
+    {7, 14336}, {8, 1024}, {9, 9216}, {10, 5120}, {11, 13312}, {12, 3072},
+    {13, 11264}, {14, 7168}, {15, 15360}, {16, 512}, {17, 8704}, {18, 4608},
+    {19, 12800}, {20, 2560}, {21, 10752}, {22, 6656}, {23, 14848}, {24, 1536},
+    {25, 9728}, {26, 5632}, {27, 13824}, {28, 3584}, {29, 11776}, {30, 7680},
+    {31, 15872}, {32, 256}, {33, 8448}, {34, 4352}, {35, 12544}, {36, 2304},
+    {37, 10496}, {38, 6400}, {39, 14592}, {40, 1280}, {41, 9472}, {42, 5376},
+    {43, 13568}, {44, 3328}, {45, 11520}, {46, 7424}, {47, 15616}, {48, 768},
+    {49, 8960}, {50, 4864}, {51, 13056}, {52, 2816}, {53, 11008}, {54, 6912},
+    {55, 15104}, {56, 1792}, {57, 9984}, {58, 5888}, {59, 14080}, {60, 3840},
+    {61, 12032}, {62, 7936}, {63, 16128}, {64, 128}, {65, 8320}, {66, 4224},
+    {67, 12416}, {68, 2176}, {69, 10368}, {70, 6272}, {71, 14464}, {72, 1152},
+    {73, 9344}, {74, 5248}, {75, 13440}, {76, 3200}, {77, 11392}, {78, 7296},
+    {79, 15488}, {80, 640}, {81, 8832}, {82, 4736}, {83, 12928}, {84, 2688},
+    {85, 10880}, {86, 6784}, {87, 14976}, {88, 1664}, {89, 9856}, {90, 5760},
+    {91, 13952}, {92, 3712}, {93, 11904}, {94, 7808}, {95, 16000}, {96, 384},
+    {97, 8576}, {98, 4480}, {99, 12672}, {100, 2432}, {101, 10624}, {102, 6528},
+    {103, 14720}, {104, 1408}, {105, 9600}, {106, 5504}, {107, 13696},
+    {108, 3456}, {109, 11648}, {110, 7552}, {111, 15744}, {112, 896},
+    {113, 9088}, {114, 4992}, {115, 13184}, {116, 2944}, {117, 11136},
+    {118, 7040}, {119, 15232}, {120, 1920}, {121, 10112}, {122, 6016},
+    {123, 14208}, {124, 3968}, {125, 12160}, {126, 8064}, {127, 16256},
+    {129, 8256}, {130, 4160}, {131, 12352}, {132, 2112}, {133, 10304},
+    {134, 6208}, {135, 14400}, {136, 1088}, {137, 9280}, {138, 5184},
+    {139, 13376}, {140, 3136}, {141, 11328}, {142, 7232}, {143, 15424},
+    {144, 576}, {145, 8768}, {146, 4672}, {147, 12864}, {148, 2624},
+    {149, 10816}, {150, 6720}, {151, 14912}, {152, 1600}, {153, 9792},
+    {154, 5696}, {155, 13888}, {156, 3648}, {157, 11840}, {158, 7744},
+    {159, 15936}, {160, 320}, {161, 8512}, {162, 4416}, {163, 12608},
+    {164, 2368}, {165, 10560}, {166, 6464}, {167, 14656}, {168, 1344},
+    {169, 9536}, {170, 5440}, {171, 13632}, {172, 3392}, {173, 11584},
+    {174, 7488}, {175, 15680}, {176, 832}, {177, 9024}, {178, 4928},
+    {179, 13120}, {180, 2880}, {181, 11072}, {182, 6976}, {183, 15168},
+    {184, 1856}, {185, 10048}, {186, 5952}, {187, 14144}, {188, 3904},
+    {189, 12096}, {190, 8000}, {191, 16192}, {193, 8384}, {194, 4288},
+    {195, 12480}, {196, 2240}, {197, 10432}, {198, 6336}, {199, 14528},
+    {200, 1216}, {201, 9408}, {202, 5312}, {203, 13504}, {204, 3264},
+    {205, 11456}, {206, 7360}, {207, 15552}, {208, 704}, {209, 8896},
+    {210, 4800}, {211, 12992}, {212, 2752}, {213, 10944}, {214, 6848},
+    {215, 15040}, {216, 1728}, {217, 9920}, {218, 5824}, {219, 14016},
+    {220, 3776}, {221, 11968}, {222, 7872}, {223, 16064}, {224, 448},
+    {225, 8640}, {226, 4544}, {227, 12736}, {228, 2496}, {229, 10688},
+    {230, 6592}, {231, 14784}, {232, 1472}, {233, 9664}, {234, 5568},
+    {235, 13760}, {236, 3520}, {237, 11712}, {238, 7616}, {239, 15808},
+    {240, 960}, {241, 9152}, {242, 5056}, {243, 13248}, {244, 3008},
+    {245, 11200}, {246, 7104}, {247, 15296}, {248, 1984}, {249, 10176},
+    {250, 6080}, {251, 14272}, {252, 4032}, {253, 12224}, {254, 8128},
+    {255, 16320}, {257, 8224}, {258, 4128}, {259, 12320}, {260, 2080},
+    {261, 10272}, {262, 6176}, {263, 14368}, {264, 1056}, {265, 9248},
+    {266, 5152}, {267, 13344}, {268, 3104}, {269, 11296}, {270, 7200},
+    {271, 15392}, {272, 544}, {273, 8736}, {274, 4640}, {275, 12832},
+    {276, 2592}, {277, 10784}, {278, 6688}, {279, 14880}, {280, 1568},
+    {281, 9760}, {282, 5664}, {283, 13856}, {284, 3616}, {285, 11808},
+    {286, 7712}, {287, 15904}, {289, 8480}, {290, 4384}, {291, 12576},
+    {292, 2336}, {293, 10528}, {294, 6432}, {295, 14624}, {296, 1312},
+    {297, 9504}, {298, 5408}, {299, 13600}, {300, 3360}, {301, 11552},
+    {302, 7456}, {303, 15648}, {304, 800}, {305, 8992}, {306, 4896},
+    {307, 13088}, {308, 2848}, {309, 11040}, {310, 6944}, {311, 15136},
+    {312, 1824}, {313, 10016}, {314, 5920}, {315, 14112}, {316, 3872},
+    {317, 12064}, {318, 7968}, {319, 16160}, {321, 8352}, {322, 4256},
+    {323, 12448}, {324, 2208}, {325, 10400}, {326, 6304}, {327, 14496},
+    {328, 1184}, {329, 9376}, {330, 5280}, {331, 13472}, {332, 3232},
+    {333, 11424}, {334, 7328}, {335, 15520}, {336, 672}, {337, 8864},
+    {338, 4768}, {339, 12960}, {340, 2720}, {341, 10912}, {342, 6816},
+    {343, 15008}, {344, 1696}, {345, 9888}, {346, 5792}, {347, 13984},
+    {348, 3744}, {349, 11936}, {350, 7840}, {351, 16032}, {352, 416},
+    {353, 8608}, {354, 4512}, {355, 12704}, {356, 2464}, {357, 10656},
+    {358, 6560}, {359, 14752}, {360, 1440}, {361, 9632}, {362, 5536},
+    {363, 13728}, {364, 3488}, {365, 11680}, {366, 7584}, {367, 15776},
+    {368, 928}, {369, 9120}, {370, 5024}, {371, 13216}, {372, 2976},
+    {373, 11168}, {374, 7072}, {375, 15264}, {376, 1952}, {377, 10144},
+    {378, 6048}, {379, 14240}, {380, 4000}, {381, 12192}, {382, 8096},
+    {383, 16288}, {385, 8288}, {386, 4192}, {387, 12384}, {388, 2144},
+    {389, 10336}, {390, 6240}, {391, 14432}, {392, 1120}, {393, 9312},
+    {394, 5216}, {395, 13408}, {396, 3168}, {397, 11360}, {398, 7264},
+    {399, 15456}, {400, 608}, {401, 8800}, {402, 4704}, {403, 12896},
+    {404, 2656}, {405, 10848}, {406, 6752}, {407, 14944}, {408, 1632},
+    {409, 9824}, {410, 5728}, {411, 13920}, {412, 3680}, {413, 11872},
+    {414, 7776}, {415, 15968}, {417, 8544}, {418, 4448}, {419, 12640},
+    {420, 2400}, {421, 10592}, {422, 6496}, {423, 14688}, {424, 1376},
+    {425, 9568}, {426, 5472}, {427, 13664}, {428, 3424}, {429, 11616},
+    {430, 7520}, {431, 15712}, {432, 864}, {433, 9056}, {434, 4960},
+    {435, 13152}, {436, 2912}, {437, 11104}, {438, 7008}, {439, 15200},
+    {440, 1888}, {441, 10080}, {442, 5984}, {443, 14176}, {444, 3936},
+    {445, 12128}, {446, 8032}, {447, 16224}, {449, 8416}, {450, 4320},
+    {451, 12512}, {452, 2272}, {453, 10464}, {454, 6368}, {455, 14560},
+    {456, 1248}, {457, 9440}, {458, 5344}, {459, 13536}, {460, 3296},
+    {461, 11488}, {462, 7392}, {463, 15584}, {464, 736}, {465, 8928},
+    {466, 4832}, {467, 13024}, {468, 2784}, {469, 10976}, {470, 6880},
+    {471, 15072}, {472, 1760}, {473, 9952}, {474, 5856}, {475, 14048},
+    {476, 3808}, {477, 12000}, {478, 7904}, {479, 16096}, {481, 8672},
+    {482, 4576}, {483, 12768}, {484, 2528}, {485, 10720}, {486, 6624},
+    {487, 14816}, {488, 1504}, {489, 9696}, {490, 5600}, {491, 13792},
+    {492, 3552}, {493, 11744}, {494, 7648}, {495, 15840}, {496, 992},
+    {497, 9184}, {498, 5088}, {499, 13280}, {500, 3040}, {501, 11232},
+    {502, 7136}, {503, 15328}, {504, 2016}, {505, 10208}, {506, 6112},
+    {507, 14304}, {508, 4064}, {509, 12256}, {510, 8160}, {511, 16352},
+    {513, 8208}, {514, 4112}, {515, 12304}, {516, 2064}, {517, 10256},
+    {518, 6160}, {519, 14352}, {520, 1040}, {521, 9232}, {522, 5136},
+    {523, 13328}, {524, 3088}, {525, 11280}, {526, 7184}, {527, 15376},
+    {529, 8720}, {530, 4624}, {531, 12816}, {532, 2576}, {533, 10768},
+    {534, 6672}, {535, 14864}, {536, 1552}, {537, 9744}, {538, 5648},
+    {539, 13840}, {540, 3600}, {541, 11792}, {542, 7696}, {543, 15888},
+    {545, 8464}, {546, 4368}, {547, 12560}, {548, 2320}, {549, 10512},
+    {550, 6416}, {551, 14608}, {552, 1296}, {553, 9488}, {554, 5392},
+    {555, 13584}, {556, 3344}, {557, 11536}, {558, 7440}, {559, 15632},
+    {560, 784}, {561, 8976}, {562, 4880}, {563, 13072}, {564, 2832},
+    {565, 11024}, {566, 6928}, {567, 15120}, {568, 1808}, {569, 10000},
+    {570, 5904}, {571, 14096}, {572, 3856}, {573, 12048}, {574, 7952},
+    {575, 16144}, {577, 8336}, {578, 4240}, {579, 12432}, {580, 2192},
+    {581, 10384}, {582, 6288}, {583, 14480}, {584, 1168}, {585, 9360},
+    {586, 5264}, {587, 13456}, {588, 3216}, {589, 11408}, {590, 7312},
+    {591, 15504}, {592, 656}, {593, 8848}, {594, 4752}, {595, 12944},
+    {596, 2704}, {597, 10896}, {598, 6800}, {599, 14992}, {600, 1680},
+    {601, 9872}, {602, 5776}, {603, 13968}, {604, 3728}, {605, 11920},
+    {606, 7824}, {607, 16016}, {609, 8592}, {610, 4496}, {611, 12688},
+    {612, 2448}, {613, 10640}, {614, 6544}, {615, 14736}, {616, 1424},
+    {617, 9616}, {618, 5520}, {619, 13712}, {620, 3472}, {621, 11664},
+    {622, 7568}, {623, 15760}, {624, 912}, {625, 9104}, {626, 5008},
+    {627, 13200}, {628, 2960}, {629, 11152}, {630, 7056}, {631, 15248},
+    {632, 1936}, {633, 10128}, {634, 6032}, {635, 14224}, {636, 3984},
+    {637, 12176}, {638, 8080}, {639, 16272}, {641, 8272}, {642, 4176},
+    {643, 12368}, {644, 2128}, {645, 10320}, {646, 6224}, {647, 14416},
+    {648, 1104}, {649, 9296}, {650, 5200}, {651, 13392}, {652, 3152},
+    {653, 11344}, {654, 7248}, {655, 15440}, {657, 8784}, {658, 4688},
+    {659, 12880}, {660, 2640}, {661, 10832}, {662, 6736}, {663, 14928},
+    {664, 1616}, {665, 9808}, {666, 5712}, {667, 13904}, {668, 3664},
+    {669, 11856}, {670, 7760}, {671, 15952}, {673, 8528}, {674, 4432},
+    {675, 12624}, {676, 2384}, {677, 10576}, {678, 6480}, {679, 14672},
+    {680, 1360}, {681, 9552}, {682, 5456}, {683, 13648}, {684, 3408},
+    {685, 11600}, {686, 7504}, {687, 15696}, {688, 848}, {689, 9040},
+    {690, 4944}, {691, 13136}, {692, 2896}, {693, 11088}, {694, 6992},
+    {695, 15184}, {696, 1872}, {697, 10064}, {698, 5968}, {699, 14160},
+    {700, 3920}, {701, 12112}, {702, 8016}, {703, 16208}, {705, 8400},
+    {706, 4304}, {707, 12496}, {708, 2256}, {709, 10448}, {710, 6352},
+    {711, 14544}, {712, 1232}, {713, 9424}, {714, 5328}, {715, 13520},
+    {716, 3280}, {717, 11472}, {718, 7376}, {719, 15568}, {721, 8912},
+    {722, 4816}, {723, 13008}, {724, 2768}, {725, 10960}, {726, 6864},
+    {727, 15056}, {728, 1744}, {729, 9936}, {730, 5840}, {731, 14032},
+    {732, 3792}, {733, 11984}, {734, 7888}, {735, 16080}, {737, 8656},
+    {738, 4560}, {739, 12752}, {740, 2512}, {741, 10704}, {742, 6608},
+    {743, 14800}, {744, 1488}, {745, 9680}, {746, 5584}, {747, 13776},
+    {748, 3536}, {749, 11728}, {750, 7632}, {751, 15824}, {752, 976},
+    {753, 9168}, {754, 5072}, {755, 13264}, {756, 3024}, {757, 11216},
+    {758, 7120}, {759, 15312}, {760, 2000}, {761, 10192}, {762, 6096},
+    {763, 14288}, {764, 4048}, {765, 12240}, {766, 8144}, {767, 16336},
+    {769, 8240}, {770, 4144}, {771, 12336}, {772, 2096}, {773, 10288},
+    {774, 6192}, {775, 14384}, {776, 1072}, {777, 9264}, {778, 5168},
+    {779, 13360}, {780, 3120}, {781, 11312}, {782, 7216}, {783, 15408},
+    {785, 8752}, {786, 4656}, {787, 12848}, {788, 2608}, {789, 10800},
+    {790, 6704}, {791, 14896}, {792, 1584}, {793, 9776}, {794, 5680},
+    {795, 13872}, {796, 3632}, {797, 11824}, {798, 7728}, {799, 15920},
+    {801, 8496}, {802, 4400}, {803, 12592}, {804, 2352}, {805, 10544},
+    {806, 6448}, {807, 14640}, {808, 1328}, {809, 9520}, {810, 5424},
+    {811, 13616}, {812, 3376}, {813, 11568}, {814, 7472}, {815, 15664},
+    {817, 9008}, {818, 4912}, {819, 13104}, {820, 2864}, {821, 11056},
+    {822, 6960}, {823, 15152}, {824, 1840}, {825, 10032}, {826, 5936},
+    {827, 14128}, {828, 3888}, {829, 12080}, {830, 7984}, {831, 16176},
+    {833, 8368}, {834, 4272}, {835, 12464}, {836, 2224}, {837, 10416},
+    {838, 6320}, {839, 14512}, {840, 1200}, {841, 9392}, {842, 5296},
+    {843, 13488}, {844, 3248}, {845, 11440}, {846, 7344}, {847, 15536},
+    {849, 8880}, {850, 4784}, {851, 12976}, {852, 2736}, {853, 10928},
+    {854, 6832}, {855, 15024}, {856, 1712}, {857, 9904}, {858, 5808},
+    {859, 14000}, {860, 3760}, {861, 11952}, {862, 7856}, {863, 16048},
+    {865, 8624}, {866, 4528}, {867, 12720}, {868, 2480}, {869, 10672},
+    {870, 6576}, {871, 14768}, {872, 1456}, {873, 9648}, {874, 5552},
+    {875, 13744}, {876, 3504}, {877, 11696}, {878, 7600}, {879, 15792},
+    {880, 944}, {881, 9136}, {882, 5040}, {883, 13232}, {884, 2992},
+    {885, 11184}, {886, 7088}, {887, 15280}, {888, 1968}, {889, 10160},
+    {890, 6064}, {891, 14256}, {892, 4016}, {893, 12208}, {894, 8112},
+    {895, 16304}, {897, 8304}, {898, 4208}, {899, 12400}, {900, 2160},
+    {901, 10352}, {902, 6256}, {903, 14448}, {904, 1136}, {905, 9328},
+    {906, 5232}, {907, 13424}, {908, 3184}, {909, 11376}, {910, 7280},
+    {911, 15472}, {913, 8816}, {914, 4720}, {915, 12912}, {916, 2672},
+    {917, 10864}, {918, 6768}, {919, 14960}, {920, 1648}, {921, 9840},
+    {922, 5744}, {923, 13936}, {924, 3696}, {925, 11888}, {926, 7792},
+    {927, 15984}, {929, 8560}, {930, 4464}, {931, 12656}, {932, 2416},
+    {933, 10608}, {934, 6512}, {935, 14704}, {936, 1392}, {937, 9584},
+    {938, 5488}, {939, 13680}, {940, 3440}, {941, 11632}, {942, 7536},
+    {943, 15728}, {945, 9072}, {946, 4976}, {947, 13168}, {948, 2928},
+    {949, 11120}, {950, 7024}, {951, 15216}, {952, 1904}, {953, 10096},
+    {954, 6000}, {955, 14192}, {956, 3952}, {957, 12144}, {958, 8048},
+    {959, 16240}, {961, 8432}, {962, 4336}, {963, 12528}, {964, 2288},
+    {965, 10480}, {966, 6384}, {967, 14576}, {968, 1264}, {969, 9456},
+    {970, 5360}, {971, 13552}, {972, 3312}, {973, 11504}, {974, 7408},
+    {975, 15600}, {977, 8944}, {978, 4848}, {979, 13040}, {980, 2800},
+    {981, 10992}, {982, 6896}, {983, 15088}, {984, 1776}, {985, 9968},
+    {986, 5872}, {987, 14064}, {988, 3824}, {989, 12016}, {990, 7920},
+    {991, 16112}, {993, 8688}, {994, 4592}, {995, 12784}, {996, 2544},
+    {997, 10736}, {998, 6640}, {999, 14832}, {1000, 1520}, {1001, 9712},
+    {1002, 5616}, {1003, 13808}, {1004, 3568}, {1005, 11760}, {1006, 7664},
+    {1007, 15856}, {1009, 9200}, {1010, 5104}, {1011, 13296}, {1012, 3056},
+    {1013, 11248}, {1014, 7152}, {1015, 15344}, {1016, 2032}, {1017, 10224},
+    {1018, 6128}, {1019, 14320}, {1020, 4080}, {1021, 12272}, {1022, 8176},
+    {1023, 16368}, {1025, 8200}, {1026, 4104}, {1027, 12296}, {1028, 2056},
+    {1029, 10248}, {1030, 6152}, {1031, 14344}, {1033, 9224}, {1034, 5128},
+    {1035, 13320}, {1036, 3080}, {1037, 11272}, {1038, 7176}, {1039, 15368},
+    {1041, 8712}, {1042, 4616}, {1043, 12808}, {1044, 2568}, {1045, 10760},
+    {1046, 6664}, {1047, 14856}, {1048, 1544}, {1049, 9736}, {1050, 5640},
+    {1051, 13832}, {1052, 3592}, {1053, 11784}, {1054, 7688}, {1055, 15880},
+    {1057, 8456}, {1058, 4360}, {1059, 12552}, {1060, 2312}, {1061, 10504},
+    {1062, 6408}, {1063, 14600}, {1064, 1288}, {1065, 9480}, {1066, 5384},
+    {1067, 13576}, {1068, 3336}, {1069, 11528}, {1070, 7432}, {1071, 15624},
+    {1073, 8968}, {1074, 4872}, {1075, 13064}, {1076, 2824}, {1077, 11016},
+    {1078, 6920}, {1079, 15112}, {1080, 1800}, {1081, 9992}, {1082, 5896},
+    {1083, 14088}, {1084, 3848}, {1085, 12040}, {1086, 7944}, {1087, 16136},
+    {1089, 8328}, {1090, 4232}, {1091, 12424}, {1092, 2184}, {1093, 10376},
+    {1094, 6280}, {1095, 14472}, {1096, 1160}, {1097, 9352}, {1098, 5256},
+    {1099, 13448}, {1100, 3208}, {1101, 11400}, {1102, 7304}, {1103, 15496},
+    {1105, 8840}, {1106, 4744}, {1107, 12936}, {1108, 2696}, {1109, 10888},
+    {1110, 6792}, {1111, 14984}, {1112, 1672}, {1113, 9864}, {1114, 5768},
+    {1115, 13960}, {1116, 3720}, {1117, 11912}, {1118, 7816}, {1119, 16008},
+    {1121, 8584}, {1122, 4488}, {1123, 12680}, {1124, 2440}, {1125, 10632},
+    {1126, 6536}, {1127, 14728}, {1128, 1416}, {1129, 9608}, {1130, 5512},
+    {1131, 13704}, {1132, 3464}, {1133, 11656}, {1134, 7560}, {1135, 15752},
+    {1137, 9096}, {1138, 5000}, {1139, 13192}, {1140, 2952}, {1141, 11144},
+    {1142, 7048}, {1143, 15240}, {1144, 1928}, {1145, 10120}, {1146, 6024},
+    {1147, 14216}, {1148, 3976}, {1149, 12168}, {1150, 8072}, {1151, 16264},
+    {1153, 8264}, {1154, 4168}, {1155, 12360}, {1156, 2120}, {1157, 10312},
+    {1158, 6216}, {1159, 14408}, {1161, 9288}, {1162, 5192}, {1163, 13384},
+    {1164, 3144}, {1165, 11336}, {1166, 7240}, {1167, 15432}, {1169, 8776},
+    {1170, 4680}, {1171, 12872}, {1172, 2632}, {1173, 10824}, {1174, 6728},
+    {1175, 14920}, {1176, 1608}, {1177, 9800}, {1178, 5704}, {1179, 13896},
+    {1180, 3656}, {1181, 11848}, {1182, 7752}, {1183, 15944}, {1185, 8520},
+    {1186, 4424}, {1187, 12616}, {1188, 2376}, {1189, 10568}, {1190, 6472},
+    {1191, 14664}, {1192, 1352}, {1193, 9544}, {1194, 5448}, {1195, 13640},
+    {1196, 3400}, {1197, 11592}, {1198, 7496}, {1199, 15688}, {1201, 9032},
+    {1202, 4936}, {1203, 13128}, {1204, 2888}, {1205, 11080}, {1206, 6984},
+    {1207, 15176}, {1208, 1864}, {1209, 10056}, {1210, 5960}, {1211, 14152},
+    {1212, 3912}, {1213, 12104}, {1214, 8008}, {1215, 16200}, {1217, 8392},
+    {1218, 4296}, {1219, 12488}, {1220, 2248}, {1221, 10440}, {1222, 6344},
+    {1223, 14536}, {1225, 9416}, {1226, 5320}, {1227, 13512}, {1228, 3272},
+    {1229, 11464}, {1230, 7368}, {1231, 15560}, {1233, 8904}, {1234, 4808},
+    {1235, 13000}, {1236, 2760}, {1237, 10952}, {1238, 6856}, {1239, 15048},
+    {1240, 1736}, {1241, 9928}, {1242, 5832}, {1243, 14024}, {1244, 3784},
+    {1245, 11976}, {1246, 7880}, {1247, 16072}, {1249, 8648}, {1250, 4552},
+    {1251, 12744}, {1252, 2504}, {1253, 10696}, {1254, 6600}, {1255, 14792},
+    {1256, 1480}, {1257, 9672}, {1258, 5576}, {1259, 13768}, {1260, 3528},
+    {1261, 11720}, {1262, 7624}, {1263, 15816}, {1265, 9160}, {1266, 5064},
+    {1267, 13256}, {1268, 3016}, {1269, 11208}, {1270, 7112}, {1271, 15304},
+    {1272, 1992}, {1273, 10184}, {1274, 6088}, {1275, 14280}, {1276, 4040},
+    {1277, 12232}, {1278, 8136}, {1279, 16328}, {1281, 8232}, {1282, 4136},
+    {1283, 12328}, {1284, 2088}, {1285, 10280}, {1286, 6184}, {1287, 14376},
+    {1289, 9256}, {1290, 5160}, {1291, 13352}, {1292, 3112}, {1293, 11304},
+    {1294, 7208}, {1295, 15400}, {1297, 8744}, {1298, 4648}, {1299, 12840},
+    {1300, 2600}, {1301, 10792}, {1302, 6696}, {1303, 14888}, {1304, 1576},
+    {1305, 9768}, {1306, 5672}, {1307, 13864}, {1308, 3624}, {1309, 11816},
+    {1310, 7720}, {1311, 15912}, {1313, 8488}, {1314, 4392}, {1315, 12584},
+    {1316, 2344}, {1317, 10536}, {1318, 6440}, {1319, 14632}, {1321, 9512},
+    {1322, 5416}, {1323, 13608}, {1324, 3368}, {1325, 11560}, {1326, 7464},
+    {1327, 15656}, {1329, 9000}, {1330, 4904}, {1331, 13096}, {1332, 2856},
+    {1333, 11048}, {1334, 6952}, {1335, 15144}, {1336, 1832}, {1337, 10024},
+    {1338, 5928}, {1339, 14120}, {1340, 3880}, {1341, 12072}, {1342, 7976},
+    {1343, 16168}, {1345, 8360}, {1346, 4264}, {1347, 12456}, {1348, 2216},
+    {1349, 10408}, {1350, 6312}, {1351, 14504}, {1353, 9384}, {1354, 5288},
+    {1355, 13480}, {1356, 3240}, {1357, 11432}, {1358, 7336}, {1359, 15528},
+    {1361, 8872}, {1362, 4776}, {1363, 12968}, {1364, 2728}, {1365, 10920},
+    {1366, 6824}, {1367, 15016}, {1368, 1704}, {1369, 9896}, {1370, 5800},
+    {1371, 13992}, {1372, 3752}, {1373, 11944}, {1374, 7848}, {1375, 16040},
+    {1377, 8616}, {1378, 4520}, {1379, 12712}, {1380, 2472}, {1381, 10664},
+    {1382, 6568}, {1383, 14760}, {1384, 1448}, {1385, 9640}, {1386, 5544},
+    {1387, 13736}, {1388, 3496}, {1389, 11688}, {1390, 7592}, {1391, 15784},
+    {1393, 9128}, {1394, 5032}, {1395, 13224}, {1396, 2984}, {1397, 11176},
+    {1398, 7080}, {1399, 15272}, {1400, 1960}, {1401, 10152}, {1402, 6056},
+    {1403, 14248}, {1404, 4008}, {1405, 12200}, {1406, 8104}, {1407, 16296},
+    {1409, 8296}, {1410, 4200}, {1411, 12392}, {1412, 2152}, {1413, 10344},
+    {1414, 6248}, {1415, 14440}, {1417, 9320}, {1418, 5224}, {1419, 13416},
+    {1420, 3176}, {1421, 11368}, {1422, 7272}, {1423, 15464}, {1425, 8808},
+    {1426, 4712}, {1427, 12904}, {1428, 2664}, {1429, 10856}, {1430, 6760},
+    {1431, 14952}, {1432, 1640}, {1433, 9832}, {1434, 5736}, {1435, 13928},
+    {1436, 3688}, {1437, 11880}, {1438, 7784}, {1439, 15976}, {1441, 8552},
+    {1442, 4456}, {1443, 12648}, {1444, 2408}, {1445, 10600}, {1446, 6504},
+    {1447, 14696}, {1449, 9576}, {1450, 5480}, {1451, 13672}, {1452, 3432},
+    {1453, 11624}, {1454, 7528}, {1455, 15720}, {1457, 9064}, {1458, 4968},
+    {1459, 13160}, {1460, 2920}, {1461, 11112}, {1462, 7016}, {1463, 15208},
+    {1464, 1896}, {1465, 10088}, {1466, 5992}, {1467, 14184}, {1468, 3944},
+    {1469, 12136}, {1470, 8040}, {1471, 16232}, {1473, 8424}, {1474, 4328},
+    {1475, 12520}, {1476, 2280}, {1477, 10472}, {1478, 6376}, {1479, 14568},
+    {1481, 9448}, {1482, 5352}, {1483, 13544}, {1484, 3304}, {1485, 11496},
+    {1486, 7400}, {1487, 15592}, {1489, 8936}, {1490, 4840}, {1491, 13032},
+    {1492, 2792}, {1493, 10984}, {1494, 6888}, {1495, 15080}, {1496, 1768},
+    {1497, 9960}, {1498, 5864}, {1499, 14056}, {1500, 3816}, {1501, 12008},
+    {1502, 7912}, {1503, 16104}, {1505, 8680}, {1506, 4584}, {1507, 12776},
+    {1508, 2536}, {1509, 10728}, {1510, 6632}, {1511, 14824}, {1513, 9704},
+    {1514, 5608}, {1515, 13800}, {1516, 3560}, {1517, 11752}, {1518, 7656},
+    {1519, 15848}, {1521, 9192}, {1522, 5096}, {1523, 13288}, {1524, 3048},
+    {1525, 11240}, {1526, 7144}, {1527, 15336}, {1528, 2024}, {1529, 10216},
+    {1530, 6120}, {1531, 14312}, {1532, 4072}, {1533, 12264}, {1534, 8168},
+    {1535, 16360}, {1537, 8216}, {1538, 4120}, {1539, 12312}, {1540, 2072},
+    {1541, 10264}, {1542, 6168}, {1543, 14360}, {1545, 9240}, {1546, 5144},
+    {1547, 13336}, {1548, 3096}, {1549, 11288}, {1550, 7192}, {1551, 15384},
+    {1553, 8728}, {1554, 4632}, {1555, 12824}, {1556, 2584}, {1557, 10776},
+    {1558, 6680}, {1559, 14872}, {1561, 9752}, {1562, 5656}, {1563, 13848},
+    {1564, 3608}, {1565, 11800}, {1566, 7704}, {1567, 15896}, {1569, 8472},
+    {1570, 4376}, {1571, 12568}, {1572, 2328}, {1573, 10520}, {1574, 6424},
+    {1575, 14616}, {1577, 9496}, {1578, 5400}, {1579, 13592}, {1580, 3352},
+    {1581, 11544}, {1582, 7448}, {1583, 15640}, {1585, 8984}, {1586, 4888},
+    {1587, 13080}, {1588, 2840}, {1589, 11032}, {1590, 6936}, {1591, 15128},
+    {1592, 1816}, {1593, 10008}, {1594, 5912}, {1595, 14104}, {1596, 3864},
+    {1597, 12056}, {1598, 7960}, {1599, 16152}, {1601, 8344}, {1602, 4248},
+    {1603, 12440}, {1604, 2200}, {1605, 10392}, {1606, 6296}, {1607, 14488},
+    {1609, 9368}, {1610, 5272}, {1611, 13464}, {1612, 3224}, {1613, 11416},
+    {1614, 7320}, {1615, 15512}, {1617, 8856}, {1618, 4760}, {1619, 12952},
+    {1620, 2712}, {1621, 10904}, {1622, 6808}, {1623, 15000}, {1624, 1688},
+    {1625, 9880}, {1626, 5784}, {1627, 13976}, {1628, 3736}, {1629, 11928},
+    {1630, 7832}, {1631, 16024}, {1633, 8600}, {1634, 4504}, {1635, 12696},
+    {1636, 2456}, {1637, 10648}, {1638, 6552}, {1639, 14744}, {1641, 9624},
+    {1642, 5528}, {1643, 13720}, {1644, 3480}, {1645, 11672}, {1646, 7576},
+    {1647, 15768}, {1649, 9112}, {1650, 5016}, {1651, 13208}, {1652, 2968},
+    {1653, 11160}, {1654, 7064}, {1655, 15256}, {1656, 1944}, {1657, 10136},
+    {1658, 6040}, {1659, 14232}, {1660, 3992}, {1661, 12184}, {1662, 8088},
+    {1663, 16280}, {1665, 8280}, {1666, 4184}, {1667, 12376}, {1668, 2136},
+    {1669, 10328}, {1670, 6232}, {1671, 14424}, {1673, 9304}, {1674, 5208},
+    {1675, 13400}, {1676, 3160}, {1677, 11352}, {1678, 7256}, {1679, 15448},
+    {1681, 8792}, {1682, 4696}, {1683, 12888}, {1684, 2648}, {1685, 10840},
+    {1686, 6744}, {1687, 14936}, {1689, 9816}, {1690, 5720}, {1691, 13912},
+    {1692, 3672}, {1693, 11864}, {1694, 7768}, {1695, 15960}, {1697, 8536},
+    {1698, 4440}, {1699, 12632}, {1700, 2392}, {1701, 10584}, {1702, 6488},
+    {1703, 14680}, {1705, 9560}, {1706, 5464}, {1707, 13656}, {1708, 3416},
+    {1709, 11608}, {1710, 7512}, {1711, 15704}, {1713, 9048}, {1714, 4952},
+    {1715, 13144}, {1716, 2904}, {1717, 11096}, {1718, 7000}, {1719, 15192},
+    {1720, 1880}, {1721, 10072}, {1722, 5976}, {1723, 14168}, {1724, 3928},
+    {1725, 12120}, {1726, 8024}, {1727, 16216}, {1729, 8408}, {1730, 4312},
+    {1731, 12504}, {1732, 2264}, {1733, 10456}, {1734, 6360}, {1735, 14552},
+    {1737, 9432}, {1738, 5336}, {1739, 13528}, {1740, 3288}, {1741, 11480},
+    {1742, 7384}, {1743, 15576}, {1745, 8920}, {1746, 4824}, {1747, 13016},
+    {1748, 2776}, {1749, 10968}, {1750, 6872}, {1751, 15064}, {1753, 9944},
+    {1754, 5848}, {1755, 14040}, {1756, 3800}, {1757, 11992}, {1758, 7896},
+    {1759, 16088}, {1761, 8664}, {1762, 4568}, {1763, 12760}, {1764, 2520},
+    {1765, 10712}, {1766, 6616}, {1767, 14808}, {1769, 9688}, {1770, 5592},
+    {1771, 13784}, {1772, 3544}, {1773, 11736}, {1774, 7640}, {1775, 15832},
+    {1777, 9176}, {1778, 5080}, {1779, 13272}, {1780, 3032}, {1781, 11224},
+    {1782, 7128}, {1783, 15320}, {1784, 2008}, {1785, 10200}, {1786, 6104},
+    {1787, 14296}, {1788, 4056}, {1789, 12248}, {1790, 8152}, {1791, 16344},
+    {1793, 8248}, {1794, 4152}, {1795, 12344}, {1796, 2104}, {1797, 10296},
+    {1798, 6200}, {1799, 14392}, {1801, 9272}, {1802, 5176}, {1803, 13368},
+    {1804, 3128}, {1805, 11320}, {1806, 7224}, {1807, 15416}, {1809, 8760},
+    {1810, 4664}, {1811, 12856}, {1812, 2616}, {1813, 10808}, {1814, 6712},
+    {1815, 14904}, {1817, 9784}, {1818, 5688}, {1819, 13880}, {1820, 3640},
+    {1821, 11832}, {1822, 7736}, {1823, 15928}, {1825, 8504}, {1826, 4408},
+    {1827, 12600}, {1828, 2360}, {1829, 10552}, {1830, 6456}, {1831, 14648},
+    {1833, 9528}, {1834, 5432}, {1835, 13624}, {1836, 3384}, {1837, 11576},
+    {1838, 7480}, {1839, 15672}, {1841, 9016}, {1842, 4920}, {1843, 13112},
+    {1844, 2872}, {1845, 11064}, {1846, 6968}, {1847, 15160}, {1849, 10040},
+    {1850, 5944}, {1851, 14136}, {1852, 3896}, {1853, 12088}, {1854, 7992},
+    {1855, 16184}, {1857, 8376}, {1858, 4280}, {1859, 12472}, {1860, 2232},
+    {1861, 10424}, {1862, 6328}, {1863, 14520}, {1865, 9400}, {1866, 5304},
+    {1867, 13496}, {1868, 3256}, {1869, 11448}, {1870, 7352}, {1871, 15544},
+    {1873, 8888}, {1874, 4792}, {1875, 12984}, {1876, 2744}, {1877, 10936},
+    {1878, 6840}, {1879, 15032}, {1881, 9912}, {1882, 5816}, {1883, 14008},
+    {1884, 3768}, {1885, 11960}, {1886, 7864}, {1887, 16056}, {1889, 8632},
+    {1890, 4536}, {1891, 12728}, {1892, 2488}, {1893, 10680}, {1894, 6584},
+    {1895, 14776}, {1897, 9656}, {1898, 5560}, {1899, 13752}, {1900, 3512},
+    {1901, 11704}, {1902, 7608}, {1903, 15800}, {1905, 9144}, {1906, 5048},
+    {1907, 13240}, {1908, 3000}, {1909, 11192}, {1910, 7096}, {1911, 15288},
+    {1912, 1976}, {1913, 10168}, {1914, 6072}, {1915, 14264}, {1916, 4024},
+    {1917, 12216}, {1918, 8120}, {1919, 16312}, {1921, 8312}, {1922, 4216},
+    {1923, 12408}, {1924, 2168}, {1925, 10360}, {1926, 6264}, {1927, 14456},
+    {1929, 9336}, {1930, 5240}, {1931, 13432}, {1932, 3192}, {1933, 11384},
+    {1934, 7288}, {1935, 15480}, {1937, 8824}, {1938, 4728}, {1939, 12920},
+    {1940, 2680}, {1941, 10872}, {1942, 6776}, {1943, 14968}, {1945, 9848},
+    {1946, 5752}, {1947, 13944}, {1948, 3704}, {1949, 11896}, {1950, 7800},
+    {1951, 15992}, {1953, 8568}, {1954, 4472}, {1955, 12664}, {1956, 2424},
+    {1957, 10616}, {1958, 6520}, {1959, 14712}, {1961, 9592}, {1962, 5496},
+    {1963, 13688}, {1964, 3448}, {1965, 11640}, {1966, 7544}, {1967, 15736},
+    {1969, 9080}, {1970, 4984}, {1971, 13176}, {1972, 2936}, {1973, 11128},
+    {1974, 7032}, {1975, 15224}, {1977, 10104}, {1978, 6008}, {1979, 14200},
+    {1980, 3960}, {1981, 12152}, {1982, 8056}, {1983, 16248}, {1985, 8440},
+    {1986, 4344}, {1987, 12536}, {1988, 2296}, {1989, 10488}, {1990, 6392},
+    {1991, 14584}, {1993, 9464}, {1994, 5368}, {1995, 13560}, {1996, 3320},
+    {1997, 11512}, {1998, 7416}, {1999, 15608}, {2001, 8952}, {2002, 4856},
+    {2003, 13048}, {2004, 2808}, {2005, 11000}, {2006, 6904}, {2007, 15096},
+    {2009, 9976}, {2010, 5880}, {2011, 14072}, {2012, 3832}, {2013, 12024},
+    {2014, 7928}, {2015, 16120}, {2017, 8696}, {2018, 4600}, {2019, 12792},
+    {2020, 2552}, {2021, 10744}, {2022, 6648}, {2023, 14840}, {2025, 9720},
+    {2026, 5624}, {2027, 13816}, {2028, 3576}, {2029, 11768}, {2030, 7672},
+    {2031, 15864}, {2033, 9208}, {2034, 5112}, {2035, 13304}, {2036, 3064},
+    {2037, 11256}, {2038, 7160}, {2039, 15352}, {2041, 10232}, {2042, 6136},
+    {2043, 14328}, {2044, 4088}, {2045, 12280}, {2046, 8184}, {2047, 16376},
+    {2049, 8196}, {2050, 4100}, {2051, 12292}, {2053, 10244}, {2054, 6148},
+    {2055, 14340}, {2057, 9220}, {2058, 5124}, {2059, 13316}, {2060, 3076},
+    {2061, 11268}, {2062, 7172}, {2063, 15364}, {2065, 8708}, {2066, 4612},
+    {2067, 12804}, {2068, 2564}, {2069, 10756}, {2070, 6660}, {2071, 14852},
+    {2073, 9732}, {2074, 5636}, {2075, 13828}, {2076, 3588}, {2077, 11780},
+    {2078, 7684}, {2079, 15876}, {2081, 8452}, {2082, 4356}, {2083, 12548},
+    {2084, 2308}, {2085, 10500}, {2086, 6404}, {2087, 14596}, {2089, 9476},
+    {2090, 5380}, {2091, 13572}, {2092, 3332}, {2093, 11524}, {2094, 7428},
+    {2095, 15620}, {2097, 8964}, {2098, 4868}, {2099, 13060}, {2100, 2820},
+    {2101, 11012}, {2102, 6916}, {2103, 15108}, {2105, 9988}, {2106, 5892},
+    {2107, 14084}, {2108, 3844}, {2109, 12036}, {2110, 7940}, {2111, 16132},
+    {2113, 8324}, {2114, 4228}, {2115, 12420}, {2116, 2180}, {2117, 10372},
+    {2118, 6276}, {2119, 14468}, {2121, 9348}, {2122, 5252}, {2123, 13444},
+    {2124, 3204}, {2125, 11396}, {2126, 7300}, {2127, 15492}, {2129, 8836},
+    {2130, 4740}, {2131, 12932}, {2132, 2692}, {2133, 10884}, {2134, 6788},
+    {2135, 14980}, {2137, 9860}, {2138, 5764}, {2139, 13956}, {2140, 3716},
+    {2141, 11908}, {2142, 7812}, {2143, 16004}, {2145, 8580}, {2146, 4484},
+    {2147, 12676}, {2148, 2436}, {2149, 10628}, {2150, 6532}, {2151, 14724},
+    {2153, 9604}, {2154, 5508}, {2155, 13700}, {2156, 3460}, {2157, 11652},
+    {2158, 7556}, {2159, 15748}, {2161, 9092}, {2162, 4996}, {2163, 13188},
+    {2164, 2948}, {2165, 11140}, {2166, 7044}, {2167, 15236}, {2169, 10116},
+    {2170, 6020}, {2171, 14212}, {2172, 3972}, {2173, 12164}, {2174, 8068},
+    {2175, 16260}, {2177, 8260}, {2178, 4164}, {2179, 12356}, {2181, 10308},
+    {2182, 6212}, {2183, 14404}, {2185, 9284}, {2186, 5188}, {2187, 13380},
+    {2188, 3140}, {2189, 11332}, {2190, 7236}, {2191, 15428}, {2193, 8772},
+    {2194, 4676}, {2195, 12868}, {2196, 2628}, {2197, 10820}, {2198, 6724},
+    {2199, 14916}, {2201, 9796}, {2202, 5700}, {2203, 13892}, {2204, 3652},
+    {2205, 11844}, {2206, 7748}, {2207, 15940}, {2209, 8516}, {2210, 4420},
+    {2211, 12612}, {2212, 2372}, {2213, 10564}, {2214, 6468}, {2215, 14660},
+    {2217, 9540}, {2218, 5444}, {2219, 13636}, {2220, 3396}, {2221, 11588},
+    {2222, 7492}, {2223, 15684}, {2225, 9028}, {2226, 4932}, {2227, 13124},
+    {2228, 2884}, {2229, 11076}, {2230, 6980}, {2231, 15172}, {2233, 10052},
+    {2234, 5956}, {2235, 14148}, {2236, 3908}, {2237, 12100}, {2238, 8004},
+    {2239, 16196}, {2241, 8388}, {2242, 4292}, {2243, 12484}, {2245, 10436},
+    {2246, 6340}, {2247, 14532}, {2249, 9412}, {2250, 5316}, {2251, 13508},
+    {2252, 3268}, {2253, 11460}, {2254, 7364}, {2255, 15556}, {2257, 8900},
+    {2258, 4804}, {2259, 12996}, {2260, 2756}, {2261, 10948}, {2262, 6852},
+    {2263, 15044}, {2265, 9924}, {2266, 5828}, {2267, 14020}, {2268, 3780},
+    {2269, 11972}, {2270, 7876}, {2271, 16068}, {2273, 8644}, {2274, 4548},
+    {2275, 12740}, {2276, 2500}, {2277, 10692}, {2278, 6596}, {2279, 14788},
+    {2281, 9668}, {2282, 5572}, {2283, 13764}, {2284, 3524}, {2285, 11716},
+    {2286, 7620}, {2287, 15812}, {2289, 9156}, {2290, 5060}, {2291, 13252},
+    {2292, 3012}, {2293, 11204}, {2294, 7108}, {2295, 15300}, {2297, 10180},
+    {2298, 6084}, {2299, 14276}, {2300, 4036}, {2301, 12228}, {2302, 8132},
+    {2303, 16324}, {2305, 8228}, {2306, 4132}, {2307, 12324}, {2309, 10276},
+    {2310, 6180}, {2311, 14372}, {2313, 9252}, {2314, 5156}, {2315, 13348},
+    {2316, 3108}, {2317, 11300}, {2318, 7204}, {2319, 15396}, {2321, 8740},
+    {2322, 4644}, {2323, 12836}, {2324, 2596}, {2325, 10788}, {2326, 6692},
+    {2327, 14884}, {2329, 9764}, {2330, 5668}, {2331, 13860}, {2332, 3620},
+    {2333, 11812}, {2334, 7716}, {2335, 15908}, {2337, 8484}, {2338, 4388},
+    {2339, 12580}, {2341, 10532}, {2342, 6436}, {2343, 14628}, {2345, 9508},
+    {2346, 5412}, {2347, 13604}, {2348, 3364}, {2349, 11556}, {2350, 7460},
+    {2351, 15652}, {2353, 8996}, {2354, 4900}, {2355, 13092}, {2356, 2852},
+    {2357, 11044}, {2358, 6948}, {2359, 15140}, {2361, 10020}, {2362, 5924},
+    {2363, 14116}, {2364, 3876}, {2365, 12068}, {2366, 7972}, {2367, 16164},
+    {2369, 8356}, {2370, 4260}, {2371, 12452}, {2373, 10404}, {2374, 6308},
+    {2375, 14500}, {2377, 9380}, {2378, 5284}, {2379, 13476}, {2380, 3236},
+    {2381, 11428}, {2382, 7332}, {2383, 15524}, {2385, 8868}, {2386, 4772},
+    {2387, 12964}, {2388, 2724}, {2389, 10916}, {2390, 6820}, {2391, 15012},
+    {2393, 9892}, {2394, 5796}, {2395, 13988}, {2396, 3748}, {2397, 11940},
+    {2398, 7844}, {2399, 16036}, {2401, 8612}, {2402, 4516}, {2403, 12708},
+    {2404, 2468}, {2405, 10660}, {2406, 6564}, {2407, 14756}, {2409, 9636},
+    {2410, 5540}, {2411, 13732}, {2412, 3492}, {2413, 11684}, {2414, 7588},
+    {2415, 15780}, {2417, 9124}, {2418, 5028}, {2419, 13220}, {2420, 2980},
+    {2421, 11172}, {2422, 7076}, {2423, 15268}, {2425, 10148}, {2426, 6052},
+    {2427, 14244}, {2428, 4004}, {2429, 12196}, {2430, 8100}, {2431, 16292},
+    {2433, 8292}, {2434, 4196}, {2435, 12388}, {2437, 10340}, {2438, 6244},
+    {2439, 14436}, {2441, 9316}, {2442, 5220}, {2443, 13412}, {2444, 3172},
+    {2445, 11364}, {2446, 7268}, {2447, 15460}, {2449, 8804}, {2450, 4708},
+    {2451, 12900}, {2452, 2660}, {2453, 10852}, {2454, 6756}, {2455, 14948},
+    {2457, 9828}, {2458, 5732}, {2459, 13924}, {2460, 3684}, {2461, 11876},
+    {2462, 7780}, {2463, 15972}, {2465, 8548}, {2466, 4452}, {2467, 12644},
+    {2469, 10596}, {2470, 6500}, {2471, 14692}, {2473, 9572}, {2474, 5476},
+    {2475, 13668}, {2476, 3428}, {2477, 11620}, {2478, 7524}, {2479, 15716},
+    {2481, 9060}, {2482, 4964}, {2483, 13156}, {2484, 2916}, {2485, 11108},
+    {2486, 7012}, {2487, 15204}, {2489, 10084}, {2490, 5988}, {2491, 14180},
+    {2492, 3940}, {2493, 12132}, {2494, 8036}, {2495, 16228}, {2497, 8420},
+    {2498, 4324}, {2499, 12516}, {2501, 10468}, {2502, 6372}, {2503, 14564},
+    {2505, 9444}, {2506, 5348}, {2507, 13540}, {2508, 3300}, {2509, 11492},
+    {2510, 7396}, {2511, 15588}, {2513, 8932}, {2514, 4836}, {2515, 13028},
+    {2516, 2788}, {2517, 10980}, {2518, 6884}, {2519, 15076}, {2521, 9956},
+    {2522, 5860}, {2523, 14052}, {2524, 3812}, {2525, 12004}, {2526, 7908},
+    {2527, 16100}, {2529, 8676}, {2530, 4580}, {2531, 12772}, {2533, 10724},
+    {2534, 6628}, {2535, 14820}, {2537, 9700}, {2538, 5604}, {2539, 13796},
+    {2540, 3556}, {2541, 11748}, {2542, 7652}, {2543, 15844}, {2545, 9188},
+    {2546, 5092}, {2547, 13284}, {2548, 3044}, {2549, 11236}, {2550, 7140},
+    {2551, 15332}, {2553, 10212}, {2554, 6116}, {2555, 14308}, {2556, 4068},
+    {2557, 12260}, {2558, 8164}, {2559, 16356}, {2561, 8212}, {2562, 4116},
+    {2563, 12308}, {2565, 10260}, {2566, 6164}, {2567, 14356}, {2569, 9236},
+    {2570, 5140}, {2571, 13332}, {2572, 3092}, {2573, 11284}, {2574, 7188},
+    {2575, 15380}, {2577, 8724}, {2578, 4628}, {2579, 12820}, {2581, 10772},
+    {2582, 6676}, {2583, 14868}, {2585, 9748}, {2586, 5652}, {2587, 13844},
+    {2588, 3604}, {2589, 11796}, {2590, 7700}, {2591, 15892}, {2593, 8468},
+    {2594, 4372}, {2595, 12564}, {2597, 10516}, {2598, 6420}, {2599, 14612},
+    {2601, 9492}, {2602, 5396}, {2603, 13588}, {2604, 3348}, {2605, 11540},
+    {2606, 7444}, {2607, 15636}, {2609, 8980}, {2610, 4884}, {2611, 13076},
+    {2612, 2836}, {2613, 11028}, {2614, 6932}, {2615, 15124}, {2617, 10004},
+    {2618, 5908}, {2619, 14100}, {2620, 3860}, {2621, 12052}, {2622, 7956},
+    {2623, 16148}, {2625, 8340}, {2626, 4244}, {2627, 12436}, {2629, 10388},
+    {2630, 6292}, {2631, 14484}, {2633, 9364}, {2634, 5268}, {2635, 13460},
+    {2636, 3220}, {2637, 11412}, {2638, 7316}, {2639, 15508}, {2641, 8852},
+    {2642, 4756}, {2643, 12948}, {2644, 2708}, {2645, 10900}, {2646, 6804},
+    {2647, 14996}, {2649, 9876}, {2650, 5780}, {2651, 13972}, {2652, 3732},
+    {2653, 11924}, {2654, 7828}, {2655, 16020}, {2657, 8596}, {2658, 4500},
+    {2659, 12692}, {2661, 10644}, {2662, 6548}, {2663, 14740}, {2665, 9620},
+    {2666, 5524}, {2667, 13716}, {2668, 3476}, {2669, 11668}, {2670, 7572},
+    {2671, 15764}, {2673, 9108}, {2674, 5012}, {2675, 13204}, {2676, 2964},
+    {2677, 11156}, {2678, 7060}, {2679, 15252}, {2681, 10132}, {2682, 6036},
+    {2683, 14228}, {2684, 3988}, {2685, 12180}, {2686, 8084}, {2687, 16276},
+    {2689, 8276}, {2690, 4180}, {2691, 12372}, {2693, 10324}, {2694, 6228},
+    {2695, 14420}, {2697, 9300}, {2698, 5204}, {2699, 13396}, {2700, 3156},
+    {2701, 11348}, {2702, 7252}, {2703, 15444}, {2705, 8788}, {2706, 4692},
+    {2707, 12884}, {2709, 10836}, {2710, 6740}, {2711, 14932}, {2713, 9812},
+    {2714, 5716}, {2715, 13908}, {2716, 3668}, {2717, 11860}, {2718, 7764},
+    {2719, 15956}, {2721, 8532}, {2722, 4436}, {2723, 12628}, {2725, 10580},
+    {2726, 6484}, {2727, 14676}, {2729, 9556}, {2730, 5460}, {2731, 13652},
+    {2732, 3412}, {2733, 11604}, {2734, 7508}, {2735, 15700}, {2737, 9044},
+    {2738, 4948}, {2739, 13140}, {2740, 2900}, {2741, 11092}, {2742, 6996},
+    {2743, 15188}, {2745, 10068}, {2746, 5972}, {2747, 14164}, {2748, 3924},
+    {2749, 12116}, {2750, 8020}, {2751, 16212}, {2753, 8404}, {2754, 4308},
+    {2755, 12500}, {2757, 10452}, {2758, 6356}, {2759, 14548}, {2761, 9428},
+    {2762, 5332}, {2763, 13524}, {2764, 3284}, {2765, 11476}, {2766, 7380},
+    {2767, 15572}, {2769, 8916}, {2770, 4820}, {2771, 13012}, {2773, 10964},
+    {2774, 6868}, {2775, 15060}, {2777, 9940}, {2778, 5844}, {2779, 14036},
+    {2780, 3796}, {2781, 11988}, {2782, 7892}, {2783, 16084}, {2785, 8660},
+    {2786, 4564}, {2787, 12756}, {2789, 10708}, {2790, 6612}, {2791, 14804},
+    {2793, 9684}, {2794, 5588}, {2795, 13780}, {2796, 3540}, {2797, 11732},
+    {2798, 7636}, {2799, 15828}, {2801, 9172}, {2802, 5076}, {2803, 13268},
+    {2804, 3028}, {2805, 11220}, {2806, 7124}, {2807, 15316}, {2809, 10196},
+    {2810, 6100}, {2811, 14292}, {2812, 4052}, {2813, 12244}, {2814, 8148},
+    {2815, 16340}, {2817, 8244}, {2818, 4148}, {2819, 12340}, {2821, 10292},
+    {2822, 6196}, {2823, 14388}, {2825, 9268}, {2826, 5172}, {2827, 13364},
+    {2828, 3124}, {2829, 11316}, {2830, 7220}, {2831, 15412}, {2833, 8756},
+    {2834, 4660}, {2835, 12852}, {2837, 10804}, {2838, 6708}, {2839, 14900},
+    {2841, 9780}, {2842, 5684}, {2843, 13876}, {2844, 3636}, {2845, 11828},
+    {2846, 7732}, {2847, 15924}, {2849, 8500}, {2850, 4404}, {2851, 12596},
+    {2853, 10548}, {2854, 6452}, {2855, 14644}, {2857, 9524}, {2858, 5428},
+    {2859, 13620}, {2860, 3380}, {2861, 11572}, {2862, 7476}, {2863, 15668},
+    {2865, 9012}, {2866, 4916}, {2867, 13108}, {2869, 11060}, {2870, 6964},
+    {2871, 15156}, {2873, 10036}, {2874, 5940}, {2875, 14132}, {2876, 3892},
+    {2877, 12084}, {2878, 7988}, {2879, 16180}, {2881, 8372}, {2882, 4276},
+    {2883, 12468}, {2885, 10420}, {2886, 6324}, {2887, 14516}, {2889, 9396},
+    {2890, 5300}, {2891, 13492}, {2892, 3252}, {2893, 11444}, {2894, 7348},
+    {2895, 15540}, {2897, 8884}, {2898, 4788}, {2899, 12980}, {2901, 10932},
+    {2902, 6836}, {2903, 15028}, {2905, 9908}, {2906, 5812}, {2907, 14004},
+    {2908, 3764}, {2909, 11956}, {2910, 7860}, {2911, 16052}, {2913, 8628},
+    {2914, 4532}, {2915, 12724}, {2917, 10676}, {2918, 6580}, {2919, 14772},
+    {2921, 9652}, {2922, 5556}, {2923, 13748}, {2924, 3508}, {2925, 11700},
+    {2926, 7604}, {2927, 15796}, {2929, 9140}, {2930, 5044}, {2931, 13236},
+    {2932, 2996}, {2933, 11188}, {2934, 7092}, {2935, 15284}, {2937, 10164},
+    {2938, 6068}, {2939, 14260}, {2940, 4020}, {2941, 12212}, {2942, 8116},
+    {2943, 16308}, {2945, 8308}, {2946, 4212}, {2947, 12404}, {2949, 10356},
+    {2950, 6260}, {2951, 14452}, {2953, 9332}, {2954, 5236}, {2955, 13428},
+    {2956, 3188}, {2957, 11380}, {2958, 7284}, {2959, 15476}, {2961, 8820},
+    {2962, 4724}, {2963, 12916}, {2965, 10868}, {2966, 6772}, {2967, 14964},
+    {2969, 9844}, {2970, 5748}, {2971, 13940}, {2972, 3700}, {2973, 11892},
+    {2974, 7796}, {2975, 15988}, {2977, 8564}, {2978, 4468}, {2979, 12660},
+    {2981, 10612}, {2982, 6516}, {2983, 14708}, {2985, 9588}, {2986, 5492},
+    {2987, 13684}, {2988, 3444}, {2989, 11636}, {2990, 7540}, {2991, 15732},
+    {2993, 9076}, {2994, 4980}, {2995, 13172}, {2997, 11124}, {2998, 7028},
+    {2999, 15220}, {3001, 10100}, {3002, 6004}, {3003, 14196}, {3004, 3956},
+    {3005, 12148}, {3006, 8052}, {3007, 16244}, {3009, 8436}, {3010, 4340},
+    {3011, 12532}, {3013, 10484}, {3014, 6388}, {3015, 14580}, {3017, 9460},
+    {3018, 5364}, {3019, 13556}, {3020, 3316}, {3021, 11508}, {3022, 7412},
+    {3023, 15604}, {3025, 8948}, {3026, 4852}, {3027, 13044}, {3029, 10996},
+    {3030, 6900}, {3031, 15092}, {3033, 9972}, {3034, 5876}, {3035, 14068},
+    {3036, 3828}, {3037, 12020}, {3038, 7924}, {3039, 16116}, {3041, 8692},
+    {3042, 4596}, {3043, 12788}, {3045, 10740}, {3046, 6644}, {3047, 14836},
+    {3049, 9716}, {3050, 5620}, {3051, 13812}, {3052, 3572}, {3053, 11764},
+    {3054, 7668}, {3055, 15860}, {3057, 9204}, {3058, 5108}, {3059, 13300},
+    {3061, 11252}, {3062, 7156}, {3063, 15348}, {3065, 10228}, {3066, 6132},
+    {3067, 14324}, {3068, 4084}, {3069, 12276}, {3070, 8180}, {3071, 16372},
+    {3073, 8204}, {3074, 4108}, {3075, 12300}, {3077, 10252}, {3078, 6156},
+    {3079, 14348}, {3081, 9228}, {3082, 5132}, {3083, 13324}, {3085, 11276},
+    {3086, 7180}, {3087, 15372}, {3089, 8716}, {3090, 4620}, {3091, 12812},
+    {3093, 10764}, {3094, 6668}, {3095, 14860}, {3097, 9740}, {3098, 5644},
+    {3099, 13836}, {3100, 3596}, {3101, 11788}, {3102, 7692}, {3103, 15884},
+    {3105, 8460}, {3106, 4364}, {3107, 12556}, {3109, 10508}, {3110, 6412},
+    {3111, 14604}, {3113, 9484}, {3114, 5388}, {3115, 13580}, {3116, 3340},
+    {3117, 11532}, {3118, 7436}, {3119, 15628}, {3121, 8972}, {3122, 4876},
+    {3123, 13068}, {3125, 11020}, {3126, 6924}, {3127, 15116}, {3129, 9996},
+    {3130, 5900}, {3131, 14092}, {3132, 3852}, {3133, 12044}, {3134, 7948},
+    {3135, 16140}, {3137, 8332}, {3138, 4236}, {3139, 12428}, {3141, 10380},
+    {3142, 6284}, {3143, 14476}, {3145, 9356}, {3146, 5260}, {3147, 13452},
+    {3148, 3212}, {3149, 11404}, {3150, 7308}, {3151, 15500}, {3153, 8844},
+    {3154, 4748}, {3155, 12940}, {3157, 10892}, {3158, 6796}, {3159, 14988},
+    {3161, 9868}, {3162, 5772}, {3163, 13964}, {3164, 3724}, {3165, 11916},
+    {3166, 7820}, {3167, 16012}, {3169, 8588}, {3170, 4492}, {3171, 12684},
+    {3173, 10636}, {3174, 6540}, {3175, 14732}, {3177, 9612}, {3178, 5516},
+    {3179, 13708}, {3180, 3468}, {3181, 11660}, {3182, 7564}, {3183, 15756},
+    {3185, 9100}, {3186, 5004}, {3187, 13196}, {3189, 11148}, {3190, 7052},
+    {3191, 15244}, {3193, 10124}, {3194, 6028}, {3195, 14220}, {3196, 3980},
+    {3197, 12172}, {3198, 8076}, {3199, 16268}, {3201, 8268}, {3202, 4172},
+    {3203, 12364}, {3205, 10316}, {3206, 6220}, {3207, 14412}, {3209, 9292},
+    {3210, 5196}, {3211, 13388}, {3213, 11340}, {3214, 7244}, {3215, 15436},
+    {3217, 8780}, {3218, 4684}, {3219, 12876}, {3221, 10828}, {3222, 6732},
+    {3223, 14924}, {3225, 9804}, {3226, 5708}, {3227, 13900}, {3228, 3660},
+    {3229, 11852}, {3230, 7756}, {3231, 15948}, {3233, 8524}, {3234, 4428},
+    {3235, 12620}, {3237, 10572}, {3238, 6476}, {3239, 14668}, {3241, 9548},
+    {3242, 5452}, {3243, 13644}, {3244, 3404}, {3245, 11596}, {3246, 7500},
+    {3247, 15692}, {3249, 9036}, {3250, 4940}, {3251, 13132}, {3253, 11084},
+    {3254, 6988}, {3255, 15180}, {3257, 10060}, {3258, 5964}, {3259, 14156},
+    {3260, 3916}, {3261, 12108}, {3262, 8012}, {3263, 16204}, {3265, 8396},
+    {3266, 4300}, {3267, 12492}, {3269, 10444}, {3270, 6348}, {3271, 14540},
+    {3273, 9420}, {3274, 5324}, {3275, 13516}, {3277, 11468}, {3278, 7372},
+    {3279, 15564}, {3281, 8908}, {3282, 4812}, {3283, 13004}, {3285, 10956},
+    {3286, 6860}, {3287, 15052}, {3289, 9932}, {3290, 5836}, {3291, 14028},
+    {3292, 3788}, {3293, 11980}, {3294, 7884}, {3295, 16076}, {3297, 8652},
+    {3298, 4556}, {3299, 12748}, {3301, 10700}, {3302, 6604}, {3303, 14796},
+    {3305, 9676}, {3306, 5580}, {3307, 13772}, {3308, 3532}, {3309, 11724},
+    {3310, 7628}, {3311, 15820}, {3313, 9164}, {3314, 5068}, {3315, 13260},
+    {3317, 11212}, {3318, 7116}, {3319, 15308}, {3321, 10188}, {3322, 6092},
+    {3323, 14284}, {3324, 4044}, {3325, 12236}, {3326, 8140}, {3327, 16332},
+    {3329, 8236}, {3330, 4140}, {3331, 12332}, {3333, 10284}, {3334, 6188},
+    {3335, 14380}, {3337, 9260}, {3338, 5164}, {3339, 13356}, {3341, 11308},
+    {3342, 7212}, {3343, 15404}, {3345, 8748}, {3346, 4652}, {3347, 12844},
+    {3349, 10796}, {3350, 6700}, {3351, 14892}, {3353, 9772}, {3354, 5676},
+    {3355, 13868}, {3356, 3628}, {3357, 11820}, {3358, 7724}, {3359, 15916},
+    {3361, 8492}, {3362, 4396}, {3363, 12588}, {3365, 10540}, {3366, 6444},
+    {3367, 14636}, {3369, 9516}, {3370, 5420}, {3371, 13612}, {3373, 11564},
+    {3374, 7468}, {3375, 15660}, {3377, 9004}, {3378, 4908}, {3379, 13100},
+    {3381, 11052}, {3382, 6956}, {3383, 15148}, {3385, 10028}, {3386, 5932},
+    {3387, 14124}, {3388, 3884}, {3389, 12076}, {3390, 7980}, {3391, 16172},
+    {3393, 8364}, {3394, 4268}, {3395, 12460}, {3397, 10412}, {3398, 6316},
+    {3399, 14508}, {3401, 9388}, {3402, 5292}, {3403, 13484}, {3405, 11436},
+    {3406, 7340}, {3407, 15532}, {3409, 8876}, {3410, 4780}, {3411, 12972},
+    {3413, 10924}, {3414, 6828}, {3415, 15020}, {3417, 9900}, {3418, 5804},
+    {3419, 13996}, {3420, 3756}, {3421, 11948}, {3422, 7852}, {3423, 16044},
+    {3425, 8620}, {3426, 4524}, {3427, 12716}, {3429, 10668}, {3430, 6572},
+    {3431, 14764}, {3433, 9644}, {3434, 5548}, {3435, 13740}, {3436, 3500},
+    {3437, 11692}, {3438, 7596}, {3439, 15788}, {3441, 9132}, {3442, 5036},
+    {3443, 13228}, {3445, 11180}, {3446, 7084}, {3447, 15276}, {3449, 10156},
+    {3450, 6060}, {3451, 14252}, {3452, 4012}, {3453, 12204}, {3454, 8108},
+    {3455, 16300}, {3457, 8300}, {3458, 4204}, {3459, 12396}, {3461, 10348},
+    {3462, 6252}, {3463, 14444}, {3465, 9324}, {3466, 5228}, {3467, 13420},
+    {3469, 11372}, {3470, 7276}, {3471, 15468}, {3473, 8812}, {3474, 4716},
+    {3475, 12908}, {3477, 10860}, {3478, 6764}, {3479, 14956}, {3481, 9836},
+    {3482, 5740}, {3483, 13932}, {3484, 3692}, {3485, 11884}, {3486, 7788},
+    {3487, 15980}, {3489, 8556}, {3490, 4460}, {3491, 12652}, {3493, 10604},
+    {3494, 6508}, {3495, 14700}, {3497, 9580}, {3498, 5484}, {3499, 13676},
+    {3501, 11628}, {3502, 7532}, {3503, 15724}, {3505, 9068}, {3506, 4972},
+    {3507, 13164}, {3509, 11116}, {3510, 7020}, {3511, 15212}, {3513, 10092},
+    {3514, 5996}, {3515, 14188}, {3516, 3948}, {3517, 12140}, {3518, 8044},
+    {3519, 16236}, {3521, 8428}, {3522, 4332}, {3523, 12524}, {3525, 10476},
+    {3526, 6380}, {3527, 14572}, {3529, 9452}, {3530, 5356}, {3531, 13548},
+    {3533, 11500}, {3534, 7404}, {3535, 15596}, {3537, 8940}, {3538, 4844},
+    {3539, 13036}, {3541, 10988}, {3542, 6892}, {3543, 15084}, {3545, 9964},
+    {3546, 5868}, {3547, 14060}, {3548, 3820}, {3549, 12012}, {3550, 7916},
+    {3551, 16108}, {3553, 8684}, {3554, 4588}, {3555, 12780}, {3557, 10732},
+    {3558, 6636}, {3559, 14828}, {3561, 9708}, {3562, 5612}, {3563, 13804},
+    {3565, 11756}, {3566, 7660}, {3567, 15852}, {3569, 9196}, {3570, 5100},
+    {3571, 13292}, {3573, 11244}, {3574, 7148}, {3575, 15340}, {3577, 10220},
+    {3578, 6124}, {3579, 14316}, {3580, 4076}, {3581, 12268}, {3582, 8172},
+    {3583, 16364}, {3585, 8220}, {3586, 4124}, {3587, 12316}, {3589, 10268},
+    {3590, 6172}, {3591, 14364}, {3593, 9244}, {3594, 5148}, {3595, 13340},
+    {3597, 11292}, {3598, 7196}, {3599, 15388}, {3601, 8732}, {3602, 4636},
+    {3603, 12828}, {3605, 10780}, {3606, 6684}, {3607, 14876}, {3609, 9756},
+    {3610, 5660}, {3611, 13852}, {3613, 11804}, {3614, 7708}, {3615, 15900},
+    {3617, 8476}, {3618, 4380}, {3619, 12572}, {3621, 10524}, {3622, 6428},
+    {3623, 14620}, {3625, 9500}, {3626, 5404}, {3627, 13596}, {3629, 11548},
+    {3630, 7452}, {3631, 15644}, {3633, 8988}, {3634, 4892}, {3635, 13084},
+    {3637, 11036}, {3638, 6940}, {3639, 15132}, {3641, 10012}, {3642, 5916},
+    {3643, 14108}, {3644, 3868}, {3645, 12060}, {3646, 7964}, {3647, 16156},
+    {3649, 8348}, {3650, 4252}, {3651, 12444}, {3653, 10396}, {3654, 6300},
+    {3655, 14492}, {3657, 9372}, {3658, 5276}, {3659, 13468}, {3661, 11420},
+    {3662, 7324}, {3663, 15516}, {3665, 8860}, {3666, 4764}, {3667, 12956},
+    {3669, 10908}, {3670, 6812}, {3671, 15004}, {3673, 9884}, {3674, 5788},
+    {3675, 13980}, {3676, 3740}, {3677, 11932}, {3678, 7836}, {3679, 16028},
+    {3681, 8604}, {3682, 4508}, {3683, 12700}, {3685, 10652}, {3686, 6556},
+    {3687, 14748}, {3689, 9628}, {3690, 5532}, {3691, 13724}, {3693, 11676},
+    {3694, 7580}, {3695, 15772}, {3697, 9116}, {3698, 5020}, {3699, 13212},
+    {3701, 11164}, {3702, 7068}, {3703, 15260}, {3705, 10140}, {3706, 6044},
+    {3707, 14236}, {3708, 3996}, {3709, 12188}, {3710, 8092}, {3711, 16284},
+    {3713, 8284}, {3714, 4188}, {3715, 12380}, {3717, 10332}, {3718, 6236},
+    {3719, 14428}, {3721, 9308}, {3722, 5212}, {3723, 13404}, {3725, 11356},
+    {3726, 7260}, {3727, 15452}, {3729, 8796}, {3730, 4700}, {3731, 12892},
+    {3733, 10844}, {3734, 6748}, {3735, 14940}, {3737, 9820}, {3738, 5724},
+    {3739, 13916}, {3741, 11868}, {3742, 7772}, {3743, 15964}, {3745, 8540},
+    {3746, 4444}, {3747, 12636}, {3749, 10588}, {3750, 6492}, {3751, 14684},
+    {3753, 9564}, {3754, 5468}, {3755, 13660}, {3757, 11612}, {3758, 7516},
+    {3759, 15708}, {3761, 9052}, {3762, 4956}, {3763, 13148}, {3765, 11100},
+    {3766, 7004}, {3767, 15196}, {3769, 10076}, {3770, 5980}, {3771, 14172},
+    {3772, 3932}, {3773, 12124}, {3774, 8028}, {3775, 16220}, {3777, 8412},
+    {3778, 4316}, {3779, 12508}, {3781, 10460}, {3782, 6364}, {3783, 14556},
+    {3785, 9436}, {3786, 5340}, {3787, 13532}, {3789, 11484}, {3790, 7388},
+    {3791, 15580}, {3793, 8924}, {3794, 4828}, {3795, 13020}, {3797, 10972},
+    {3798, 6876}, {3799, 15068}, {3801, 9948}, {3802, 5852}, {3803, 14044},
+    {3805, 11996}, {3806, 7900}, {3807, 16092}, {3809, 8668}, {3810, 4572},
+    {3811, 12764}, {3813, 10716}, {3814, 6620}, {3815, 14812}, {3817, 9692},
+    {3818, 5596}, {3819, 13788}, {3821, 11740}, {3822, 7644}, {3823, 15836},
+    {3825, 9180}, {3826, 5084}, {3827, 13276}, {3829, 11228}, {3830, 7132},
+    {3831, 15324}, {3833, 10204}, {3834, 6108}, {3835, 14300}, {3836, 4060},
+    {3837, 12252}, {3838, 8156}, {3839, 16348}, {3841, 8252}, {3842, 4156},
+    {3843, 12348}, {3845, 10300}, {3846, 6204}, {3847, 14396}, {3849, 9276},
+    {3850, 5180}, {3851, 13372}, {3853, 11324}, {3854, 7228}, {3855, 15420},
+    {3857, 8764}, {3858, 4668}, {3859, 12860}, {3861, 10812}, {3862, 6716},
+    {3863, 14908}, {3865, 9788}, {3866, 5692}, {3867, 13884}, {3869, 11836},
+    {3870, 7740}, {3871, 15932}, {3873, 8508}, {3874, 4412}, {3875, 12604},
+    {3877, 10556}, {3878, 6460}, {3879, 14652}, {3881, 9532}, {3882, 5436},
+    {3883, 13628}, {3885, 11580}, {3886, 7484}, {3887, 15676}, {3889, 9020},
+    {3890, 4924}, {3891, 13116}, {3893, 11068}, {3894, 6972}, {3895, 15164},
+    {3897, 10044}, {3898, 5948}, {3899, 14140}, {3901, 12092}, {3902, 7996},
+    {3903, 16188}, {3905, 8380}, {3906, 4284}, {3907, 12476}, {3909, 10428},
+    {3910, 6332}, {3911, 14524}, {3913, 9404}, {3914, 5308}, {3915, 13500},
+    {3917, 11452}, {3918, 7356}, {3919, 15548}, {3921, 8892}, {3922, 4796},
+    {3923, 12988}, {3925, 10940}, {3926, 6844}, {3927, 15036}, {3929, 9916},
+    {3930, 5820}, {3931, 14012}, {3933, 11964}, {3934, 7868}, {3935, 16060},
+    {3937, 8636}, {3938, 4540}, {3939, 12732}, {3941, 10684}, {3942, 6588},
+    {3943, 14780}, {3945, 9660}, {3946, 5564}, {3947, 13756}, {3949, 11708},
+    {3950, 7612}, {3951, 15804}, {3953, 9148}, {3954, 5052}, {3955, 13244},
+    {3957, 11196}, {3958, 7100}, {3959, 15292}, {3961, 10172}, {3962, 6076},
+    {3963, 14268}, {3964, 4028}, {3965, 12220}, {3966, 8124}, {3967, 16316},
+    {3969, 8316}, {3970, 4220}, {3971, 12412}, {3973, 10364}, {3974, 6268},
+    {3975, 14460}, {3977, 9340}, {3978, 5244}, {3979, 13436}, {3981, 11388},
+    {3982, 7292}, {3983, 15484}, {3985, 8828}, {3986, 4732}, {3987, 12924},
+    {3989, 10876}, {3990, 6780}, {3991, 14972}, {3993, 9852}, {3994, 5756},
+    {3995, 13948}, {3997, 11900}, {3998, 7804}, {3999, 15996}, {4001, 8572},
+    {4002, 4476}, {4003, 12668}, {4005, 10620}, {4006, 6524}, {4007, 14716},
+    {4009, 9596}, {4010, 5500}, {4011, 13692}, {4013, 11644}, {4014, 7548},
+    {4015, 15740}, {4017, 9084}, {4018, 4988}, {4019, 13180}, {4021, 11132},
+    {4022, 7036}, {4023, 15228}, {4025, 10108}, {4026, 6012}, {4027, 14204},
+    {4029, 12156}, {4030, 8060}, {4031, 16252}, {4033, 8444}, {4034, 4348},
+    {4035, 12540}, {4037, 10492}, {4038, 6396}, {4039, 14588}, {4041, 9468},
+    {4042, 5372}, {4043, 13564}, {4045, 11516}, {4046, 7420}, {4047, 15612},
+    {4049, 8956}, {4050, 4860}, {4051, 13052}, {4053, 11004}, {4054, 6908},
+    {4055, 15100}, {4057, 9980}, {4058, 5884}, {4059, 14076}, {4061, 12028},
+    {4062, 7932}, {4063, 16124}, {4065, 8700}, {4066, 4604}, {4067, 12796},
+    {4069, 10748}, {4070, 6652}, {4071, 14844}, {4073, 9724}, {4074, 5628},
+    {4075, 13820}, {4077, 11772}, {4078, 7676}, {4079, 15868}, {4081, 9212},
+    {4082, 5116}, {4083, 13308}, {4085, 11260}, {4086, 7164}, {4087, 15356},
+    {4089, 10236}, {4090, 6140}, {4091, 14332}, {4093, 12284}, {4094, 8188},
+    {4095, 16380}, {4097, 8194}, {4099, 12290}, {4101, 10242}, {4102, 6146},
+    {4103, 14338}, {4105, 9218}, {4106, 5122}, {4107, 13314}, {4109, 11266},
+    {4110, 7170}, {4111, 15362}, {4113, 8706}, {4114, 4610}, {4115, 12802},
+    {4117, 10754}, {4118, 6658}, {4119, 14850}, {4121, 9730}, {4122, 5634},
+    {4123, 13826}, {4125, 11778}, {4126, 7682}, {4127, 15874}, {4129, 8450},
+    {4130, 4354}, {4131, 12546}, {4133, 10498}, {4134, 6402}, {4135, 14594},
+    {4137, 9474}, {4138, 5378}, {4139, 13570}, {4141, 11522}, {4142, 7426},
+    {4143, 15618}, {4145, 8962}, {4146, 4866}, {4147, 13058}, {4149, 11010},
+    {4150, 6914}, {4151, 15106}, {4153, 9986}, {4154, 5890}, {4155, 14082},
+    {4157, 12034}, {4158, 7938}, {4159, 16130}, {4161, 8322}, {4162, 4226},
+    {4163, 12418}, {4165, 10370}, {4166, 6274}, {4167, 14466}, {4169, 9346},
+    {4170, 5250}, {4171, 13442}, {4173, 11394}, {4174, 7298}, {4175, 15490},
+    {4177, 8834}, {4178, 4738}, {4179, 12930}, {4181, 10882}, {4182, 6786},
+    {4183, 14978}, {4185, 9858}, {4186, 5762}, {4187, 13954}, {4189, 11906},
+    {4190, 7810}, {4191, 16002}, {4193, 8578}, {4194, 4482}, {4195, 12674},
+    {4197, 10626}, {4198, 6530}, {4199, 14722}, {4201, 9602}, {4202, 5506},
+    {4203, 13698}, {4205, 11650}, {4206, 7554}, {4207, 15746}, {4209, 9090},
+    {4210, 4994}, {4211, 13186}, {4213, 11138}, {4214, 7042}, {4215, 15234},
+    {4217, 10114}, {4218, 6018}, {4219, 14210}, {4221, 12162}, {4222, 8066},
+    {4223, 16258}, {4225, 8258}, {4227, 12354}, {4229, 10306}, {4230, 6210},
+    {4231, 14402}, {4233, 9282}, {4234, 5186}, {4235, 13378}, {4237, 11330},
+    {4238, 7234}, {4239, 15426}, {4241, 8770}, {4242, 4674}, {4243, 12866},
+    {4245, 10818}, {4246, 6722}, {4247, 14914}, {4249, 9794}, {4250, 5698},
+    {4251, 13890}, {4253, 11842}, {4254, 7746}, {4255, 15938}, {4257, 8514},
+    {4258, 4418}, {4259, 12610}, {4261, 10562}, {4262, 6466}, {4263, 14658},
+    {4265, 9538}, {4266, 5442}, {4267, 13634}, {4269, 11586}, {4270, 7490},
+    {4271, 15682}, {4273, 9026}, {4274, 4930}, {4275, 13122}, {4277, 11074},
+    {4278, 6978}, {4279, 15170}, {4281, 10050}, {4282, 5954}, {4283, 14146},
+    {4285, 12098}, {4286, 8002}, {4287, 16194}, {4289, 8386}, {4291, 12482},
+    {4293, 10434}, {4294, 6338}, {4295, 14530}, {4297, 9410}, {4298, 5314},
+    {4299, 13506}, {4301, 11458}, {4302, 7362}, {4303, 15554}, {4305, 8898},
+    {4306, 4802}, {4307, 12994}, {4309, 10946}, {4310, 6850}, {4311, 15042},
+    {4313, 9922}, {4314, 5826}, {4315, 14018}, {4317, 11970}, {4318, 7874},
+    {4319, 16066}, {4321, 8642}, {4322, 4546}, {4323, 12738}, {4325, 10690},
+    {4326, 6594}, {4327, 14786}, {4329, 9666}, {4330, 5570}, {4331, 13762},
+    {4333, 11714}, {4334, 7618}, {4335, 15810}, {4337, 9154}, {4338, 5058},
+    {4339, 13250}, {4341, 11202}, {4342, 7106}, {4343, 15298}, {4345, 10178},
+    {4346, 6082}, {4347, 14274}, {4349, 12226}, {4350, 8130}, {4351, 16322},
+    {4353, 8226}, {4355, 12322}, {4357, 10274}, {4358, 6178}, {4359, 14370},
+    {4361, 9250}, {4362, 5154}, {4363, 13346}, {4365, 11298}, {4366, 7202},
+    {4367, 15394}, {4369, 8738}, {4370, 4642}, {4371, 12834}, {4373, 10786},
+    {4374, 6690}, {4375, 14882}, {4377, 9762}, {4378, 5666}, {4379, 13858},
+    {4381, 11810}, {4382, 7714}, {4383, 15906}, {4385, 8482}, {4387, 12578},
+    {4389, 10530}, {4390, 6434}, {4391, 14626}, {4393, 9506}, {4394, 5410},
+    {4395, 13602}, {4397, 11554}, {4398, 7458}, {4399, 15650}, {4401, 8994},
+    {4402, 4898}, {4403, 13090}, {4405, 11042}, {4406, 6946}, {4407, 15138},
+    {4409, 10018}, {4410, 5922}, {4411, 14114}, {4413, 12066}, {4414, 7970},
+    {4415, 16162}, {4417, 8354}, {4419, 12450}, {4421, 10402}, {4422, 6306},
+    {4423, 14498}, {4425, 9378}, {4426, 5282}, {4427, 13474}, {4429, 11426},
+    {4430, 7330}, {4431, 15522}, {4433, 8866}, {4434, 4770}, {4435, 12962},
+    {4437, 10914}, {4438, 6818}, {4439, 15010}, {4441, 9890}, {4442, 5794},
+    {4443, 13986}, {4445, 11938}, {4446, 7842}, {4447, 16034}, {4449, 8610},
+    {4450, 4514}, {4451, 12706}, {4453, 10658}, {4454, 6562}, {4455, 14754},
+    {4457, 9634}, {4458, 5538}, {4459, 13730}, {4461, 11682}, {4462, 7586},
+    {4463, 15778}, {4465, 9122}, {4466, 5026}, {4467, 13218}, {4469, 11170},
+    {4470, 7074}, {4471, 15266}, {4473, 10146}, {4474, 6050}, {4475, 14242},
+    {4477, 12194}, {4478, 8098}, {4479, 16290}, {4481, 8290}, {4483, 12386},
+    {4485, 10338}, {4486, 6242}, {4487, 14434}, {4489, 9314}, {4490, 5218},
+    {4491, 13410}, {4493, 11362}, {4494, 7266}, {4495, 15458}, {4497, 8802},
+    {4498, 4706}, {4499, 12898}, {4501, 10850}, {4502, 6754}, {4503, 14946},
+    {4505, 9826}, {4506, 5730}, {4507, 13922}, {4509, 11874}, {4510, 7778},
+    {4511, 15970}, {4513, 8546}, {4515, 12642}, {4517, 10594}, {4518, 6498},
+    {4519, 14690}, {4521, 9570}, {4522, 5474}, {4523, 13666}, {4525, 11618},
+    {4526, 7522}, {4527, 15714}, {4529, 9058}, {4530, 4962}, {4531, 13154},
+    {4533, 11106}, {4534, 7010}, {4535, 15202}, {4537, 10082}, {4538, 5986},
+    {4539, 14178}, {4541, 12130}, {4542, 8034}, {4543, 16226}, {4545, 8418},
+    {4547, 12514}, {4549, 10466}, {4550, 6370}, {4551, 14562}, {4553, 9442},
+    {4554, 5346}, {4555, 13538}, {4557, 11490}, {4558, 7394}, {4559, 15586},
+    {4561, 8930}, {4562, 4834}, {4563, 13026}, {4565, 10978}, {4566, 6882},
+    {4567, 15074}, {4569, 9954}, {4570, 5858}, {4571, 14050}, {4573, 12002},
+    {4574, 7906}, {4575, 16098}, {4577, 8674}, {4579, 12770}, {4581, 10722},
+    {4582, 6626}, {4583, 14818}, {4585, 9698}, {4586, 5602}, {4587, 13794},
+    {4589, 11746}, {4590, 7650}, {4591, 15842}, {4593, 9186}, {4594, 5090},
+    {4595, 13282}, {4597, 11234}, {4598, 7138}, {4599, 15330}, {4601, 10210},
+    {4602, 6114}, {4603, 14306}, {4605, 12258}, {4606, 8162}, {4607, 16354},
+    {4609, 8210}, {4611, 12306}, {4613, 10258}, {4614, 6162}, {4615, 14354},
+    {4617, 9234}, {4618, 5138}, {4619, 13330}, {4621, 11282}, {4622, 7186},
+    {4623, 15378}, {4625, 8722}, {4627, 12818}, {4629, 10770}, {4630, 6674},
+    {4631, 14866}, {4633, 9746}, {4634, 5650}, {4635, 13842}, {4637, 11794},
+    {4638, 7698}, {4639, 15890}, {4641, 8466}, {4643, 12562}, {4645, 10514},
+    {4646, 6418}, {4647, 14610}, {4649, 9490}, {4650, 5394}, {4651, 13586},
+    {4653, 11538}, {4654, 7442}, {4655, 15634}, {4657, 8978}, {4658, 4882},
+    {4659, 13074}, {4661, 11026}, {4662, 6930}, {4663, 15122}, {4665, 10002},
+    {4666, 5906}, {4667, 14098}, {4669, 12050}, {4670, 7954}, {4671, 16146},
+    {4673, 8338}, {4675, 12434}, {4677, 10386}, {4678, 6290}, {4679, 14482},
+    {4681, 9362}, {4682, 5266}, {4683, 13458}, {4685, 11410}, {4686, 7314},
+    {4687, 15506}, {4689, 8850}, {4690, 4754}, {4691, 12946}, {4693, 10898},
+    {4694, 6802}, {4695, 14994}, {4697, 9874}, {4698, 5778}, {4699, 13970},
+    {4701, 11922}, {4702, 7826}, {4703, 16018}, {4705, 8594}, {4707, 12690},
+    {4709, 10642}, {4710, 6546}, {4711, 14738}, {4713, 9618}, {4714, 5522},
+    {4715, 13714}, {4717, 11666}, {4718, 7570}, {4719, 15762}, {4721, 9106},
+    {4722, 5010}, {4723, 13202}, {4725, 11154}, {4726, 7058}, {4727, 15250},
+    {4729, 10130}, {4730, 6034}, {4731, 14226}, {4733, 12178}, {4734, 8082},
+    {4735, 16274}, {4737, 8274}, {4739, 12370}, {4741, 10322}, {4742, 6226},
+    {4743, 14418}, {4745, 9298}, {4746, 5202}, {4747, 13394}, {4749, 11346},
+    {4750, 7250}, {4751, 15442}, {4753, 8786}, {4755, 12882}, {4757, 10834},
+    {4758, 6738}, {4759, 14930}, {4761, 9810}, {4762, 5714}, {4763, 13906},
+    {4765, 11858}, {4766, 7762}, {4767, 15954}, {4769, 8530}, {4771, 12626},
+    {4773, 10578}, {4774, 6482}, {4775, 14674}, {4777, 9554}, {4778, 5458},
+    {4779, 13650}, {4781, 11602}, {4782, 7506}, {4783, 15698}, {4785, 9042},
+    {4786, 4946}, {4787, 13138}, {4789, 11090}, {4790, 6994}, {4791, 15186},
+    {4793, 10066}, {4794, 5970}, {4795, 14162}, {4797, 12114}, {4798, 8018},
+    {4799, 16210}, {4801, 8402}, {4803, 12498}, {4805, 10450}, {4806, 6354},
+    {4807, 14546}, {4809, 9426}, {4810, 5330}, {4811, 13522}, {4813, 11474},
+    {4814, 7378}, {4815, 15570}, {4817, 8914}, {4819, 13010}, {4821, 10962},
+    {4822, 6866}, {4823, 15058}, {4825, 9938}, {4826, 5842}, {4827, 14034},
+    {4829, 11986}, {4830, 7890}, {4831, 16082}, {4833, 8658}, {4835, 12754},
+    {4837, 10706}, {4838, 6610}, {4839, 14802}, {4841, 9682}, {4842, 5586},
+    {4843, 13778}, {4845, 11730}, {4846, 7634}, {4847, 15826}, {4849, 9170},
+    {4850, 5074}, {4851, 13266}, {4853, 11218}, {4854, 7122}, {4855, 15314},
+    {4857, 10194}, {4858, 6098}, {4859, 14290}, {4861, 12242}, {4862, 8146},
+    {4863, 16338}, {4865, 8242}, {4867, 12338}, {4869, 10290}, {4870, 6194},
+    {4871, 14386}, {4873, 9266}, {4874, 5170}, {4875, 13362}, {4877, 11314},
+    {4878, 7218}, {4879, 15410}, {4881, 8754}, {4883, 12850}, {4885, 10802},
+    {4886, 6706}, {4887, 14898}, {4889, 9778}, {4890, 5682}, {4891, 13874},
+    {4893, 11826}, {4894, 7730}, {4895, 15922}, {4897, 8498}, {4899, 12594},
+    {4901, 10546}, {4902, 6450}, {4903, 14642}, {4905, 9522}, {4906, 5426},
+    {4907, 13618}, {4909, 11570}, {4910, 7474}, {4911, 15666}, {4913, 9010},
+    {4915, 13106}, {4917, 11058}, {4918, 6962}, {4919, 15154}, {4921, 10034},
+    {4922, 5938}, {4923, 14130}, {4925, 12082}, {4926, 7986}, {4927, 16178},
+    {4929, 8370}, {4931, 12466}, {4933, 10418}, {4934, 6322}, {4935, 14514},
+    {4937, 9394}, {4938, 5298}, {4939, 13490}, {4941, 11442}, {4942, 7346},
+    {4943, 15538}, {4945, 8882}, {4947, 12978}, {4949, 10930}, {4950, 6834},
+    {4951, 15026}, {4953, 9906}, {4954, 5810}, {4955, 14002}, {4957, 11954},
+    {4958, 7858}, {4959, 16050}, {4961, 8626}, {4963, 12722}, {4965, 10674},
+    {4966, 6578}, {4967, 14770}, {4969, 9650}, {4970, 5554}, {4971, 13746},
+    {4973, 11698}, {4974, 7602}, {4975, 15794}, {4977, 9138}, {4978, 5042},
+    {4979, 13234}, {4981, 11186}, {4982, 7090}, {4983, 15282}, {4985, 10162},
+    {4986, 6066}, {4987, 14258}, {4989, 12210}, {4990, 8114}, {4991, 16306},
+    {4993, 8306}, {4995, 12402}, {4997, 10354}, {4998, 6258}, {4999, 14450},
+    {5001, 9330}, {5002, 5234}, {5003, 13426}, {5005, 11378}, {5006, 7282},
+    {5007, 15474}, {5009, 8818}, {5011, 12914}, {5013, 10866}, {5014, 6770},
+    {5015, 14962}, {5017, 9842}, {5018, 5746}, {5019, 13938}, {5021, 11890},
+    {5022, 7794}, {5023, 15986}, {5025, 8562}, {5027, 12658}, {5029, 10610},
+    {5030, 6514}, {5031, 14706}, {5033, 9586}, {5034, 5490}, {5035, 13682},
+    {5037, 11634}, {5038, 7538}, {5039, 15730}, {5041, 9074}, {5043, 13170},
+    {5045, 11122}, {5046, 7026}, {5047, 15218}, {5049, 10098}, {5050, 6002},
+    {5051, 14194}, {5053, 12146}, {5054, 8050}, {5055, 16242}, {5057, 8434},
+    {5059, 12530}, {5061, 10482}, {5062, 6386}, {5063, 14578}, {5065, 9458},
+    {5066, 5362}, {5067, 13554}, {5069, 11506}, {5070, 7410}, {5071, 15602},
+    {5073, 8946}, {5075, 13042}, {5077, 10994}, {5078, 6898}, {5079, 15090},
+    {5081, 9970}, {5082, 5874}, {5083, 14066}, {5085, 12018}, {5086, 7922},
+    {5087, 16114}, {5089, 8690}, {5091, 12786}, {5093, 10738}, {5094, 6642},
+    {5095, 14834}, {5097, 9714}, {5098, 5618}, {5099, 13810}, {5101, 11762},
+    {5102, 7666}, {5103, 15858}, {5105, 9202}, {5107, 13298}, {5109, 11250},
+    {5110, 7154}, {5111, 15346}, {5113, 10226}, {5114, 6130}, {5115, 14322},
+    {5117, 12274}, {5118, 8178}, {5119, 16370}, {5121, 8202}, {5123, 12298},
+    {5125, 10250}, {5126, 6154}, {5127, 14346}, {5129, 9226}, {5131, 13322},
+    {5133, 11274}, {5134, 7178}, {5135, 15370}, {5137, 8714}, {5139, 12810},
+    {5141, 10762}, {5142, 6666}, {5143, 14858}, {5145, 9738}, {5146, 5642},
+    {5147, 13834}, {5149, 11786}, {5150, 7690}, {5151, 15882}, {5153, 8458},
+    {5155, 12554}, {5157, 10506}, {5158, 6410}, {5159, 14602}, {5161, 9482},
+    {5162, 5386}, {5163, 13578}, {5165, 11530}, {5166, 7434}, {5167, 15626},
+    {5169, 8970}, {5171, 13066}, {5173, 11018}, {5174, 6922}, {5175, 15114},
+    {5177, 9994}, {5178, 5898}, {5179, 14090}, {5181, 12042}, {5182, 7946},
+    {5183, 16138}, {5185, 8330}, {5187, 12426}, {5189, 10378}, {5190, 6282},
+    {5191, 14474}, {5193, 9354}, {5194, 5258}, {5195, 13450}, {5197, 11402},
+    {5198, 7306}, {5199, 15498}, {5201, 8842}, {5203, 12938}, {5205, 10890},
+    {5206, 6794}, {5207, 14986}, {5209, 9866}, {5210, 5770}, {5211, 13962},
+    {5213, 11914}, {5214, 7818}, {5215, 16010}, {5217, 8586}, {5219, 12682},
+    {5221, 10634}, {5222, 6538}, {5223, 14730}, {5225, 9610}, {5226, 5514},
+    {5227, 13706}, {5229, 11658}, {5230, 7562}, {5231, 15754}, {5233, 9098},
+    {5235, 13194}, {5237, 11146}, {5238, 7050}, {5239, 15242}, {5241, 10122},
+    {5242, 6026}, {5243, 14218}, {5245, 12170}, {5246, 8074}, {5247, 16266},
+    {5249, 8266}, {5251, 12362}, {5253, 10314}, {5254, 6218}, {5255, 14410},
+    {5257, 9290}, {5259, 13386}, {5261, 11338}, {5262, 7242}, {5263, 15434},
+    {5265, 8778}, {5267, 12874}, {5269, 10826}, {5270, 6730}, {5271, 14922},
+    {5273, 9802}, {5274, 5706}, {5275, 13898}, {5277, 11850}, {5278, 7754},
+    {5279, 15946}, {5281, 8522}, {5283, 12618}, {5285, 10570}, {5286, 6474},
+    {5287, 14666}, {5289, 9546}, {5290, 5450}, {5291, 13642}, {5293, 11594},
+    {5294, 7498}, {5295, 15690}, {5297, 9034}, {5299, 13130}, {5301, 11082},
+    {5302, 6986}, {5303, 15178}, {5305, 10058}, {5306, 5962}, {5307, 14154},
+    {5309, 12106}, {5310, 8010}, {5311, 16202}, {5313, 8394}, {5315, 12490},
+    {5317, 10442}, {5318, 6346}, {5319, 14538}, {5321, 9418}, {5323, 13514},
+    {5325, 11466}, {5326, 7370}, {5327, 15562}, {5329, 8906}, {5331, 13002},
+    {5333, 10954}, {5334, 6858}, {5335, 15050}, {5337, 9930}, {5338, 5834},
+    {5339, 14026}, {5341, 11978}, {5342, 7882}, {5343, 16074}, {5345, 8650},
+    {5347, 12746}, {5349, 10698}, {5350, 6602}, {5351, 14794}, {5353, 9674},
+    {5354, 5578}, {5355, 13770}, {5357, 11722}, {5358, 7626}, {5359, 15818},
+    {5361, 9162}, {5363, 13258}, {5365, 11210}, {5366, 7114}, {5367, 15306},
+    {5369, 10186}, {5370, 6090}, {5371, 14282}, {5373, 12234}, {5374, 8138},
+    {5375, 16330}, {5377, 8234}, {5379, 12330}, {5381, 10282}, {5382, 6186},
+    {5383, 14378}, {5385, 9258}, {5387, 13354}, {5389, 11306}, {5390, 7210},
+    {5391, 15402}, {5393, 8746}, {5395, 12842}, {5397, 10794}, {5398, 6698},
+    {5399, 14890}, {5401, 9770}, {5402, 5674}, {5403, 13866}, {5405, 11818},
+    {5406, 7722}, {5407, 15914}, {5409, 8490}, {5411, 12586}, {5413, 10538},
+    {5414, 6442}, {5415, 14634}, {5417, 9514}, {5419, 13610}, {5421, 11562},
+    {5422, 7466}, {5423, 15658}, {5425, 9002}, {5427, 13098}, {5429, 11050},
+    {5430, 6954}, {5431, 15146}, {5433, 10026}, {5434, 5930}, {5435, 14122},
+    {5437, 12074}, {5438, 7978}, {5439, 16170}, {5441, 8362}, {5443, 12458},
+    {5445, 10410}, {5446, 6314}, {5447, 14506}, {5449, 9386}, {5451, 13482},
+    {5453, 11434}, {5454, 7338}, {5455, 15530}, {5457, 8874}, {5459, 12970},
+    {5461, 10922}, {5462, 6826}, {5463, 15018}, {5465, 9898}, {5466, 5802},
+    {5467, 13994}, {5469, 11946}, {5470, 7850}, {5471, 16042}, {5473, 8618},
+    {5475, 12714}, {5477, 10666}, {5478, 6570}, {5479, 14762}, {5481, 9642},
+    {5482, 5546}, {5483, 13738}, {5485, 11690}, {5486, 7594}, {5487, 15786},
+    {5489, 9130}, {5491, 13226}, {5493, 11178}, {5494, 7082}, {5495, 15274},
+    {5497, 10154}, {5498, 6058}, {5499, 14250}, {5501, 12202}, {5502, 8106},
+    {5503, 16298}, {5505, 8298}, {5507, 12394}, {5509, 10346}, {5510, 6250},
+    {5511, 14442}, {5513, 9322}, {5515, 13418}, {5517, 11370}, {5518, 7274},
+    {5519, 15466}, {5521, 8810}, {5523, 12906}, {5525, 10858}, {5526, 6762},
+    {5527, 14954}, {5529, 9834}, {5530, 5738}, {5531, 13930}, {5533, 11882},
+    {5534, 7786}, {5535, 15978}, {5537, 8554}, {5539, 12650}, {5541, 10602},
+    {5542, 6506}, {5543, 14698}, {5545, 9578}, {5547, 13674}, {5549, 11626},
+    {5550, 7530}, {5551, 15722}, {5553, 9066}, {5555, 13162}, {5557, 11114},
+    {5558, 7018}, {5559, 15210}, {5561, 10090}, {5562, 5994}, {5563, 14186},
+    {5565, 12138}, {5566, 8042}, {5567, 16234}, {5569, 8426}, {5571, 12522},
+    {5573, 10474}, {5574, 6378}, {5575, 14570}, {5577, 9450}, {5579, 13546},
+    {5581, 11498}, {5582, 7402}, {5583, 15594}, {5585, 8938}, {5587, 13034},
+    {5589, 10986}, {5590, 6890}, {5591, 15082}, {5593, 9962}, {5594, 5866},
+    {5595, 14058}, {5597, 12010}, {5598, 7914}, {5599, 16106}, {5601, 8682},
+    {5603, 12778}, {5605, 10730}, {5606, 6634}, {5607, 14826}, {5609, 9706},
+    {5611, 13802}, {5613, 11754}, {5614, 7658}, {5615, 15850}, {5617, 9194},
+    {5619, 13290}, {5621, 11242}, {5622, 7146}, {5623, 15338}, {5625, 10218},
+    {5626, 6122}, {5627, 14314}, {5629, 12266}, {5630, 8170}, {5631, 16362},
+    {5633, 8218}, {5635, 12314}, {5637, 10266}, {5638, 6170}, {5639, 14362},
+    {5641, 9242}, {5643, 13338}, {5645, 11290}, {5646, 7194}, {5647, 15386},
+    {5649, 8730}, {5651, 12826}, {5653, 10778}, {5654, 6682}, {5655, 14874},
+    {5657, 9754}, {5659, 13850}, {5661, 11802}, {5662, 7706}, {5663, 15898},
+    {5665, 8474}, {5667, 12570}, {5669, 10522}, {5670, 6426}, {5671, 14618},
+    {5673, 9498}, {5675, 13594}, {5677, 11546}, {5678, 7450}, {5679, 15642},
+    {5681, 8986}, {5683, 13082}, {5685, 11034}, {5686, 6938}, {5687, 15130},
+    {5689, 10010}, {5690, 5914}, {5691, 14106}, {5693, 12058}, {5694, 7962},
+    {5695, 16154}, {5697, 8346}, {5699, 12442}, {5701, 10394}, {5702, 6298},
+    {5703, 14490}, {5705, 9370}, {5707, 13466}, {5709, 11418}, {5710, 7322},
+    {5711, 15514}, {5713, 8858}, {5715, 12954}, {5717, 10906}, {5718, 6810},
+    {5719, 15002}, {5721, 9882}, {5722, 5786}, {5723, 13978}, {5725, 11930},
+    {5726, 7834}, {5727, 16026}, {5729, 8602}, {5731, 12698}, {5733, 10650},
+    {5734, 6554}, {5735, 14746}, {5737, 9626}, {5739, 13722}, {5741, 11674},
+    {5742, 7578}, {5743, 15770}, {5745, 9114}, {5747, 13210}, {5749, 11162},
+    {5750, 7066}, {5751, 15258}, {5753, 10138}, {5754, 6042}, {5755, 14234},
+    {5757, 12186}, {5758, 8090}, {5759, 16282}, {5761, 8282}, {5763, 12378},
+    {5765, 10330}, {5766, 6234}, {5767, 14426}, {5769, 9306}, {5771, 13402},
+    {5773, 11354}, {5774, 7258}, {5775, 15450}, {5777, 8794}, {5779, 12890},
+    {5781, 10842}, {5782, 6746}, {5783, 14938}, {5785, 9818}, {5787, 13914},
+    {5789, 11866}, {5790, 7770}, {5791, 15962}, {5793, 8538}, {5795, 12634},
+    {5797, 10586}, {5798, 6490}, {5799, 14682}, {5801, 9562}, {5803, 13658},
+    {5805, 11610}, {5806, 7514}, {5807, 15706}, {5809, 9050}, {5811, 13146},
+    {5813, 11098}, {5814, 7002}, {5815, 15194}, {5817, 10074}, {5818, 5978},
+    {5819, 14170}, {5821, 12122}, {5822, 8026}, {5823, 16218}, {5825, 8410},
+    {5827, 12506}, {5829, 10458}, {5830, 6362}, {5831, 14554}, {5833, 9434},
+    {5835, 13530}, {5837, 11482}, {5838, 7386}, {5839, 15578}, {5841, 8922},
+    {5843, 13018}, {5845, 10970}, {5846, 6874}, {5847, 15066}, {5849, 9946},
+    {5851, 14042}, {5853, 11994}, {5854, 7898}, {5855, 16090}, {5857, 8666},
+    {5859, 12762}, {5861, 10714}, {5862, 6618}, {5863, 14810}, {5865, 9690},
+    {5867, 13786}, {5869, 11738}, {5870, 7642}, {5871, 15834}, {5873, 9178},
+    {5875, 13274}, {5877, 11226}, {5878, 7130}, {5879, 15322}, {5881, 10202},
+    {5882, 6106}, {5883, 14298}, {5885, 12250}, {5886, 8154}, {5887, 16346},
+    {5889, 8250}, {5891, 12346}, {5893, 10298}, {5894, 6202}, {5895, 14394},
+    {5897, 9274}, {5899, 13370}, {5901, 11322}, {5902, 7226}, {5903, 15418},
+    {5905, 8762}, {5907, 12858}, {5909, 10810}, {5910, 6714}, {5911, 14906},
+    {5913, 9786}, {5915, 13882}, {5917, 11834}, {5918, 7738}, {5919, 15930},
+    {5921, 8506}, {5923, 12602}, {5925, 10554}, {5926, 6458}, {5927, 14650},
+    {5929, 9530}, {5931, 13626}, {5933, 11578}, {5934, 7482}, {5935, 15674},
+    {5937, 9018}, {5939, 13114}, {5941, 11066}, {5942, 6970}, {5943, 15162},
+    {5945, 10042}, {5947, 14138}, {5949, 12090}, {5950, 7994}, {5951, 16186},
+    {5953, 8378}, {5955, 12474}, {5957, 10426}, {5958, 6330}, {5959, 14522},
+    {5961, 9402}, {5963, 13498}, {5965, 11450}, {5966, 7354}, {5967, 15546},
+    {5969, 8890}, {5971, 12986}, {5973, 10938}, {5974, 6842}, {5975, 15034},
+    {5977, 9914}, {5979, 14010}, {5981, 11962}, {5982, 7866}, {5983, 16058},
+    {5985, 8634}, {5987, 12730}, {5989, 10682}, {5990, 6586}, {5991, 14778},
+    {5993, 9658}, {5995, 13754}, {5997, 11706}, {5998, 7610}, {5999, 15802},
+    {6001, 9146}, {6003, 13242}, {6005, 11194}, {6006, 7098}, {6007, 15290},
+    {6009, 10170}, {6010, 6074}, {6011, 14266}, {6013, 12218}, {6014, 8122},
+    {6015, 16314}, {6017, 8314}, {6019, 12410}, {6021, 10362}, {6022, 6266},
+    {6023, 14458}, {6025, 9338}, {6027, 13434}, {6029, 11386}, {6030, 7290},
+    {6031, 15482}, {6033, 8826}, {6035, 12922}, {6037, 10874}, {6038, 6778},
+    {6039, 14970}, {6041, 9850}, {6043, 13946}, {6045, 11898}, {6046, 7802},
+    {6047, 15994}, {6049, 8570}, {6051, 12666}, {6053, 10618}, {6054, 6522},
+    {6055, 14714}, {6057, 9594}, {6059, 13690}, {6061, 11642}, {6062, 7546},
+    {6063, 15738}, {6065, 9082}, {6067, 13178}, {6069, 11130}, {6070, 7034},
+    {6071, 15226}, {6073, 10106}, {6075, 14202}, {6077, 12154}, {6078, 8058},
+    {6079, 16250}, {6081, 8442}, {6083, 12538}, {6085, 10490}, {6086, 6394},
+    {6087, 14586}, {6089, 9466}, {6091, 13562}, {6093, 11514}, {6094, 7418},
+    {6095, 15610}, {6097, 8954}, {6099, 13050}, {6101, 11002}, {6102, 6906},
+    {6103, 15098}, {6105, 9978}, {6107, 14074}, {6109, 12026}, {6110, 7930},
+    {6111, 16122}, {6113, 8698}, {6115, 12794}, {6117, 10746}, {6118, 6650},
+    {6119, 14842}, {6121, 9722}, {6123, 13818}, {6125, 11770}, {6126, 7674},
+    {6127, 15866}, {6129, 9210}, {6131, 13306}, {6133, 11258}, {6134, 7162},
+    {6135, 15354}, {6137, 10234}, {6139, 14330}, {6141, 12282}, {6142, 8186},
+    {6143, 16378}, {6145, 8198}, {6147, 12294}, {6149, 10246}, {6151, 14342},
+    {6153, 9222}, {6155, 13318}, {6157, 11270}, {6158, 7174}, {6159, 15366},
+    {6161, 8710}, {6163, 12806}, {6165, 10758}, {6166, 6662}, {6167, 14854},
+    {6169, 9734}, {6171, 13830}, {6173, 11782}, {6174, 7686}, {6175, 15878},
+    {6177, 8454}, {6179, 12550}, {6181, 10502}, {6182, 6406}, {6183, 14598},
+    {6185, 9478}, {6187, 13574}, {6189, 11526}, {6190, 7430}, {6191, 15622},
+    {6193, 8966}, {6195, 13062}, {6197, 11014}, {6198, 6918}, {6199, 15110},
+    {6201, 9990}, {6203, 14086}, {6205, 12038}, {6206, 7942}, {6207, 16134},
+    {6209, 8326}, {6211, 12422}, {6213, 10374}, {6214, 6278}, {6215, 14470},
+    {6217, 9350}, {6219, 13446}, {6221, 11398}, {6222, 7302}, {6223, 15494},
+    {6225, 8838}, {6227, 12934}, {6229, 10886}, {6230, 6790}, {6231, 14982},
+    {6233, 9862}, {6235, 13958}, {6237, 11910}, {6238, 7814}, {6239, 16006},
+    {6241, 8582}, {6243, 12678}, {6245, 10630}, {6246, 6534}, {6247, 14726},
+    {6249, 9606}, {6251, 13702}, {6253, 11654}, {6254, 7558}, {6255, 15750},
+    {6257, 9094}, {6259, 13190}, {6261, 11142}, {6262, 7046}, {6263, 15238},
+    {6265, 10118}, {6267, 14214}, {6269, 12166}, {6270, 8070}, {6271, 16262},
+    {6273, 8262}, {6275, 12358}, {6277, 10310}, {6279, 14406}, {6281, 9286},
+    {6283, 13382}, {6285, 11334}, {6286, 7238}, {6287, 15430}, {6289, 8774},
+    {6291, 12870}, {6293, 10822}, {6294, 6726}, {6295, 14918}, {6297, 9798},
+    {6299, 13894}, {6301, 11846}, {6302, 7750}, {6303, 15942}, {6305, 8518},
+    {6307, 12614}, {6309, 10566}, {6310, 6470}, {6311, 14662}, {6313, 9542},
+    {6315, 13638}, {6317, 11590}, {6318, 7494}, {6319, 15686}, {6321, 9030},
+    {6323, 13126}, {6325, 11078}, {6326, 6982}, {6327, 15174}, {6329, 10054},
+    {6331, 14150}, {6333, 12102}, {6334, 8006}, {6335, 16198}, {6337, 8390},
+    {6339, 12486}, {6341, 10438}, {6343, 14534}, {6345, 9414}, {6347, 13510},
+    {6349, 11462}, {6350, 7366}, {6351, 15558}, {6353, 8902}, {6355, 12998},
+    {6357, 10950}, {6358, 6854}, {6359, 15046}, {6361, 9926}, {6363, 14022},
+    {6365, 11974}, {6366, 7878}, {6367, 16070}, {6369, 8646}, {6371, 12742},
+    {6373, 10694}, {6374, 6598}, {6375, 14790}, {6377, 9670}, {6379, 13766},
+    {6381, 11718}, {6382, 7622}, {6383, 15814}, {6385, 9158}, {6387, 13254},
+    {6389, 11206}, {6390, 7110}, {6391, 15302}, {6393, 10182}, {6395, 14278},
+    {6397, 12230}, {6398, 8134}, {6399, 16326}, {6401, 8230}, {6403, 12326},
+    {6405, 10278}, {6407, 14374}, {6409, 9254}, {6411, 13350}, {6413, 11302},
+    {6414, 7206}, {6415, 15398}, {6417, 8742}, {6419, 12838}, {6421, 10790},
+    {6422, 6694}, {6423, 14886}, {6425, 9766}, {6427, 13862}, {6429, 11814},
+    {6430, 7718}, {6431, 15910}, {6433, 8486}, {6435, 12582}, {6437, 10534},
+    {6439, 14630}, {6441, 9510}, {6443, 13606}, {6445, 11558}, {6446, 7462},
+    {6447, 15654}, {6449, 8998}, {6451, 13094}, {6453, 11046}, {6454, 6950},
+    {6455, 15142}, {6457, 10022}, {6459, 14118}, {6461, 12070}, {6462, 7974},
+    {6463, 16166}, {6465, 8358}, {6467, 12454}, {6469, 10406}, {6471, 14502},
+    {6473, 9382}, {6475, 13478}, {6477, 11430}, {6478, 7334}, {6479, 15526},
+    {6481, 8870}, {6483, 12966}, {6485, 10918}, {6486, 6822}, {6487, 15014},
+    {6489, 9894}, {6491, 13990}, {6493, 11942}, {6494, 7846}, {6495, 16038},
+    {6497, 8614}, {6499, 12710}, {6501, 10662}, {6502, 6566}, {6503, 14758},
+    {6505, 9638}, {6507, 13734}, {6509, 11686}, {6510, 7590}, {6511, 15782},
+    {6513, 9126}, {6515, 13222}, {6517, 11174}, {6518, 7078}, {6519, 15270},
+    {6521, 10150}, {6523, 14246}, {6525, 12198}, {6526, 8102}, {6527, 16294},
+    {6529, 8294}, {6531, 12390}, {6533, 10342}, {6535, 14438}, {6537, 9318},
+    {6539, 13414}, {6541, 11366}, {6542, 7270}, {6543, 15462}, {6545, 8806},
+    {6547, 12902}, {6549, 10854}, {6550, 6758}, {6551, 14950}, {6553, 9830},
+    {6555, 13926}, {6557, 11878}, {6558, 7782}, {6559, 15974}, {6561, 8550},
+    {6563, 12646}, {6565, 10598}, {6567, 14694}, {6569, 9574}, {6571, 13670},
+    {6573, 11622}, {6574, 7526}, {6575, 15718}, {6577, 9062}, {6579, 13158},
+    {6581, 11110}, {6582, 7014}, {6583, 15206}, {6585, 10086}, {6587, 14182},
+    {6589, 12134}, {6590, 8038}, {6591, 16230}, {6593, 8422}, {6595, 12518},
+    {6597, 10470}, {6599, 14566}, {6601, 9446}, {6603, 13542}, {6605, 11494},
+    {6606, 7398}, {6607, 15590}, {6609, 8934}, {6611, 13030}, {6613, 10982},
+    {6614, 6886}, {6615, 15078}, {6617, 9958}, {6619, 14054}, {6621, 12006},
+    {6622, 7910}, {6623, 16102}, {6625, 8678}, {6627, 12774}, {6629, 10726},
+    {6631, 14822}, {6633, 9702}, {6635, 13798}, {6637, 11750}, {6638, 7654},
+    {6639, 15846}, {6641, 9190}, {6643, 13286}, {6645, 11238}, {6646, 7142},
+    {6647, 15334}, {6649, 10214}, {6651, 14310}, {6653, 12262}, {6654, 8166},
+    {6655, 16358}, {6657, 8214}, {6659, 12310}, {6661, 10262}, {6663, 14358},
+    {6665, 9238}, {6667, 13334}, {6669, 11286}, {6670, 7190}, {6671, 15382},
+    {6673, 8726}, {6675, 12822}, {6677, 10774}, {6679, 14870}, {6681, 9750},
+    {6683, 13846}, {6685, 11798}, {6686, 7702}, {6687, 15894}, {6689, 8470},
+    {6691, 12566}, {6693, 10518}, {6695, 14614}, {6697, 9494}, {6699, 13590},
+    {6701, 11542}, {6702, 7446}, {6703, 15638}, {6705, 8982}, {6707, 13078},
+    {6709, 11030}, {6710, 6934}, {6711, 15126}, {6713, 10006}, {6715, 14102},
+    {6717, 12054}, {6718, 7958}, {6719, 16150}, {6721, 8342}, {6723, 12438},
+    {6725, 10390}, {6727, 14486}, {6729, 9366}, {6731, 13462}, {6733, 11414},
+    {6734, 7318}, {6735, 15510}, {6737, 8854}, {6739, 12950}, {6741, 10902},
+    {6742, 6806}, {6743, 14998}, {6745, 9878}, {6747, 13974}, {6749, 11926},
+    {6750, 7830}, {6751, 16022}, {6753, 8598}, {6755, 12694}, {6757, 10646},
+    {6759, 14742}, {6761, 9622}, {6763, 13718}, {6765, 11670}, {6766, 7574},
+    {6767, 15766}, {6769, 9110}, {6771, 13206}, {6773, 11158}, {6774, 7062},
+    {6775, 15254}, {6777, 10134}, {6779, 14230}, {6781, 12182}, {6782, 8086},
+    {6783, 16278}, {6785, 8278}, {6787, 12374}, {6789, 10326}, {6791, 14422},
+    {6793, 9302}, {6795, 13398}, {6797, 11350}, {6798, 7254}, {6799, 15446},
+    {6801, 8790}, {6803, 12886}, {6805, 10838}, {6807, 14934}, {6809, 9814},
+    {6811, 13910}, {6813, 11862}, {6814, 7766}, {6815, 15958}, {6817, 8534},
+    {6819, 12630}, {6821, 10582}, {6823, 14678}, {6825, 9558}, {6827, 13654},
+    {6829, 11606}, {6830, 7510}, {6831, 15702}, {6833, 9046}, {6835, 13142},
+    {6837, 11094}, {6838, 6998}, {6839, 15190}, {6841, 10070}, {6843, 14166},
+    {6845, 12118}, {6846, 8022}, {6847, 16214}, {6849, 8406}, {6851, 12502},
+    {6853, 10454}, {6855, 14550}, {6857, 9430}, {6859, 13526}, {6861, 11478},
+    {6862, 7382}, {6863, 15574}, {6865, 8918}, {6867, 13014}, {6869, 10966},
+    {6871, 15062}, {6873, 9942}, {6875, 14038}, {6877, 11990}, {6878, 7894},
+    {6879, 16086}, {6881, 8662}, {6883, 12758}, {6885, 10710}, {6887, 14806},
+    {6889, 9686}, {6891, 13782}, {6893, 11734}, {6894, 7638}, {6895, 15830},
+    {6897, 9174}, {6899, 13270}, {6901, 11222}, {6902, 7126}, {6903, 15318},
+    {6905, 10198}, {6907, 14294}, {6909, 12246}, {6910, 8150}, {6911, 16342},
+    {6913, 8246}, {6915, 12342}, {6917, 10294}, {6919, 14390}, {6921, 9270},
+    {6923, 13366}, {6925, 11318}, {6926, 7222}, {6927, 15414}, {6929, 8758},
+    {6931, 12854}, {6933, 10806}, {6935, 14902}, {6937, 9782}, {6939, 13878},
+    {6941, 11830}, {6942, 7734}, {6943, 15926}, {6945, 8502}, {6947, 12598},
+    {6949, 10550}, {6951, 14646}, {6953, 9526}, {6955, 13622}, {6957, 11574},
+    {6958, 7478}, {6959, 15670}, {6961, 9014}, {6963, 13110}, {6965, 11062},
+    {6967, 15158}, {6969, 10038}, {6971, 14134}, {6973, 12086}, {6974, 7990},
+    {6975, 16182}, {6977, 8374}, {6979, 12470}, {6981, 10422}, {6983, 14518},
+    {6985, 9398}, {6987, 13494}, {6989, 11446}, {6990, 7350}, {6991, 15542},
+    {6993, 8886}, {6995, 12982}, {6997, 10934}, {6999, 15030}, {7001, 9910},
+    {7003, 14006}, {7005, 11958}, {7006, 7862}, {7007, 16054}, {7009, 8630},
+    {7011, 12726}, {7013, 10678}, {7015, 14774}, {7017, 9654}, {7019, 13750},
+    {7021, 11702}, {7022, 7606}, {7023, 15798}, {7025, 9142}, {7027, 13238},
+    {7029, 11190}, {7030, 7094}, {7031, 15286}, {7033, 10166}, {7035, 14262},
+    {7037, 12214}, {7038, 8118}, {7039, 16310}, {7041, 8310}, {7043, 12406},
+    {7045, 10358}, {7047, 14454}, {7049, 9334}, {7051, 13430}, {7053, 11382},
+    {7054, 7286}, {7055, 15478}, {7057, 8822}, {7059, 12918}, {7061, 10870},
+    {7063, 14966}, {7065, 9846}, {7067, 13942}, {7069, 11894}, {7070, 7798},
+    {7071, 15990}, {7073, 8566}, {7075, 12662}, {7077, 10614}, {7079, 14710},
+    {7081, 9590}, {7083, 13686}, {7085, 11638}, {7086, 7542}, {7087, 15734},
+    {7089, 9078}, {7091, 13174}, {7093, 11126}, {7095, 15222}, {7097, 10102},
+    {7099, 14198}, {7101, 12150}, {7102, 8054}, {7103, 16246}, {7105, 8438},
+    {7107, 12534}, {7109, 10486}, {7111, 14582}, {7113, 9462}, {7115, 13558},
+    {7117, 11510}, {7118, 7414}, {7119, 15606}, {7121, 8950}, {7123, 13046},
+    {7125, 10998}, {7127, 15094}, {7129, 9974}, {7131, 14070}, {7133, 12022},
+    {7134, 7926}, {7135, 16118}, {7137, 8694}, {7139, 12790}, {7141, 10742},
+    {7143, 14838}, {7145, 9718}, {7147, 13814}, {7149, 11766}, {7150, 7670},
+    {7151, 15862}, {7153, 9206}, {7155, 13302}, {7157, 11254}, {7159, 15350},
+    {7161, 10230}, {7163, 14326}, {7165, 12278}, {7166, 8182}, {7167, 16374},
+    {7169, 8206}, {7171, 12302}, {7173, 10254}, {7175, 14350}, {7177, 9230},
+    {7179, 13326}, {7181, 11278}, {7183, 15374}, {7185, 8718}, {7187, 12814},
+    {7189, 10766}, {7191, 14862}, {7193, 9742}, {7195, 13838}, {7197, 11790},
+    {7198, 7694}, {7199, 15886}, {7201, 8462}, {7203, 12558}, {7205, 10510},
+    {7207, 14606}, {7209, 9486}, {7211, 13582}, {7213, 11534}, {7214, 7438},
+    {7215, 15630}, {7217, 8974}, {7219, 13070}, {7221, 11022}, {7223, 15118},
+    {7225, 9998}, {7227, 14094}, {7229, 12046}, {7230, 7950}, {7231, 16142},
+    {7233, 8334}, {7235, 12430}, {7237, 10382}, {7239, 14478}, {7241, 9358},
+    {7243, 13454}, {7245, 11406}, {7246, 7310}, {7247, 15502}, {7249, 8846},
+    {7251, 12942}, {7253, 10894}, {7255, 14990}, {7257, 9870}, {7259, 13966},
+    {7261, 11918}, {7262, 7822}, {7263, 16014}, {7265, 8590}, {7267, 12686},
+    {7269, 10638}, {7271, 14734}, {7273, 9614}, {7275, 13710}, {7277, 11662},
+    {7278, 7566}, {7279, 15758}, {7281, 9102}, {7283, 13198}, {7285, 11150},
+    {7287, 15246}, {7289, 10126}, {7291, 14222}, {7293, 12174}, {7294, 8078},
+    {7295, 16270}, {7297, 8270}, {7299, 12366}, {7301, 10318}, {7303, 14414},
+    {7305, 9294}, {7307, 13390}, {7309, 11342}, {7311, 15438}, {7313, 8782},
+    {7315, 12878}, {7317, 10830}, {7319, 14926}, {7321, 9806}, {7323, 13902},
+    {7325, 11854}, {7326, 7758}, {7327, 15950}, {7329, 8526}, {7331, 12622},
+    {7333, 10574}, {7335, 14670}, {7337, 9550}, {7339, 13646}, {7341, 11598},
+    {7342, 7502}, {7343, 15694}, {7345, 9038}, {7347, 13134}, {7349, 11086},
+    {7351, 15182}, {7353, 10062}, {7355, 14158}, {7357, 12110}, {7358, 8014},
+    {7359, 16206}, {7361, 8398}, {7363, 12494}, {7365, 10446}, {7367, 14542},
+    {7369, 9422}, {7371, 13518}, {7373, 11470}, {7375, 15566}, {7377, 8910},
+    {7379, 13006}, {7381, 10958}, {7383, 15054}, {7385, 9934}, {7387, 14030},
+    {7389, 11982}, {7390, 7886}, {7391, 16078}, {7393, 8654}, {7395, 12750},
+    {7397, 10702}, {7399, 14798}, {7401, 9678}, {7403, 13774}, {7405, 11726},
+    {7406, 7630}, {7407, 15822}, {7409, 9166}, {7411, 13262}, {7413, 11214},
+    {7415, 15310}, {7417, 10190}, {7419, 14286}, {7421, 12238}, {7422, 8142},
+    {7423, 16334}, {7425, 8238}, {7427, 12334}, {7429, 10286}, {7431, 14382},
+    {7433, 9262}, {7435, 13358}, {7437, 11310}, {7439, 15406}, {7441, 8750},
+    {7443, 12846}, {7445, 10798}, {7447, 14894}, {7449, 9774}, {7451, 13870},
+    {7453, 11822}, {7454, 7726}, {7455, 15918}, {7457, 8494}, {7459, 12590},
+    {7461, 10542}, {7463, 14638}, {7465, 9518}, {7467, 13614}, {7469, 11566},
+    {7471, 15662}, {7473, 9006}, {7475, 13102}, {7477, 11054}, {7479, 15150},
+    {7481, 10030}, {7483, 14126}, {7485, 12078}, {7486, 7982}, {7487, 16174},
+    {7489, 8366}, {7491, 12462}, {7493, 10414}, {7495, 14510}, {7497, 9390},
+    {7499, 13486}, {7501, 11438}, {7503, 15534}, {7505, 8878}, {7507, 12974},
+    {7509, 10926}, {7511, 15022}, {7513, 9902}, {7515, 13998}, {7517, 11950},
+    {7518, 7854}, {7519, 16046}, {7521, 8622}, {7523, 12718}, {7525, 10670},
+    {7527, 14766}, {7529, 9646}, {7531, 13742}, {7533, 11694}, {7534, 7598},
+    {7535, 15790}, {7537, 9134}, {7539, 13230}, {7541, 11182}, {7543, 15278},
+    {7545, 10158}, {7547, 14254}, {7549, 12206}, {7550, 8110}, {7551, 16302},
+    {7553, 8302}, {7555, 12398}, {7557, 10350}, {7559, 14446}, {7561, 9326},
+    {7563, 13422}, {7565, 11374}, {7567, 15470}, {7569, 8814}, {7571, 12910},
+    {7573, 10862}, {7575, 14958}, {7577, 9838}, {7579, 13934}, {7581, 11886},
+    {7582, 7790}, {7583, 15982}, {7585, 8558}, {7587, 12654}, {7589, 10606},
+    {7591, 14702}, {7593, 9582}, {7595, 13678}, {7597, 11630}, {7599, 15726},
+    {7601, 9070}, {7603, 13166}, {7605, 11118}, {7607, 15214}, {7609, 10094},
+    {7611, 14190}, {7613, 12142}, {7614, 8046}, {7615, 16238}, {7617, 8430},
+    {7619, 12526}, {7621, 10478}, {7623, 14574}, {7625, 9454}, {7627, 13550},
+    {7629, 11502}, {7631, 15598}, {7633, 8942}, {7635, 13038}, {7637, 10990},
+    {7639, 15086}, {7641, 9966}, {7643, 14062}, {7645, 12014}, {7646, 7918},
+    {7647, 16110}, {7649, 8686}, {7651, 12782}, {7653, 10734}, {7655, 14830},
+    {7657, 9710}, {7659, 13806}, {7661, 11758}, {7663, 15854}, {7665, 9198},
+    {7667, 13294}, {7669, 11246}, {7671, 15342}, {7673, 10222}, {7675, 14318},
+    {7677, 12270}, {7678, 8174}, {7679, 16366}, {7681, 8222}, {7683, 12318},
+    {7685, 10270}, {7687, 14366}, {7689, 9246}, {7691, 13342}, {7693, 11294},
+    {7695, 15390}, {7697, 8734}, {7699, 12830}, {7701, 10782}, {7703, 14878},
+    {7705, 9758}, {7707, 13854}, {7709, 11806}, {7711, 15902}, {7713, 8478},
+    {7715, 12574}, {7717, 10526}, {7719, 14622}, {7721, 9502}, {7723, 13598},
+    {7725, 11550}, {7727, 15646}, {7729, 8990}, {7731, 13086}, {7733, 11038},
+    {7735, 15134}, {7737, 10014}, {7739, 14110}, {7741, 12062}, {7742, 7966},
+    {7743, 16158}, {7745, 8350}, {7747, 12446}, {7749, 10398}, {7751, 14494},
+    {7753, 9374}, {7755, 13470}, {7757, 11422}, {7759, 15518}, {7761, 8862},
+    {7763, 12958}, {7765, 10910}, {7767, 15006}, {7769, 9886}, {7771, 13982},
+    {7773, 11934}, {7774, 7838}, {7775, 16030}, {7777, 8606}, {7779, 12702},
+    {7781, 10654}, {7783, 14750}, {7785, 9630}, {7787, 13726}, {7789, 11678},
+    {7791, 15774}, {7793, 9118}, {7795, 13214}, {7797, 11166}, {7799, 15262},
+    {7801, 10142}, {7803, 14238}, {7805, 12190}, {7806, 8094}, {7807, 16286},
+    {7809, 8286}, {7811, 12382}, {7813, 10334}, {7815, 14430}, {7817, 9310},
+    {7819, 13406}, {7821, 11358}, {7823, 15454}, {7825, 8798}, {7827, 12894},
+    {7829, 10846}, {7831, 14942}, {7833, 9822}, {7835, 13918}, {7837, 11870},
+    {7839, 15966}, {7841, 8542}, {7843, 12638}, {7845, 10590}, {7847, 14686},
+    {7849, 9566}, {7851, 13662}, {7853, 11614}, {7855, 15710}, {7857, 9054},
+    {7859, 13150}, {7861, 11102}, {7863, 15198}, {7865, 10078}, {7867, 14174},
+    {7869, 12126}, {7870, 8030}, {7871, 16222}, {7873, 8414}, {7875, 12510},
+    {7877, 10462}, {7879, 14558}, {7881, 9438}, {7883, 13534}, {7885, 11486},
+    {7887, 15582}, {7889, 8926}, {7891, 13022}, {7893, 10974}, {7895, 15070},
+    {7897, 9950}, {7899, 14046}, {7901, 11998}, {7903, 16094}, {7905, 8670},
+    {7907, 12766}, {7909, 10718}, {7911, 14814}, {7913, 9694}, {7915, 13790},
+    {7917, 11742}, {7919, 15838}, {7921, 9182}, {7923, 13278}, {7925, 11230},
+    {7927, 15326}, {7929, 10206}, {7931, 14302}, {7933, 12254}, {7934, 8158},
+    {7935, 16350}, {7937, 8254}, {7939, 12350}, {7941, 10302}, {7943, 14398},
+    {7945, 9278}, {7947, 13374}, {7949, 11326}, {7951, 15422}, {7953, 8766},
+    {7955, 12862}, {7957, 10814}, {7959, 14910}, {7961, 9790}, {7963, 13886},
+    {7965, 11838}, {7967, 15934}, {7969, 8510}, {7971, 12606}, {7973, 10558},
+    {7975, 14654}, {7977, 9534}, {7979, 13630}, {7981, 11582}, {7983, 15678},
+    {7985, 9022}, {7987, 13118}, {7989, 11070}, {7991, 15166}, {7993, 10046},
+    {7995, 14142}, {7997, 12094}, {7999, 16190}, {8001, 8382}, {8003, 12478},
+    {8005, 10430}, {8007, 14526}, {8009, 9406}, {8011, 13502}, {8013, 11454},
+    {8015, 15550}, {8017, 8894}, {8019, 12990}, {8021, 10942}, {8023, 15038},
+    {8025, 9918}, {8027, 14014}, {8029, 11966}, {8031, 16062}, {8033, 8638},
+    {8035, 12734}, {8037, 10686}, {8039, 14782}, {8041, 9662}, {8043, 13758},
+    {8045, 11710}, {8047, 15806}, {8049, 9150}, {8051, 13246}, {8053, 11198},
+    {8055, 15294}, {8057, 10174}, {8059, 14270}, {8061, 12222}, {8062, 8126},
+    {8063, 16318}, {8065, 8318}, {8067, 12414}, {8069, 10366}, {8071, 14462},
+    {8073, 9342}, {8075, 13438}, {8077, 11390}, {8079, 15486}, {8081, 8830},
+    {8083, 12926}, {8085, 10878}, {8087, 14974}, {8089, 9854}, {8091, 13950},
+    {8093, 11902}, {8095, 15998}, {8097, 8574}, {8099, 12670}, {8101, 10622},
+    {8103, 14718}, {8105, 9598}, {8107, 13694}, {8109, 11646}, {8111, 15742},
+    {8113, 9086}, {8115, 13182}, {8117, 11134}, {8119, 15230}, {8121, 10110},
+    {8123, 14206}, {8125, 12158}, {8127, 16254}, {8129, 8446}, {8131, 12542},
+    {8133, 10494}, {8135, 14590}, {8137, 9470}, {8139, 13566}, {8141, 11518},
+    {8143, 15614}, {8145, 8958}, {8147, 13054}, {8149, 11006}, {8151, 15102},
+    {8153, 9982}, {8155, 14078}, {8157, 12030}, {8159, 16126}, {8161, 8702},
+    {8163, 12798}, {8165, 10750}, {8167, 14846}, {8169, 9726}, {8171, 13822},
+    {8173, 11774}, {8175, 15870}, {8177, 9214}, {8179, 13310}, {8181, 11262},
+    {8183, 15358}, {8185, 10238}, {8187, 14334}, {8189, 12286}, {8191, 16382},
+    {8195, 12289}, {8197, 10241}, {8199, 14337}, {8201, 9217}, {8203, 13313},
+    {8205, 11265}, {8207, 15361}, {8209, 8705}, {8211, 12801}, {8213, 10753},
+    {8215, 14849}, {8217, 9729}, {8219, 13825}, {8221, 11777}, {8223, 15873},
+    {8225, 8449}, {8227, 12545}, {8229, 10497}, {8231, 14593}, {8233, 9473},
+    {8235, 13569}, {8237, 11521}, {8239, 15617}, {8241, 8961}, {8243, 13057},
+    {8245, 11009}, {8247, 15105}, {8249, 9985}, {8251, 14081}, {8253, 12033},
+    {8255, 16129}, {8257, 8321}, {8259, 12417}, {8261, 10369}, {8263, 14465},
+    {8265, 9345}, {8267, 13441}, {8269, 11393}, {8271, 15489}, {8273, 8833},
+    {8275, 12929}, {8277, 10881}, {8279, 14977}, {8281, 9857}, {8283, 13953},
+    {8285, 11905}, {8287, 16001}, {8289, 8577}, {8291, 12673}, {8293, 10625},
+    {8295, 14721}, {8297, 9601}, {8299, 13697}, {8301, 11649}, {8303, 15745},
+    {8305, 9089}, {8307, 13185}, {8309, 11137}, {8311, 15233}, {8313, 10113},
+    {8315, 14209}, {8317, 12161}, {8319, 16257}, {8323, 12353}, {8325, 10305},
+    {8327, 14401}, {8329, 9281}, {8331, 13377}, {8333, 11329}, {8335, 15425},
+    {8337, 8769}, {8339, 12865}, {8341, 10817}, {8343, 14913}, {8345, 9793},
+    {8347, 13889}, {8349, 11841}, {8351, 15937}, {8353, 8513}, {8355, 12609},
+    {8357, 10561}, {8359, 14657}, {8361, 9537}, {8363, 13633}, {8365, 11585},
+    {8367, 15681}, {8369, 9025}, {8371, 13121}, {8373, 11073}, {8375, 15169},
+    {8377, 10049}, {8379, 14145}, {8381, 12097}, {8383, 16193}, {8387, 12481},
+    {8389, 10433}, {8391, 14529}, {8393, 9409}, {8395, 13505}, {8397, 11457},
+    {8399, 15553}, {8401, 8897}, {8403, 12993}, {8405, 10945}, {8407, 15041},
+    {8409, 9921}, {8411, 14017}, {8413, 11969}, {8415, 16065}, {8417, 8641},
+    {8419, 12737}, {8421, 10689}, {8423, 14785}, {8425, 9665}, {8427, 13761},
+    {8429, 11713}, {8431, 15809}, {8433, 9153}, {8435, 13249}, {8437, 11201},
+    {8439, 15297}, {8441, 10177}, {8443, 14273}, {8445, 12225}, {8447, 16321},
+    {8451, 12321}, {8453, 10273}, {8455, 14369}, {8457, 9249}, {8459, 13345},
+    {8461, 11297}, {8463, 15393}, {8465, 8737}, {8467, 12833}, {8469, 10785},
+    {8471, 14881}, {8473, 9761}, {8475, 13857}, {8477, 11809}, {8479, 15905},
+    {8483, 12577}, {8485, 10529}, {8487, 14625}, {8489, 9505}, {8491, 13601},
+    {8493, 11553}, {8495, 15649}, {8497, 8993}, {8499, 13089}, {8501, 11041},
+    {8503, 15137}, {8505, 10017}, {8507, 14113}, {8509, 12065}, {8511, 16161},
+    {8515, 12449}, {8517, 10401}, {8519, 14497}, {8521, 9377}, {8523, 13473},
+    {8525, 11425}, {8527, 15521}, {8529, 8865}, {8531, 12961}, {8533, 10913},
+    {8535, 15009}, {8537, 9889}, {8539, 13985}, {8541, 11937}, {8543, 16033},
+    {8545, 8609}, {8547, 12705}, {8549, 10657}, {8551, 14753}, {8553, 9633},
+    {8555, 13729}, {8557, 11681}, {8559, 15777}, {8561, 9121}, {8563, 13217},
+    {8565, 11169}, {8567, 15265}, {8569, 10145}, {8571, 14241}, {8573, 12193},
+    {8575, 16289}, {8579, 12385}, {8581, 10337}, {8583, 14433}, {8585, 9313},
+    {8587, 13409}, {8589, 11361}, {8591, 15457}, {8593, 8801}, {8595, 12897},
+    {8597, 10849}, {8599, 14945}, {8601, 9825}, {8603, 13921}, {8605, 11873},
+    {8607, 15969}, {8611, 12641}, {8613, 10593}, {8615, 14689}, {8617, 9569},
+    {8619, 13665}, {8621, 11617}, {8623, 15713}, {8625, 9057}, {8627, 13153},
+    {8629, 11105}, {8631, 15201}, {8633, 10081}, {8635, 14177}, {8637, 12129},
+    {8639, 16225}, {8643, 12513}, {8645, 10465}, {8647, 14561}, {8649, 9441},
+    {8651, 13537}, {8653, 11489}, {8655, 15585}, {8657, 8929}, {8659, 13025},
+    {8661, 10977}, {8663, 15073}, {8665, 9953}, {8667, 14049}, {8669, 12001},
+    {8671, 16097}, {8675, 12769}, {8677, 10721}, {8679, 14817}, {8681, 9697},
+    {8683, 13793}, {8685, 11745}, {8687, 15841}, {8689, 9185}, {8691, 13281},
+    {8693, 11233}, {8695, 15329}, {8697, 10209}, {8699, 14305}, {8701, 12257},
+    {8703, 16353}, {8707, 12305}, {8709, 10257}, {8711, 14353}, {8713, 9233},
+    {8715, 13329}, {8717, 11281}, {8719, 15377}, {8723, 12817}, {8725, 10769},
+    {8727, 14865}, {8729, 9745}, {8731, 13841}, {8733, 11793}, {8735, 15889},
+    {8739, 12561}, {8741, 10513}, {8743, 14609}, {8745, 9489}, {8747, 13585},
+    {8749, 11537}, {8751, 15633}, {8753, 8977}, {8755, 13073}, {8757, 11025},
+    {8759, 15121}, {8761, 10001}, {8763, 14097}, {8765, 12049}, {8767, 16145},
+    {8771, 12433}, {8773, 10385}, {8775, 14481}, {8777, 9361}, {8779, 13457},
+    {8781, 11409}, {8783, 15505}, {8785, 8849}, {8787, 12945}, {8789, 10897},
+    {8791, 14993}, {8793, 9873}, {8795, 13969}, {8797, 11921}, {8799, 16017},
+    {8803, 12689}, {8805, 10641}, {8807, 14737}, {8809, 9617}, {8811, 13713},
+    {8813, 11665}, {8815, 15761}, {8817, 9105}, {8819, 13201}, {8821, 11153},
+    {8823, 15249}, {8825, 10129}, {8827, 14225}, {8829, 12177}, {8831, 16273},
+    {8835, 12369}, {8837, 10321}, {8839, 14417}, {8841, 9297}, {8843, 13393},
+    {8845, 11345}, {8847, 15441}, {8851, 12881}, {8853, 10833}, {8855, 14929},
+    {8857, 9809}, {8859, 13905}, {8861, 11857}, {8863, 15953}, {8867, 12625},
+    {8869, 10577}, {8871, 14673}, {8873, 9553}, {8875, 13649}, {8877, 11601},
+    {8879, 15697}, {8881, 9041}, {8883, 13137}, {8885, 11089}, {8887, 15185},
+    {8889, 10065}, {8891, 14161}, {8893, 12113}, {8895, 16209}, {8899, 12497},
+    {8901, 10449}, {8903, 14545}, {8905, 9425}, {8907, 13521}, {8909, 11473},
+    {8911, 15569}, {8915, 13009}, {8917, 10961}, {8919, 15057}, {8921, 9937},
+    {8923, 14033}, {8925, 11985}, {8927, 16081}, {8931, 12753}, {8933, 10705},
+    {8935, 14801}, {8937, 9681}, {8939, 13777}, {8941, 11729}, {8943, 15825},
+    {8945, 9169}, {8947, 13265}, {8949, 11217}, {8951, 15313}, {8953, 10193},
+    {8955, 14289}, {8957, 12241}, {8959, 16337}, {8963, 12337}, {8965, 10289},
+    {8967, 14385}, {8969, 9265}, {8971, 13361}, {8973, 11313}, {8975, 15409},
+    {8979, 12849}, {8981, 10801}, {8983, 14897}, {8985, 9777}, {8987, 13873},
+    {8989, 11825}, {8991, 15921}, {8995, 12593}, {8997, 10545}, {8999, 14641},
+    {9001, 9521}, {9003, 13617}, {9005, 11569}, {9007, 15665}, {9011, 13105},
+    {9013, 11057}, {9015, 15153}, {9017, 10033}, {9019, 14129}, {9021, 12081},
+    {9023, 16177}, {9027, 12465}, {9029, 10417}, {9031, 14513}, {9033, 9393},
+    {9035, 13489}, {9037, 11441}, {9039, 15537}, {9043, 12977}, {9045, 10929},
+    {9047, 15025}, {9049, 9905}, {9051, 14001}, {9053, 11953}, {9055, 16049},
+    {9059, 12721}, {9061, 10673}, {9063, 14769}, {9065, 9649}, {9067, 13745},
+    {9069, 11697}, {9071, 15793}, {9073, 9137}, {9075, 13233}, {9077, 11185},
+    {9079, 15281}, {9081, 10161}, {9083, 14257}, {9085, 12209}, {9087, 16305},
+    {9091, 12401}, {9093, 10353}, {9095, 14449}, {9097, 9329}, {9099, 13425},
+    {9101, 11377}, {9103, 15473}, {9107, 12913}, {9109, 10865}, {9111, 14961},
+    {9113, 9841}, {9115, 13937}, {9117, 11889}, {9119, 15985}, {9123, 12657},
+    {9125, 10609}, {9127, 14705}, {9129, 9585}, {9131, 13681}, {9133, 11633},
+    {9135, 15729}, {9139, 13169}, {9141, 11121}, {9143, 15217}, {9145, 10097},
+    {9147, 14193}, {9149, 12145}, {9151, 16241}, {9155, 12529}, {9157, 10481},
+    {9159, 14577}, {9161, 9457}, {9163, 13553}, {9165, 11505}, {9167, 15601},
+    {9171, 13041}, {9173, 10993}, {9175, 15089}, {9177, 9969}, {9179, 14065},
+    {9181, 12017}, {9183, 16113}, {9187, 12785}, {9189, 10737}, {9191, 14833},
+    {9193, 9713}, {9195, 13809}, {9197, 11761}, {9199, 15857}, {9203, 13297},
+    {9205, 11249}, {9207, 15345}, {9209, 10225}, {9211, 14321}, {9213, 12273},
+    {9215, 16369}, {9219, 12297}, {9221, 10249}, {9223, 14345}, {9227, 13321},
+    {9229, 11273}, {9231, 15369}, {9235, 12809}, {9237, 10761}, {9239, 14857},
+    {9241, 9737}, {9243, 13833}, {9245, 11785}, {9247, 15881}, {9251, 12553},
+    {9253, 10505}, {9255, 14601}, {9257, 9481}, {9259, 13577}, {9261, 11529},
+    {9263, 15625}, {9267, 13065}, {9269, 11017}, {9271, 15113}, {9273, 9993},
+    {9275, 14089}, {9277, 12041}, {9279, 16137}, {9283, 12425}, {9285, 10377},
+    {9287, 14473}, {9289, 9353}, {9291, 13449}, {9293, 11401}, {9295, 15497},
+    {9299, 12937}, {9301, 10889}, {9303, 14985}, {9305, 9865}, {9307, 13961},
+    {9309, 11913}, {9311, 16009}, {9315, 12681}, {9317, 10633}, {9319, 14729},
+    {9321, 9609}, {9323, 13705}, {9325, 11657}, {9327, 15753}, {9331, 13193},
+    {9333, 11145}, {9335, 15241}, {9337, 10121}, {9339, 14217}, {9341, 12169},
+    {9343, 16265}, {9347, 12361}, {9349, 10313}, {9351, 14409}, {9355, 13385},
+    {9357, 11337}, {9359, 15433}, {9363, 12873}, {9365, 10825}, {9367, 14921},
+    {9369, 9801}, {9371, 13897}, {9373, 11849}, {9375, 15945}, {9379, 12617},
+    {9381, 10569}, {9383, 14665}, {9385, 9545}, {9387, 13641}, {9389, 11593},
+    {9391, 15689}, {9395, 13129}, {9397, 11081}, {9399, 15177}, {9401, 10057},
+    {9403, 14153}, {9405, 12105}, {9407, 16201}, {9411, 12489}, {9413, 10441},
+    {9415, 14537}, {9419, 13513}, {9421, 11465}, {9423, 15561}, {9427, 13001},
+    {9429, 10953}, {9431, 15049}, {9433, 9929}, {9435, 14025}, {9437, 11977},
+    {9439, 16073}, {9443, 12745}, {9445, 10697}, {9447, 14793}, {9449, 9673},
+    {9451, 13769}, {9453, 11721}, {9455, 15817}, {9459, 13257}, {9461, 11209},
+    {9463, 15305}, {9465, 10185}, {9467, 14281}, {9469, 12233}, {9471, 16329},
+    {9475, 12329}, {9477, 10281}, {9479, 14377}, {9483, 13353}, {9485, 11305},
+    {9487, 15401}, {9491, 12841}, {9493, 10793}, {9495, 14889}, {9497, 9769},
+    {9499, 13865}, {9501, 11817}, {9503, 15913}, {9507, 12585}, {9509, 10537},
+    {9511, 14633}, {9515, 13609}, {9517, 11561}, {9519, 15657}, {9523, 13097},
+    {9525, 11049}, {9527, 15145}, {9529, 10025}, {9531, 14121}, {9533, 12073},
+    {9535, 16169}, {9539, 12457}, {9541, 10409}, {9543, 14505}, {9547, 13481},
+    {9549, 11433}, {9551, 15529}, {9555, 12969}, {9557, 10921}, {9559, 15017},
+    {9561, 9897}, {9563, 13993}, {9565, 11945}, {9567, 16041}, {9571, 12713},
+    {9573, 10665}, {9575, 14761}, {9577, 9641}, {9579, 13737}, {9581, 11689},
+    {9583, 15785}, {9587, 13225}, {9589, 11177}, {9591, 15273}, {9593, 10153},
+    {9595, 14249}, {9597, 12201}, {9599, 16297}, {9603, 12393}, {9605, 10345},
+    {9607, 14441}, {9611, 13417}, {9613, 11369}, {9615, 15465}, {9619, 12905},
+    {9621, 10857}, {9623, 14953}, {9625, 9833}, {9627, 13929}, {9629, 11881},
+    {9631, 15977}, {9635, 12649}, {9637, 10601}, {9639, 14697}, {9643, 13673},
+    {9645, 11625}, {9647, 15721}, {9651, 13161}, {9653, 11113}, {9655, 15209},
+    {9657, 10089}, {9659, 14185}, {9661, 12137}, {9663, 16233}, {9667, 12521},
+    {9669, 10473}, {9671, 14569}, {9675, 13545}, {9677, 11497}, {9679, 15593},
+    {9683, 13033}, {9685, 10985}, {9687, 15081}, {9689, 9961}, {9691, 14057},
+    {9693, 12009}, {9695, 16105}, {9699, 12777}, {9701, 10729}, {9703, 14825},
+    {9707, 13801}, {9709, 11753}, {9711, 15849}, {9715, 13289}, {9717, 11241},
+    {9719, 15337}, {9721, 10217}, {9723, 14313}, {9725, 12265}, {9727, 16361},
+    {9731, 12313}, {9733, 10265}, {9735, 14361}, {9739, 13337}, {9741, 11289},
+    {9743, 15385}, {9747, 12825}, {9749, 10777}, {9751, 14873}, {9755, 13849},
+    {9757, 11801}, {9759, 15897}, {9763, 12569}, {9765, 10521}, {9767, 14617},
+    {9771, 13593}, {9773, 11545}, {9775, 15641}, {9779, 13081}, {9781, 11033},
+    {9783, 15129}, {9785, 10009}, {9787, 14105}, {9789, 12057}, {9791, 16153},
+    {9795, 12441}, {9797, 10393}, {9799, 14489}, {9803, 13465}, {9805, 11417},
+    {9807, 15513}, {9811, 12953}, {9813, 10905}, {9815, 15001}, {9817, 9881},
+    {9819, 13977}, {9821, 11929}, {9823, 16025}, {9827, 12697}, {9829, 10649},
+    {9831, 14745}, {9835, 13721}, {9837, 11673}, {9839, 15769}, {9843, 13209},
+    {9845, 11161}, {9847, 15257}, {9849, 10137}, {9851, 14233}, {9853, 12185},
+    {9855, 16281}, {9859, 12377}, {9861, 10329}, {9863, 14425}, {9867, 13401},
+    {9869, 11353}, {9871, 15449}, {9875, 12889}, {9877, 10841}, {9879, 14937},
+    {9883, 13913}, {9885, 11865}, {9887, 15961}, {9891, 12633}, {9893, 10585},
+    {9895, 14681}, {9899, 13657}, {9901, 11609}, {9903, 15705}, {9907, 13145},
+    {9909, 11097}, {9911, 15193}, {9913, 10073}, {9915, 14169}, {9917, 12121},
+    {9919, 16217}, {9923, 12505}, {9925, 10457}, {9927, 14553}, {9931, 13529},
+    {9933, 11481}, {9935, 15577}, {9939, 13017}, {9941, 10969}, {9943, 15065},
+    {9947, 14041}, {9949, 11993}, {9951, 16089}, {9955, 12761}, {9957, 10713},
+    {9959, 14809}, {9963, 13785}, {9965, 11737}, {9967, 15833}, {9971, 13273},
+    {9973, 11225}, {9975, 15321}, {9977, 10201}, {9979, 14297}, {9981, 12249},
+    {9983, 16345}, {9987, 12345}, {9989, 10297}, {9991, 14393}, {9995, 13369},
+    {9997, 11321}, {9999, 15417}, {10003, 12857}, {10005, 10809},
+    {10007, 14905}, {10011, 13881}, {10013, 11833}, {10015, 15929},
+    {10019, 12601}, {10021, 10553}, {10023, 14649}, {10027, 13625},
+    {10029, 11577}, {10031, 15673}, {10035, 13113}, {10037, 11065},
+    {10039, 15161}, {10043, 14137}, {10045, 12089}, {10047, 16185},
+    {10051, 12473}, {10053, 10425}, {10055, 14521}, {10059, 13497},
+    {10061, 11449}, {10063, 15545}, {10067, 12985}, {10069, 10937},
+    {10071, 15033}, {10075, 14009}, {10077, 11961}, {10079, 16057},
+    {10083, 12729}, {10085, 10681}, {10087, 14777}, {10091, 13753},
+    {10093, 11705}, {10095, 15801}, {10099, 13241}, {10101, 11193},
+    {10103, 15289}, {10105, 10169}, {10107, 14265}, {10109, 12217},
+    {10111, 16313}, {10115, 12409}, {10117, 10361}, {10119, 14457},
+    {10123, 13433}, {10125, 11385}, {10127, 15481}, {10131, 12921},
+    {10133, 10873}, {10135, 14969}, {10139, 13945}, {10141, 11897},
+    {10143, 15993}, {10147, 12665}, {10149, 10617}, {10151, 14713},
+    {10155, 13689}, {10157, 11641}, {10159, 15737}, {10163, 13177},
+    {10165, 11129}, {10167, 15225}, {10171, 14201}, {10173, 12153},
+    {10175, 16249}, {10179, 12537}, {10181, 10489}, {10183, 14585},
+    {10187, 13561}, {10189, 11513}, {10191, 15609}, {10195, 13049},
+    {10197, 11001}, {10199, 15097}, {10203, 14073}, {10205, 12025},
+    {10207, 16121}, {10211, 12793}, {10213, 10745}, {10215, 14841},
+    {10219, 13817}, {10221, 11769}, {10223, 15865}, {10227, 13305},
+    {10229, 11257}, {10231, 15353}, {10235, 14329}, {10237, 12281},
+    {10239, 16377}, {10243, 12293}, {10247, 14341}, {10251, 13317},
+    {10253, 11269}, {10255, 15365}, {10259, 12805}, {10261, 10757},
+    {10263, 14853}, {10267, 13829}, {10269, 11781}, {10271, 15877},
+    {10275, 12549}, {10277, 10501}, {10279, 14597}, {10283, 13573},
+    {10285, 11525}, {10287, 15621}, {10291, 13061}, {10293, 11013},
+    {10295, 15109}, {10299, 14085}, {10301, 12037}, {10303, 16133},
+    {10307, 12421}, {10309, 10373}, {10311, 14469}, {10315, 13445},
+    {10317, 11397}, {10319, 15493}, {10323, 12933}, {10325, 10885},
+    {10327, 14981}, {10331, 13957}, {10333, 11909}, {10335, 16005},
+    {10339, 12677}, {10341, 10629}, {10343, 14725}, {10347, 13701},
+    {10349, 11653}, {10351, 15749}, {10355, 13189}, {10357, 11141},
+    {10359, 15237}, {10363, 14213}, {10365, 12165}, {10367, 16261},
+    {10371, 12357}, {10375, 14405}, {10379, 13381}, {10381, 11333},
+    {10383, 15429}, {10387, 12869}, {10389, 10821}, {10391, 14917},
+    {10395, 13893}, {10397, 11845}, {10399, 15941}, {10403, 12613},
+    {10405, 10565}, {10407, 14661}, {10411, 13637}, {10413, 11589},
+    {10415, 15685}, {10419, 13125}, {10421, 11077}, {10423, 15173},
+    {10427, 14149}, {10429, 12101}, {10431, 16197}, {10435, 12485},
+    {10439, 14533}, {10443, 13509}, {10445, 11461}, {10447, 15557},
+    {10451, 12997}, {10453, 10949}, {10455, 15045}, {10459, 14021},
+    {10461, 11973}, {10463, 16069}, {10467, 12741}, {10469, 10693},
+    {10471, 14789}, {10475, 13765}, {10477, 11717}, {10479, 15813},
+    {10483, 13253}, {10485, 11205}, {10487, 15301}, {10491, 14277},
+    {10493, 12229}, {10495, 16325}, {10499, 12325}, {10503, 14373},
+    {10507, 13349}, {10509, 11301}, {10511, 15397}, {10515, 12837},
+    {10517, 10789}, {10519, 14885}, {10523, 13861}, {10525, 11813},
+    {10527, 15909}, {10531, 12581}, {10535, 14629}, {10539, 13605},
+    {10541, 11557}, {10543, 15653}, {10547, 13093}, {10549, 11045},
+    {10551, 15141}, {10555, 14117}, {10557, 12069}, {10559, 16165},
+    {10563, 12453}, {10567, 14501}, {10571, 13477}, {10573, 11429},
+    {10575, 15525}, {10579, 12965}, {10581, 10917}, {10583, 15013},
+    {10587, 13989}, {10589, 11941}, {10591, 16037}, {10595, 12709},
+    {10597, 10661}, {10599, 14757}, {10603, 13733}, {10605, 11685},
+    {10607, 15781}, {10611, 13221}, {10613, 11173}, {10615, 15269},
+    {10619, 14245}, {10621, 12197}, {10623, 16293}, {10627, 12389},
+    {10631, 14437}, {10635, 13413}, {10637, 11365}, {10639, 15461},
+    {10643, 12901}, {10645, 10853}, {10647, 14949}, {10651, 13925},
+    {10653, 11877}, {10655, 15973}, {10659, 12645}, {10663, 14693},
+    {10667, 13669}, {10669, 11621}, {10671, 15717}, {10675, 13157},
+    {10677, 11109}, {10679, 15205}, {10683, 14181}, {10685, 12133},
+    {10687, 16229}, {10691, 12517}, {10695, 14565}, {10699, 13541},
+    {10701, 11493}, {10703, 15589}, {10707, 13029}, {10709, 10981},
+    {10711, 15077}, {10715, 14053}, {10717, 12005}, {10719, 16101},
+    {10723, 12773}, {10727, 14821}, {10731, 13797}, {10733, 11749},
+    {10735, 15845}, {10739, 13285}, {10741, 11237}, {10743, 15333},
+    {10747, 14309}, {10749, 12261}, {10751, 16357}, {10755, 12309},
+    {10759, 14357}, {10763, 13333}, {10765, 11285}, {10767, 15381},
+    {10771, 12821}, {10775, 14869}, {10779, 13845}, {10781, 11797},
+    {10783, 15893}, {10787, 12565}, {10791, 14613}, {10795, 13589},
+    {10797, 11541}, {10799, 15637}, {10803, 13077}, {10805, 11029},
+    {10807, 15125}, {10811, 14101}, {10813, 12053}, {10815, 16149},
+    {10819, 12437}, {10823, 14485}, {10827, 13461}, {10829, 11413},
+    {10831, 15509}, {10835, 12949}, {10837, 10901}, {10839, 14997},
+    {10843, 13973}, {10845, 11925}, {10847, 16021}, {10851, 12693},
+    {10855, 14741}, {10859, 13717}, {10861, 11669}, {10863, 15765},
+    {10867, 13205}, {10869, 11157}, {10871, 15253}, {10875, 14229},
+    {10877, 12181}, {10879, 16277}, {10883, 12373}, {10887, 14421},
+    {10891, 13397}, {10893, 11349}, {10895, 15445}, {10899, 12885},
+    {10903, 14933}, {10907, 13909}, {10909, 11861}, {10911, 15957},
+    {10915, 12629}, {10919, 14677}, {10923, 13653}, {10925, 11605},
+    {10927, 15701}, {10931, 13141}, {10933, 11093}, {10935, 15189},
+    {10939, 14165}, {10941, 12117}, {10943, 16213}, {10947, 12501},
+    {10951, 14549}, {10955, 13525}, {10957, 11477}, {10959, 15573},
+    {10963, 13013}, {10967, 15061}, {10971, 14037}, {10973, 11989},
+    {10975, 16085}, {10979, 12757}, {10983, 14805}, {10987, 13781},
+    {10989, 11733}, {10991, 15829}, {10995, 13269}, {10997, 11221},
+    {10999, 15317}, {11003, 14293}, {11005, 12245}, {11007, 16341},
+    {11011, 12341}, {11015, 14389}, {11019, 13365}, {11021, 11317},
+    {11023, 15413}, {11027, 12853}, {11031, 14901}, {11035, 13877},
+    {11037, 11829}, {11039, 15925}, {11043, 12597}, {11047, 14645},
+    {11051, 13621}, {11053, 11573}, {11055, 15669}, {11059, 13109},
+    {11063, 15157}, {11067, 14133}, {11069, 12085}, {11071, 16181},
+    {11075, 12469}, {11079, 14517}, {11083, 13493}, {11085, 11445},
+    {11087, 15541}, {11091, 12981}, {11095, 15029}, {11099, 14005},
+    {11101, 11957}, {11103, 16053}, {11107, 12725}, {11111, 14773},
+    {11115, 13749}, {11117, 11701}, {11119, 15797}, {11123, 13237},
+    {11125, 11189}, {11127, 15285}, {11131, 14261}, {11133, 12213},
+    {11135, 16309}, {11139, 12405}, {11143, 14453}, {11147, 13429},
+    {11149, 11381}, {11151, 15477}, {11155, 12917}, {11159, 14965},
+    {11163, 13941}, {11165, 11893}, {11167, 15989}, {11171, 12661},
+    {11175, 14709}, {11179, 13685}, {11181, 11637}, {11183, 15733},
+    {11187, 13173}, {11191, 15221}, {11195, 14197}, {11197, 12149},
+    {11199, 16245}, {11203, 12533}, {11207, 14581}, {11211, 13557},
+    {11213, 11509}, {11215, 15605}, {11219, 13045}, {11223, 15093},
+    {11227, 14069}, {11229, 12021}, {11231, 16117}, {11235, 12789},
+    {11239, 14837}, {11243, 13813}, {11245, 11765}, {11247, 15861},
+    {11251, 13301}, {11255, 15349}, {11259, 14325}, {11261, 12277},
+    {11263, 16373}, {11267, 12301}, {11271, 14349}, {11275, 13325},
+    {11279, 15373}, {11283, 12813}, {11287, 14861}, {11291, 13837},
+    {11293, 11789}, {11295, 15885}, {11299, 12557}, {11303, 14605},
+    {11307, 13581}, {11309, 11533}, {11311, 15629}, {11315, 13069},
+    {11319, 15117}, {11323, 14093}, {11325, 12045}, {11327, 16141},
+    {11331, 12429}, {11335, 14477}, {11339, 13453}, {11341, 11405},
+    {11343, 15501}, {11347, 12941}, {11351, 14989}, {11355, 13965},
+    {11357, 11917}, {11359, 16013}, {11363, 12685}, {11367, 14733},
+    {11371, 13709}, {11373, 11661}, {11375, 15757}, {11379, 13197},
+    {11383, 15245}, {11387, 14221}, {11389, 12173}, {11391, 16269},
+    {11395, 12365}, {11399, 14413}, {11403, 13389}, {11407, 15437},
+    {11411, 12877}, {11415, 14925}, {11419, 13901}, {11421, 11853},
+    {11423, 15949}, {11427, 12621}, {11431, 14669}, {11435, 13645},
+    {11437, 11597}, {11439, 15693}, {11443, 13133}, {11447, 15181},
+    {11451, 14157}, {11453, 12109}, {11455, 16205}, {11459, 12493},
+    {11463, 14541}, {11467, 13517}, {11471, 15565}, {11475, 13005},
+    {11479, 15053}, {11483, 14029}, {11485, 11981}, {11487, 16077},
+    {11491, 12749}, {11495, 14797}, {11499, 13773}, {11501, 11725},
+    {11503, 15821}, {11507, 13261}, {11511, 15309}, {11515, 14285},
+    {11517, 12237}, {11519, 16333}, {11523, 12333}, {11527, 14381},
+    {11531, 13357}, {11535, 15405}, {11539, 12845}, {11543, 14893},
+    {11547, 13869}, {11549, 11821}, {11551, 15917}, {11555, 12589},
+    {11559, 14637}, {11563, 13613}, {11567, 15661}, {11571, 13101},
+    {11575, 15149}, {11579, 14125}, {11581, 12077}, {11583, 16173},
+    {11587, 12461}, {11591, 14509}, {11595, 13485}, {11599, 15533},
+    {11603, 12973}, {11607, 15021}, {11611, 13997}, {11613, 11949},
+    {11615, 16045}, {11619, 12717}, {11623, 14765}, {11627, 13741},
+    {11629, 11693}, {11631, 15789}, {11635, 13229}, {11639, 15277},
+    {11643, 14253}, {11645, 12205}, {11647, 16301}, {11651, 12397},
+    {11655, 14445}, {11659, 13421}, {11663, 15469}, {11667, 12909},
+    {11671, 14957}, {11675, 13933}, {11677, 11885}, {11679, 15981},
+    {11683, 12653}, {11687, 14701}, {11691, 13677}, {11695, 15725},
+    {11699, 13165}, {11703, 15213}, {11707, 14189}, {11709, 12141},
+    {11711, 16237}, {11715, 12525}, {11719, 14573}, {11723, 13549},
+    {11727, 15597}, {11731, 13037}, {11735, 15085}, {11739, 14061},
+    {11741, 12013}, {11743, 16109}, {11747, 12781}, {11751, 14829},
+    {11755, 13805}, {11759, 15853}, {11763, 13293}, {11767, 15341},
+    {11771, 14317}, {11773, 12269}, {11775, 16365}, {11779, 12317},
+    {11783, 14365}, {11787, 13341}, {11791, 15389}, {11795, 12829},
+    {11799, 14877}, {11803, 13853}, {11807, 15901}, {11811, 12573},
+    {11815, 14621}, {11819, 13597}, {11823, 15645}, {11827, 13085},
+    {11831, 15133}, {11835, 14109}, {11837, 12061}, {11839, 16157},
+    {11843, 12445}, {11847, 14493}, {11851, 13469}, {11855, 15517},
+    {11859, 12957}, {11863, 15005}, {11867, 13981}, {11869, 11933},
+    {11871, 16029}, {11875, 12701}, {11879, 14749}, {11883, 13725},
+    {11887, 15773}, {11891, 13213}, {11895, 15261}, {11899, 14237},
+    {11901, 12189}, {11903, 16285}, {11907, 12381}, {11911, 14429},
+    {11915, 13405}, {11919, 15453}, {11923, 12893}, {11927, 14941},
+    {11931, 13917}, {11935, 15965}, {11939, 12637}, {11943, 14685},
+    {11947, 13661}, {11951, 15709}, {11955, 13149}, {11959, 15197},
+    {11963, 14173}, {11965, 12125}, {11967, 16221}, {11971, 12509},
+    {11975, 14557}, {11979, 13533}, {11983, 15581}, {11987, 13021},
+    {11991, 15069}, {11995, 14045}, {11999, 16093}, {12003, 12765},
+    {12007, 14813}, {12011, 13789}, {12015, 15837}, {12019, 13277},
+    {12023, 15325}, {12027, 14301}, {12029, 12253}, {12031, 16349},
+    {12035, 12349}, {12039, 14397}, {12043, 13373}, {12047, 15421},
+    {12051, 12861}, {12055, 14909}, {12059, 13885}, {12063, 15933},
+    {12067, 12605}, {12071, 14653}, {12075, 13629}, {12079, 15677},
+    {12083, 13117}, {12087, 15165}, {12091, 14141}, {12095, 16189},
+    {12099, 12477}, {12103, 14525}, {12107, 13501}, {12111, 15549},
+    {12115, 12989}, {12119, 15037}, {12123, 14013}, {12127, 16061},
+    {12131, 12733}, {12135, 14781}, {12139, 13757}, {12143, 15805},
+    {12147, 13245}, {12151, 15293}, {12155, 14269}, {12157, 12221},
+    {12159, 16317}, {12163, 12413}, {12167, 14461}, {12171, 13437},
+    {12175, 15485}, {12179, 12925}, {12183, 14973}, {12187, 13949},
+    {12191, 15997}, {12195, 12669}, {12199, 14717}, {12203, 13693},
+    {12207, 15741}, {12211, 13181}, {12215, 15229}, {12219, 14205},
+    {12223, 16253}, {12227, 12541}, {12231, 14589}, {12235, 13565},
+    {12239, 15613}, {12243, 13053}, {12247, 15101}, {12251, 14077},
+    {12255, 16125}, {12259, 12797}, {12263, 14845}, {12267, 13821},
+    {12271, 15869}, {12275, 13309}, {12279, 15357}, {12283, 14333},
+    {12287, 16381}, {12295, 14339}, {12299, 13315}, {12303, 15363},
+    {12307, 12803}, {12311, 14851}, {12315, 13827}, {12319, 15875},
+    {12323, 12547}, {12327, 14595}, {12331, 13571}, {12335, 15619},
+    {12339, 13059}, {12343, 15107}, {12347, 14083}, {12351, 16131},
+    {12355, 12419}, {12359, 14467}, {12363, 13443}, {12367, 15491},
+    {12371, 12931}, {12375, 14979}, {12379, 13955}, {12383, 16003},
+    {12387, 12675}, {12391, 14723}, {12395, 13699}, {12399, 15747},
+    {12403, 13187}, {12407, 15235}, {12411, 14211}, {12415, 16259},
+    {12423, 14403}, {12427, 13379}, {12431, 15427}, {12435, 12867},
+    {12439, 14915}, {12443, 13891}, {12447, 15939}, {12451, 12611},
+    {12455, 14659}, {12459, 13635}, {12463, 15683}, {12467, 13123},
+    {12471, 15171}, {12475, 14147}, {12479, 16195}, {12487, 14531},
+    {12491, 13507}, {12495, 15555}, {12499, 12995}, {12503, 15043},
+    {12507, 14019}, {12511, 16067}, {12515, 12739}, {12519, 14787},
+    {12523, 13763}, {12527, 15811}, {12531, 13251}, {12535, 15299},
+    {12539, 14275}, {12543, 16323}, {12551, 14371}, {12555, 13347},
+    {12559, 15395}, {12563, 12835}, {12567, 14883}, {12571, 13859},
+    {12575, 15907}, {12583, 14627}, {12587, 13603}, {12591, 15651},
+    {12595, 13091}, {12599, 15139}, {12603, 14115}, {12607, 16163},
+    {12615, 14499}, {12619, 13475}, {12623, 15523}, {12627, 12963},
+    {12631, 15011}, {12635, 13987}, {12639, 16035}, {12643, 12707},
+    {12647, 14755}, {12651, 13731}, {12655, 15779}, {12659, 13219},
+    {12663, 15267}, {12667, 14243}, {12671, 16291}, {12679, 14435},
+    {12683, 13411}, {12687, 15459}, {12691, 12899}, {12695, 14947},
+    {12699, 13923}, {12703, 15971}, {12711, 14691}, {12715, 13667},
+    {12719, 15715}, {12723, 13155}, {12727, 15203}, {12731, 14179},
+    {12735, 16227}, {12743, 14563}, {12747, 13539}, {12751, 15587},
+    {12755, 13027}, {12759, 15075}, {12763, 14051}, {12767, 16099},
+    {12775, 14819}, {12779, 13795}, {12783, 15843}, {12787, 13283},
+    {12791, 15331}, {12795, 14307}, {12799, 16355}, {12807, 14355},
+    {12811, 13331}, {12815, 15379}, {12823, 14867}, {12827, 13843},
+    {12831, 15891}, {12839, 14611}, {12843, 13587}, {12847, 15635},
+    {12851, 13075}, {12855, 15123}, {12859, 14099}, {12863, 16147},
+    {12871, 14483}, {12875, 13459}, {12879, 15507}, {12883, 12947},
+    {12887, 14995}, {12891, 13971}, {12895, 16019}, {12903, 14739},
+    {12907, 13715}, {12911, 15763}, {12915, 13203}, {12919, 15251},
+    {12923, 14227}, {12927, 16275}, {12935, 14419}, {12939, 13395},
+    {12943, 15443}, {12951, 14931}, {12955, 13907}, {12959, 15955},
+    {12967, 14675}, {12971, 13651}, {12975, 15699}, {12979, 13139},
+    {12983, 15187}, {12987, 14163}, {12991, 16211}, {12999, 14547},
+    {13003, 13523}, {13007, 15571}, {13015, 15059}, {13019, 14035},
+    {13023, 16083}, {13031, 14803}, {13035, 13779}, {13039, 15827},
+    {13043, 13267}, {13047, 15315}, {13051, 14291}, {13055, 16339},
+    {13063, 14387}, {13067, 13363}, {13071, 15411}, {13079, 14899},
+    {13083, 13875}, {13087, 15923}, {13095, 14643}, {13099, 13619},
+    {13103, 15667}, {13111, 15155}, {13115, 14131}, {13119, 16179},
+    {13127, 14515}, {13131, 13491}, {13135, 15539}, {13143, 15027},
+    {13147, 14003}, {13151, 16051}, {13159, 14771}, {13163, 13747},
+    {13167, 15795}, {13171, 13235}, {13175, 15283}, {13179, 14259},
+    {13183, 16307}, {13191, 14451}, {13195, 13427}, {13199, 15475},
+    {13207, 14963}, {13211, 13939}, {13215, 15987}, {13223, 14707},
+    {13227, 13683}, {13231, 15731}, {13239, 15219}, {13243, 14195},
+    {13247, 16243}, {13255, 14579}, {13259, 13555}, {13263, 15603},
+    {13271, 15091}, {13275, 14067}, {13279, 16115}, {13287, 14835},
+    {13291, 13811}, {13295, 15859}, {13303, 15347}, {13307, 14323},
+    {13311, 16371}, {13319, 14347}, {13327, 15371}, {13335, 14859},
+    {13339, 13835}, {13343, 15883}, {13351, 14603}, {13355, 13579},
+    {13359, 15627}, {13367, 15115}, {13371, 14091}, {13375, 16139},
+    {13383, 14475}, {13387, 13451}, {13391, 15499}, {13399, 14987},
+    {13403, 13963}, {13407, 16011}, {13415, 14731}, {13419, 13707},
+    {13423, 15755}, {13431, 15243}, {13435, 14219}, {13439, 16267},
+    {13447, 14411}, {13455, 15435}, {13463, 14923}, {13467, 13899},
+    {13471, 15947}, {13479, 14667}, {13483, 13643}, {13487, 15691},
+    {13495, 15179}, {13499, 14155}, {13503, 16203}, {13511, 14539},
+    {13519, 15563}, {13527, 15051}, {13531, 14027}, {13535, 16075},
+    {13543, 14795}, {13547, 13771}, {13551, 15819}, {13559, 15307},
+    {13563, 14283}, {13567, 16331}, {13575, 14379}, {13583, 15403},
+    {13591, 14891}, {13595, 13867}, {13599, 15915}, {13607, 14635},
+    {13615, 15659}, {13623, 15147}, {13627, 14123}, {13631, 16171},
+    {13639, 14507}, {13647, 15531}, {13655, 15019}, {13659, 13995},
+    {13663, 16043}, {13671, 14763}, {13675, 13739}, {13679, 15787},
+    {13687, 15275}, {13691, 14251}, {13695, 16299}, {13703, 14443},
+    {13711, 15467}, {13719, 14955}, {13723, 13931}, {13727, 15979},
+    {13735, 14699}, {13743, 15723}, {13751, 15211}, {13755, 14187},
+    {13759, 16235}, {13767, 14571}, {13775, 15595}, {13783, 15083},
+    {13787, 14059}, {13791, 16107}, {13799, 14827}, {13807, 15851},
+    {13815, 15339}, {13819, 14315}, {13823, 16363}, {13831, 14363},
+    {13839, 15387}, {13847, 14875}, {13855, 15899}, {13863, 14619},
+    {13871, 15643}, {13879, 15131}, {13883, 14107}, {13887, 16155},
+    {13895, 14491}, {13903, 15515}, {13911, 15003}, {13915, 13979},
+    {13919, 16027}, {13927, 14747}, {13935, 15771}, {13943, 15259},
+    {13947, 14235}, {13951, 16283}, {13959, 14427}, {13967, 15451},
+    {13975, 14939}, {13983, 15963}, {13991, 14683}, {13999, 15707},
+    {14007, 15195}, {14011, 14171}, {14015, 16219}, {14023, 14555},
+    {14031, 15579}, {14039, 15067}, {14047, 16091}, {14055, 14811},
+    {14063, 15835}, {14071, 15323}, {14075, 14299}, {14079, 16347},
+    {14087, 14395}, {14095, 15419}, {14103, 14907}, {14111, 15931},
+    {14119, 14651}, {14127, 15675}, {14135, 15163}, {14143, 16187},
+    {14151, 14523}, {14159, 15547}, {14167, 15035}, {14175, 16059},
+    {14183, 14779}, {14191, 15803}, {14199, 15291}, {14203, 14267},
+    {14207, 16315}, {14215, 14459}, {14223, 15483}, {14231, 14971},
+    {14239, 15995}, {14247, 14715}, {14255, 15739}, {14263, 15227},
+    {14271, 16251}, {14279, 14587}, {14287, 15611}, {14295, 15099},
+    {14303, 16123}, {14311, 14843}, {14319, 15867}, {14327, 15355},
+    {14335, 16379}, {14351, 15367}, {14359, 14855}, {14367, 15879},
+    {14375, 14599}, {14383, 15623}, {14391, 15111}, {14399, 16135},
+    {14407, 14471}, {14415, 15495}, {14423, 14983}, {14431, 16007},
+    {14439, 14727}, {14447, 15751}, {14455, 15239}, {14463, 16263},
+    {14479, 15431}, {14487, 14919}, {14495, 15943}, {14503, 14663},
+    {14511, 15687}, {14519, 15175}, {14527, 16199}, {14543, 15559},
+    {14551, 15047}, {14559, 16071}, {14567, 14791}, {14575, 15815},
+    {14583, 15303}, {14591, 16327}, {14607, 15399}, {14615, 14887},
+    {14623, 15911}, {14639, 15655}, {14647, 15143}, {14655, 16167},
+    {14671, 15527}, {14679, 15015}, {14687, 16039}, {14695, 14759},
+    {14703, 15783}, {14711, 15271}, {14719, 16295}, {14735, 15463},
+    {14743, 14951}, {14751, 15975}, {14767, 15719}, {14775, 15207},
+    {14783, 16231}, {14799, 15591}, {14807, 15079}, {14815, 16103},
+    {14831, 15847}, {14839, 15335}, {14847, 16359}, {14863, 15383},
+    {14879, 15895}, {14895, 15639}, {14903, 15127}, {14911, 16151},
+    {14927, 15511}, {14935, 14999}, {14943, 16023}, {14959, 15767},
+    {14967, 15255}, {14975, 16279}, {14991, 15447}, {15007, 15959},
+    {15023, 15703}, {15031, 15191}, {15039, 16215}, {15055, 15575},
+    {15071, 16087}, {15087, 15831}, {15095, 15319}, {15103, 16343},
+    {15119, 15415}, {15135, 15927}, {15151, 15671}, {15167, 16183},
+    {15183, 15543}, {15199, 16055}, {15215, 15799}, {15223, 15287},
+    {15231, 16311}, {15247, 15479}, {15263, 15991}, {15279, 15735},
+    {15295, 16247}, {15311, 15607}, {15327, 16119}, {15343, 15863},
+    {15359, 16375}, {15391, 15887}, {15407, 15631}, {15423, 16143},
+    {15439, 15503}, {15455, 16015}, {15471, 15759}, {15487, 16271},
+    {15519, 15951}, {15535, 15695}, {15551, 16207}, {15583, 16079},
+    {15599, 15823}, {15615, 16335}, {15647, 15919}, {15679, 16175},
+    {15711, 16047}, {15727, 15791}, {15743, 16303}, {15775, 15983},
+    {15807, 16239}, {15839, 16111}, {15871, 16367}, {15935, 16159},
+    {15967, 16031}, {15999, 16287}, {16063, 16223}, {16127, 16351},
+    {16255, 16319}
+};
+
+static void fft_fixed_rearrange(float data_re[], float data_im[]) {
+  for (int s = 0; s < 8128; ++s) {
+    const int a = fft_fixed_swaps[s][0];
+    const int b = fft_fixed_swaps[s][1];
+    const float temp_re = data_re[a];
+    const float temp_im = data_im[a];
+    data_re[a] = data_re[b];
+    data_im[a] = data_im[b];
+    data_re[b] = temp_re;
+    data_im[b] = temp_im;
+  }
+}
+
+static void fft_fixed_compute(float data_re[], float data_im[]) {
+  // stages 1 and 2 as radix-4 butterflies: twiddles 1 and -i
+  for (int i = 0; i < 16384; i += 4) {
+    const float a_re = data_re[i] + data_re[i + 1];
+    const float a_im = data_im[i] + data_im[i + 1];
+    const float b_re = data_re[i] - data_re[i + 1];
+    const float b_im = data_im[i] - data_im[i + 1];
+    const float c_re = data_re[i + 2] + data_re[i + 3];
+    const float c_im = data_im[i + 2] + data_im[i + 3];
+    const float d_re = data_re[i + 2] - data_re[i + 3];
+    const float d_im = data_im[i + 2] - data_im[i + 3];
+    data_re[i] = a_re + c_re;
+    data_im[i] = a_im + c_im;
+    data_re[i + 2] = a_re - c_re;
+    data_im[i + 2] = a_im - c_im;
+    data_re[i + 1] = b_re + d_im;
+    data_im[i + 1] = b_im - d_re;
+    data_re[i + 3] = b_re - d_im;
+    data_im[i + 3] = b_im + d_re;
+  }
+
+  // the rest radix-2, each block of a stage in turn
+  for (int step = 4; step < 16384; step <<= 1) {
+    const int stride = 8192 / step;  // twiddle index per group
+    for (int block = 0; block < 16384; block += step << 1) {
+      for (int group = 0; group < step; ++group) {
+        const float twiddle_re = fft_fixed_twiddle_re[group * stride];
+        const float twiddle_im = fft_fixed_twiddle_im[group * stride];
+        const int pair = block + group;
+        const int match = pair + step;
+        const float product_re =
+            twiddle_re * data_re[match] - twiddle_im * data_im[match];
+        const float product_im =
+            twiddle_im * data_re[match] + twiddle_re * data_im[match];
+        data_re[match] = data_re[pair] - product_re;
+        data_im[match] = data_im[pair] - product_im;
+        data_re[pair] += product_re;
+        data_im[pair] += product_im;
+      }
+    }
+  }
+}
+
+#endif  // FFT_16384_H
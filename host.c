@@ -0,0 +1,3612 @@
+/*
+ * Host (Linux) build of the tuner.
+ *
+ * main.c talks to the DE1-SoC through memory-mapped devices. When it is built
+ * with -DHOST_BUILD those devices are replaced by the in-memory stand-ins
+ * defined here, so the drawing and analysis code runs unchanged off the board:
+ *
+ *   gcc -O2 -DHOST_BUILD main.c tuner.c host.c -lm -pthread -o tuner-host
+ *
+ *   ./tuner-host render [-o dir] [--compare dir]
+ *       draws the screen through a scripted session, dumps every frame as
+ *       PPM and PNG plus the character buffer as text, prints pixel and
+ *       character writes and the time taken by each draw routine. With
+ *       --compare, frames are checked against golden frames from an earlier
+ *       run and the exit status is non-zero if any pixel or character differs.
+ *
+ *   ./tuner-host bench [--min N] [--max N] [--reps R] [--warmup W]
+ *                      [--label name] [--csv | --json]
+ *       times rearrange(), compute(), fft(), the windowed conversion (Hann)
+ *       and estimatePitch() for every power of two N from 256 to 65536: ns
+ *       per sample, samples per second and an estimate of Nios II cycles,
+ *       summarised over R repetitions.
+ *       CSV and JSON rows carry the label so runs of different revisions can
+ *       be compared.
+ *
+ *   ./tuner-host accuracy [--trials T] [--recordings dir] [--csv]
+ *       cents error and time-to-answer of each pitch engine against capture
+ *       length (the last being each string's from the tuning profile),
+ *       string, detuning, noise and harmonic content, on synthetic plucks
+ *       (Karplus-Strong, and stiff strings with a weak fundamental).
+ *       With --recordings, every .wav (16-bit PCM) and .raw/.pcm (s16le mono
+ *       at 8 kHz) file in dir is replayed through the same engines. The
+ *       expected pitch comes from the file name: a string name (E2 A2 D3 G3
+ *       B3 E4) or a frequency such as 110.5hz.
+ *
+ *   ./tuner-host analyze [--threads N] [--length L] [--csv] file|dir...
+ *       runs the pitch analysis over every recording given (directories are
+ *       searched recursively) on a work-stealing pool of up to N threads
+ *       (default: all cores). Prints files per second for 1, 2, 4 ... N
+ *       threads, then one row per file: samples analysed (the whole
+ *       recording, up to L), expected pitch from the name, estimate and
+ *       error.
+ *
+ *   ./tuner-host record-session -o session.bin [--readings R]
+ *                               [--window none|hann|blackman-harris|kaiser]
+ *       records R synthetic readings of every string into the session log,
+ *       as the board does with SW3 on (and the window picked by SW8 and
+ *       SW9), and writes it out.
+ *
+ *   ./tuner-host replay [-o dir] [--from C] [--count K] session.bin
+ *       feeds a session log (a memory dump of sessionLog from the board, up
+ *       to sessionLogBytes()) back through the analysis and drawing code,
+ *       as fast as it runs, and checks each reading against the recorded
+ *       one. --from seeks to capture C through the index; -o dumps a frame
+ *       per reading.
+ *
+ *   ./tuner-host stream [--rate Hz] [--window N] [--hop H] [--string S]
+ *                       [--window-type W] [--full-search] [--quiet]
+ *       reads s16le mono PCM from stdin as it arrives (arecord -t raw -f
+ *       S16_LE -c1 -r48000, or a file through pv -L) and prints a reading
+ *       every H samples (default 256 of a 16384-sample window) through the
+ *       tuner library, with the latency from the arrival of the samples to
+ *       the reading. --string takes the window and hop of string S (E2 ...
+ *       E4) from the board's tuning profile. Rates that are a multiple of 8
+ *       kHz are decimated to the board's 8 kHz. Ends with latency
+ *       percentiles and the real-time headroom of the analysis thread.
+ *       Each reading is the board's pitch estimate (harmonic summation) of
+ *       the window weighted by W (none, hann, blackman-harris or kaiser;
+ *       none by default, as on the board with SW8 and SW9 down). The pitch
+ *       is tracked from window to window unless --full-search is given.
+ *
+ *   ./tuner-host latency-sim [--presses N] [--cpu-scale S] [-o dir]
+ *       runs N KEY3 readings on a simulated clock (keys, 8 kHz audio FIFO,
+ *       60 Hz frames, a cost per pixel and character written) with the
+ *       latency panel on, and prints the panel: last, median and worst time
+ *       of each stage and a histogram of the total. The run is deterministic
+ *       unless --cpu-scale charges host compute time, stretched S times, to
+ *       the clock as well.
+ *
+ *   ./tuner-host strum [--trials T] [--detune cents] [--stiff] [-o dir]
+ *       cents error of each string found by polyphonic mode (SW5) in T
+ *       synthetic strums of all six strings, each detuned at random and at
+ *       its own loudness. -o dumps the screen after the last strum.
+ *
+ *   ./tuner-host auto-string [--readings R] [--detune cents]
+ *       plays R plucks of random strings, each detuned up to the given cents,
+ *       through KEY3 with auto string selection (SW6) on and counts the
+ *       readings that selected the string played. Then times tuner_classify()
+ *       against a search by log2f() over strings and over the 64 notes A0 to
+ *       C6, and counts any frequency on which they disagree.
+ *
+ *   ./tuner-host chromatic [--readings R] [--detune cents]
+ *       plays R plucks of random notes from A0 to C6, each detuned up to
+ *       the given cents, through KEY3 in chromatic mode (SW7) and checks the
+ *       note named and the cents error of the reading. Then compares
+ *       tuner_pitch_millicents() with 1200 log2f() over a sweep: worst error
+ *       and time per call.
+ *
+ *   ./tuner-host gen-fft N [-o file.h]
+ *       writes the fixed-size FFT kernel for N points that tuner.c includes
+ *       (fft_16384.h is made with gen-fft 16384 -o fft_16384.h). bench
+ *       compares it with the generic kernels.
+ *
+ *   ./tuner-host trig [--count N]
+ *       checks the fixed-point trig engine of tuner.c against libm in
+ *       doubles over N arguments (worst and RMS error of each function), then
+ *       times it and the libm calls it replaces, with an estimate of Nios II
+ *       cycles for both. Exits non-zero if an error passes the bound
+ *       documented in tuner.h.
+ *
+ *   ./tuner-host fft-sizes [--reps R] [N ...]
+ *       checks tuner_fft() at each N (default: a spread of capture lengths
+ *       that are and are not powers of two) against a DFT in doubles and
+ *       times it: algorithm and stages planned, largest error relative to
+ *       the largest bin, plan and transform time, and an estimate for the
+ *       Nios II. Exits non-zero if an error passes 1e-5.
+ *
+ *   ./tuner-host decode-log dump.bin
+ *       prints the records of a memory dump of logRing (from the board, or
+ *       the log.bin that render -o writes) as text with timestamps.
+ *
+ *   ./tuner-host telemetry-send [--encoding float|int16|delta] [--raw]
+ *       writes the telemetry frames the board sends over the JTAG UART with
+ *       SW1 (and SW2 for --raw) on, for a synthetic reading of each string.
+ *
+ *   ./tuner-host decode-telemetry [-o prefix] [file|-]
+ *       decodes a captured telemetry stream (e.g. nios2-terminal output):
+ *       prefix_estimates.csv, prefix_spectra.csv and one s16le .raw file per
+ *       raw capture, named with the expected pitch so accuracy --recordings
+ *       replays it. Reports frames, CRC errors and sequence gaps.
+ *
+ * Adding -DTUNER_PROFILE enables the timing scopes of main.c; the host stands
+ * in a 100 MHz timer from the monotonic clock, and render ends with the
+ * profile report that the board sends over the JTAG UART.
+ */
+
+#include <ctype.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "main.h"
+#include "tuner.h"
+
+#define SCREEN_WIDTH 320
+#define SCREEN_HEIGHT 240
+#define PIXEL_ROW_STRIDE 512  // shorts per row, as on the VGA pixel buffer
+#define TEXT_COLUMNS 80
+#define TEXT_ROWS 60
+#define TEXT_ROW_STRIDE 128   // characters per row, as on the VGA
+
+/*****************************************************************************/
+/* DEVICE STAND-INS */
+/*****************************************************************************/
+
+unsigned long int hostKeyRegisters[4];
+int hostAudioRegisters[8];
+unsigned long int hostLedRegisters[1];
+unsigned long int hostSwitchRegisters[1];
+unsigned long int hostPixelControlRegisters[4];
+int hostControlRegisters[6];
+short hostPixelBuffer[SCREEN_HEIGHT * PIXEL_ROW_STRIDE];
+char hostCharacterBuffer[TEXT_ROWS * TEXT_ROW_STRIDE];
+unsigned long int hostPixelWrites = 0;
+unsigned long int hostCharacterWrites = 0;
+
+// simulated time for latency-sim. While hostClockSimulated is set, the
+// interval timer reads hostSimulatedTicks plus a cost for every pixel and
+// character written (and, with hostCpuScale, the host's own compute time
+// stretched by that factor); delays and FIFO waits advance it instantly
+#define HOST_SIM_PIXEL_TICKS 10
+#define HOST_SIM_CHARACTER_TICKS 10
+bool hostClockSimulated = false;
+unsigned long long hostSimulatedTicks = 0;
+double hostCpuScale = 0;
+double hostCpuStartNs = 0;
+
+unsigned long long hostSimulatedNow() {
+  double cpuTicks = 0;
+  if (hostCpuScale > 0) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    double ns = ts.tv_sec * 1e9 + ts.tv_nsec;
+    cpuTicks = (ns - hostCpuStartNs) / 10 * hostCpuScale;
+  }
+  return hostSimulatedTicks + hostPixelWrites * HOST_SIM_PIXEL_TICKS +
+         hostCharacterWrites * HOST_SIM_CHARACTER_TICKS +
+         (unsigned long long)cpuTicks;
+}
+
+// interval timer stand-in: 100 MHz ticks of the monotonic clock
+unsigned int hostTimerTicks() {
+  if (hostClockSimulated) {
+    return (unsigned int)hostSimulatedNow();
+  }
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (unsigned int)(ts.tv_sec * 100000000ull + ts.tv_nsec / 10);
+}
+
+// delayTicks() stand-in: host tools never wait in real time
+void hostDelayTicks(unsigned int ticks) {
+  if (hostClockSimulated) {
+    hostSimulatedTicks += ticks;
+  }
+}
+
+// audio core stand-in. With the simulated clock, hostAudioSource plays at
+// 8 kHz into a 128-sample read FIFO: reading an empty FIFO moves time on to
+// the next sample, as the board's polling loop would, and a full FIFO
+// overruns. Otherwise the registers read as last stored. The source loops
+// from the sample hostAudioSourceStart; -1 starts it with the next sample
+// read, as a string plucked for a capture
+#define HOST_AUDIO_RATE 8000
+#define HOST_AUDIO_FIFO 128
+const int *hostAudioSource = NULL;
+int hostAudioSourceLength = 0;
+long long hostAudioSourceStart = 0;
+long long hostAudioConsumed = 0;
+
+int hostAudioRead(int offset) {
+  if (!hostClockSimulated || !hostAudioSource) {
+    return hostAudioRegisters[offset];
+  }
+  const long long ticksPerSample = 100000000 / HOST_AUDIO_RATE;
+  long long arrived = (long long)(hostSimulatedNow() / ticksPerSample);
+  if (arrived - hostAudioConsumed > HOST_AUDIO_FIFO) {
+    hostAudioConsumed = arrived - HOST_AUDIO_FIFO;  // overrun: oldest lost
+  }
+  int available = (int)(arrived - hostAudioConsumed);
+  if (offset == 1) {
+    if (available == 0) {
+      hostSimulatedTicks +=
+          (arrived + 1) * ticksPerSample - hostSimulatedNow();
+    }
+    return available | (available << 8);  // RARC and RALC
+  }
+  if (hostAudioSourceStart < 0) {
+    hostAudioSourceStart = hostAudioConsumed;
+  }
+  int sample = hostAudioSource[(hostAudioConsumed - hostAudioSourceStart) %
+                               hostAudioSourceLength];
+  if (offset == 3 && available > 0) {
+    hostAudioConsumed++;
+  }
+  return sample;
+}
+
+// JTAG UART stand-in: a stream that always has room
+FILE *hostJtagOutput = NULL;  // stdout unless a command redirects it
+
+bool hostJtagTryPutChar(char c) {
+  fputc(c, hostJtagOutput ? hostJtagOutput : stdout);
+  return true;
+}
+
+/*****************************************************************************/
+/* DRAW ROUTINE TIMING */
+/*****************************************************************************/
+
+struct routineStats {
+  const char *name;
+  int calls;
+  double totalMicroseconds;
+  unsigned long int pixelWrites;
+  unsigned long int characterWrites;
+};
+
+#define MAX_ROUTINES 16
+struct routineStats routines[MAX_ROUTINES];
+int numRoutines = 0;
+
+double nowMicroseconds() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+struct routineStats *findRoutine(const char *name) {
+  for (int i = 0; i < numRoutines; ++i) {
+    if (strcmp(routines[i].name, name) == 0) {
+      return &routines[i];
+    }
+  }
+  if (numRoutines == MAX_ROUTINES) {
+    fprintf(stderr, "too many draw routines\n");
+    exit(1);
+  }
+  routines[numRoutines].name = name;
+  return &routines[numRoutines++];
+}
+
+// runs a draw call and adds its time and writes to the routine's totals
+#define TIME_DRAW(name, call)                                        \
+  do {                                                               \
+    struct routineStats *stats = findRoutine(name);                  \
+    unsigned long int pixelsBefore = hostPixelWrites;                \
+    unsigned long int charactersBefore = hostCharacterWrites;        \
+    double start = nowMicroseconds();                                \
+    call;                                                            \
+    stats->totalMicroseconds += nowMicroseconds() - start;           \
+    stats->calls++;                                                  \
+    stats->pixelWrites += hostPixelWrites - pixelsBefore;            \
+    stats->characterWrites += hostCharacterWrites - charactersBefore; \
+  } while (0)
+
+void printRoutineStats() {
+  printf("%-24s %6s %12s %12s %12s %12s\n", "routine", "calls", "total us",
+         "us/call", "pixels", "chars");
+  for (int i = 0; i < numRoutines; ++i) {
+    struct routineStats *stats = &routines[i];
+    printf("%-24s %6d %12.1f %12.2f %12lu %12lu\n", stats->name, stats->calls,
+           stats->totalMicroseconds, stats->totalMicroseconds / stats->calls,
+           stats->pixelWrites, stats->characterWrites);
+  }
+}
+
+/*****************************************************************************/
+/* FRAME DUMPS */
+/*****************************************************************************/
+
+void pixelToRGB(short pixel, unsigned char rgb[3]) {
+  unsigned short p = (unsigned short)pixel;
+  rgb[0] = (unsigned char)(((p >> 11) & 0x1F) * 255 / 31);
+  rgb[1] = (unsigned char)(((p >> 5) & 0x3F) * 255 / 63);
+  rgb[2] = (unsigned char)((p & 0x1F) * 255 / 31);
+}
+
+bool writePPM(const char *path) {
+  FILE *file = fopen(path, "wb");
+  if (!file) {
+    return false;
+  }
+  fprintf(file, "P6\n%d %d\n255\n", SCREEN_WIDTH, SCREEN_HEIGHT);
+  for (int y = 0; y < SCREEN_HEIGHT; ++y) {
+    for (int x = 0; x < SCREEN_WIDTH; ++x) {
+      unsigned char rgb[3];
+      pixelToRGB(hostPixelBuffer[y * PIXEL_ROW_STRIDE + x], rgb);
+      fwrite(rgb, 1, 3, file);
+    }
+  }
+  fclose(file);
+  return true;
+}
+
+uint32_t crc32Update(uint32_t crc, const unsigned char *data, size_t length) {
+  static uint32_t table[256];
+  if (table[1] == 0) {
+    for (uint32_t n = 0; n < 256; ++n) {
+      uint32_t c = n;
+      for (int k = 0; k < 8; ++k) {
+        c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+      }
+      table[n] = c;
+    }
+  }
+  crc = ~crc;
+  for (size_t i = 0; i < length; ++i) {
+    crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+  }
+  return ~crc;
+}
+
+void putBigEndian32(unsigned char *out, uint32_t value) {
+  out[0] = (unsigned char)(value >> 24);
+  out[1] = (unsigned char)(value >> 16);
+  out[2] = (unsigned char)(value >> 8);
+  out[3] = (unsigned char)value;
+}
+
+void writePNGChunk(FILE *file, const char *type, const unsigned char *data,
+                   uint32_t length) {
+  unsigned char header[8];
+  putBigEndian32(header, length);
+  memcpy(header + 4, type, 4);
+  fwrite(header, 1, 8, file);
+  fwrite(data, 1, length, file);
+  uint32_t crc = crc32Update(0, header + 4, 4);
+  crc = crc32Update(crc, data, length);
+  unsigned char crcBytes[4];
+  putBigEndian32(crcBytes, crc);
+  fwrite(crcBytes, 1, 4, file);
+}
+
+// writes an uncompressed PNG (zlib stream of stored deflate blocks), which
+// needs no compression library
+bool writePNG(const char *path) {
+  FILE *file = fopen(path, "wb");
+  if (!file) {
+    return false;
+  }
+  static const unsigned char signature[8] = {0x89, 'P',  'N',  'G',
+                                             '\r', '\n', 0x1A, '\n'};
+  fwrite(signature, 1, 8, file);
+
+  unsigned char ihdr[13];
+  putBigEndian32(ihdr, SCREEN_WIDTH);
+  putBigEndian32(ihdr + 4, SCREEN_HEIGHT);
+  ihdr[8] = 8;   // bit depth
+  ihdr[9] = 2;   // truecolour
+  ihdr[10] = 0;  // deflate
+  ihdr[11] = 0;  // adaptive filtering
+  ihdr[12] = 0;  // no interlace
+  writePNGChunk(file, "IHDR", ihdr, sizeof(ihdr));
+
+  // one scanline = filter byte + RGB; one stored block per scanline
+  const uint32_t lineLength = 1 + SCREEN_WIDTH * 3;
+  const uint32_t idatLength = 2 + SCREEN_HEIGHT * (5 + lineLength) + 4;
+  unsigned char *idat = malloc(idatLength);
+  unsigned char *out = idat;
+  *out++ = 0x78;  // zlib header: deflate, 32K window
+  *out++ = 0x01;
+  uint32_t adlerA = 1, adlerB = 0;
+  for (int y = 0; y < SCREEN_HEIGHT; ++y) {
+    *out++ = (y == SCREEN_HEIGHT - 1) ? 1 : 0;  // BFINAL on the last block
+    *out++ = (unsigned char)(lineLength & 0xFF);
+    *out++ = (unsigned char)(lineLength >> 8);
+    *out++ = (unsigned char)(~lineLength & 0xFF);
+    *out++ = (unsigned char)((~lineLength >> 8) & 0xFF);
+    unsigned char *line = out;
+    *out++ = 0;  // filter: none
+    for (int x = 0; x < SCREEN_WIDTH; ++x) {
+      pixelToRGB(hostPixelBuffer[y * PIXEL_ROW_STRIDE + x], out);
+      out += 3;
+    }
+    for (uint32_t i = 0; i < lineLength; ++i) {
+      adlerA = (adlerA + line[i]) % 65521;
+      adlerB = (adlerB + adlerA) % 65521;
+    }
+  }
+  putBigEndian32(out, (adlerB << 16) | adlerA);
+  writePNGChunk(file, "IDAT", idat, idatLength);
+  free(idat);
+  writePNGChunk(file, "IEND", NULL, 0);
+  fclose(file);
+  return true;
+}
+
+// the character buffer as 60 lines of 80 characters, blanks as spaces
+bool writeCharacterBuffer(const char *path) {
+  FILE *file = fopen(path, "w");
+  if (!file) {
+    return false;
+  }
+  for (int y = 0; y < TEXT_ROWS; ++y) {
+    for (int x = 0; x < TEXT_COLUMNS; ++x) {
+      char c = hostCharacterBuffer[y * TEXT_ROW_STRIDE + x];
+      fputc(c ? c : ' ', file);
+    }
+    fputc('\n', file);
+  }
+  fclose(file);
+  return true;
+}
+
+// compares the current frame against <dir>/<name>.ppm and <dir>/<name>.txt.
+// Returns the number of differing pixels and characters
+long compareWithGolden(const char *dir, const char *name) {
+  char path[512];
+  long differences = 0;
+
+  snprintf(path, sizeof(path), "%s/%s.ppm", dir, name);
+  FILE *file = fopen(path, "rb");
+  int width, height, maxValue;
+  if (!file || fscanf(file, "P6 %d %d %d", &width, &height, &maxValue) != 3 ||
+      width != SCREEN_WIDTH || height != SCREEN_HEIGHT || fgetc(file) < 0) {
+    fprintf(stderr, "cannot read golden frame %s\n", path);
+    if (file) {
+      fclose(file);
+    }
+    return -1;
+  }
+  for (int y = 0; y < SCREEN_HEIGHT; ++y) {
+    for (int x = 0; x < SCREEN_WIDTH; ++x) {
+      unsigned char expected[3], actual[3];
+      if (fread(expected, 1, 3, file) != 3) {
+        fclose(file);
+        return -1;
+      }
+      pixelToRGB(hostPixelBuffer[y * PIXEL_ROW_STRIDE + x], actual);
+      differences += memcmp(expected, actual, 3) != 0;
+    }
+  }
+  fclose(file);
+
+  snprintf(path, sizeof(path), "%s/%s.txt", dir, name);
+  file = fopen(path, "r");
+  if (!file) {
+    fprintf(stderr, "cannot read golden text %s\n", path);
+    return -1;
+  }
+  for (int y = 0; y < TEXT_ROWS; ++y) {
+    for (int x = 0; x <= TEXT_COLUMNS; ++x) {
+      int expected = fgetc(file);
+      if (x == TEXT_COLUMNS) {
+        continue;  // newline
+      }
+      char c = hostCharacterBuffer[y * TEXT_ROW_STRIDE + x];
+      differences += expected != (c ? c : ' ');
+    }
+  }
+  fclose(file);
+  return differences;
+}
+
+/*****************************************************************************/
+/* RENDER COMMAND */
+/*****************************************************************************/
+
+const char *outputDir = NULL;
+const char *goldenDir = NULL;
+int frameNumber = 0;
+bool goldenMismatch = false;
+unsigned long int framePixelWrites = 0;
+unsigned long int frameCharacterWrites = 0;
+
+// dumps and/or checks the current frame and reports the writes since the last
+void finishFrame(const char *name) {
+  char frameName[128];
+  snprintf(frameName, sizeof(frameName), "frame%02d_%s", frameNumber++, name);
+  printf("%-32s %8lu pixel writes %6lu char writes\n", frameName,
+         hostPixelWrites - framePixelWrites,
+         hostCharacterWrites - frameCharacterWrites);
+  framePixelWrites = hostPixelWrites;
+  frameCharacterWrites = hostCharacterWrites;
+
+  if (outputDir) {
+    char path[512];
+    snprintf(path, sizeof(path), "%s/%s.ppm", outputDir, frameName);
+    bool ok = writePPM(path);
+    snprintf(path, sizeof(path), "%s/%s.png", outputDir, frameName);
+    ok = ok && writePNG(path);
+    snprintf(path, sizeof(path), "%s/%s.txt", outputDir, frameName);
+    ok = ok && writeCharacterBuffer(path);
+    // the log ring as the board would dump it, for decode-log
+    snprintf(path, sizeof(path), "%s/log.bin", outputDir);
+    FILE *log = fopen(path, "wb");
+    ok = ok && log &&
+         fwrite(&logRing, 1, logRingBytes(), log) == logRingBytes();
+    if (log) {
+      fclose(log);
+    }
+    if (!ok) {
+      fprintf(stderr, "cannot write frame %s to %s\n", frameName, outputDir);
+      exit(1);
+    }
+  }
+  if (goldenDir) {
+    long differences = compareWithGolden(goldenDir, frameName);
+    if (differences != 0) {
+      printf("  MISMATCH against golden frame: %ld\n", differences);
+      goldenMismatch = true;
+    }
+  }
+}
+
+// fills the analysis buffers with a synthetic spectrum peaking at peakHz
+void fakeSpectrum(float peakHz) {
+  for (int k = 0; k < 16384; ++k) {
+    float hz = k * 8000.0f / 16384;
+    float distance = (hz - peakHz) / 2.0f;
+    analysisRe[k] = 1e6f / (1.0f + distance * distance) + 1e3f;
+    analysisIm[k] = 0;
+  }
+}
+
+// animates the needle until it settles, counting the frames
+void settleNeedle() {
+  int frames = 0;
+  unsigned long int before;
+  do {
+    before = hostPixelWrites;
+    TIME_DRAW("animateNeedle", animateNeedle());
+    ++frames;
+  } while (hostPixelWrites != before && frames < 1000);
+  printf("needle settled after %d frames\n", frames);
+}
+
+int renderCommand(int argc, char **argv) {
+  for (int i = 0; i < argc; ++i) {
+    if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+      outputDir = argv[++i];
+    } else if (strcmp(argv[i], "--compare") == 0 && i + 1 < argc) {
+      goldenDir = argv[++i];
+    } else {
+      fprintf(stderr, "usage: tuner-host render [-o dir] [--compare dir]\n");
+      return 2;
+    }
+  }
+
+  TIME_DRAW("clear_screen", clear_screen());
+  TIME_DRAW("clear_character_buffer", clear_character_buffer());
+  finishFrame("cleared");
+
+  logEvent(LOG_BOOT, 0, 0);
+  TIME_DRAW("drawInitialScreen", drawInitialScreen());
+  TIME_DRAW("drawGuitar", drawGuitar());
+  TIME_DRAW("drawScale", drawScale());
+  TIME_DRAW("drawSpectrumPanels", drawSpectrumPanels());
+  finishFrame("initial");
+
+  for (int string = 0; string < 6; ++string) {
+    stringState = string;
+    TIME_DRAW("clearArrows", clearArrows());
+    TIME_DRAW("drawArrow", drawArrow());
+  }
+  stringState = 0;
+  TIME_DRAW("clearArrows", clearArrows());
+  TIME_DRAW("drawArrow", drawArrow());
+  finishFrame("arrows");
+
+  // a flat D string, then a sharp one, then in tune
+  const float readings[3] = {139.0f, 160.0f, 147.0f};
+  for (int i = 0; i < 3; ++i) {
+    fakeSpectrum(readings[i]);
+    TIME_DRAW("updateSpectrumDisplay",
+              updateSpectrumDisplay(analysisRe, analysisIm, 16384));
+    TIME_DRAW("drawNoteOnScale",
+              drawNoteOnScale(readings[i], guitarStringFrequencies[0]));
+    logEvent(LOG_READING, (int32_t)(readings[i] * 1000),
+             (int32_t)(guitarStringFrequencies[0] * 1000));
+    settleNeedle();
+    finishFrame("reading");
+  }
+
+  // strobe: a D string 3 cents sharp with a second harmonic, for 64 blocks
+  const float sharpHz = guitarStringFrequencies[0] * powf(2, 3 / 1200.0f);
+  int block[256];
+  TIME_DRAW("eraseNeedle", eraseNeedle());
+  resetStrobe(guitarStringFrequencies[0]);
+  int blockLength = strobeBlockLength();
+  for (int b = 0; b < 64; ++b) {
+    for (int i = 0; i < blockLength; ++i) {
+      float t = (b * blockLength + i) / 8000.0f;
+      block[i] = (int)(2e8f * sinf(2 * (float)M_PI * sharpHz * t) +
+                       1e8f * sinf(4 * (float)M_PI * sharpHz * t + 1.0f));
+    }
+    processStrobeBlock(block, blockLength);
+    TIME_DRAW("drawStrobe", drawStrobe());
+  }
+  printf("strobe reads %+.2f cents for a tone 3 cents sharp\n", strobeCents());
+  finishFrame("strobe");
+  TIME_DRAW("eraseStrobe", eraseStrobe());
+  TIME_DRAW("animateNeedle", animateNeedle());
+  finishFrame("needle");
+
+  printf("\n");
+  printRoutineStats();
+#ifdef TUNER_PROFILE
+  printf("\n");
+  dumpProfileReport();
+#endif
+
+  if (goldenMismatch) {
+    printf("\nframes differ from %s\n", goldenDir);
+    return 1;
+  }
+  return 0;
+}
+
+/*****************************************************************************/
+/* FFT BENCHMARK */
+/*****************************************************************************/
+// Every kernel works in place, so the input is restored before each timed
+// repetition (outside the timed region).
+
+// Rough Nios II/f cycle costs without a floating point unit, used to turn
+// operation counts into an estimate of cycles on the board. Soft-float add
+// and multiply run in the tens of cycles; cos() and sin() are double precision
+// library calls. Integer multiplies are in hardware: a Q30 product is a mul,
+// a mulxss and the shifts to join them
+#define NIOS_FLOAT_ADD_CYCLES 60
+#define NIOS_FLOAT_MUL_CYCLES 70
+#define NIOS_INT_TO_FLOAT_CYCLES 40
+#define NIOS_TRIG_CYCLES 3000
+#define NIOS_MEMORY_CYCLES 2
+#define NIOS_Q30_MUL_CYCLES 6
+#define NIOS_SQRT_CYCLES 500
+#define NIOS_CLOCK_HZ 100e6
+
+// tuner_sincos(): 7 Q30 products, ~25 integer operations and two loads
+double niosCyclesSincos() {
+  return 7 * NIOS_Q30_MUL_CYCLES + 25 + 2 * NIOS_MEMORY_CYCLES;
+}
+
+// CORDIC vectoring: ~10 integer operations and a load per iteration
+double niosCyclesCordic() {
+  return TUNER_CORDIC_ITERATIONS * (10 + NIOS_MEMORY_CYCLES) + 20;
+}
+
+// the peak searches are of the band and rate tuner-host stream uses
+#define BENCH_PEAK_RATE 8000
+#define BENCH_PEAK_LOW_HZ 50
+#define BENCH_PEAK_HIGH_HZ 380
+
+struct benchBuffers {
+  int *samples;
+  float *inputRe;
+  float *inputIm;
+  float *re;
+  float *im;
+};
+
+// estimated Nios II cycles of each kernel from its operation counts
+double niosCyclesRearrangeGeneric(int N) {
+  // ~8 integer operations per position, a swap of 4 loads/stores for half
+  return N * 8.0 + N / 2.0 * 4 * NIOS_MEMORY_CYCLES;
+}
+
+double niosCyclesComputeGeneric(int N) {
+  int stages = 0;
+  while ((1 << stages) < N) {
+    ++stages;
+  }
+  double butterflies = N / 2.0 * stages;
+  // complex multiply (4 mul, 2 add) and two complex add/subtract (4 add)
+  double butterfly = 4 * NIOS_FLOAT_MUL_CYCLES + 6 * NIOS_FLOAT_ADD_CYCLES +
+                     8 * NIOS_MEMORY_CYCLES;
+  // a tuner_sincos() and its conversion for all but the first group of each
+  // stage
+  double twiddles =
+      (N - 1.0 - stages) * (niosCyclesSincos() + 2 * NIOS_INT_TO_FLOAT_CYCLES +
+                            2 * NIOS_FLOAT_MUL_CYCLES);
+  return butterflies * butterfly + twiddles;
+}
+
+double niosCyclesFFTGeneric(int N) {
+  return niosCyclesRearrangeGeneric(N) + niosCyclesComputeGeneric(N);
+}
+
+// the generated kernel: ~N / 2 swaps from a table, no per-position work
+double niosCyclesRearrange(int N) {
+#ifdef TUNER_FFT_FIXED_N
+  if (N == TUNER_FFT_FIXED_N) {
+    return N / 2.0 * (3 + 10 * NIOS_MEMORY_CYCLES);
+  }
+#endif
+  return niosCyclesRearrangeGeneric(N);
+}
+
+// the generated kernel: no multiplies in the first two stages, and the
+// twiddles are two loads per group instead of a tuner_sincos()
+double niosCyclesCompute(int N) {
+#ifdef TUNER_FFT_FIXED_N
+  if (N == TUNER_FFT_FIXED_N) {
+    int stages = 0;
+    while ((1 << stages) < N) {
+      ++stages;
+    }
+    double leaf = N / 4.0 * (16 * NIOS_FLOAT_ADD_CYCLES +
+                             16 * NIOS_MEMORY_CYCLES);
+    double butterfly = 4 * NIOS_FLOAT_MUL_CYCLES + 6 * NIOS_FLOAT_ADD_CYCLES +
+                       10 * NIOS_MEMORY_CYCLES;
+    return leaf + N / 2.0 * (stages - 2) * butterfly;
+  }
+#endif
+  return niosCyclesComputeGeneric(N);
+}
+
+// a planned transform of N points that is not a power of two: mixed-radix
+// stages of N / p butterflies (the p-point DFT and p - 1 twiddles), or
+// Bluestein's two power-of-two FFTs and three complex products per point
+double niosCyclesPlannedFFT(int N) {
+  const double complexMul = 4 * NIOS_FLOAT_MUL_CYCLES +
+                            2 * NIOS_FLOAT_ADD_CYCLES;
+  // adds and multiplies of the DFT of each radix
+  const double dftAdds[6] = {0, 0, 4, 12, 16, 32};
+  const double dftMuls[6] = {0, 0, 0, 4, 0, 16};
+  static const int radices[] = {4, 2, 3, 5};
+  double cycles = 0;
+  int rest = N;
+  for (int i = 0; i < 4; ++i) {
+    for (int p = radices[i]; rest % p == 0; rest /= p) {
+      cycles += N / (double)p *
+                (dftAdds[p] * NIOS_FLOAT_ADD_CYCLES +
+                 dftMuls[p] * NIOS_FLOAT_MUL_CYCLES + (p - 1) * complexMul +
+                 4 * p * NIOS_MEMORY_CYCLES);
+    }
+  }
+  if (rest == 1) {
+    return cycles;
+  }
+  int M = 1;
+  while (M < 2 * N - 1) {
+    M <<= 1;
+  }
+  return 2 * (niosCyclesRearrange(M) + niosCyclesCompute(M)) +
+         (2.0 * N + M) * complexMul;
+}
+
+double niosCyclesFFT(int N) {
+  if (N & (N - 1)) {
+    return niosCyclesPlannedFFT(N);
+  }
+  return niosCyclesRearrange(N) + niosCyclesCompute(N);
+}
+
+// conversion and window in one pass: a table load for every two samples
+double niosCyclesWindow(int N) {
+  return N * (NIOS_INT_TO_FLOAT_CYCLES + NIOS_FLOAT_MUL_CYCLES +
+              2.5 * NIOS_MEMORY_CYCLES);
+}
+
+// tuner_find_peak(): a load and a compare for each bin of the band
+double niosCyclesPeak(int N) {
+  double bins = (BENCH_PEAK_HIGH_HZ - BENCH_PEAK_LOW_HZ) * (double)N /
+                BENCH_PEAK_RATE;
+  return bins * (NIOS_FLOAT_ADD_CYCLES + 2 * NIOS_MEMORY_CYCLES);
+}
+
+// tuner_track_pitch() holding its pitch: tuner_find_pitch() over the
+// neighbourhood's candidates, and over the whole band every
+// TUNER_TRACK_REFRESH windows. A candidate's partial h spans h bins, and
+// each partial's power is rooted
+double niosCyclesTrack(int N) {
+  double bins = (BENCH_PEAK_HIGH_HZ - BENCH_PEAK_LOW_HZ) * (double)N /
+                BENCH_PEAK_RATE;
+  double searched = 2 * TUNER_TRACK_RADIUS + 1 + bins / TUNER_TRACK_REFRESH;
+  double partialBins = TUNER_HARMONICS * (TUNER_HARMONICS + 1) / 2.0;
+  return searched *
+         (partialBins * (2 * NIOS_FLOAT_MUL_CYCLES + 2 * NIOS_FLOAT_ADD_CYCLES +
+                         2 * NIOS_MEMORY_CYCLES) +
+          TUNER_HARMONICS * (NIOS_SQRT_CYCLES + NIOS_FLOAT_ADD_CYCLES));
+}
+
+double niosCyclesEstimatePitch(int N) {
+  // windowed conversion, then the peak search compares and scales every bin
+  return niosCyclesWindow(N) +
+         niosCyclesFFT(N) +
+         N / 2.0 * (3 * NIOS_FLOAT_MUL_CYCLES + 3 * NIOS_FLOAT_ADD_CYCLES);
+}
+
+void benchRearrange(struct benchBuffers *b, int N) {
+  rearrange(b->re, b->im, N);
+}
+void benchCompute(struct benchBuffers *b, int N) {
+  compute(b->re, b->im, N);
+}
+void benchFFT(struct benchBuffers *b, int N) { fft(b->re, b->im, N); }
+void benchRearrangeGeneric(struct benchBuffers *b, int N) {
+  rearrange_generic(b->re, b->im, N);
+}
+void benchComputeGeneric(struct benchBuffers *b, int N) {
+  compute_generic(b->re, b->im, N);
+}
+void benchFFTGeneric(struct benchBuffers *b, int N) {
+  fft_generic(b->re, b->im, N);
+}
+struct tuner_window_cache benchWindows;
+void benchWindow(struct benchBuffers *b, int N) {
+  tuner_window_samples(
+      tuner_window_table(&benchWindows, TUNER_WINDOW_HANN, N), b->samples,
+      b->re, b->im, N);
+}
+void benchPeak(struct benchBuffers *b, int N) {
+  tuner_find_peak(b->re, N, BENCH_PEAK_RATE, BENCH_PEAK_LOW_HZ,
+                  BENCH_PEAK_HIGH_HZ);
+}
+// every repetition is the same window, so after the first the pitch is held
+struct tuner_pitch_tracker benchTracker;
+int benchTrackerN;
+void benchTrack(struct benchBuffers *b, int N) {
+  if (benchTrackerN != N) {
+    tuner_track_init(&benchTracker, N, BENCH_PEAK_RATE, BENCH_PEAK_LOW_HZ,
+                     BENCH_PEAK_HIGH_HZ);
+    benchTrackerN = N;
+  }
+  tuner_track_pitch(&benchTracker, b->re, b->im);
+}
+void benchEstimatePitch(struct benchBuffers *b, int N) {
+  estimatePitch(b->samples, b->re, b->im, N);
+}
+
+struct benchKernel {
+  const char *name;
+  void (*run)(struct benchBuffers *b, int N);
+  double (*niosCycles)(int N);
+};
+
+// the kernels measured; alternative implementations are added here so that
+// they are compared against the current ones on the same input
+struct benchKernel benchKernels[] = {
+    {"rearrange", benchRearrange, niosCyclesRearrange},
+    {"compute", benchCompute, niosCyclesCompute},
+    {"fft", benchFFT, niosCyclesFFT},
+    {"rearrange-gen", benchRearrangeGeneric, niosCyclesRearrangeGeneric},
+    {"compute-gen", benchComputeGeneric, niosCyclesComputeGeneric},
+    {"fft-gen", benchFFTGeneric, niosCyclesFFTGeneric},
+    {"window", benchWindow, niosCyclesWindow},
+    {"peak", benchPeak, niosCyclesPeak},
+    {"track", benchTrack, niosCyclesTrack},
+    {"estimatePitch", benchEstimatePitch, niosCyclesEstimatePitch},
+};
+#define NUM_BENCH_KERNELS (int)(sizeof(benchKernels) / sizeof(benchKernels[0]))
+
+double nowNanoseconds() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+int compareDoubles(const void *a, const void *b) {
+  double x = *(const double *)a, y = *(const double *)b;
+  return (x > y) - (x < y);
+}
+
+// a plucked D string with a little noise, as the board would capture it
+void fillBenchInput(struct benchBuffers *b, int N) {
+  unsigned int seed = 12345;
+  for (int i = 0; i < N; ++i) {
+    seed = seed * 1103515245 + 12345;
+    float t = (float)i / 8000;
+    float noise = (float)((seed >> 16) & 0x7FFF) / 0x7FFF - 0.5f;
+    float tone = sinf(2 * (float)M_PI * 146.83f * t) +
+                 0.5f * sinf(4 * (float)M_PI * 146.83f * t);
+    b->samples[i] = (int)((tone * expf(-t) + 0.05f * noise) * 1e8f);
+    b->inputRe[i] = (float)b->samples[i];
+    b->inputIm[i] = 0;
+  }
+}
+
+int benchCommand(int argc, char **argv) {
+  int minN = 256, maxN = 65536, reps = 20, warmup = 3;
+  const char *label = "current";
+  enum { TABLE, CSV, JSON } format = TABLE;
+  for (int i = 0; i < argc; ++i) {
+    if (strcmp(argv[i], "--min") == 0 && i + 1 < argc) {
+      minN = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--max") == 0 && i + 1 < argc) {
+      maxN = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--reps") == 0 && i + 1 < argc) {
+      reps = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--warmup") == 0 && i + 1 < argc) {
+      warmup = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--label") == 0 && i + 1 < argc) {
+      label = argv[++i];
+    } else if (strcmp(argv[i], "--csv") == 0) {
+      format = CSV;
+    } else if (strcmp(argv[i], "--json") == 0) {
+      format = JSON;
+    } else {
+      fprintf(stderr,
+              "usage: tuner-host bench [--min N] [--max N] [--reps R] "
+              "[--warmup W] [--label name] [--csv | --json]\n");
+      return 2;
+    }
+  }
+  if (reps < 1 || minN < 2 || maxN < minN) {
+    fprintf(stderr, "bench: bad sizes or repetitions\n");
+    return 2;
+  }
+
+  struct benchBuffers b;
+  b.samples = malloc(sizeof(int) * maxN);
+  b.inputRe = malloc(sizeof(float) * maxN);
+  b.inputIm = malloc(sizeof(float) * maxN);
+  b.re = malloc(sizeof(float) * maxN);
+  b.im = malloc(sizeof(float) * maxN);
+  double *times = malloc(sizeof(double) * reps);
+
+  if (format == TABLE) {
+    printf("%-14s %6s %10s %10s %10s %10s %9s %12s %12s %10s\n", "kernel", "N",
+           "min ns", "median ns", "mean ns", "stddev ns", "ns/sample",
+           "samples/s", "nios cycles", "nios ms");
+  } else if (format == CSV) {
+    printf("label,kernel,n,reps,min_ns,median_ns,mean_ns,stddev_ns,p90_ns,"
+           "ns_per_sample,samples_per_second,nios_cycles_estimate\n");
+  } else {
+    printf("[\n");
+  }
+
+  bool first = true;
+  for (int N = minN; N <= maxN; N <<= 1) {
+    fillBenchInput(&b, N);
+    for (int k = 0; k < NUM_BENCH_KERNELS; ++k) {
+      for (int r = -warmup; r < reps; ++r) {
+        memcpy(b.re, b.inputRe, sizeof(float) * N);
+        memcpy(b.im, b.inputIm, sizeof(float) * N);
+        double start = nowNanoseconds();
+        benchKernels[k].run(&b, N);
+        double elapsed = nowNanoseconds() - start;
+        if (r >= 0) {
+          times[r] = elapsed;
+        }
+      }
+
+      double mean = 0, variance = 0;
+      for (int r = 0; r < reps; ++r) {
+        mean += times[r] / reps;
+      }
+      for (int r = 0; r < reps; ++r) {
+        variance += (times[r] - mean) * (times[r] - mean) / reps;
+      }
+      qsort(times, reps, sizeof(double), compareDoubles);
+      double median = times[reps / 2];
+      double p90 = times[(reps - 1) * 9 / 10];
+      double cycles = benchKernels[k].niosCycles(N);
+
+      if (format == TABLE) {
+        printf("%-14s %6d %10.0f %10.0f %10.0f %10.0f %9.2f %12.3g %12.3g "
+               "%10.1f\n",
+               benchKernels[k].name, N, times[0], median, mean, sqrt(variance),
+               median / N, N / median * 1e9, cycles,
+               cycles / NIOS_CLOCK_HZ * 1e3);
+      } else if (format == CSV) {
+        printf("%s,%s,%d,%d,%.0f,%.0f,%.0f,%.0f,%.0f,%.4f,%.0f,%.0f\n", label,
+               benchKernels[k].name, N, reps, times[0], median, mean,
+               sqrt(variance), p90, median / N, N / median * 1e9, cycles);
+      } else {
+        printf("%s  {\"label\": \"%s\", \"kernel\": \"%s\", \"n\": %d, "
+               "\"reps\": %d, \"min_ns\": %.0f, \"median_ns\": %.0f, "
+               "\"mean_ns\": %.0f, \"stddev_ns\": %.0f, \"p90_ns\": %.0f, "
+               "\"ns_per_sample\": %.4f, \"samples_per_second\": %.0f, "
+               "\"nios_cycles_estimate\": %.0f}",
+               first ? "" : ",\n", label, benchKernels[k].name, N, reps,
+               times[0], median, mean, sqrt(variance), p90, median / N,
+               N / median * 1e9, cycles);
+      }
+      first = false;
+    }
+  }
+  if (format == JSON) {
+    printf("\n]\n");
+  }
+
+#ifdef TUNER_FFT_FIXED_N
+  // the generated kernel against the generic one on the same input
+  if (format == TABLE && TUNER_FFT_FIXED_N >= minN &&
+      TUNER_FFT_FIXED_N <= maxN) {
+    const int N = TUNER_FFT_FIXED_N;
+    fillBenchInput(&b, N);
+    memcpy(b.re, b.inputRe, sizeof(float) * N);
+    memcpy(b.im, b.inputIm, sizeof(float) * N);
+    fft(b.re, b.im, N);
+    fft_generic(b.inputRe, b.inputIm, N);
+    double largest = 0, difference = 0;
+    for (int i = 0; i < N; ++i) {
+      largest = fmax(largest, hypot(b.inputRe[i], b.inputIm[i]));
+      difference = fmax(difference, hypot(b.re[i] - b.inputRe[i],
+                                          b.im[i] - b.inputIm[i]));
+    }
+    printf("\nfft against fft-gen at N = %d: largest difference %.2g of the "
+           "largest bin\n",
+           N, difference / largest);
+  }
+#endif
+
+  free(b.samples);
+  free(b.inputRe);
+  free(b.inputIm);
+  free(b.re);
+  free(b.im);
+  free(times);
+  return 0;
+}
+
+/*****************************************************************************/
+/* FFT GENERATOR */
+/*****************************************************************************/
+// Writes the fixed-size kernel that tuner.c uses in place of the generic
+// rearrange() and compute() for one N: twiddles and the bit-reversal swaps
+// as const tables (ROM on the board), constant loop bounds, and the first
+// two stages unrolled as radix-4 butterflies, whose twiddles are 1 and -i.
+
+// prints n values of a table, as many to a line as fit in 80 columns
+void printTable(FILE *out, const char *declaration, int n,
+                void (*format)(char *text, size_t size, int i)) {
+  fprintf(out, "%s = {\n", declaration);
+  int column = 0;
+  for (int i = 0; i < n; ++i) {
+    char text[64];
+    format(text, sizeof(text), i);
+    int width = (int)strlen(text) + (i + 1 < n);  // and its comma
+    if (column > 0 && column + 1 + width > 80) {
+      fprintf(out, "\n");
+      column = 0;
+    }
+    fprintf(out, "%s%s%s", column == 0 ? "    " : " ", text,
+            i + 1 < n ? "," : "");
+    column += (column == 0 ? 4 : 1) + width;
+  }
+  fprintf(out, "\n};\n\n");
+}
+
+int genN;
+int genSwaps[65536][2];
+
+// a float literal that reads back as exactly value
+void formatFloat(char *text, size_t size, float value) {
+  snprintf(text, size, "%.9g", value);
+  if (!strpbrk(text, ".e")) {
+    strncat(text, ".0", size - strlen(text) - 1);
+  }
+  strncat(text, "f", size - strlen(text) - 1);
+}
+
+void formatTwiddleRe(char *text, size_t size, int k) {
+  formatFloat(text, size, (float)cos(2 * M_PI * k / genN));
+}
+void formatTwiddleIm(char *text, size_t size, int k) {
+  formatFloat(text, size, (float)-sin(2 * M_PI * k / genN));
+}
+void formatSwap(char *text, size_t size, int s) {
+  snprintf(text, size, "{%d, %d}", genSwaps[s][0], genSwaps[s][1]);
+}
+
+int genFFTCommand(int argc, char **argv) {
+  const char *path = NULL;
+  int N = 0;
+  for (int i = 0; i < argc; ++i) {
+    if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+      path = argv[++i];
+    } else {
+      N = atoi(argv[i]);
+    }
+  }
+  if (N < 8 || N > 65536 || (N & (N - 1))) {
+    fprintf(stderr, "usage: tuner-host gen-fft N [-o file.h]  "
+                    "(N a power of two, 8 to 65536)\n");
+    return 2;
+  }
+  FILE *out = path ? fopen(path, "w") : stdout;
+  if (!out) {
+    fprintf(stderr, "cannot write %s\n", path);
+    return 1;
+  }
+
+  // the same permutation as rearrange(), as the pairs it swaps
+  genN = N;
+  int swaps = 0;
+  for (int position = 0, target = 0; position < N; position++) {
+    if (target > position) {
+      genSwaps[swaps][0] = position;
+      genSwaps[swaps][1] = target;
+      swaps++;
+    }
+    int mask = N;
+    while (target & (mask >>= 1)) target &= ~mask;
+    target |= mask;
+  }
+
+  fprintf(out,
+          "/*\n"
+          " * Generated by tuner-host gen-fft %d; do not edit.\n"
+          " *\n"
+          " * Radix-2 FFT of exactly %d points, included by tuner.c, which\n"
+          " * uses it in place of the generic kernels when N matches. The\n"
+          " * twiddles are exact to float rather than computed per group, so\n"
+          " * results differ from the generic path in the last bits.\n"
+          " */\n\n"
+          "#ifndef FFT_%d_H\n#define FFT_%d_H\n\n"
+          "#define TUNER_FFT_FIXED_N %d\n\n",
+          N, N, N, N, N);
+
+  fprintf(out, "// exp(-2 pi i k / %d)\n", N);
+  char declaration[96];
+  snprintf(declaration, sizeof(declaration),
+           "static const float fft_fixed_twiddle_re[%d]", N / 2);
+  printTable(out, declaration, N / 2, formatTwiddleRe);
+  snprintf(declaration, sizeof(declaration),
+           "static const float fft_fixed_twiddle_im[%d]", N / 2);
+  printTable(out, declaration, N / 2, formatTwiddleIm);
+  fprintf(out, "// bit reversal as the pairs of positions to swap\n");
+  snprintf(declaration, sizeof(declaration),
+           "static const uint16_t fft_fixed_swaps[%d][2]", swaps);
+  printTable(out, declaration, swaps, formatSwap);
+
+  fprintf(out,
+          "static void fft_fixed_rearrange(float data_re[], float data_im[]) "
+          "{\n"
+          "  for (int s = 0; s < %d; ++s) {\n"
+          "    const int a = fft_fixed_swaps[s][0];\n"
+          "    const int b = fft_fixed_swaps[s][1];\n"
+          "    const float temp_re = data_re[a];\n"
+          "    const float temp_im = data_im[a];\n"
+          "    data_re[a] = data_re[b];\n"
+          "    data_im[a] = data_im[b];\n"
+          "    data_re[b] = temp_re;\n"
+          "    data_im[b] = temp_im;\n"
+          "  }\n"
+          "}\n\n",
+          swaps);
+
+  fprintf(out,
+          "static void fft_fixed_compute(float data_re[], float data_im[]) {\n"
+          "  // stages 1 and 2 as radix-4 butterflies: twiddles 1 and -i\n"
+          "  for (int i = 0; i < %d; i += 4) {\n"
+          "    const float a_re = data_re[i] + data_re[i + 1];\n"
+          "    const float a_im = data_im[i] + data_im[i + 1];\n"
+          "    const float b_re = data_re[i] - data_re[i + 1];\n"
+          "    const float b_im = data_im[i] - data_im[i + 1];\n"
+          "    const float c_re = data_re[i + 2] + data_re[i + 3];\n"
+          "    const float c_im = data_im[i + 2] + data_im[i + 3];\n"
+          "    const float d_re = data_re[i + 2] - data_re[i + 3];\n"
+          "    const float d_im = data_im[i + 2] - data_im[i + 3];\n"
+          "    data_re[i] = a_re + c_re;\n"
+          "    data_im[i] = a_im + c_im;\n"
+          "    data_re[i + 2] = a_re - c_re;\n"
+          "    data_im[i + 2] = a_im - c_im;\n"
+          "    data_re[i + 1] = b_re + d_im;\n"
+          "    data_im[i + 1] = b_im - d_re;\n"
+          "    data_re[i + 3] = b_re - d_im;\n"
+          "    data_im[i + 3] = b_im + d_re;\n"
+          "  }\n\n"
+          "  // the rest radix-2, each block of a stage in turn\n"
+          "  for (int step = 4; step < %d; step <<= 1) {\n"
+          "    const int stride = %d / step;  // twiddle index per group\n"
+          "    for (int block = 0; block < %d; block += step << 1) {\n"
+          "      for (int group = 0; group < step; ++group) {\n"
+          "        const float twiddle_re = "
+          "fft_fixed_twiddle_re[group * stride];\n"
+          "        const float twiddle_im = "
+          "fft_fixed_twiddle_im[group * stride];\n"
+          "        const int pair = block + group;\n"
+          "        const int match = pair + step;\n"
+          "        const float product_re =\n"
+          "            twiddle_re * data_re[match] - "
+          "twiddle_im * data_im[match];\n"
+          "        const float product_im =\n"
+          "            twiddle_im * data_re[match] + "
+          "twiddle_re * data_im[match];\n"
+          "        data_re[match] = data_re[pair] - product_re;\n"
+          "        data_im[match] = data_im[pair] - product_im;\n"
+          "        data_re[pair] += product_re;\n"
+          "        data_im[pair] += product_im;\n"
+          "      }\n"
+          "    }\n"
+          "  }\n"
+          "}\n\n"
+          "#endif  // FFT_%d_H\n",
+          N, N, N / 2, N, N);
+
+  if (path) {
+    fclose(out);
+    printf("%d-point kernel, %d swaps, written to %s\n", N, swaps, path);
+  }
+  return 0;
+}
+
+/*****************************************************************************/
+/* FFT SIZES */
+/*****************************************************************************/
+
+const char *fftAlgorithmNames[] = {"radix-2", "mixed-radix", "bluestein"};
+
+// capture lengths of 0.25 to 2 s: powers of two, products of 2, 3 and 5, a
+// prime and a multiple of 7
+static const int defaultFFTSizes[] = {2048,  3000,  6561,  8000,  8192,
+                                      10007, 12000, 14000, 15625, 16384};
+
+// checks tuner_fft() against a DFT in doubles of the same random input and
+// times it, for each size
+int fftSizesCommand(int argc, char **argv) {
+  int reps = 20;
+  int sizes[64], count = 0;
+  for (int i = 0; i < argc; ++i) {
+    if (strcmp(argv[i], "--reps") == 0 && i + 1 < argc) {
+      reps = atoi(argv[++i]);
+    } else if (count < 64 && atoi(argv[i]) >= 1 &&
+               atoi(argv[i]) <= TUNER_MAX_FFT) {
+      sizes[count++] = atoi(argv[i]);
+    } else {
+      reps = 0;
+      break;
+    }
+  }
+  if (reps < 1) {
+    fprintf(stderr, "usage: tuner-host fft-sizes [--reps R] [N ...] "
+                    "(N from 1 to %d)\n",
+            TUNER_MAX_FFT);
+    return 2;
+  }
+  if (count == 0) {
+    count = sizeof(defaultFFTSizes) / sizeof(defaultFFTSizes[0]);
+    memcpy(sizes, defaultFFTSizes, sizeof(defaultFFTSizes));
+  }
+
+  static struct tuner_fft_plan plan;
+  static struct tuner_fft_scratch scratch;
+  static float inputRe[TUNER_MAX_FFT], inputIm[TUNER_MAX_FFT];
+  static float re[TUNER_MAX_FFT], im[TUNER_MAX_FFT];
+  static double rootRe[TUNER_MAX_FFT], rootIm[TUNER_MAX_FFT];
+  static double times[1024];
+  if (reps > 1024) {
+    reps = 1024;
+  }
+  printf("%6s %-12s %-16s %10s %10s %10s %10s %10s\n", "N", "algorithm",
+         "stages", "max error", "plan us", "fft us", "ns/sample", "nios ms");
+  bool pass = true;
+  for (int c = 0; c < count; ++c) {
+    const int N = sizes[c];
+    unsigned int seed = 12345 + N;
+    for (int i = 0; i < N; ++i) {
+      seed = seed * 1664525u + 1013904223u;
+      inputRe[i] = (float)(seed >> 8) / (1 << 23) - 1;
+      seed = seed * 1664525u + 1013904223u;
+      inputIm[i] = (float)(seed >> 8) / (1 << 23) - 1;
+      rootRe[i] = cos(2 * M_PI * i / N);
+      rootIm[i] = -sin(2 * M_PI * i / N);
+    }
+
+    double start = nowNanoseconds();
+    tuner_fft_plan_init(&plan, N, &scratch);
+    double planUs = (nowNanoseconds() - start) / 1e3;
+    for (int r = 0; r < reps; ++r) {
+      memcpy(re, inputRe, sizeof(float) * N);
+      memcpy(im, inputIm, sizeof(float) * N);
+      start = nowNanoseconds();
+      tuner_fft(&plan, re, im);
+      times[r] = nowNanoseconds() - start;
+    }
+    qsort(times, reps, sizeof(double), compareDoubles);
+
+    // every bin against the DFT, relative to the largest
+    double worst = 0, largest = 0;
+    for (int k = 0; k < N; ++k) {
+      double sumRe = 0, sumIm = 0;
+      for (int n = 0, t = 0; n < N; ++n, t = (t + k) % N) {
+        sumRe += inputRe[n] * rootRe[t] - inputIm[n] * rootIm[t];
+        sumIm += inputRe[n] * rootIm[t] + inputIm[n] * rootRe[t];
+      }
+      worst = fmax(worst, hypot(re[k] - sumRe, im[k] - sumIm));
+      largest = fmax(largest, hypot(sumRe, sumIm));
+    }
+    double error = largest > 0 ? worst / largest : worst;
+    pass = pass && error < 1e-5;
+
+    char stages[64] = "";
+    if (plan.algorithm == TUNER_FFT_BLUESTEIN) {
+      snprintf(stages, sizeof(stages), "M = %d", plan.M);
+    } else if (plan.algorithm == TUNER_FFT_RADIX_2) {
+      snprintf(stages, sizeof(stages), "-");
+    }
+    for (int i = 0; i < plan.factor_count && i < 16; ++i) {
+      stages[i] = (char)('0' + plan.factors[i]);
+      stages[i + 1] = 0;
+    }
+    double median = times[reps / 2];
+    printf("%6d %-12s %-16s %10.2g %10.1f %10.1f %10.2f %10.1f\n", N,
+           fftAlgorithmNames[plan.algorithm], stages, error, planUs,
+           median / 1e3, median / N, niosCyclesFFT(N) / NIOS_CLOCK_HZ * 1e3);
+  }
+  printf("\n%s\n", pass ? "every size within 1e-5 of the DFT"
+                         : "a size is NOT within 1e-5 of the DFT");
+  return pass ? 0 : 1;
+}
+
+/*****************************************************************************/
+/* ACCURACY HARNESS */
+/*****************************************************************************/
+
+#define HARNESS_RATE 8000
+#define HARNESS_MAX_SAMPLES 16384
+#define CENTS_PER_OCTAVE 1200.0
+
+// the pitch estimators under test. New engines are added here and every
+// configuration is run through each of them
+struct pitchEngine {
+  const char *name;
+  float (*estimate)(const int samples[], float data_re[], float data_im[],
+                    const int N);
+};
+
+// the estimator the board shipped with, kept as the baseline: the bin with
+// the largest real part between 50 Hz and 380 Hz
+float fftPeakPitch(const int samples[], float data_re[], float data_im[],
+                   const int N) {
+  static struct tuner_fft_plan_cache plans;
+  for (int j = 0; j < N; j++) {
+    data_re[j] = 1.0 * samples[j];
+    data_im[j] = 0;
+  }
+  tuner_fft(tuner_fft_plan_for(&plans, N), data_re, data_im);
+  int maxK = tuner_find_peak(data_re, N, HARNESS_RATE, 50, 380);
+  return ((1.0) / N) * 1.0 * maxK * HARNESS_RATE;
+}
+
+// tuner_window_type by name, as SW8 and SW9 select them
+const char *windowNames[TUNER_WINDOW_TYPES] = {"none", "hann",
+                                               "blackman-harris", "kaiser"};
+
+int windowByName(const char *name) {
+  for (int type = 0; type < TUNER_WINDOW_TYPES; ++type) {
+    if (strcmp(name, windowNames[type]) == 0) {
+      return type;
+    }
+  }
+  return -1;
+}
+
+// harmonic summation on a capture weighted by each window
+float windowedPitch(int type, const int samples[], float data_re[],
+                    float data_im[], const int N) {
+  analysisWindowType = type;
+  float estimate = estimatePitch(samples, data_re, data_im, N);
+  analysisWindowType = TUNER_WINDOW_RECTANGULAR;
+  return estimate;
+}
+
+float hannPitch(const int samples[], float data_re[], float data_im[],
+                const int N) {
+  return windowedPitch(TUNER_WINDOW_HANN, samples, data_re, data_im, N);
+}
+
+float blackmanHarrisPitch(const int samples[], float data_re[],
+                          float data_im[], const int N) {
+  return windowedPitch(TUNER_WINDOW_BLACKMAN_HARRIS, samples, data_re,
+                       data_im, N);
+}
+
+float kaiserPitch(const int samples[], float data_re[], float data_im[],
+                  const int N) {
+  return windowedPitch(TUNER_WINDOW_KAISER, samples, data_re, data_im, N);
+}
+
+struct pitchEngine pitchEngines[] = {
+    {"fft-peak", fftPeakPitch},
+    {"harmonic-sum", estimatePitch},
+    {"hs-hann", hannPitch},
+    {"hs-blackman-harris", blackmanHarrisPitch},
+    {"hs-kaiser", kaiserPitch},
+};
+#define NUM_PITCH_ENGINES \
+  (int)(sizeof(pitchEngines) / sizeof(pitchEngines[0]))
+
+// string by name (E2 ... E4), or -1
+int stringByName(const char *name) {
+  for (int string = 0; string < 6; ++string) {
+    if (strcmp(name, guitarStringNames[string]) == 0) {
+      return string;
+    }
+  }
+  return -1;
+}
+
+enum toneModel { TONE_KARPLUS_STRONG, TONE_STIFF_STRING, NUM_TONE_MODELS };
+const char *toneModelNames[NUM_TONE_MODELS] = {"karplus-strong",
+                                               "stiff-weak-fund"};
+
+unsigned int harnessSeed = 1;
+
+// uniform in [-1,1)
+float harnessNoise() {
+  harnessSeed = harnessSeed * 1664525u + 1013904223u;
+  return (float)(harnessSeed >> 8) / (1 << 23) - 1.0f;
+}
+
+// Karplus-Strong pluck at exactly f0: a noise burst circulating through a
+// delay line with a two-point average. The half-sample delay of the average
+// and the fractional part of the period are made up by a first-order allpass
+void karplusStrong(float *out, int n, float f0) {
+  static float delayLine[HARNESS_RATE / 20];
+  float period = HARNESS_RATE / f0 - 0.5f;  // minus the averager's delay
+  int length = (int)floorf(period - 0.1f);
+  float fraction = period - length;           // in [0.1,1.1)
+  float a = (1 - fraction) / (1 + fraction);  // allpass coefficient
+
+  for (int i = 0; i < length; ++i) {
+    delayLine[i] = harnessNoise();
+  }
+  float previous = 0, allpassIn = 0, allpassOut = 0;
+  int position = 0;
+  for (int i = 0; i < n; ++i) {
+    float x = delayLine[position];
+    float averaged = 0.996f * 0.5f * (x + previous);
+    previous = x;
+    allpassOut = a * averaged + allpassIn - a * allpassOut;
+    allpassIn = averaged;
+    delayLine[position] = allpassOut;
+    position = (position + 1) % length;
+    out[i] = x;
+  }
+}
+
+// stiff string: partial k at k f0 sqrt(1 + B k^2), amplitudes falling as 1/k
+// with the fundamental scaled by fundamentalGain, each with its own decay
+void stiffString(float *out, int n, float f0, float inharmonicity,
+                 float fundamentalGain) {
+  for (int i = 0; i < n; ++i) {
+    out[i] = 0;
+  }
+  for (int k = 1; k <= 12; ++k) {
+    float frequency = k * f0 * sqrtf(1 + inharmonicity * k * k);
+    if (frequency > HARNESS_RATE / 2) {
+      break;
+    }
+    float amplitude = (k == 1 ? fundamentalGain : 1.0f) / k;
+    float phase = (harnessNoise() + 1) * (float)M_PI;
+    float decay = 1.0f + 0.3f * k;  // per second
+    for (int i = 0; i < n; ++i) {
+      float t = (float)i / HARNESS_RATE;
+      out[i] += amplitude * expf(-decay * t) *
+                sinf(2 * (float)M_PI * frequency * t + phase);
+    }
+  }
+}
+
+// a test tone as the audio core delivers it: 32-bit samples at ~1/4 scale.
+// noiseLevel is the RMS of added white noise relative to the tone's RMS.
+// Returns the true frequency of the fundamental
+float synthesizeTone(int *samples, int n, enum toneModel model, float f0,
+                     float noiseLevel) {
+  static float tone[HARNESS_MAX_SAMPLES];
+  float fundamental = f0;
+  if (model == TONE_KARPLUS_STRONG) {
+    karplusStrong(tone, n, f0);
+  } else {
+    const float inharmonicity = 1e-4f;
+    stiffString(tone, n, f0, inharmonicity, 0.2f);
+    fundamental = f0 * sqrtf(1 + inharmonicity);
+  }
+
+  double power = 0;
+  for (int i = 0; i < n; ++i) {
+    power += tone[i] * tone[i];
+  }
+  float rms = (float)sqrt(power / n);
+  float noiseScale = noiseLevel * rms * sqrtf(3);  // uniform noise RMS 1/sqrt3
+  float gain = 0.25f * 2147483647.0f / (4 * rms + noiseScale + 1e-9f);
+  for (int i = 0; i < n; ++i) {
+    samples[i] = (int)(gain * (tone[i] + noiseScale * harnessNoise()));
+  }
+  return fundamental;
+}
+
+double centsError(float estimate, float expected) {
+  if (estimate <= 0) {
+    return 2400;  // no pitch found: count as two octaves off
+  }
+  return CENTS_PER_OCTAVE * log2((double)estimate / expected);
+}
+
+// errors collected for one row of a summary table
+struct errorSummary {
+  int count;
+  double absolute[4096];
+  double computeMs;
+};
+
+int compareAbsolute(const void *a, const void *b) {
+  return compareDoubles(a, b);
+}
+
+void addError(struct errorSummary *summary, double cents, double computeMs) {
+  if (summary->count < 4096) {
+    summary->absolute[summary->count++] = fabs(cents);
+  }
+  summary->computeMs += computeMs;
+}
+
+void printSummaryRow(const char *label, struct errorSummary *summary,
+                     double captureMs, double niosMs) {
+  if (summary->count == 0) {
+    return;
+  }
+  qsort(summary->absolute, summary->count, sizeof(double), compareAbsolute);
+  double mean = 0;
+  int within5 = 0;
+  for (int i = 0; i < summary->count; ++i) {
+    mean += summary->absolute[i] / summary->count;
+    within5 += summary->absolute[i] <= 5;
+  }
+  printf("%-34s %6d %9.2f %9.2f %9.2f %6.1f%% %9.0f %9.2f %9.0f\n", label,
+         summary->count, mean, summary->absolute[summary->count / 2],
+         summary->absolute[(summary->count - 1) * 9 / 10],
+         100.0 * within5 / summary->count, captureMs,
+         summary->computeMs / summary->count, captureMs + niosMs);
+}
+
+void printSummaryHeader(const char *title) {
+  printf("\n%s\n%-34s %6s %9s %9s %9s %7s %9s %9s %9s\n", title,
+         "configuration", "runs", "mean |c|", "p50 |c|", "p90 |c|", "<=5c",
+         "capture", "host ms", "board ms");
+}
+
+// one estimate, timed
+float runEngine(struct pitchEngine *engine, const int *samples, float *re,
+                float *im, int n, double *computeMs) {
+  double start = nowNanoseconds();
+  float estimate = engine->estimate(samples, re, im, n);
+  *computeMs = (nowNanoseconds() - start) / 1e6;
+  return estimate;
+}
+
+// 12000 (1.5 s) runs the mixed-radix transform. 0 stands for each string's
+// length from the board's tuning profile
+static const int harnessLengths[] = {2048, 4096, 8192, 12000, 16384, 0};
+#define NUM_HARNESS_LENGTHS 6
+
+int harnessLength(int l, int string) {
+  return harnessLengths[l] ? harnessLengths[l] : stringCaptureLength(string);
+}
+
+// label of harness length l, and its capture and estimated Nios II compute
+// times in ms, averaged over the strings for the tuning profile
+void describeHarnessLength(int l, char *label, int size, double *captureMs,
+                           double *niosMs) {
+  if (harnessLengths[l]) {
+    snprintf(label, size, "%d", harnessLengths[l]);
+  } else {
+    snprintf(label, size, "profile");
+  }
+  *captureMs = 0;
+  *niosMs = 0;
+  for (int string = 0; string < 6; ++string) {
+    int n = harnessLength(l, string);
+    *captureMs += 1000.0 * n / HARNESS_RATE / 6;
+    *niosMs += niosCyclesEstimatePitch(n) / NIOS_CLOCK_HZ * 1e3 / 6;
+  }
+}
+static const float harnessDetunes[] = {-30, -10, -3, 0, 3, 10, 30};  // cents
+#define NUM_HARNESS_DETUNES 7
+static const float harnessNoiseLevels[] = {0, 0.3f, 1.0f};
+#define NUM_HARNESS_NOISE_LEVELS 3
+
+int syntheticAccuracy(int trials, bool csv) {
+  static int samples[HARNESS_MAX_SAMPLES];
+  static float re[HARNESS_MAX_SAMPLES], im[HARNESS_MAX_SAMPLES];
+  // summaries by (engine, length, string) and (engine, length, noise, tone)
+  static struct errorSummary byString[8][NUM_HARNESS_LENGTHS][6];
+  static struct errorSummary byNoise[8][NUM_HARNESS_LENGTHS]
+                                    [NUM_HARNESS_NOISE_LEVELS][NUM_TONE_MODELS];
+  if (NUM_PITCH_ENGINES > 8) {
+    fprintf(stderr, "accuracy: too many engines\n");
+    return 1;
+  }
+
+  if (csv) {
+    printf("engine,samples,string,detune_cents,noise,tone,trial,true_hz,"
+           "estimate_hz,error_cents,capture_ms,host_compute_ms\n");
+  }
+  for (int e = 0; e < NUM_PITCH_ENGINES; ++e) {
+    for (int l = 0; l < NUM_HARNESS_LENGTHS; ++l) {
+      for (int string = 0; string < 6; ++string) {
+        int n = harnessLength(l, string);
+        for (int d = 0; d < NUM_HARNESS_DETUNES; ++d) {
+          for (int noise = 0; noise < NUM_HARNESS_NOISE_LEVELS; ++noise) {
+            for (int tone = 0; tone < NUM_TONE_MODELS; ++tone) {
+              for (int trial = 0; trial < trials; ++trial) {
+                harnessSeed = 1 + trial * 7919 + string * 104729 + d * 31;
+                float f0 = guitarStringFrequencies[string] *
+                           powf(2, harnessDetunes[d] / 1200.0f);
+                float truth = synthesizeTone(samples, n, tone, f0,
+                                             harnessNoiseLevels[noise]);
+                double computeMs;
+                float estimate =
+                    runEngine(&pitchEngines[e], samples, re, im, n, &computeMs);
+                double cents = centsError(estimate, truth);
+                addError(&byString[e][l][string], cents, computeMs);
+                addError(&byNoise[e][l][noise][tone], cents, computeMs);
+                if (csv) {
+                  printf("%s,%d,%s,%.0f,%.2f,%s,%d,%.3f,%.3f,%.2f,%.0f,%.3f\n",
+                         pitchEngines[e].name, n, guitarStringNames[string],
+                         harnessDetunes[d], harnessNoiseLevels[noise],
+                         toneModelNames[tone], trial, truth, estimate, cents,
+                         1000.0 * n / HARNESS_RATE, computeMs);
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+  if (csv) {
+    return 0;
+  }
+
+  char label[128];
+  printSummaryHeader(
+      "Synthetic plucks by engine, capture length and string (|c| in cents, "
+      "times in ms; board ms = capture + estimated Nios II compute)");
+  for (int e = 0; e < NUM_PITCH_ENGINES; ++e) {
+    for (int l = 0; l < NUM_HARNESS_LENGTHS; ++l) {
+      for (int string = 0; string < 6; ++string) {
+        int n = harnessLength(l, string);
+        snprintf(label, sizeof(label), "%s N=%d %s", pitchEngines[e].name, n,
+                 guitarStringNames[string]);
+        printSummaryRow(label, &byString[e][l][string],
+                        1000.0 * n / HARNESS_RATE,
+                        niosCyclesEstimatePitch(n) / NIOS_CLOCK_HZ * 1e3);
+      }
+    }
+  }
+
+  printSummaryHeader("Synthetic plucks by engine, capture length, noise "
+                     "(RMS relative to tone) and tone model");
+  for (int e = 0; e < NUM_PITCH_ENGINES; ++e) {
+    for (int l = 0; l < NUM_HARNESS_LENGTHS; ++l) {
+      char length[16];
+      double captureMs, niosMs;
+      describeHarnessLength(l, length, sizeof(length), &captureMs, &niosMs);
+      for (int noise = 0; noise < NUM_HARNESS_NOISE_LEVELS; ++noise) {
+        for (int tone = 0; tone < NUM_TONE_MODELS; ++tone) {
+          snprintf(label, sizeof(label), "%s N=%s noise=%.1f %s",
+                   pitchEngines[e].name, length, harnessNoiseLevels[noise],
+                   toneModelNames[tone]);
+          printSummaryRow(label, &byNoise[e][l][noise][tone], captureMs,
+                          niosMs);
+        }
+      }
+    }
+  }
+  return 0;
+}
+
+// expected pitch from a file name: a string name (E2 ... E4) or "<number>hz"
+float expectedPitchFromName(const char *name) {
+  for (const char *p = name; *p; ++p) {
+    bool startsNumber = isdigit((unsigned char)*p) &&
+                        (p == name || !isdigit((unsigned char)p[-1]));
+    if (startsNumber) {
+      char *end;
+      double value = strtod(p, &end);
+      if (tolower((unsigned char)end[0]) == 'h' &&
+          tolower((unsigned char)end[1]) == 'z') {
+        return (float)value;
+      }
+    }
+  }
+  for (const char *p = name; *p; ++p) {
+    for (int string = 0; string < 6; ++string) {
+      if (strncmp(p, guitarStringNames[string], 2) == 0 &&
+          !isalnum((unsigned char)p[2]) &&
+          (p == name || !isalnum((unsigned char)p[-1]))) {
+        return guitarStringFrequencies[string];
+      }
+    }
+  }
+  return -1;
+}
+
+uint32_t readLittleEndian(const unsigned char *p, int bytes) {
+  uint32_t value = 0;
+  for (int i = bytes - 1; i >= 0; --i) {
+    value = (value << 8) | p[i];
+  }
+  return value;
+}
+
+// decodes a recording held in memory as 32-bit samples at 8 kHz (16-bit PCM
+// shifted up as the audio core delivers it). WAV files of other rates are
+// resampled linearly. Returns the number of samples, or -1
+int decodeRecording(const char *path, const unsigned char *data, long got,
+                    int *samples, int maxSamples) {
+  const unsigned char *pcm = data;
+  long pcmBytes = got;
+  int channels = 1, rate = HARNESS_RATE;
+  if (got >= 12 && memcmp(data, "RIFF", 4) == 0 &&
+      memcmp(data + 8, "WAVE", 4) == 0) {
+    pcm = NULL;
+    int bits = 0, format = 0;
+    for (long offset = 12; offset + 8 <= got;) {
+      uint32_t chunkSize = readLittleEndian(data + offset + 4, 4);
+      const unsigned char *chunk = data + offset + 8;
+      if (memcmp(data + offset, "fmt ", 4) == 0 && chunkSize >= 16) {
+        format = readLittleEndian(chunk, 2);
+        channels = readLittleEndian(chunk + 2, 2);
+        rate = readLittleEndian(chunk + 4, 4);
+        bits = readLittleEndian(chunk + 14, 2);
+      } else if (memcmp(data + offset, "data", 4) == 0) {
+        pcm = chunk;
+        pcmBytes = chunkSize;
+        if (offset + 8 + pcmBytes > got) {
+          pcmBytes = got - offset - 8;
+        }
+      }
+      offset += 8 + chunkSize + (chunkSize & 1);
+    }
+    if (!pcm || format != 1 || bits != 16 || channels < 1 || rate <= 0) {
+      fprintf(stderr, "%s: only 16-bit PCM WAV files are supported\n", path);
+      return -1;
+    }
+  }
+
+  long frames = pcmBytes / (2 * channels);
+  int n = 0;
+  for (; n < maxSamples; ++n) {
+    double position = (double)n * rate / HARNESS_RATE;
+    long index = (long)position;
+    double fraction = position - index;
+    if (index >= frames || (fraction > 0 && index + 1 >= frames)) {
+      break;
+    }
+    int16_t a = (int16_t)readLittleEndian(pcm + index * 2 * channels, 2);
+    int16_t b = fraction > 0 ? (int16_t)readLittleEndian(
+                                   pcm + (index + 1) * 2 * channels, 2)
+                             : a;
+    samples[n] = (int)((a + (b - a) * fraction) * 65536);
+  }
+  return n;
+}
+
+// reads a recording file and decodes it as above
+int loadRecording(const char *path, int *samples, int maxSamples) {
+  FILE *file = fopen(path, "rb");
+  if (!file) {
+    return -1;
+  }
+  fseek(file, 0, SEEK_END);
+  long size = ftell(file);
+  fseek(file, 0, SEEK_SET);
+  unsigned char *data = malloc(size > 0 ? size : 1);
+  long got = fread(data, 1, size, file);
+  fclose(file);
+  int n = decodeRecording(path, data, got, samples, maxSamples);
+  free(data);
+  return n;
+}
+
+int recordedAccuracy(const char *dirPath, bool csv) {
+  static int samples[HARNESS_MAX_SAMPLES];
+  static float re[HARNESS_MAX_SAMPLES], im[HARNESS_MAX_SAMPLES];
+  DIR *dir = opendir(dirPath);
+  if (!dir) {
+    fprintf(stderr, "cannot open %s\n", dirPath);
+    return 1;
+  }
+
+  if (csv) {
+    printf("file,engine,samples,expected_hz,estimate_hz,error_cents,"
+           "capture_ms,host_compute_ms\n");
+  } else {
+    printf("\nRecordings in %s\n%-32s %-10s %6s %9s %9s %9s %9s %9s\n",
+           dirPath, "file", "engine", "N", "expected", "estimate", "cents",
+           "capture", "host ms");
+  }
+  struct dirent *entry;
+  int files = 0;
+  while ((entry = readdir(dir)) != NULL) {
+    const char *dot = strrchr(entry->d_name, '.');
+    if (!dot || (strcasecmp(dot, ".wav") != 0 && strcasecmp(dot, ".raw") != 0 &&
+                 strcasecmp(dot, ".pcm") != 0)) {
+      continue;
+    }
+    char path[1024];
+    snprintf(path, sizeof(path), "%s/%s", dirPath, entry->d_name);
+    int available = loadRecording(path, samples, HARNESS_MAX_SAMPLES);
+    if (available <= 0) {
+      continue;
+    }
+    ++files;
+    float expected = expectedPitchFromName(entry->d_name);
+    for (int e = 0; e < NUM_PITCH_ENGINES; ++e) {
+      for (int l = 0; l < NUM_HARNESS_LENGTHS; ++l) {
+        int n = harnessLengths[l];
+        if (n == 0 || n > available) {
+          break;  // the string of a recording is not known for its profile
+        }
+        double computeMs;
+        float estimate =
+            runEngine(&pitchEngines[e], samples, re, im, n, &computeMs);
+        double cents = expected > 0 ? centsError(estimate, expected) : NAN;
+        printf(csv ? "%s,%s,%d,%.3f,%.3f,%.2f,%.0f,%.3f\n"
+                   : "%-32s %-10s %6d %9.2f %9.2f %9.2f %9.0f %9.3f\n",
+               entry->d_name, pitchEngines[e].name, n, expected, estimate,
+               cents, 1000.0 * n / HARNESS_RATE, computeMs);
+      }
+    }
+  }
+  closedir(dir);
+  if (files == 0) {
+    fprintf(stderr, "no .wav, .raw or .pcm files in %s\n", dirPath);
+    return 1;
+  }
+  return 0;
+}
+
+int accuracyCommand(int argc, char **argv) {
+  int trials = 3;
+  const char *recordings = NULL;
+  bool csv = false;
+  for (int i = 0; i < argc; ++i) {
+    if (strcmp(argv[i], "--trials") == 0 && i + 1 < argc) {
+      trials = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--recordings") == 0 && i + 1 < argc) {
+      recordings = argv[++i];
+    } else if (strcmp(argv[i], "--csv") == 0) {
+      csv = true;
+    } else {
+      fprintf(stderr, "usage: tuner-host accuracy [--trials T] "
+                      "[--recordings dir] [--csv]\n");
+      return 2;
+    }
+  }
+  if (recordings) {
+    return recordedAccuracy(recordings, csv);
+  }
+  return syntheticAccuracy(trials < 1 ? 1 : trials, csv);
+}
+
+/*****************************************************************************/
+/* BATCH ANALYZER */
+/*****************************************************************************/
+// Runs estimatePitch() over an archive of recordings on every core. Each
+// worker owns a deque of file indices and a set of analysis buffers reused
+// for every file; it takes work from the front of its own deque and, when
+// that is empty, steals the back half of another worker's. Files are
+// memory-mapped and decoded straight into the worker's sample buffer.
+
+#define MAX_ANALYZE_THREADS 64
+
+struct analyzeResult {
+  int samples;  // analysed, or -1 if the file could not be read
+  float expected;
+  float estimate;
+  double computeMs;
+};
+
+struct analyzeDeque {
+  pthread_mutex_t lock;
+  int front;  // next index the owner takes
+  int back;   // one past the last index
+};
+
+struct analyzeWorker {
+  int id;
+  int stolen;  // files taken from other workers
+  int samples[HARNESS_MAX_SAMPLES];
+  float re[HARNESS_MAX_SAMPLES];
+  float im[HARNESS_MAX_SAMPLES];
+};
+
+struct analyzeJob {
+  char **paths;
+  int files;
+  int maxLength;
+  int threads;
+  struct analyzeResult *results;
+  struct analyzeDeque deques[MAX_ANALYZE_THREADS];
+  struct analyzeWorker *workers[MAX_ANALYZE_THREADS];
+};
+
+struct analyzeJob analyzeJob;
+
+// next file for worker id: its own deque first, then half of a victim's
+int takeAnalyzeWork(int id, int *stolen) {
+  struct analyzeDeque *own = &analyzeJob.deques[id];
+  pthread_mutex_lock(&own->lock);
+  if (own->front < own->back) {
+    int index = own->front++;
+    pthread_mutex_unlock(&own->lock);
+    return index;
+  }
+  pthread_mutex_unlock(&own->lock);
+
+  for (int offset = 1; offset < analyzeJob.threads; ++offset) {
+    struct analyzeDeque *victim =
+        &analyzeJob.deques[(id + offset) % analyzeJob.threads];
+    pthread_mutex_lock(&victim->lock);
+    int available = victim->back - victim->front;
+    if (available <= 0) {
+      pthread_mutex_unlock(&victim->lock);
+      continue;
+    }
+    int take = (available + 1) / 2;
+    int first = victim->back - take;
+    victim->back = first;
+    pthread_mutex_unlock(&victim->lock);
+
+    // keep the first stolen file, queue the rest on our own deque
+    pthread_mutex_lock(&own->lock);
+    own->front = first + 1;
+    own->back = first + take;
+    pthread_mutex_unlock(&own->lock);
+    *stolen += take;
+    return first;
+  }
+  return -1;
+}
+
+void analyzeFile(struct analyzeWorker *worker, int index) {
+  struct analyzeResult *result = &analyzeJob.results[index];
+  const char *path = analyzeJob.paths[index];
+  const char *base = strrchr(path, '/');
+  result->expected = expectedPitchFromName(base ? base + 1 : path);
+  result->samples = -1;
+  result->estimate = 0;
+  result->computeMs = 0;
+
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) {
+    return;
+  }
+  struct stat info;
+  if (fstat(fd, &info) != 0 || info.st_size == 0) {
+    close(fd);
+    return;
+  }
+  void *data = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED) {
+    return;
+  }
+  int available = decodeRecording(path, data, info.st_size, worker->samples,
+                                  analyzeJob.maxLength);
+  munmap(data, info.st_size);
+
+  int n = available;
+  if (n < 256) {
+    return;
+  }
+  double start = nowNanoseconds();
+  result->estimate = estimatePitch(worker->samples, worker->re, worker->im, n);
+  result->computeMs = (nowNanoseconds() - start) / 1e6;
+  result->samples = n;
+}
+
+void *analyzeThread(void *argument) {
+  struct analyzeWorker *worker = argument;
+  int index;
+  while ((index = takeAnalyzeWork(worker->id, &worker->stolen)) >= 0) {
+    analyzeFile(worker, index);
+  }
+  return NULL;
+}
+
+// analyses every file with the given number of threads, returns seconds
+double runAnalyzeJob(int threads, int *stolen) {
+  analyzeJob.threads = threads;
+  for (int t = 0; t < threads; ++t) {
+    analyzeJob.deques[t].front = (long)analyzeJob.files * t / threads;
+    analyzeJob.deques[t].back = (long)analyzeJob.files * (t + 1) / threads;
+    analyzeJob.workers[t]->id = t;
+    analyzeJob.workers[t]->stolen = 0;
+  }
+
+  pthread_t handles[MAX_ANALYZE_THREADS];
+  double start = nowNanoseconds();
+  for (int t = 1; t < threads; ++t) {
+    pthread_create(&handles[t], NULL, analyzeThread, analyzeJob.workers[t]);
+  }
+  analyzeThread(analyzeJob.workers[0]);
+  for (int t = 1; t < threads; ++t) {
+    pthread_join(handles[t], NULL);
+  }
+  double seconds = (nowNanoseconds() - start) / 1e9;
+
+  *stolen = 0;
+  for (int t = 0; t < threads; ++t) {
+    *stolen += analyzeJob.workers[t]->stolen;
+  }
+  return seconds;
+}
+
+bool isRecordingName(const char *name) {
+  const char *dot = strrchr(name, '.');
+  return dot && (strcasecmp(dot, ".wav") == 0 || strcasecmp(dot, ".raw") == 0 ||
+                 strcasecmp(dot, ".pcm") == 0);
+}
+
+// appends path, or the recordings under it if it is a directory
+void collectRecordings(const char *path, char ***paths, int *count,
+                       int *capacity) {
+  struct stat info;
+  if (stat(path, &info) != 0) {
+    fprintf(stderr, "cannot open %s\n", path);
+    return;
+  }
+  if (S_ISDIR(info.st_mode)) {
+    DIR *dir = opendir(path);
+    struct dirent *entry;
+    while (dir && (entry = readdir(dir)) != NULL) {
+      if (entry->d_name[0] == '.') {
+        continue;
+      }
+      char child[1024];
+      snprintf(child, sizeof(child), "%s/%s", path, entry->d_name);
+      struct stat childInfo;
+      if (stat(child, &childInfo) == 0 &&
+          (S_ISDIR(childInfo.st_mode) || isRecordingName(entry->d_name))) {
+        collectRecordings(child, paths, count, capacity);
+      }
+    }
+    if (dir) {
+      closedir(dir);
+    }
+    return;
+  }
+  if (*count == *capacity) {
+    *capacity = *capacity ? *capacity * 2 : 256;
+    *paths = realloc(*paths, *capacity * sizeof(char *));
+  }
+  (*paths)[(*count)++] = strdup(path);
+}
+
+int comparePaths(const void *a, const void *b) {
+  return strcmp(*(char *const *)a, *(char *const *)b);
+}
+
+int analyzeCommand(int argc, char **argv) {
+  int maxThreads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+  bool csv = false;
+  analyzeJob.maxLength = HARNESS_MAX_SAMPLES;
+  char **paths = NULL;
+  int count = 0, capacity = 0;
+  for (int i = 0; i < argc; ++i) {
+    if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+      maxThreads = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--length") == 0 && i + 1 < argc) {
+      analyzeJob.maxLength = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--csv") == 0) {
+      csv = true;
+    } else if (argv[i][0] == '-') {
+      count = 0;
+      break;
+    } else {
+      collectRecordings(argv[i], &paths, &count, &capacity);
+    }
+  }
+  if (count == 0 || maxThreads < 1 || analyzeJob.maxLength < 256 ||
+      analyzeJob.maxLength > HARNESS_MAX_SAMPLES) {
+    fprintf(stderr,
+            "usage: tuner-host analyze [--threads N] [--length 256-16384] "
+            "[--csv] file|dir...\n");
+    return 2;
+  }
+  if (maxThreads > MAX_ANALYZE_THREADS) {
+    maxThreads = MAX_ANALYZE_THREADS;
+  }
+  qsort(paths, count, sizeof(char *), comparePaths);
+
+  analyzeJob.paths = paths;
+  analyzeJob.files = count;
+  analyzeJob.results = calloc(count, sizeof(struct analyzeResult));
+  for (int t = 0; t < maxThreads; ++t) {
+    pthread_mutex_init(&analyzeJob.deques[t].lock, NULL);
+    analyzeJob.workers[t] = malloc(sizeof(struct analyzeWorker));
+  }
+
+  // throughput for 1, 2, 4 ... threads and maxThreads
+  FILE *report = csv ? stderr : stdout;
+  fprintf(report, "%d files\n%8s %10s %12s %8s %8s\n", count, "threads",
+          "seconds", "files/s", "speedup", "stolen");
+  double singleSeconds = 0;
+  for (int threads = 1; threads <= maxThreads;
+       threads = threads < maxThreads && threads * 2 > maxThreads
+                     ? maxThreads
+                     : threads * 2) {
+    int stolen;
+    double seconds = runAnalyzeJob(threads, &stolen);
+    if (threads == 1) {
+      singleSeconds = seconds;
+    }
+    fprintf(report, "%8d %10.3f %12.1f %8.2f %8d\n", threads, seconds,
+            count / seconds, singleSeconds / seconds, stolen);
+    if (threads == maxThreads) {
+      break;
+    }
+  }
+
+  if (csv) {
+    printf("file,samples,expected_hz,estimate_hz,error_cents,host_compute_ms\n");
+  } else {
+    printf("\n%-40s %6s %9s %9s %9s %9s\n", "file", "N", "expected",
+           "estimate", "cents", "host ms");
+  }
+  int failed = 0;
+  for (int i = 0; i < count; ++i) {
+    struct analyzeResult *r = &analyzeJob.results[i];
+    failed += r->samples < 0;
+    double cents = r->samples > 0 && r->expected > 0
+                       ? centsError(r->estimate, r->expected)
+                       : NAN;
+    printf(csv ? "%s,%d,%.3f,%.3f,%.2f,%.3f\n"
+               : "%-40s %6d %9.2f %9.2f %9.2f %9.3f\n",
+           paths[i], r->samples, r->expected, r->estimate, cents,
+           r->computeMs);
+  }
+
+  for (int t = 0; t < maxThreads; ++t) {
+    pthread_mutex_destroy(&analyzeJob.deques[t].lock);
+    free(analyzeJob.workers[t]);
+  }
+  for (int i = 0; i < count; ++i) {
+    free(paths[i]);
+  }
+  free(paths);
+  free(analyzeJob.results);
+  if (failed > 0) {
+    fprintf(stderr, "%d files could not be analysed\n", failed);
+  }
+  return failed > 0;
+}
+
+/*****************************************************************************/
+/* SESSION RECORD AND REPLAY */
+/*****************************************************************************/
+
+#define SESSION_MAGIC 0x53455354
+#define SESSION_HEADER_BYTES 32
+#define SESSION_INDEX_BYTES 16
+#define SESSION_STRING 1
+#define SESSION_CAPTURE 2
+#define SESSION_RESULT 3
+#define SESSION_WINDOW 4
+
+// records a session as the board does with SW3 on: a few synthetic plucks of
+// every string, each taken through the same calls as a KEY3 reading
+int recordSessionCommand(int argc, char **argv) {
+  const char *path = NULL;
+  int readings = 2;
+  int window = TUNER_WINDOW_RECTANGULAR;
+  for (int i = 0; i < argc; ++i) {
+    if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+      path = argv[++i];
+    } else if (strcmp(argv[i], "--readings") == 0 && i + 1 < argc) {
+      readings = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--window") == 0 && i + 1 < argc) {
+      window = windowByName(argv[++i]);
+    } else {
+      path = NULL;
+      break;
+    }
+  }
+  if (!path || readings < 1 || window < 0) {
+    fprintf(stderr, "usage: tuner-host record-session -o session.bin "
+                    "[--readings R] [--window none|hann|blackman-harris|"
+                    "kaiser]\n");
+    return 2;
+  }
+
+  static int samples[HARNESS_MAX_SAMPLES];
+  hostSwitchRegisters[0] = 0b1000 | window << 8;  // SW3, SW8 and SW9
+  analysisWindowType = windowSelected();  // as the KEY3 handler does
+  drawInitialScreen();
+  for (int string = 0; string < 6; ++string) {
+    selectString(string);
+    for (int r = 0; r < readings; ++r) {
+      float cents = 20 * harnessNoise();
+      float f0 = guitarStringFrequencies[string] *
+                 powf(2, cents / (float)CENTS_PER_OCTAVE);
+      const int n = captureLength();  // the string's, from the profile
+      synthesizeTone(samples, n, TONE_KARPLUS_STRONG, f0, 0.05f);
+      for (int i = 0; i < n; ++i) {
+        samples[i] &= ~0xffff;  // 16 bits, as the audio core delivers them
+      }
+      // recordAndPrint() after its capture loop, then the KEY3 handler
+      recordSessionCapture(samples, n);
+      float frequency = analyseCapture(samples, n);
+      showReading(frequency);
+      selectString(string);
+    }
+  }
+
+  FILE *file = fopen(path, "wb");
+  if (!file ||
+      fwrite(&sessionLog, 1, sessionLogBytes(), file) != sessionLogBytes()) {
+    fprintf(stderr, "cannot write %s\n", path);
+    return 1;
+  }
+  fclose(file);
+  printf("%d readings, %u bytes written to %s\n", 6 * readings,
+         sessionLogBytes(), path);
+  return 0;
+}
+
+// feeds a session log back through analyseCapture() and the drawing code,
+// checking every reading against the one recorded. With --from, replay
+// starts at that capture, found through the index
+int replayCommand(int argc, char **argv) {
+  const char *path = NULL;
+  int from = 0, count = -1;
+  bool usage = false;
+  for (int i = 0; i < argc; ++i) {
+    if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+      outputDir = argv[++i];
+    } else if (strcmp(argv[i], "--from") == 0 && i + 1 < argc) {
+      from = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--count") == 0 && i + 1 < argc) {
+      count = atoi(argv[++i]);
+    } else if (argv[i][0] != '-' && !path) {
+      path = argv[i];
+    } else {
+      usage = true;
+    }
+  }
+  if (!path || usage || from < 0) {
+    fprintf(stderr, "usage: tuner-host replay [-o dir] [--from capture] "
+                    "[--count captures] session.bin\n");
+    return 2;
+  }
+
+  int fd = open(path, O_RDONLY);
+  struct stat info;
+  if (fd < 0 || fstat(fd, &info) != 0) {
+    fprintf(stderr, "cannot open %s\n", path);
+    return 1;
+  }
+  size_t size = info.st_size;
+  const unsigned char *log =
+      size ? mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+  close(fd);
+  if (log == MAP_FAILED || size < SESSION_HEADER_BYTES ||
+      readLittleEndian(log, 4) != SESSION_MAGIC) {
+    fprintf(stderr, "%s is not a session log\n", path);
+    return 1;
+  }
+  uint32_t version = readLittleEndian(log + 4, 4);
+  uint32_t indexSize = readLittleEndian(log + 8, 4);
+  uint32_t records = readLittleEndian(log + 16, 4);
+  uint32_t dataBytes = readLittleEndian(log + 20, 4);
+  size_t dataStart = SESSION_HEADER_BYTES + (size_t)indexSize *
+                                                SESSION_INDEX_BYTES;
+  if (version != 1 || records > indexSize || dataStart + dataBytes > size) {
+    fprintf(stderr, "%s: unsupported or truncated session (version %u)\n",
+            path, version);
+    return 1;
+  }
+  printf("%u records, %u captures, %u dropped when recorded\n", records,
+         readLittleEndian(log + 24, 4), readLittleEndian(log + 28, 4));
+
+  // seek: the first record of the requested capture, and the string and
+  // window selected before it
+  uint32_t first = 0;
+  int captureNumber = 0, string = 0;
+  analysisWindowType = TUNER_WINDOW_RECTANGULAR;  // unless a record says
+  for (; first < records; ++first) {
+    const unsigned char *entry =
+        log + SESSION_HEADER_BYTES + (size_t)first * SESSION_INDEX_BYTES;
+    unsigned int type = readLittleEndian(entry + 12, 2);
+    if (type == SESSION_CAPTURE && captureNumber++ == from) {
+      break;
+    }
+    string = readLittleEndian(entry + 14, 2);
+    uint32_t offset = readLittleEndian(entry, 4);
+    if (type == SESSION_WINDOW && offset + 4 <= dataBytes) {
+      analysisWindowType = (int)readLittleEndian(log + dataStart + offset, 4);
+    }
+  }
+
+  static int samples[HARNESS_MAX_SAMPLES];
+  drawInitialScreen();
+  selectString(string < 6 ? string : 0);
+
+  int replayed = 0, mismatches = 0;
+  float pending = -1;
+  double audioSeconds = 0;
+  double start = nowNanoseconds();
+  for (uint32_t r = first; r < records && (count < 0 || replayed < count);
+       ++r) {
+    const unsigned char *entry =
+        log + SESSION_HEADER_BYTES + (size_t)r * SESSION_INDEX_BYTES;
+    uint32_t offset = readLittleEndian(entry, 4);
+    uint32_t length = readLittleEndian(entry + 4, 4);
+    unsigned int type = readLittleEndian(entry + 12, 2);
+    unsigned int recordString = readLittleEndian(entry + 14, 2);
+    if (offset + (size_t)length > dataBytes) {
+      fprintf(stderr, "record %u runs past the data\n", r);
+      break;
+    }
+    const unsigned char *payload = log + dataStart + offset;
+
+    if (type == SESSION_STRING && recordString < 6) {
+      selectString(recordString);
+    } else if (type == SESSION_WINDOW && length >= 4) {
+      analysisWindowType = (int)readLittleEndian(payload, 4);
+    } else if (type == SESSION_CAPTURE && length >= 8) {
+      int rate = (int)readLittleEndian(payload, 4);
+      int n = (int)readLittleEndian(payload + 4, 4);
+      if (n > HARNESS_MAX_SAMPLES || 8 + 2 * (size_t)n > length) {
+        fprintf(stderr, "capture in record %u is too long\n", r);
+        break;
+      }
+      for (int i = 0; i < n; ++i) {
+        samples[i] = (int16_t)readLittleEndian(payload + 8 + 2 * i, 2) * 65536;
+      }
+      pending = analyseCapture(samples, n);
+      audioSeconds += (double)n / rate;
+    } else if (type == SESSION_RESULT && length >= 8 && pending >= 0) {
+      int32_t recorded = (int32_t)readLittleEndian(payload, 4);
+      showReading(pending);
+      bool match = toMillihertz(pending) == recorded;
+      mismatches += !match;
+      printf("capture %4d %s: recorded %9.3f Hz, replayed %9.3f Hz%s\n",
+             from + replayed, guitarStringNames[stringState],
+             recorded / 1000.0, (double)pending, match ? "" : "  MISMATCH");
+      if (outputDir) {
+        settleNeedle();
+        finishFrame("replay");
+      }
+      pending = -1;
+      replayed++;
+    }
+  }
+  double seconds = (nowNanoseconds() - start) / 1e9;
+  munmap((void *)log, size);
+
+  printf("%d readings replayed, %d mismatches, %.1f s of audio in %.3f s "
+         "(%.0fx real time)\n",
+         replayed, mismatches, audioSeconds, seconds,
+         seconds > 0 ? audioSeconds / seconds : 0.0);
+  return mismatches > 0;
+}
+
+/*****************************************************************************/
+/* STREAM COMMAND */
+/*****************************************************************************/
+// Pitch readings from raw PCM on stdin through the tuner library, the same
+// analysis the board runs on its captures. A reader thread takes whatever
+// the pipe holds (up to a large chunk per read), stamps its arrival time and
+// hands it over through a single-producer single-consumer ring of chunk
+// slots with no locks; the analysis thread pushes each chunk into the tuner
+// and reports, for every result, the time from the arrival of the chunk
+// holding the window's last sample to the moment the reading is printed.
+
+#define STREAM_CHUNK 4096          // samples per read at most
+#define STREAM_SLOTS 64            // chunks in flight, a power of two
+#define STREAM_LATENCY_BUCKETS 10000  // of 0.1 ms, the last one open-ended
+
+struct streamChunk {
+  int count;
+  double arrivalNs;
+  int16_t samples[STREAM_CHUNK];
+};
+
+struct streamRing {
+  struct streamChunk slots[STREAM_SLOTS];
+  _Atomic unsigned int head;  // chunks written, by the reader
+  _Atomic unsigned int tail;  // chunks consumed, by the analysis thread
+  _Atomic bool finished;      // the reader hit end of input
+  unsigned long long waits;   // times the reader found the ring full
+};
+
+struct streamRing streamRing;
+
+void streamPause() {
+  struct timespec pause = {0, 100000};  // 0.1 ms
+  nanosleep(&pause, NULL);
+}
+
+void *streamReader(void *argument) {
+  (void)argument;
+  unsigned char bytes[STREAM_CHUNK * 2 + 1];
+  int carried = 0;  // odd byte left over from the last read
+  for (;;) {
+    unsigned int head = atomic_load_explicit(&streamRing.head,
+                                             memory_order_relaxed);
+    while (head - atomic_load_explicit(&streamRing.tail,
+                                       memory_order_acquire) >= STREAM_SLOTS) {
+      streamRing.waits++;
+      streamPause();
+    }
+    ssize_t got = read(STDIN_FILENO, bytes + carried,
+                       STREAM_CHUNK * 2 - carried);
+    if (got <= 0) {
+      break;
+    }
+    double arrival = nowNanoseconds();
+    int length = carried + (int)got;
+    struct streamChunk *chunk = &streamRing.slots[head % STREAM_SLOTS];
+    chunk->count = length / 2;
+    chunk->arrivalNs = arrival;
+    for (int i = 0; i < chunk->count; ++i) {
+      chunk->samples[i] = (int16_t)readLittleEndian(bytes + 2 * i, 2);
+    }
+    carried = length & 1;
+    bytes[0] = bytes[length - 1];
+    atomic_store_explicit(&streamRing.head, head + 1, memory_order_release);
+  }
+  atomic_store_explicit(&streamRing.finished, true, memory_order_release);
+  return NULL;
+}
+
+double latencyPercentile(const unsigned long long *histogram,
+                         unsigned long long count, double p) {
+  unsigned long long rank = (unsigned long long)(p / 100 * (count - 1));
+  unsigned long long seen = 0;
+  for (int b = 0; b < STREAM_LATENCY_BUCKETS; ++b) {
+    seen += histogram[b];
+    if (seen > rank) {
+      return (b + 1) / 10.0;  // upper edge of the bucket, ms
+    }
+  }
+  return STREAM_LATENCY_BUCKETS / 10.0;
+}
+
+int streamCommand(int argc, char **argv) {
+  struct tuner_config config = {.sample_rate = HARNESS_RATE,
+                                .window = 16384,
+                                .hop = 256,
+                                .min_hz = 50,
+                                .max_hz = 380,
+                                .decimation = 1,
+                                .window_type = TUNER_WINDOW_RECTANGULAR};
+  bool quiet = false;
+  for (int i = 0; i < argc; ++i) {
+    if (strcmp(argv[i], "--rate") == 0 && i + 1 < argc) {
+      config.sample_rate = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--window") == 0 && i + 1 < argc) {
+      config.window = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--hop") == 0 && i + 1 < argc) {
+      config.hop = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--string") == 0 && i + 1 < argc) {
+      int string = stringByName(argv[++i]);
+      if (string < 0) {
+        config.window = 0;
+        break;
+      }
+      config.window = stringCaptureLength(string);
+      config.hop = stringHopLength(string);
+    } else if (strcmp(argv[i], "--window-type") == 0 && i + 1 < argc) {
+      config.window_type = windowByName(argv[++i]);
+    } else if (strcmp(argv[i], "--full-search") == 0) {
+      config.full_search = true;
+    } else if (strcmp(argv[i], "--quiet") == 0) {
+      quiet = true;
+    } else {
+      config.window = 0;
+      break;
+    }
+  }
+  // rates that are a multiple of the board's are brought down to it, so the
+  // window, bins and band are the board's
+  if (config.sample_rate > HARNESS_RATE &&
+      config.sample_rate % HARNESS_RATE == 0) {
+    config.decimation = config.sample_rate / HARNESS_RATE;
+  }
+  static tuner_state tuner;
+  if (!tuner_init(&tuner, &config)) {
+    fprintf(stderr,
+            "usage: tuner-host stream [--rate Hz] [--window N] [--hop H] "
+            "[--string E2-E4] [--window-type none|hann|blackman-harris|"
+            "kaiser] [--full-search] [--quiet] < s16le-mono.raw\n");
+    return 2;
+  }
+
+  pthread_t reader;
+  pthread_create(&reader, NULL, streamReader, NULL);
+
+  static unsigned long long latencyHistogram[STREAM_LATENCY_BUCKETS];
+  unsigned long long results = 0;
+  double maxLatencyMs = 0, busyNs = 0;
+  double startNs = nowNanoseconds();
+  for (;;) {
+    unsigned int tail = atomic_load_explicit(&streamRing.tail,
+                                             memory_order_relaxed);
+    if (tail == atomic_load_explicit(&streamRing.head,
+                                     memory_order_acquire)) {
+      if (atomic_load_explicit(&streamRing.finished, memory_order_acquire) &&
+          tail == atomic_load_explicit(&streamRing.head,
+                                       memory_order_acquire)) {
+        break;
+      }
+      streamPause();
+      continue;
+    }
+    struct streamChunk *chunk = &streamRing.slots[tail % STREAM_SLOTS];
+    double workStart = nowNanoseconds();
+    tuner_push_samples(&tuner, chunk->samples, chunk->count);
+    struct tuner_result result;
+    while (tuner_poll_result(&tuner, &result)) {
+      double latencyMs = (nowNanoseconds() - chunk->arrivalNs) / 1e6;
+      if (!quiet) {
+        printf("%10.3f s %9.3f Hz %7.2f ms\n",
+               (double)result.end_sample / config.sample_rate,
+               result.frequency, latencyMs);
+        fflush(stdout);
+      }
+      int bucket = (int)(latencyMs * 10);
+      latencyHistogram[bucket < STREAM_LATENCY_BUCKETS
+                           ? bucket
+                           : STREAM_LATENCY_BUCKETS - 1]++;
+      if (latencyMs > maxLatencyMs) {
+        maxLatencyMs = latencyMs;
+      }
+      results++;
+    }
+    busyNs += nowNanoseconds() - workStart;
+    atomic_store_explicit(&streamRing.tail, tail + 1, memory_order_release);
+  }
+  pthread_join(reader, NULL);
+
+  double audioSeconds = (double)tuner.pushed / config.sample_rate;
+  double wallSeconds = (nowNanoseconds() - startNs) / 1e9;
+  fprintf(stderr,
+          "%.1f s of audio in %.2f s, analysis busy %.3f s (%.0fx real "
+          "time), %llu reader waits, %u results dropped\n",
+          audioSeconds, wallSeconds, busyNs / 1e9,
+          busyNs > 0 ? audioSeconds / (busyNs / 1e9) : 0.0, streamRing.waits,
+          tuner.results_dropped);
+  if (results > 0) {
+    fprintf(stderr,
+            "%llu readings, latency p50 %.1f ms p95 %.1f ms p99 %.1f ms "
+            "max %.2f ms\n",
+            results, latencyPercentile(latencyHistogram, results, 50),
+            latencyPercentile(latencyHistogram, results, 95),
+            latencyPercentile(latencyHistogram, results, 99), maxLatencyMs);
+  }
+  const struct tuner_pitch_tracker *tracker = &tuner.tracker;
+  if (!config.full_search && tracker->windows > 0) {
+    fprintf(stderr,
+            "pitch search: %.1f of the band's %d candidates per window\n",
+            (double)tracker->bins_searched / tracker->windows,
+            tracker->last_bin - tracker->first_bin + 1);
+  }
+  return 0;
+}
+
+/*****************************************************************************/
+/* LATENCY SIMULATION */
+/*****************************************************************************/
+// Runs the board's KEY3 timeline on the simulated clock: the main loop's
+// needle frames at 60 Hz, key presses through interrupt_handler(), the
+// countdown delays, the audio FIFO at 8 kHz and the cost of every pixel and
+// character written. The latency panel (SW4) measures it as on the board
+
+#define SIM_FRAME_TICKS (100000000 / 60)
+
+// runs needle frames, each at the next vsync, until simulated time reaches
+// untilTicks
+void simulateFrames(unsigned long long untilTicks) {
+  while (hostSimulatedNow() < untilTicks) {
+    unsigned long long now = hostSimulatedNow();
+    hostSimulatedTicks += SIM_FRAME_TICKS - now % SIM_FRAME_TICKS;
+    serviceLatencyPanel();
+    needleFrame();
+  }
+}
+
+int latencySimCommand(int argc, char **argv) {
+  int presses = 8;
+  for (int i = 0; i < argc; ++i) {
+    if (strcmp(argv[i], "--presses") == 0 && i + 1 < argc) {
+      presses = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--cpu-scale") == 0 && i + 1 < argc) {
+      hostCpuScale = atof(argv[++i]);
+    } else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+      outputDir = argv[++i];
+    } else {
+      presses = 0;
+      break;
+    }
+  }
+  if (presses < 1 || hostCpuScale < 0) {
+    fprintf(stderr, "usage: tuner-host latency-sim [--presses N] "
+                    "[--cpu-scale S] [-o dir]\n");
+    return 2;
+  }
+
+  hostClockSimulated = true;
+  hostCpuStartNs = nowNanoseconds();
+  hostSwitchRegisters[0] = 0b10000;  // SW4
+  drawInitialScreen();
+  static int tone[HARNESS_MAX_SAMPLES];  // played in a loop
+  hostAudioSource = tone;
+  hostAudioSourceLength = HARNESS_MAX_SAMPLES;
+
+  for (int press = 0; press < presses; ++press) {
+    // a second or so of idle frames, then a pluck and KEY3
+    simulateFrames(hostSimulatedNow() + 100000000ull + press * 7000000ull);
+    int string = press % 6;
+    synthesizeTone(tone, hostAudioSourceLength, TONE_KARPLUS_STRONG,
+                   guitarStringFrequencies[string], 0.05f);
+    hostAudioSourceStart = -1;  // a capture shorter than the loop must not
+                                // straddle its seam
+    selectString(string);
+    unsigned long long pressed = hostSimulatedNow();
+    hostControlRegisters[4] = 0b10;  // ipending: pushbuttons
+    hostKeyRegisters[3] = 0b1000;    // KEY3 edge
+    interrupt_handler();
+    unsigned long long handled = hostSimulatedNow();
+    simulateFrames(handled + 2 * 100000000ull);  // let the needle settle
+    printf("press %d (%s): handler %.1f ms\n", press,
+           guitarStringNames[string], (handled - pressed) / 1e5);
+  }
+
+  printf("\n");
+  for (int row = 48; row < TEXT_ROWS; ++row) {
+    printf("%.26s\n", hostCharacterBuffer + row * TEXT_ROW_STRIDE);
+  }
+  if (outputDir) {
+    finishFrame("latency");
+  }
+  return 0;
+}
+
+/*****************************************************************************/
+/* STRUM HARNESS */
+/*****************************************************************************/
+// Polyphonic mode against synthetic strums: all six strings, each detuned at
+// random and at its own loudness, summed into one capture and taken through
+// the board's analyseCapture(), analyseStrum() and drawStrum()
+
+int strumCommand(int argc, char **argv) {
+  int trials = 20;
+  float maxDetune = 30;  // cents
+  enum toneModel model = TONE_KARPLUS_STRONG;
+  for (int i = 0; i < argc; ++i) {
+    if (strcmp(argv[i], "--trials") == 0 && i + 1 < argc) {
+      trials = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--detune") == 0 && i + 1 < argc) {
+      maxDetune = atof(argv[++i]);
+    } else if (strcmp(argv[i], "--stiff") == 0) {
+      model = TONE_STIFF_STRING;
+    } else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+      outputDir = argv[++i];
+    } else {
+      trials = 0;
+      break;
+    }
+  }
+  if (trials < 1) {
+    fprintf(stderr, "usage: tuner-host strum [--trials T] [--detune cents] "
+                    "[--stiff] [-o dir]\n");
+    return 2;
+  }
+
+  static int one[HARNESS_MAX_SAMPLES];
+  static long long sum[HARNESS_MAX_SAMPLES];
+  static int samples[HARNESS_MAX_SAMPLES];
+  static struct errorSummary summaries[6];
+  int missed[6] = {0};
+  drawInitialScreen();
+
+  for (int trial = 0; trial < trials; ++trial) {
+    float truth[6];
+    memset(sum, 0, sizeof(sum));
+    for (int string = 0; string < 6; ++string) {
+      float f0 = guitarStringFrequencies[string] *
+                 powf(2, maxDetune * harnessNoise() / (float)CENTS_PER_OCTAVE);
+      truth[string] =
+          synthesizeTone(one, HARNESS_MAX_SAMPLES, model, f0, 0.02f);
+      float loudness = 0.5f + 0.25f * (harnessNoise() + 1);
+      for (int i = 0; i < HARNESS_MAX_SAMPLES; ++i) {
+        sum[i] += (long long)(loudness * one[i]);
+      }
+    }
+    for (int i = 0; i < HARNESS_MAX_SAMPLES; ++i) {
+      samples[i] = (int)(sum[i] / 6);
+    }
+
+    double start = nowNanoseconds();
+    analyseCapture(samples, HARNESS_MAX_SAMPLES);
+    analyseStrum();
+    double computeMs = (nowNanoseconds() - start) / 1e6;
+    drawStrum();
+    for (int string = 0; string < 6; ++string) {
+      if (strum[string].frequency <= 0) {
+        missed[string]++;
+        continue;
+      }
+      addError(&summaries[string],
+               centsError(strum[string].frequency, truth[string]), computeMs);
+    }
+  }
+
+  printf("%d strums, strings detuned up to %.0f cents (%s)\n", trials,
+         maxDetune, toneModelNames[model]);
+  printSummaryHeader("Strings found in one strum");
+  for (int string = 0; string < 6; ++string) {
+    printSummaryRow(guitarStringNames[string], &summaries[string],
+                    1000.0 * HARNESS_MAX_SAMPLES / HARNESS_RATE,
+                    niosCyclesEstimatePitch(HARNESS_MAX_SAMPLES) /
+                        NIOS_CLOCK_HZ * 1e3);
+    if (missed[string]) {
+      printf("  %s not heard in %d strums\n", guitarStringNames[string],
+             missed[string]);
+    }
+  }
+  if (outputDir) {
+    finishFrame("strum");
+  }
+  return 0;
+}
+
+/*****************************************************************************/
+/* AUTO STRING HARNESS */
+/*****************************************************************************/
+
+// the nearest target in cents, the long way
+int nearestByLog(const float targets[], int count, float frequency) {
+  int best = 0;
+  for (int i = 1; i < count; ++i) {
+    if (fabsf(log2f(frequency / targets[i])) <
+        fabsf(log2f(frequency / targets[best]))) {
+      best = i;
+    }
+  }
+  return best;
+}
+
+// compares tuner_classify() with nearestByLog() over a log sweep of
+// frequencies and prints the time each takes per frequency
+void compareClassifiers(const char *label, const float targets[], int count) {
+  struct tuner_classifier classifier;
+  if (!tuner_classifier_init(&classifier, targets, count)) {
+    printf("%s: tuner_classifier_init failed\n", label);
+    return;
+  }
+  enum { SWEEP = 1 << 20 };
+  static float sweep[SWEEP];
+  for (int i = 0; i < SWEEP; ++i) {
+    sweep[i] = 20 * powf(2, 7.0f * i / SWEEP);  // 20 Hz to 2.56 kHz
+  }
+
+  volatile int sink = 0;
+  double start = nowNanoseconds();
+  for (int i = 0; i < SWEEP; ++i) {
+    sink += tuner_classify(&classifier, sweep[i]);
+  }
+  double lutNs = (nowNanoseconds() - start) / SWEEP;
+  start = nowNanoseconds();
+  for (int i = 0; i < SWEEP; ++i) {
+    sink += nearestByLog(targets, count, sweep[i]);
+  }
+  double logNs = (nowNanoseconds() - start) / SWEEP;
+
+  int disagreements = 0;
+  for (int i = 0; i < SWEEP; ++i) {
+    int lut = tuner_classify(&classifier, sweep[i]);
+    int reference = nearestByLog(targets, count, sweep[i]);
+    // a hair from the midpoint either answer is right
+    float margin = fabsf(fabsf(log2f(sweep[i] / targets[lut])) -
+                         fabsf(log2f(sweep[i] / targets[reference])));
+    disagreements += lut != reference && margin > 1e-5f;
+  }
+  printf("%-10s %3d targets: table %6.1f ns, log2f %6.1f ns, "
+         "%d of %d disagree\n",
+         label, count, lutNs, logNs, disagreements, SWEEP);
+}
+
+int autoStringCommand(int argc, char **argv) {
+  int readings = 24;
+  float maxDetune = 40;  // cents
+  for (int i = 0; i < argc; ++i) {
+    if (strcmp(argv[i], "--readings") == 0 && i + 1 < argc) {
+      readings = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--detune") == 0 && i + 1 < argc) {
+      maxDetune = atof(argv[++i]);
+    } else {
+      readings = 0;
+      break;
+    }
+  }
+  if (readings < 1) {
+    fprintf(stderr, "usage: tuner-host auto-string [--readings R] "
+                    "[--detune cents]\n");
+    return 2;
+  }
+
+  // KEY3 readings as in latency-sim, but the string is never selected
+  hostClockSimulated = true;
+  hostCpuStartNs = nowNanoseconds();
+  hostSwitchRegisters[0] = 0b1000000;  // SW6
+  drawInitialScreen();
+  static int tone[HARNESS_MAX_SAMPLES];
+  hostAudioSource = tone;
+  hostAudioSourceLength = HARNESS_MAX_SAMPLES;
+  int correct = 0;
+  for (int reading = 0; reading < readings; ++reading) {
+    int string = (int)((harnessNoise() + 1) * 3) % 6;
+    float cents = maxDetune * harnessNoise();
+    synthesizeTone(tone, HARNESS_MAX_SAMPLES, TONE_KARPLUS_STRONG,
+                   guitarStringFrequencies[string] *
+                       powf(2, cents / (float)CENTS_PER_OCTAVE),
+                   0.05f);
+    hostControlRegisters[4] = 0b10;  // ipending: pushbuttons
+    hostKeyRegisters[3] = 0b1000;    // KEY3 edge
+    interrupt_handler();
+    correct += stringState == (enum GuitarString)string;
+    printf("reading %2d: played %s %+5.1f c, read %7.2f Hz, selected %s%s\n",
+           reading, guitarStringNames[string], cents, frequencyOfString,
+           guitarStringNames[stringState],
+           stringState == (enum GuitarString)string ? "" : "  X");
+  }
+  printf("%d of %d readings selected the string played\n\n", correct,
+         readings);
+
+  float notes[64];
+  for (int i = 0; i < 64; ++i) {
+    notes[i] = 27.5f * powf(2, i / 12.0f);  // A0 up
+  }
+  compareClassifiers("strings", guitarStringFrequencies, 6);
+  compareClassifiers("chromatic", notes, 64);
+  return correct == readings ? 0 : 1;
+}
+
+/*****************************************************************************/
+/* CHROMATIC HARNESS */
+/*****************************************************************************/
+
+int chromaticCommand(int argc, char **argv) {
+  int readings = 24;
+  float maxDetune = 40;  // cents
+  for (int i = 0; i < argc; ++i) {
+    if (strcmp(argv[i], "--readings") == 0 && i + 1 < argc) {
+      readings = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--detune") == 0 && i + 1 < argc) {
+      maxDetune = atof(argv[++i]);
+    } else {
+      readings = 0;
+      break;
+    }
+  }
+  if (readings < 1) {
+    fprintf(stderr, "usage: tuner-host chromatic [--readings R] "
+                    "[--detune cents]\n");
+    return 2;
+  }
+
+  // KEY3 readings as in auto-string, with SW7 on
+  hostClockSimulated = true;
+  hostCpuStartNs = nowNanoseconds();
+  hostSwitchRegisters[0] = 0b10000000;  // SW7
+  drawInitialScreen();
+  serviceChromaticMode();
+  static int tone[HARNESS_MAX_SAMPLES];
+  static struct errorSummary summary;
+  hostAudioSource = tone;
+  hostAudioSourceLength = HARNESS_MAX_SAMPLES;
+  int named = 0;
+  for (int reading = 0; reading < readings; ++reading) {
+    int note = (int)((harnessNoise() + 1) * 32) % 64;
+    float cents = maxDetune * harnessNoise();
+    // a Karplus-Strong pluck near 1 kHz has died out within the capture
+    float truth = synthesizeTone(
+        tone, HARNESS_MAX_SAMPLES, TONE_STIFF_STRING,
+        chromaticFrequencies[note] * powf(2, cents / (float)CENTS_PER_OCTAVE),
+        0.05f);
+    hostControlRegisters[4] = 0b10;  // ipending: pushbuttons
+    hostKeyRegisters[3] = 0b1000;    // KEY3 edge
+    interrupt_handler();
+    double error = centsError(frequencyOfString, truth);
+    addError(&summary, error, 0);
+    named += chromaticNote == note;
+    printf("reading %2d: played %7.2f Hz (%+5.1f c), read %7.2f Hz, "
+           "%.4s %.10s%s\n",
+           reading, truth, cents, frequencyOfString,
+           hostCharacterBuffer + 14 * TEXT_ROW_STRIDE + 39,
+           hostCharacterBuffer + 18 * TEXT_ROW_STRIDE + 36,
+           chromaticNote == note ? "" : "  X");
+  }
+  printf("%d of %d readings named the note played\n", named, readings);
+  printSummaryHeader("Chromatic readings");
+  printSummaryRow("A0-C6", &summary,
+                  1000.0 * HARNESS_MAX_SAMPLES / HARNESS_RATE,
+                  niosCyclesEstimatePitch(HARNESS_MAX_SAMPLES) /
+                      NIOS_CLOCK_HZ * 1e3);
+
+  enum { SWEEP = 1 << 20 };
+  static float sweep[SWEEP];
+  for (int i = 0; i < SWEEP; ++i) {
+    sweep[i] = 20 * powf(2, 7.0f * i / SWEEP);  // 20 Hz to 2.56 kHz
+  }
+  volatile int32_t sink = 0;
+  double start = nowNanoseconds();
+  for (int i = 0; i < SWEEP; ++i) {
+    sink += tuner_pitch_millicents(sweep[i]);
+  }
+  double tableNs = (nowNanoseconds() - start) / SWEEP;
+  start = nowNanoseconds();
+  for (int i = 0; i < SWEEP; ++i) {
+    sink += (int32_t)(1200000 * log2f(sweep[i]));
+  }
+  double logNs = (nowNanoseconds() - start) / SWEEP;
+  double worst = 0;
+  for (int i = 0; i < SWEEP; ++i) {
+    double exact = 1200 * log2((double)sweep[i]);
+    double error = fabs(tuner_pitch_millicents(sweep[i]) / 1000.0 - exact);
+    worst = error > worst ? error : worst;
+  }
+  printf("\ntuner_pitch_millicents: %.1f ns (log2f %.1f ns), worst error "
+         "%.4f cents\n",
+         tableNs, logNs, worst);
+  return named == readings ? 0 : 1;
+}
+
+/*****************************************************************************/
+/* TRIG HARNESS */
+/*****************************************************************************/
+
+// Rough Nios II cycles of the libm calls the engine replaces: a double
+// precision sin(), cos() or atan2() is NIOS_TRIG_CYCLES, a soft-float sqrtf()
+// NIOS_SQRT_CYCLES
+
+struct trigError {
+  double worst;
+  double sumSquares;
+  int count;
+};
+
+void addTrigError(struct trigError *error, double difference) {
+  difference = fabs(difference);
+  error->worst = difference > error->worst ? difference : error->worst;
+  error->sumSquares += difference * difference;
+  error->count++;
+}
+
+uint32_t trigRandom() {
+  harnessSeed = harnessSeed * 1664525u + 1013904223u;
+  return harnessSeed;
+}
+
+// a random int32 of random size, so every normalisation shift is exercised
+int32_t trigRandomComponent() {
+  return (int32_t)trigRandom() >> (trigRandom() % 31);
+}
+
+// a random float of size 2^-20 to 2^20
+float trigRandomFloat() {
+  return ldexpf(harnessNoise(), (int)(trigRandom() % 41) - 20);
+}
+
+// angle difference in radians, wrapped into [-pi, pi]
+double wrapRadians(double difference) {
+  return remainder(difference, 2 * M_PI);
+}
+
+void printTrigRow(const char *name, const struct trigError *error,
+                  const char *unit, double ns, const char *reference,
+                  double referenceNs, double cycles, double referenceCycles) {
+  printf("%-16s %9.2g %9.2g %-4s %7.1f  %-12s %7.1f %9.0f %9.0f\n", name,
+         error->worst, sqrt(error->sumSquares / error->count), unit, ns,
+         reference, referenceNs, cycles, referenceCycles);
+}
+
+int trigCommand(int argc, char **argv) {
+  int count = 1 << 20;
+  for (int i = 0; i < argc; ++i) {
+    if (strcmp(argv[i], "--count") == 0 && i + 1 < argc) {
+      count = atoi(argv[++i]);
+    } else {
+      count = 0;
+      break;
+    }
+  }
+  if (count < 1) {
+    fprintf(stderr, "usage: tuner-host trig [--count N]\n");
+    return 2;
+  }
+
+  uint32_t *angles = malloc(count * sizeof(uint32_t));
+  int32_t *xs = malloc(count * sizeof(int32_t));
+  int32_t *ys = malloc(count * sizeof(int32_t));
+  float *radians = malloc(count * sizeof(float));
+  float *fxs = malloc(count * sizeof(float));
+  float *fys = malloc(count * sizeof(float));
+  for (int i = 0; i < count; ++i) {
+    // every quadrant and table boundary, then random angles
+    angles[i] = i < 4096 ? (uint32_t)i << 20 : trigRandom();
+    xs[i] = trigRandomComponent();
+    ys[i] = trigRandomComponent();
+    radians[i] = (float)M_PI * harnessNoise();
+    fxs[i] = trigRandomFloat();
+    fys[i] = trigRandomFloat();
+  }
+
+  // accuracy, against libm in doubles
+  const double turnRadians = 2 * M_PI / 4294967296.0;
+  struct trigError sincosError = {0}, atan2Error = {0}, magnitudeError = {0};
+  struct trigError sincosfError = {0}, atan2fError = {0}, hypotfError = {0};
+  for (int i = 0; i < count; ++i) {
+    int32_t s, c;
+    tuner_sincos(angles[i], &s, &c);
+    double angle = angles[i] * turnRadians;
+    addTrigError(&sincosError, s - sin(angle) * TUNER_Q30_ONE);
+    addTrigError(&sincosError, c - cos(angle) * TUNER_Q30_ONE);
+
+    double exact = atan2((double)ys[i], (double)xs[i]);
+    addTrigError(&atan2Error,
+                 wrapRadians((int32_t)tuner_atan2(ys[i], xs[i]) * turnRadians -
+                             exact));
+    // relative, beyond the rounding to an integer of short lengths
+    double length = hypot((double)xs[i], (double)ys[i]);
+    double rounding = length > 0 ? fmax(0, 0.5 / length) : 0;
+    if (length > 0) {
+      addTrigError(&magnitudeError,
+                   fmax(0, fabs(tuner_magnitude(xs[i], ys[i]) - length) /
+                               length -
+                           rounding));
+    }
+
+    float sf, cf;
+    tuner_sincosf(radians[i], &sf, &cf);
+    addTrigError(&sincosfError, sf - sin((double)radians[i]));
+    addTrigError(&sincosfError, cf - cos((double)radians[i]));
+    addTrigError(&atan2fError,
+                 wrapRadians(tuner_atan2f(fys[i], fxs[i]) -
+                             atan2((double)fys[i], (double)fxs[i])));
+    length = hypot((double)fxs[i], (double)fys[i]);
+    addTrigError(&hypotfError,
+                 (tuner_hypotf(fxs[i], fys[i]) - length) / length);
+  }
+
+  // time per call, of the engine and of the libm calls it replaces
+  volatile float sink = 0;
+  double start, sincosNs, sincosfNs, libmSincosNs, atan2fNs, libmAtan2Ns;
+  double hypotfNs, libmSqrtNs, atan2Ns, magnitudeNs, libmAtan2dNs, libmHypotNs;
+  start = nowNanoseconds();
+  for (int i = 0; i < count; ++i) {
+    int32_t s, c;
+    tuner_sincos(angles[i], &s, &c);
+    sink += s + c;
+  }
+  sincosNs = (nowNanoseconds() - start) / count;
+  start = nowNanoseconds();
+  for (int i = 0; i < count; ++i) {
+    sink += (float)tuner_atan2(ys[i], xs[i]);
+  }
+  atan2Ns = (nowNanoseconds() - start) / count;
+  start = nowNanoseconds();
+  for (int i = 0; i < count; ++i) {
+    sink += (float)tuner_magnitude(xs[i], ys[i]);
+  }
+  magnitudeNs = (nowNanoseconds() - start) / count;
+  start = nowNanoseconds();
+  for (int i = 0; i < count; ++i) {
+    sink += (float)atan2((double)ys[i], (double)xs[i]);
+  }
+  libmAtan2dNs = (nowNanoseconds() - start) / count;
+  start = nowNanoseconds();
+  for (int i = 0; i < count; ++i) {
+    sink += (float)hypot((double)xs[i], (double)ys[i]);
+  }
+  libmHypotNs = (nowNanoseconds() - start) / count;
+  start = nowNanoseconds();
+  for (int i = 0; i < count; ++i) {
+    float s, c;
+    tuner_sincosf(radians[i], &s, &c);
+    sink += s + c;
+  }
+  sincosfNs = (nowNanoseconds() - start) / count;
+  start = nowNanoseconds();
+  for (int i = 0; i < count; ++i) {
+    sink += (float)(sin((double)radians[i]) + cos((double)radians[i]));
+  }
+  libmSincosNs = (nowNanoseconds() - start) / count;
+  start = nowNanoseconds();
+  for (int i = 0; i < count; ++i) {
+    sink += tuner_atan2f(fys[i], fxs[i]);
+  }
+  atan2fNs = (nowNanoseconds() - start) / count;
+  start = nowNanoseconds();
+  for (int i = 0; i < count; ++i) {
+    sink += atan2f(fys[i], fxs[i]);
+  }
+  libmAtan2Ns = (nowNanoseconds() - start) / count;
+  start = nowNanoseconds();
+  for (int i = 0; i < count; ++i) {
+    sink += tuner_hypotf(fxs[i], fys[i]);
+  }
+  hypotfNs = (nowNanoseconds() - start) / count;
+  start = nowNanoseconds();
+  for (int i = 0; i < count; ++i) {
+    sink += sqrtf(fxs[i] * fxs[i] + fys[i] * fys[i]);
+  }
+  libmSqrtNs = (nowNanoseconds() - start) / count;
+
+  // the float forms add a conversion in and one or two out
+  const double toTurn = NIOS_FLOAT_MUL_CYCLES + NIOS_INT_TO_FLOAT_CYCLES;
+  const double fromQ30 = NIOS_INT_TO_FLOAT_CYCLES + NIOS_FLOAT_MUL_CYCLES;
+  const double toComponents = 2 * toTurn;
+  printf("%d arguments against libm in doubles; Nios II cycles estimated\n\n",
+         count);
+  printf("%-16s %9s %9s %-4s %7s  %-12s %7s %9s %9s\n", "function", "worst",
+         "rms", "unit", "ns", "libm", "ns", "cycles", "libm");
+  printTrigRow("tuner_sincos", &sincosError, "LSB", sincosNs, "sin+cos",
+               libmSincosNs, niosCyclesSincos(), 2 * NIOS_TRIG_CYCLES);
+  printTrigRow("tuner_atan2", &atan2Error, "rad", atan2Ns, "atan2",
+               libmAtan2dNs, niosCyclesCordic(), NIOS_TRIG_CYCLES);
+  printTrigRow("tuner_magnitude", &magnitudeError, "rel", magnitudeNs,
+               "hypot", libmHypotNs, niosCyclesCordic() + NIOS_Q30_MUL_CYCLES,
+               NIOS_TRIG_CYCLES);
+  printTrigRow("tuner_sincosf", &sincosfError, "abs", sincosfNs, "sin+cos",
+               libmSincosNs, toTurn + niosCyclesSincos() + 2 * fromQ30,
+               2 * NIOS_TRIG_CYCLES);
+  printTrigRow("tuner_atan2f", &atan2fError, "rad", atan2fNs, "atan2f",
+               libmAtan2Ns, toComponents + niosCyclesCordic() + fromQ30,
+               NIOS_TRIG_CYCLES);
+  printTrigRow("tuner_hypotf", &hypotfError, "rel", hypotfNs, "sqrtf",
+               libmSqrtNs,
+               toComponents + niosCyclesCordic() + NIOS_Q30_MUL_CYCLES +
+                   fromQ30,
+               NIOS_SQRT_CYCLES + 2 * NIOS_FLOAT_MUL_CYCLES +
+                   NIOS_FLOAT_ADD_CYCLES);
+
+  // the bounds documented in tuner.h
+  bool pass = sincosError.worst <= 3 && atan2Error.worst <= 4e-8 &&
+              magnitudeError.worst <= 5e-8 && sincosfError.worst <= 4e-7 &&
+              atan2fError.worst <= 4e-7 && hypotfError.worst <= 1e-7;
+  printf("\n%s\n", pass ? "within the documented bounds"
+                         : "OUTSIDE the documented bounds");
+  free(angles);
+  free(xs);
+  free(ys);
+  free(radians);
+  free(fxs);
+  free(fys);
+  return pass ? 0 : 1;
+}
+
+/*****************************************************************************/
+/* LOG DECODER */
+/*****************************************************************************/
+
+#define LOG_HEADER_BYTES 32
+#define LOG_RECORD_BYTES 16
+
+int decodeLogCommand(int argc, char **argv) {
+  if (argc != 1) {
+    fprintf(stderr, "usage: tuner-host decode-log dump.bin\n");
+    return 2;
+  }
+  FILE *file = fopen(argv[0], "rb");
+  if (!file) {
+    fprintf(stderr, "cannot open %s\n", argv[0]);
+    return 1;
+  }
+  static unsigned char data[1 << 20];
+  size_t got = fread(data, 1, sizeof(data), file);
+  fclose(file);
+
+  if (got < LOG_HEADER_BYTES || readLittleEndian(data, 4) != LOG_MAGIC) {
+    fprintf(stderr, "%s is not a log ring dump\n", argv[0]);
+    return 1;
+  }
+  uint32_t version = readLittleEndian(data + 4, 4);
+  uint32_t size = readLittleEndian(data + 8, 4);
+  uint32_t ticksPerSecond = readLittleEndian(data + 12, 4);
+  uint32_t head = readLittleEndian(data + 16, 4);
+  uint32_t tail = readLittleEndian(data + 20, 4);
+  uint32_t dropped = readLittleEndian(data + 24, 4);
+  if (version != LOG_VERSION || size == 0 || ticksPerSecond == 0 ||
+      LOG_HEADER_BYTES + (size_t)size * LOG_RECORD_BYTES > got) {
+    fprintf(stderr, "%s: unsupported or truncated log (version %u)\n",
+            argv[0], version);
+    return 1;
+  }
+
+  printf("%u records written, %u flushed on the board, %u dropped\n", head,
+         tail, dropped);
+  uint32_t first = head > size ? head - size : 0;
+  uint32_t firstTimestamp = 0;
+  for (uint32_t i = first; i < head; ++i) {
+    const unsigned char *record =
+        data + LOG_HEADER_BYTES + (size_t)(i % size) * LOG_RECORD_BYTES;
+    uint32_t timestamp = readLittleEndian(record, 4);
+    unsigned int event = readLittleEndian(record + 4, 2);
+    int32_t arg0 = (int32_t)readLittleEndian(record + 8, 4);
+    int32_t arg1 = (int32_t)readLittleEndian(record + 12, 4);
+    if (i == first) {
+      firstTimestamp = timestamp;
+    }
+    char line[128];
+    formatLogEvent(event, arg0, arg1, line, sizeof(line));
+    printf("%6u %12.6f s %c %s\n", i,
+           (double)(uint32_t)(timestamp - firstTimestamp) / ticksPerSecond,
+           i < tail ? ' ' : '*', line);
+  }
+  printf("(* = not yet flushed on the board)\n");
+  return 0;
+}
+
+/*****************************************************************************/
+/* TELEMETRY */
+/*****************************************************************************/
+
+#define TELEMETRY_HEADER_BYTES 8
+#define TELEMETRY_ESTIMATE 1
+#define TELEMETRY_SPECTRUM 2
+#define TELEMETRY_RAW_BLOCK 3
+
+const char *spectrumEncodingNames[] = {"float", "int16", "delta"};
+
+// plays a capture of every string through estimatePitch() and the board's
+// telemetry path, writing the frames to stdout as the JTAG UART would
+int telemetrySendCommand(int argc, char **argv) {
+  bool raw = false;
+  for (int i = 0; i < argc; ++i) {
+    if (strcmp(argv[i], "--encoding") == 0 && i + 1 < argc) {
+      const char *name = argv[++i];
+      telemetryEncoding = 3;
+      for (unsigned int e = 0; e < 3; ++e) {
+        if (strcmp(name, spectrumEncodingNames[e]) == 0) {
+          telemetryEncoding = e;
+        }
+      }
+      if (telemetryEncoding == 3) {
+        fprintf(stderr, "unknown encoding %s\n", name);
+        return 2;
+      }
+    } else if (strcmp(argv[i], "--raw") == 0) {
+      raw = true;
+    } else {
+      fprintf(stderr,
+              "usage: tuner-host telemetry-send [--encoding float|int16|"
+              "delta] [--raw]\n");
+      return 2;
+    }
+  }
+
+  static int samples[HARNESS_MAX_SAMPLES];
+  hostSwitchRegisters[0] = raw ? 0b110 : 0b010;
+  for (int string = 0; string < 6; ++string) {
+    stringState = string;
+    expectedFrequencyForString = guitarStringFrequencies[string];
+    // a few cents sharp so the estimate and expected pitch differ
+    float f0 = expectedFrequencyForString * powf(2, 5 / CENTS_PER_OCTAVE);
+    synthesizeTone(samples, HARNESS_MAX_SAMPLES, TONE_KARPLUS_STRONG, f0,
+                   0.05f);
+    float estimate = estimatePitch(samples, analysisRe, analysisIm,
+                                   HARNESS_MAX_SAMPLES);
+    sendReadingTelemetry(samples, analysisRe, analysisIm, HARNESS_MAX_SAMPLES,
+                         estimate, expectedFrequencyForString);
+    serviceTelemetry();
+  }
+  fflush(stdout);
+  if (telemetryDropped > 0) {
+    fprintf(stderr, "%u frames dropped\n", telemetryDropped);
+  }
+  return 0;
+}
+
+float floatFromBits(uint32_t bits) {
+  union {
+    uint32_t u;
+    float f;
+  } value = {bits};
+  return value.f;
+}
+
+// reads a zigzag varint at *p, advancing it; false if it runs past end
+bool readVarint(const unsigned char **p, const unsigned char *end, int *out) {
+  uint32_t value = 0;
+  for (int shift = 0; *p < end && shift < 35; shift += 7) {
+    unsigned char byte = *(*p)++;
+    value |= (uint32_t)(byte & 0x7F) << shift;
+    if (!(byte & 0x80)) {
+      *out = (int)(value >> 1) ^ -(int)(value & 1);
+      return true;
+    }
+  }
+  return false;
+}
+
+struct telemetryCapture {
+  int id;
+  float expected;
+  int total;
+  int16_t *samples;
+};
+
+// writes a finished raw capture as s16le, named so accuracy --recordings
+// picks up the expected pitch
+void writeTelemetryCapture(const char *prefix, struct telemetryCapture *c) {
+  if (!c->samples) {
+    return;
+  }
+  char path[512];
+  snprintf(path, sizeof(path), "%s_capture%04d_%.3fhz.raw", prefix, c->id,
+           c->expected);
+  FILE *file = fopen(path, "wb");
+  if (file) {
+    for (int i = 0; i < c->total; ++i) {
+      unsigned char bytes[2] = {(unsigned char)(c->samples[i] & 0xFF),
+                                (unsigned char)((c->samples[i] >> 8) & 0xFF)};
+      fwrite(bytes, 1, 2, file);
+    }
+    fclose(file);
+  }
+  free(c->samples);
+  c->samples = NULL;
+}
+
+int decodeTelemetryCommand(int argc, char **argv) {
+  const char *prefix = "telemetry";
+  const char *input = "-";
+  for (int i = 0; i < argc; ++i) {
+    if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+      prefix = argv[++i];
+    } else if (argv[i][0] != '-' || strcmp(argv[i], "-") == 0) {
+      input = argv[i];
+    } else {
+      fprintf(stderr,
+              "usage: tuner-host decode-telemetry [-o prefix] [file|-]\n");
+      return 2;
+    }
+  }
+  FILE *file = strcmp(input, "-") == 0 ? stdin : fopen(input, "rb");
+  if (!file) {
+    fprintf(stderr, "cannot open %s\n", input);
+    return 1;
+  }
+  size_t capacity = 1 << 20, got = 0;
+  unsigned char *data = malloc(capacity);
+  size_t n;
+  while ((n = fread(data + got, 1, capacity - got, file)) > 0) {
+    got += n;
+    if (got == capacity) {
+      capacity *= 2;
+      data = realloc(data, capacity);
+    }
+  }
+  if (file != stdin) {
+    fclose(file);
+  }
+
+  char path[512];
+  snprintf(path, sizeof(path), "%s_estimates.csv", prefix);
+  FILE *estimates = fopen(path, "w");
+  snprintf(path, sizeof(path), "%s_spectra.csv", prefix);
+  FILE *spectra = fopen(path, "w");
+  if (!estimates || !spectra) {
+    fprintf(stderr, "cannot write %s_*.csv\n", prefix);
+    return 1;
+  }
+  fprintf(estimates, "capture,string,n,bin,estimate_hz,expected_hz,cents\n");
+  fprintf(spectra, "capture,encoding,bin,frequency_hz,magnitude\n");
+
+  long frames = 0, crcErrors = 0, skippedBytes = 0, sequenceGaps = 0;
+  int expectedSequence = -1;
+  struct telemetryCapture capture = {-1, 0, 0, NULL};
+  size_t at = 0;
+  while (at + TELEMETRY_HEADER_BYTES + 2 <= got) {
+    if (data[at] != 'T' || data[at + 1] != 'M') {
+      at++;
+      skippedBytes++;
+      continue;
+    }
+    const unsigned char *header = data + at;
+    unsigned int type = header[2], encoding = header[3];
+    unsigned int sequence = readLittleEndian(header + 4, 2);
+    unsigned int length = readLittleEndian(header + 6, 2);
+    if (at + TELEMETRY_HEADER_BYTES + length + 2 > got) {
+      break;  // truncated frame at the end of the stream
+    }
+    const unsigned char *payload = header + TELEMETRY_HEADER_BYTES;
+    unsigned short crc = crc16Update(0xFFFF, header + 2, 6 + length);
+    if (crc != readLittleEndian(payload + length, 2)) {
+      crcErrors++;  // resync from the next byte
+      at++;
+      skippedBytes++;
+      continue;
+    }
+    at += TELEMETRY_HEADER_BYTES + length + 2;
+    frames++;
+    if (expectedSequence >= 0 && sequence != (unsigned int)expectedSequence) {
+      sequenceGaps++;
+    }
+    expectedSequence = (sequence + 1) & 0xFFFF;
+
+    int id = (int)readLittleEndian(payload, 2);
+    if (type == TELEMETRY_ESTIMATE && length >= 20) {
+      int N = (int)readLittleEndian(payload + 4, 4);
+      float estimate = (int32_t)readLittleEndian(payload + 12, 4) / 1000.0f;
+      float expected = (int32_t)readLittleEndian(payload + 16, 4) / 1000.0f;
+      fprintf(estimates, "%d,%s,%d,%u,%.3f,%.3f,%.2f\n", id,
+              payload[2] < 6 ? guitarStringNames[payload[2]] : "?", N,
+              readLittleEndian(payload + 8, 4), estimate, expected,
+              estimate > 0 && expected > 0
+                  ? CENTS_PER_OCTAVE * log2(estimate / expected)
+                  : 0.0);
+      if (capture.id != id) {
+        writeTelemetryCapture(prefix, &capture);
+        capture.id = id;
+      }
+      capture.expected = expected;
+    } else if (type == TELEMETRY_SPECTRUM && length >= 24 && encoding < 3) {
+      int N = (int)readLittleEndian(payload + 4, 4);
+      int rate = (int)readLittleEndian(payload + 8, 4);
+      int firstBin = (int)readLittleEndian(payload + 12, 4);
+      int bins = (int)readLittleEndian(payload + 16, 4);
+      float scale = floatFromBits(readLittleEndian(payload + 20, 4));
+      const unsigned char *p = payload + 24, *end = payload + length;
+      int value = 0;
+      for (int k = 0; k < bins; ++k) {
+        float magnitude;
+        if (encoding == 0 && p + 4 <= end) {
+          magnitude = floatFromBits(readLittleEndian(p, 4));
+          p += 4;
+        } else if (encoding == 1 && p + 2 <= end) {
+          magnitude = readLittleEndian(p, 2) * scale;
+          p += 2;
+        } else {
+          int delta;
+          if (encoding != 2 || !readVarint(&p, end, &delta)) {
+            break;
+          }
+          value += delta;
+          magnitude = value * scale;
+        }
+        fprintf(spectra, "%d,%s,%d,%.3f,%g\n", id,
+                spectrumEncodingNames[encoding], firstBin + k,
+                (double)(firstBin + k) * rate / N, magnitude);
+      }
+    } else if (type == TELEMETRY_RAW_BLOCK && length >= 12) {
+      int offset = (int)readLittleEndian(payload + 4, 4);
+      int total = (int)readLittleEndian(payload + 8, 4);
+      int count = (length - 12) / 2;
+      if (capture.id != id || !capture.samples || capture.total != total) {
+        if (capture.id != id) {
+          writeTelemetryCapture(prefix, &capture);
+        }
+        capture.id = id;
+        capture.total = total;
+        free(capture.samples);
+        capture.samples = calloc(total, sizeof(int16_t));
+      }
+      for (int i = 0; i < count && offset + i < total; ++i) {
+        capture.samples[offset + i] =
+            (int16_t)readLittleEndian(payload + 12 + 2 * i, 2);
+      }
+    }
+  }
+  writeTelemetryCapture(prefix, &capture);
+  skippedBytes += got - at;
+  fclose(estimates);
+  fclose(spectra);
+  free(data);
+
+  printf("%ld frames, %ld CRC errors, %ld bytes skipped, %ld sequence gaps\n",
+         frames, crcErrors, skippedBytes, sequenceGaps);
+  return crcErrors > 0 || sequenceGaps > 0;
+}
+
+/*****************************************************************************/
+/* MAIN */
+/*****************************************************************************/
+
+void printUsage() {
+  fprintf(stderr,
+          "usage: tuner-host <command> [options]\n"
+          "  render [-o dir] [--compare dir]  render benchmark, frame dumps\n"
+          "  bench [options]                  FFT and pitch benchmark\n"
+          "  accuracy [options]               cents error vs configuration\n"
+          "  analyze [options] file|dir...    batch pitch analysis, all cores\n"
+          "  record-session -o file [options] synthetic session log\n"
+          "  replay [options] session.bin     replay a session log\n"
+          "  stream [options] < pcm           readings from s16le on stdin\n"
+          "  latency-sim [options]            KEY3-to-display timeline\n"
+          "  strum [options]                  polyphonic mode vs strums\n"
+          "  auto-string [options]            auto string selection check\n"
+          "  chromatic [options]              chromatic mode check\n"
+          "  gen-fft N [-o file.h]            fixed-size FFT kernel source\n"
+          "  trig [--count N]                 trig engine vs libm\n"
+          "  fft-sizes [--reps R] [N ...]     any-N FFT vs DFT, timing\n"
+          "  decode-log dump.bin              print a dumped log ring\n"
+          "  telemetry-send [options]         synthetic telemetry to stdout\n"
+          "  decode-telemetry [-o prefix] [file|-]  telemetry to CSV/raw\n");
+}
+
+int main(int argc, char **argv) {
+  if (argc < 2) {
+    printUsage();
+    return 2;
+  }
+  if (strcmp(argv[1], "render") == 0) {
+    return renderCommand(argc - 2, argv + 2);
+  }
+  if (strcmp(argv[1], "bench") == 0) {
+    return benchCommand(argc - 2, argv + 2);
+  }
+  if (strcmp(argv[1], "accuracy") == 0) {
+    return accuracyCommand(argc - 2, argv + 2);
+  }
+  if (strcmp(argv[1], "analyze") == 0) {
+    return analyzeCommand(argc - 2, argv + 2);
+  }
+  if (strcmp(argv[1], "record-session") == 0) {
+    return recordSessionCommand(argc - 2, argv + 2);
+  }
+  if (strcmp(argv[1], "replay") == 0) {
+    return replayCommand(argc - 2, argv + 2);
+  }
+  if (strcmp(argv[1], "stream") == 0) {
+    return streamCommand(argc - 2, argv + 2);
+  }
+  if (strcmp(argv[1], "latency-sim") == 0) {
+    return latencySimCommand(argc - 2, argv + 2);
+  }
+  if (strcmp(argv[1], "strum") == 0) {
+    return strumCommand(argc - 2, argv + 2);
+  }
+  if (strcmp(argv[1], "auto-string") == 0) {
+    return autoStringCommand(argc - 2, argv + 2);
+  }
+  if (strcmp(argv[1], "chromatic") == 0) {
+    return chromaticCommand(argc - 2, argv + 2);
+  }
+  if (strcmp(argv[1], "gen-fft") == 0) {
+    return genFFTCommand(argc - 2, argv + 2);
+  }
+  if (strcmp(argv[1], "fft-sizes") == 0) {
+    return fftSizesCommand(argc - 2, argv + 2);
+  }
+  if (strcmp(argv[1], "trig") == 0) {
+    return trigCommand(argc - 2, argv + 2);
+  }
+  if (strcmp(argv[1], "decode-log") == 0) {
+    return decodeLogCommand(argc - 2, argv + 2);
+  }
+  if (strcmp(argv[1], "telemetry-send") == 0) {
+    return telemetrySendCommand(argc - 2, argv + 2);
+  }
+  if (strcmp(argv[1], "decode-telemetry") == 0) {
+    return decodeTelemetryCommand(argc - 2, argv + 2);
+  }
+  printUsage();
+  return 2;
+}
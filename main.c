@@ -5,13 +5,64 @@
 #include <stdlib.h>
 #include <time.h>
 
+#include "main.h"
+#include "tuner.h"
+
+#ifdef HOST_BUILD
+// Host builds (see host.c) replace the memory-mapped devices with in-memory
+// stand-ins laid out like the real ones, so the drawing and analysis code runs
+// unchanged on Linux. Pixel and character writes are counted per frame
+extern unsigned long int hostKeyRegisters[4];
+extern int hostAudioRegisters[8];
+extern unsigned long int hostLedRegisters[1];
+extern unsigned long int hostSwitchRegisters[1];
+extern unsigned long int hostPixelControlRegisters[4];
+extern int hostControlRegisters[6];
+extern short hostPixelBuffer[];
+extern char hostCharacterBuffer[];
+extern unsigned long int hostPixelWrites;
+extern unsigned long int hostCharacterWrites;
+unsigned int hostTimerTicks();
+void hostDelayTicks(unsigned int ticks);
+int hostAudioRead(int offset);
+bool hostJtagTryPutChar(char c);
+
+#define KEYS_BASE hostKeyRegisters
+#define AUDIO_BASE hostAudioRegisters
+#define LED_BASE hostLedRegisters
+#define SWITCHES_BASE hostSwitchRegisters
+#define PIXEL_BUF_CTRL_BASE hostPixelControlRegisters
+#define PIXEL_BUF_BASE ((char *)hostPixelBuffer)
+#define CHAR_BUF_BASE ((char *)hostCharacterBuffer)
+#define __builtin_rdctl(reg) (hostControlRegisters[reg])
+#define __builtin_wrctl(reg, value) (hostControlRegisters[reg] = (value))
+#define COUNT_PIXEL_WRITE() (++hostPixelWrites)
+#define COUNT_CHARACTER_WRITE() (++hostCharacterWrites)
+#define READ_AUDIO(audio_ptr, offset) ((void)(audio_ptr), hostAudioRead(offset))
+// host analyze runs estimatePitch() on several threads at once
+#define ANALYSIS_THREAD_LOCAL _Thread_local
+#else
 #define KEYS_BASE 0xFF200050
 #define AUDIO_BASE 0xFF203040
 #define LED_BASE 0xFF200000
+#define SWITCHES_BASE 0xFF200040
+#define PIXEL_BUF_CTRL_BASE 0xFF203020
+#define TIMER_BASE 0xFF202000
+#define JTAG_UART_BASE 0xFF201000
+#define PIXEL_BUF_BASE 0x08000000
+#define CHAR_BUF_BASE 0x09000000
+#define COUNT_PIXEL_WRITE()
+#define COUNT_CHARACTER_WRITE()
+#define READ_AUDIO(audio_ptr, offset) (*((audio_ptr) + (offset)))
+#define ANALYSIS_THREAD_LOCAL
+#endif
 
 #define PI 3.141592653589
 #define NUMSAMPLES 16384
+#define SAMPLE_RATE 8000
 #define PADDING 5
+#define PITCH_LOW_HZ 50    // band searched for the strings
+#define PITCH_HIGH_HZ 380
 
 #define E4 329.63
 #define B3 246.94
@@ -28,53 +79,1149 @@ float expectedFrequencyForString = D3;
 bool areWeTuning = false;  // If true, exit empty while loop in main and record
                            // and do fourier transform
 
-enum GuitarString {
-  D_STRING,
-  A_STRING,
-  E_STRING,
-  G_STRING,
-  B_STRING,
-  HIGH_E_STRING
-};
-
 float guitarStringFrequencies[6] = {D3, A2, E2, G3, B3, E4};
+char *guitarStringNames[6] = {"D3", "A2", "E2", "G3", "B3", "E4"};
+
+// Tuning profile: how much of each string is analysed, in periods of its
+// frequency. The same number of periods gives every string about the same
+// precision in cents, so the higher strings need far shorter captures. The
+// hop spaces the readings of a window sliding over a stream
+struct stringProfile {
+  float periods;     // in a capture
+  float hopPeriods;  // between readings of a stream
+};
+struct stringProfile stringProfiles[6] = {
+    {160, 40}, {160, 40}, {160, 40}, {160, 40}, {160, 40}, {160, 40}};
 
 enum GuitarString stringState =
     D_STRING;  // Initialize string state to E_STRING
 
-// Forward declaration of guitar and triangle (arrow) image arrays
-extern const uint16_t guitar[162][85];
-extern const uint16_t triangle[15][15];
+// Forward declaration of guitar and triangle (arrow) image arrays
+extern const uint16_t guitar[162][85];
+extern const uint16_t triangle[15][15];
+
+// Forward declaration of functions (those the host tools call too are
+// declared in main.h)
+void setupKeys();
+void clearKeyEdgeCapture();
+void setupAudio();
+void setupProcessorForInterrupts();
+bool selectNearestString(float frequency);
+void showChromaticReading(float frequency);
+void drawChromaticNote();
+void write_pixel(int x, int y, short colour);
+void draw_vertical_line(int x, int higherYValue, int lowerYValue, short colour);
+void write_char(int x, int y, char c);
+void write_phrase(int x, int y, char *phrase);
+void drawBox(int x1, int x2, int y1, int y2, short colour);
+void wait_for_vsync();
+short scalePixelColour(int x, int y);
+
+// Forward declaration of needle animation functions
+void setNeedleTarget(int x, short colour);
+
+// A text widget owns a span of cells on one row of the character buffer and
+// remembers what it last wrote there, so an update only touches the cells that
+// the old and new messages cover instead of clearing all 80 x 60 cells.
+struct textWidget {
+  int x;         // anchor column: left edge, or centre column if centred
+  int y;         // row in [0,59]
+  bool centred;  // if true, messages are centred on x
+  int startX;    // first column currently occupied on screen
+  char text[81]; // message currently on screen
+};
+
+struct textWidget statusText = {40, 16, true, 0, ""};  // countdown, advice
+struct textWidget noteText = {40, 14, true, 0, ""};    // name of target note
+struct textWidget centsText = {40, 18, true, 0, ""};   // deviation in cents
+
+// Forward declaration of text layer functions
+void write_text_widget(struct textWidget *widget, char *phrase);
+void clear_text_widget(struct textWidget *widget);
+
+// Forward declaration of switch functions
+bool strobeModeSelected();
+bool telemetrySelected();
+bool rawTelemetrySelected();
+bool sessionSelected();
+bool latencySelected();
+bool polyphonicSelected();
+bool autoStringSelected();
+bool chromaticSelected();
+
+// Forward declaration of strobe functions
+void serviceStrobe();
+
+// Forward declaration of spectrum and waterfall functions
+void buildSpectrumColourMap();
+
+// Forward declaration of capture and pitch functions (the transform and peak
+// search are in tuner.c)
+extern float pitchLowHz;
+extern float pitchHighHz;
+float recordAndPrint();
+
+/*****************************************************************************/
+/* INTERVAL TIMER */
+/*****************************************************************************/
+// The interval timer runs free at 100 MHz and timestamps profiling scopes and
+// log records
+
+#define TIMER_TICKS_PER_SECOND 100000000
+
+// interval timer registers (16-bit halves)
+struct intervalTimerStruct {
+  volatile unsigned long int status;
+  volatile unsigned long int control;
+  volatile unsigned long int periodLow;
+  volatile unsigned long int periodHigh;
+  volatile unsigned long int snapshotLow;
+  volatile unsigned long int snapshotHigh;
+};
+
+#ifdef HOST_BUILD
+#define readTimerTicks() hostTimerTicks()
+#define setupIntervalTimer()
+#define delayTicks(ticks) hostDelayTicks(ticks)
+#else
+struct intervalTimerStruct *timerptr = (struct intervalTimerStruct *)TIMER_BASE;
+
+// runs the interval timer continuously over its full 32-bit period
+void setupIntervalTimer() {
+  timerptr->control = 0b1000;  // stop
+  timerptr->periodLow = 0xFFFF;
+  timerptr->periodHigh = 0xFFFF;
+  timerptr->control = 0b0110;  // start, continuous
+}
+
+// ticks since the timer started. The timer counts down, so it is inverted
+unsigned int readTimerTicks() {
+  timerptr->snapshotLow = 0;  // any write latches the counter
+  unsigned int counter =
+      (timerptr->snapshotHigh << 16) | (timerptr->snapshotLow & 0xFFFF);
+  return 0xFFFFFFFF - counter;
+}
+
+// busy-waits for the given number of ticks
+void delayTicks(unsigned int ticks) {
+  unsigned int start = readTimerTicks();
+  while (readTimerTicks() - start < ticks) {
+  }
+}
+#endif
+
+/*****************************************************************************/
+/* JTAG UART */
+/*****************************************************************************/
+// Direct writes to the JTAG UART, bypassing printf. On the host the UART is a
+// stream (stdout, or a pipe or socket chosen by host.c)
+
+// writes a byte if the write FIFO has room. Never waits
+bool jtagTryPutChar(char c) {
+#ifdef HOST_BUILD
+  return hostJtagTryPutChar(c);
+#else
+  volatile unsigned long int *jtag = (unsigned long int *)JTAG_UART_BASE;
+  if (*(jtag + 1) & 0xFFFF0000) {  // WSPACE: room in the write FIFO
+    *jtag = (unsigned char)c;
+    return true;
+  }
+  return false;
+#endif
+}
+
+// writes a character to the JTAG UART, giving up if the host is not reading
+void jtagPutChar(char c) {
+  for (int tries = 0; tries < 100000; ++tries) {
+    if (jtagTryPutChar(c)) {
+      return;
+    }
+  }
+}
+
+void jtagPutString(char *string) {
+  while (*string) {
+    jtagPutChar(*string++);
+  }
+}
+
+/*****************************************************************************/
+/* PROFILING */
+/*****************************************************************************/
+// Named timing scopes for the phases of a reading. Build with -DTUNER_PROFILE
+// to enable them; otherwise PROFILE_BEGIN/PROFILE_END expand to nothing and
+// none of the code below is compiled. Durations come from the interval timer
+// (one tick is one Nios II cycle at 100 MHz). Each
+// scope keeps min/max/mean over all samples, a log2 histogram, and a ring of
+// the latest samples for percentiles. KEY2 toggles an overlay with the table
+// on the character buffer and dumps it over the JTAG UART.
+
+enum ProfileScope {
+  PROFILE_COUNTDOWN,
+  PROFILE_CAPTURE,
+  PROFILE_CONVERT,
+  PROFILE_REARRANGE,
+  PROFILE_COMPUTE,
+  PROFILE_PEAK,
+  PROFILE_SPECTRUM,
+  PROFILE_REDRAW,
+  PROFILE_NEEDLE_FRAME,
+  PROFILE_STROBE_BLOCK,
+  NUM_PROFILE_SCOPES
+};
+
+#ifdef TUNER_PROFILE
+
+#define PROFILE_RING 64          // latest samples kept for percentiles
+#define PROFILE_OVERLAY_ROW 0    // clear of the latency panel (SW4) below
+#define PROFILE_TICKS_PER_US (TIMER_TICKS_PER_SECOND / 1000000)
+
+char *profileScopeNames[NUM_PROFILE_SCOPES] = {
+    "countdown", "capture", "convert", "rearrange", "compute",
+    "peak",      "spectrum", "redraw", "needle",    "strobe"};
+
+struct profileScopeStats {
+  unsigned int count;
+  unsigned int min;
+  unsigned int max;
+  unsigned long long total;
+  unsigned int histogram[32];  // bucket b counts durations in
+                               // [2^b, 2^(b+1)) us, bucket 0 those below 2
+  unsigned int recent[PROFILE_RING];
+};
+
+struct profileScopeStats profileStats[NUM_PROFILE_SCOPES];
+bool profileOverlayVisible = false;
+
+#define PROFILE_BEGIN(scope) \
+  unsigned int profileStart_##scope = readTimerTicks()
+#define PROFILE_END(scope) \
+  recordProfileSample(scope, readTimerTicks() - profileStart_##scope)
+
+void recordProfileSample(enum ProfileScope scope, unsigned int ticks) {
+  struct profileScopeStats *stats = &profileStats[scope];
+  if (stats->count == 0 || ticks < stats->min) {
+    stats->min = ticks;
+  }
+  if (ticks > stats->max) {
+    stats->max = ticks;
+  }
+  stats->total += ticks;
+  stats->recent[stats->count % PROFILE_RING] = ticks;
+  stats->count++;
+
+  unsigned int us = ticks / PROFILE_TICKS_PER_US;
+  int bucket = 0;
+  while ((us >> bucket) > 1 && bucket < 31) {
+    ++bucket;
+  }
+  stats->histogram[bucket]++;
+}
+
+// p-th percentile (0-100) of the samples in the ring
+unsigned int profilePercentile(struct profileScopeStats *stats, int p) {
+  unsigned int sorted[PROFILE_RING];
+  int n = stats->count < PROFILE_RING ? stats->count : PROFILE_RING;
+  for (int i = 0; i < n; ++i) {  // insertion sort, at most 64 samples
+    unsigned int value = stats->recent[i];
+    int j = i;
+    while (j > 0 && sorted[j - 1] > value) {
+      sorted[j] = sorted[j - 1];
+      --j;
+    }
+    sorted[j] = value;
+  }
+  return n ? sorted[(n - 1) * p / 100] : 0;
+}
+
+// one line of the report, times in microseconds
+void formatProfileLine(enum ProfileScope scope, char *line, int size) {
+  struct profileScopeStats *stats = &profileStats[scope];
+  unsigned int mean = stats->count ? stats->total / stats->count : 0;
+  snprintf(line, size, "%-9s %5u %9u %9u %9u %9u %9u",
+           profileScopeNames[scope], stats->count,
+           stats->min / PROFILE_TICKS_PER_US, mean / PROFILE_TICKS_PER_US,
+           profilePercentile(stats, 50) / PROFILE_TICKS_PER_US,
+           profilePercentile(stats, 90) / PROFILE_TICKS_PER_US,
+           stats->max / PROFILE_TICKS_PER_US);
+}
+
+char *profileHeader = "scope     count    min us   mean us    p50 us    p90 us"
+                      "    max us";
+
+struct textWidget profileOverlayLines[NUM_PROFILE_SCOPES + 1];
+
+// draws (or refreshes) the overlay on the top rows of the character buffer
+void drawProfileOverlay() {
+  char line[80];
+  for (int i = 0; i <= NUM_PROFILE_SCOPES; ++i) {
+    profileOverlayLines[i].x = 0;
+    profileOverlayLines[i].y = PROFILE_OVERLAY_ROW + i;
+    if (i == 0) {
+      write_text_widget(&profileOverlayLines[i], profileHeader);
+    } else {
+      formatProfileLine(i - 1, line, sizeof(line));
+      write_text_widget(&profileOverlayLines[i], line);
+    }
+  }
+}
+
+void clearProfileOverlay() {
+  for (int i = 0; i <= NUM_PROFILE_SCOPES; ++i) {
+    clear_text_widget(&profileOverlayLines[i]);
+  }
+}
+
+// dumps the report, including the histograms, over the JTAG UART
+void dumpProfileReport() {
+  char line[80];
+  jtagPutString(profileHeader);
+  jtagPutString("\n");
+  for (int scope = 0; scope < NUM_PROFILE_SCOPES; ++scope) {
+    formatProfileLine(scope, line, sizeof(line));
+    jtagPutString(line);
+    jtagPutString("\n  histogram (log2 us):");
+    for (int bucket = 0; bucket < 32; ++bucket) {
+      if (profileStats[scope].histogram[bucket]) {
+        snprintf(line, sizeof(line), " 2^%d:%u", bucket,
+                 profileStats[scope].histogram[bucket]);
+        jtagPutString(line);
+      }
+    }
+    jtagPutString("\n");
+  }
+}
+
+// KEY2: show or hide the overlay
+void toggleProfileOverlay() {
+  profileOverlayVisible = !profileOverlayVisible;
+  if (profileOverlayVisible) {
+    drawProfileOverlay();
+    dumpProfileReport();
+  } else {
+    clearProfileOverlay();
+  }
+}
+
+void refreshProfileOverlay() {
+  if (profileOverlayVisible) {
+    drawProfileOverlay();
+  }
+}
+
+#else
+#define PROFILE_BEGIN(scope)
+#define PROFILE_END(scope)
+#define toggleProfileOverlay()
+#define refreshProfileOverlay()
+#endif
+
+/*****************************************************************************/
+/* LOGGING */
+/*****************************************************************************/
+// printf() goes through the JTAG UART and can block for milliseconds, which
+// must not happen in the interrupt handler. Events are instead written to a
+// ring of fixed-size binary records (timestamp, event ID, two arguments) with
+// no formatting, and flushLog() formats them from the main loop when idle.
+// The ring has a fixed little-endian layout, so a memory dump of logRing can
+// be decoded on the host (tuner-host decode-log).
+
+#define LOG_RING_SIZE 64  // records, a power of two
+
+// how each event is formatted; each argument is divided by its scale first
+struct logEventInfo {
+  char *name;
+  char *format;
+  float scale[2];
+};
+
+struct logEventInfo logEventInfos[NUM_LOG_EVENTS] = {
+    {"boot", "tuner started", {1, 1}},
+    {"string", "expected frequency for string state: %.0f: %.3f Hz",
+     {1, 1000}},
+    {"reading", "frequency of String: %.3f Hz and expected frequency: %.3f Hz",
+     {1000, 1000}},
+    {"error", "Error: stringState %.0f is not one of the strings", {1, 1}},
+    {"strobe", "strobe mode %.0f", {1, 1}},
+};
+
+struct logRecord {
+  uint32_t timestamp;  // interval timer ticks
+  uint16_t event;
+  uint16_t reserved;
+  int32_t args[2];
+};
+
+struct logRingStruct {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t size;            // records in the ring
+  uint32_t ticksPerSecond;  // timestamp rate
+  volatile uint32_t head;   // records written so far
+  volatile uint32_t tail;   // records flushed so far
+  volatile uint32_t dropped;  // records lost because the ring was full
+  uint32_t reserved;
+  struct logRecord records[LOG_RING_SIZE];
+};
+
+struct logRingStruct logRing = {.magic = LOG_MAGIC,
+                                .version = LOG_VERSION,
+                                .size = LOG_RING_SIZE,
+                                .ticksPerSecond = TIMER_TICKS_PER_SECOND};
+
+// appends a record. Safe to call from the interrupt handler and the main loop:
+// interrupts are held off for the few stores it takes
+void logEvent(enum LogEvent event, int32_t arg0, int32_t arg1) {
+  int status = __builtin_rdctl(0);
+  __builtin_wrctl(0, status & ~0b1);  // clear PIE
+
+  uint32_t head = logRing.head;
+  if (head - logRing.tail >= LOG_RING_SIZE) {
+    logRing.dropped++;
+  } else {
+    struct logRecord *record = &logRing.records[head % LOG_RING_SIZE];
+    record->timestamp = readTimerTicks();
+    record->event = (uint16_t)event;
+    record->reserved = 0;
+    record->args[0] = arg0;
+    record->args[1] = arg1;
+    logRing.head = head + 1;
+  }
+
+  __builtin_wrctl(0, status);
+}
+
+// frequencies are logged in mHz
+int32_t toMillihertz(float frequency) { return (int32_t)(frequency * 1000); }
+
+// formats the text of an event into line (also used by the host decoder)
+void formatLogEvent(unsigned int event, int32_t arg0, int32_t arg1, char *line,
+                    int size) {
+  if (event >= NUM_LOG_EVENTS) {
+    snprintf(line, size, "unknown event %u (%ld, %ld)", event, (long)arg0,
+             (long)arg1);
+    return;
+  }
+  struct logEventInfo *info = &logEventInfos[event];
+  snprintf(line, size, info->format, arg0 / info->scale[0],
+           arg1 / info->scale[1]);
+}
+
+unsigned int logRingBytes() { return sizeof(logRing); }
+
+// prints up to maxRecords pending records. Called from the main loop only
+void flushLog(int maxRecords) {
+  char line[96];
+  if (logRing.dropped) {
+    printf("log: %lu records dropped\n", (unsigned long)logRing.dropped);
+    logRing.dropped = 0;
+  }
+  while (maxRecords-- > 0 && logRing.tail != logRing.head) {
+    struct logRecord *record = &logRing.records[logRing.tail % LOG_RING_SIZE];
+    formatLogEvent(record->event, record->args[0], record->args[1], line,
+                   sizeof(line));
+    printf("%s\n", line);
+    logRing.tail++;
+  }
+}
+
+/*****************************************************************************/
+/* TELEMETRY */
+/*****************************************************************************/
+// With SW1 on, every reading is streamed over the JTAG UART as binary frames:
+// the estimate and chosen bin, the 50-400 Hz magnitude spectrum and, with SW2
+// on, the raw capture as 16-bit samples. Frames are queued in a ring and the
+// main loop moves bytes into the UART only while its FIFO has room, so the
+// analysis never waits for the host. Frames that do not fit are dropped and
+// show up as gaps in the sequence numbers. tuner-host decode-telemetry turns
+// the stream back into files.
+//
+// Frame (little-endian):
+//   'T' 'M' | type u8 | encoding u8 | sequence u16 | length u16 |
+//   payload[length] | CRC-16/CCITT of type..payload u16
+
+#define TELEMETRY_SYNC0 'T'
+#define TELEMETRY_SYNC1 'M'
+#define TELEMETRY_HEADER_BYTES 8
+#define TELEMETRY_MAX_PAYLOAD 4096
+#define TELEMETRY_RING_SIZE 65536  // bytes, a power of two
+#define TELEMETRY_RAW_CHUNK 1024   // samples per raw frame
+#define TELEMETRY_LOW_HZ 50
+#define TELEMETRY_HIGH_HZ 400
+
+enum TelemetryType {
+  TELEMETRY_ESTIMATE = 1,   // capture u16, string u8, 0 u8, N u32, bin u32,
+                            // estimate mHz i32, expected mHz i32
+  TELEMETRY_SPECTRUM = 2,   // capture u16, 0 u16, N u32, sample rate u32,
+                            // first bin u32, bins u32, scale f32, data
+  TELEMETRY_RAW_BLOCK = 3,  // capture u16, 0 u16, offset u32, total u32,
+                            // samples i16[]
+};
+
+unsigned char telemetryRing[TELEMETRY_RING_SIZE];
+volatile unsigned int telemetryHead = 0;  // bytes queued, written by producer
+volatile unsigned int telemetryTail = 0;  // bytes sent, written by main loop
+unsigned int telemetryDropped = 0;        // frames that did not fit
+unsigned short telemetrySequence = 0;
+unsigned short telemetryCapture = 0;
+enum SpectrumEncoding telemetryEncoding = SPECTRUM_INT16_DELTA;
+unsigned char telemetryPayload[TELEMETRY_MAX_PAYLOAD];
+
+void putLE16(unsigned char *out, unsigned int value) {
+  out[0] = value & 0xFF;
+  out[1] = (value >> 8) & 0xFF;
+}
+
+void putLE32(unsigned char *out, uint32_t value) {
+  putLE16(out, value & 0xFFFF);
+  putLE16(out + 2, value >> 16);
+}
+
+unsigned short crc16Update(unsigned short crc, const unsigned char *data,
+                           int length) {
+  for (int i = 0; i < length; ++i) {
+    crc ^= (unsigned short)(data[i] << 8);
+    for (int bit = 0; bit < 8; ++bit) {
+      crc = (crc & 0x8000) ? (unsigned short)((crc << 1) ^ 0x1021)
+                           : (unsigned short)(crc << 1);
+    }
+  }
+  return crc;
+}
+
+void telemetryRingWrite(const unsigned char *data, int length) {
+  for (int i = 0; i < length; ++i) {
+    telemetryRing[(telemetryHead + i) & (TELEMETRY_RING_SIZE - 1)] = data[i];
+  }
+  telemetryHead += length;
+}
+
+// queues one frame, or drops it if the ring is too full
+void telemetrySend(enum TelemetryType type, int encoding,
+                   const unsigned char *payload, int length) {
+  int frameLength = TELEMETRY_HEADER_BYTES + length + 2;
+  unsigned short sequence = telemetrySequence++;
+  if (TELEMETRY_RING_SIZE - (telemetryHead - telemetryTail) <
+      (unsigned int)frameLength) {
+    telemetryDropped++;
+    return;
+  }
+
+  unsigned char header[TELEMETRY_HEADER_BYTES];
+  header[0] = TELEMETRY_SYNC0;
+  header[1] = TELEMETRY_SYNC1;
+  header[2] = (unsigned char)type;
+  header[3] = (unsigned char)encoding;
+  putLE16(header + 4, sequence);
+  putLE16(header + 6, length);
+  unsigned short crc = crc16Update(0xFFFF, header + 2, 6);
+  crc = crc16Update(crc, payload, length);
+  unsigned char trailer[2];
+  putLE16(trailer, crc);
+
+  telemetryRingWrite(header, TELEMETRY_HEADER_BYTES);
+  telemetryRingWrite(payload, length);
+  telemetryRingWrite(trailer, 2);
+}
+
+// zigzag varint of a signed difference, returns bytes written
+int putVarint(unsigned char *out, int value) {
+  unsigned int zigzag = (unsigned int)((value << 1) ^ (value >> 31));
+  int n = 0;
+  while (zigzag >= 0x80) {
+    out[n++] = (unsigned char)(zigzag | 0x80);
+    zigzag >>= 7;
+  }
+  out[n++] = (unsigned char)zigzag;
+  return n;
+}
+
+// queues the telemetry of one reading: estimate, band spectrum and (with SW2)
+// the raw samples. The spectrum must still be in data_re and data_im
+void sendReadingTelemetry(const int samples[], float data_re[],
+                          float data_im[], const int N, float estimate,
+                          float expected) {
+  unsigned char *p = telemetryPayload;
+  unsigned short capture = telemetryCapture++;
+  unsigned int bin = (unsigned int)(estimate * N / SAMPLE_RATE + 0.5f);
+
+  putLE16(p, capture);
+  p[2] = (unsigned char)stringState;
+  p[3] = 0;
+  putLE32(p + 4, N);
+  putLE32(p + 8, bin);
+  putLE32(p + 12, (uint32_t)toMillihertz(estimate));
+  putLE32(p + 16, (uint32_t)toMillihertz(expected));
+  telemetrySend(TELEMETRY_ESTIMATE, 0, p, 20);
+
+  // band-limited magnitude spectrum
+  int firstBin = TELEMETRY_LOW_HZ * N / SAMPLE_RATE;
+  int bins = TELEMETRY_HIGH_HZ * N / SAMPLE_RATE - firstBin;
+  int bytesPerBin = telemetryEncoding == SPECTRUM_FLOAT32 ? 4 : 2;
+  if (bins * bytesPerBin > TELEMETRY_MAX_PAYLOAD - 24) {
+    bins = (TELEMETRY_MAX_PAYLOAD - 24) / bytesPerBin;
+  }
+  float maxMagnitude = 0;
+  for (int k = 0; k < bins; ++k) {
+    float re = data_re[firstBin + k], im = data_im[firstBin + k];
+    float magnitude = sqrtf(re * re + im * im);
+    if (magnitude > maxMagnitude) {
+      maxMagnitude = magnitude;
+    }
+  }
+  float scale = maxMagnitude > 0 ? maxMagnitude / 65535 : 1;
+
+  putLE16(p, capture);
+  putLE16(p + 2, 0);
+  putLE32(p + 4, N);
+  putLE32(p + 8, SAMPLE_RATE);
+  putLE32(p + 12, firstBin);
+  putLE32(p + 16, bins);
+  union {
+    float f;
+    uint32_t u;
+  } scaleBits = {scale};
+  putLE32(p + 20, scaleBits.u);
+  int length = 24;
+  int previous = 0;
+  for (int k = 0; k < bins; ++k) {
+    float re = data_re[firstBin + k], im = data_im[firstBin + k];
+    float magnitude = sqrtf(re * re + im * im);
+    if (telemetryEncoding == SPECTRUM_FLOAT32) {
+      union {
+        float f;
+        uint32_t u;
+      } bits = {magnitude};
+      putLE32(p + length, bits.u);
+      length += 4;
+      continue;
+    }
+    int quantized = (int)(magnitude / scale + 0.5f);
+    if (telemetryEncoding == SPECTRUM_INT16) {
+      putLE16(p + length, quantized);
+      length += 2;
+    } else {
+      // a varint is at most 3 bytes for 17-bit differences
+      if (length + 3 > TELEMETRY_MAX_PAYLOAD) {
+        bins = k;
+        putLE32(p + 16, bins);
+        break;
+      }
+      length += putVarint(p + length, quantized - previous);
+      previous = quantized;
+    }
+  }
+  telemetrySend(TELEMETRY_SPECTRUM, telemetryEncoding, p, length);
+
+  if (!rawTelemetrySelected()) {
+    return;
+  }
+  for (int offset = 0; offset < N; offset += TELEMETRY_RAW_CHUNK) {
+    int count = N - offset < TELEMETRY_RAW_CHUNK ? N - offset
+                                                 : TELEMETRY_RAW_CHUNK;
+    putLE16(p, capture);
+    putLE16(p + 2, 0);
+    putLE32(p + 4, offset);
+    putLE32(p + 8, N);
+    for (int i = 0; i < count; ++i) {
+      // the audio core's 32-bit samples, top 16 bits
+      putLE16(p + 12 + 2 * i, (unsigned int)(samples[offset + i] >> 16));
+    }
+    telemetrySend(TELEMETRY_RAW_BLOCK, 0, p, 12 + 2 * count);
+  }
+}
+
+// moves queued bytes into the UART while it has room. Called from the main
+// loop; never waits
+void serviceTelemetry() {
+  while (telemetryTail != telemetryHead) {
+    char c = (char)telemetryRing[telemetryTail & (TELEMETRY_RING_SIZE - 1)];
+    if (!jtagTryPutChar(c)) {
+      return;
+    }
+    telemetryTail++;
+  }
+}
+
+/*****************************************************************************/
+/* SESSION LOG */
+/*****************************************************************************/
+// With SW3 on, every reading is appended to sessionLog: the string selected,
+// the captured samples as 16-bit values and the frequency shown. A memory
+// dump of the used part of sessionLog (sessionLogBytes()) is a session file
+// that tuner-host replay feeds back through the same analysis and drawing
+// code. Records are only written from the interrupt handler, so no locking
+// is needed. The index holds one entry per record so a reader can seek
+// straight to the n-th capture; when the index or data area is full further
+// records are dropped and counted.
+
+#define SESSION_MAGIC 0x53455354  // "TSES"
+#define SESSION_VERSION 1
+#define SESSION_INDEX_SIZE 1024          // records
+#define SESSION_DATA_BYTES (4 << 20)     // about 120 captures of 16384
+
+enum SessionRecordType {
+  SESSION_STRING = 1,   // expected frequency in mHz i32
+  SESSION_CAPTURE = 2,  // sample rate u32, N u32, samples i16[N]
+  SESSION_RESULT = 3,   // frequency shown in mHz i32, expected in mHz i32
+  SESSION_WINDOW = 4,   // tuner_window_type u32 of the capture that follows
+};
+
+struct sessionIndexEntry {
+  uint32_t offset;     // of the payload in data
+  uint32_t length;     // payload bytes
+  uint32_t timestamp;  // interval timer ticks
+  uint16_t type;
+  uint16_t string;     // string state when the record was written
+};
+
+struct sessionLogStruct {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t indexSize;       // entries in index
+  uint32_t ticksPerSecond;  // timestamp rate
+  uint32_t records;         // entries of index in use
+  uint32_t dataBytes;       // bytes of data in use
+  uint32_t captures;        // SESSION_CAPTURE records among them
+  uint32_t dropped;         // records that did not fit
+  struct sessionIndexEntry index[SESSION_INDEX_SIZE];
+  unsigned char data[SESSION_DATA_BYTES];
+};
+
+struct sessionLogStruct sessionLog = {.magic = SESSION_MAGIC,
+                                      .version = SESSION_VERSION,
+                                      .indexSize = SESSION_INDEX_SIZE,
+                                      .ticksPerSecond = TIMER_TICKS_PER_SECOND};
+
+// reserves a record and returns where its payload goes, or NULL if full
+unsigned char *appendSessionRecord(enum SessionRecordType type,
+                                   uint32_t length) {
+  uint32_t offset = sessionLog.dataBytes;
+  if (sessionLog.records >= SESSION_INDEX_SIZE ||
+      length > SESSION_DATA_BYTES - offset) {
+    sessionLog.dropped++;
+    return NULL;
+  }
+  struct sessionIndexEntry *entry = &sessionLog.index[sessionLog.records++];
+  entry->offset = offset;
+  entry->length = length;
+  entry->timestamp = readTimerTicks();
+  entry->type = (uint16_t)type;
+  entry->string = (uint16_t)stringState;
+  sessionLog.dataBytes = (offset + length + 3) & ~3u;  // keep payloads aligned
+  return sessionLog.data + offset;
+}
+
+void recordSessionString() {
+  if (!sessionSelected()) {
+    return;
+  }
+  int32_t *payload = (int32_t *)appendSessionRecord(SESSION_STRING, 4);
+  if (payload) {
+    payload[0] = toMillihertz(expectedFrequencyForString);
+  }
+}
+
+// keeps the top 16 bits of each sample, as the audio core delivers them
+void recordSessionCapture(const int samples[], const int N) {
+  if (!sessionSelected()) {
+    return;
+  }
+  uint32_t *window = (uint32_t *)appendSessionRecord(SESSION_WINDOW, 4);
+  if (window) {
+    window[0] = analysisWindowType;
+  }
+  uint32_t *payload =
+      (uint32_t *)appendSessionRecord(SESSION_CAPTURE, 8 + 2 * N);
+  if (!payload) {
+    return;
+  }
+  payload[0] = SAMPLE_RATE;
+  payload[1] = N;
+  int16_t *block = (int16_t *)(payload + 2);
+  for (int i = 0; i < N; ++i) {
+    block[i] = (int16_t)(samples[i] >> 16);
+  }
+  sessionLog.captures++;
+}
+
+void recordSessionResult(float frequency) {
+  if (!sessionSelected()) {
+    return;
+  }
+  int32_t *payload = (int32_t *)appendSessionRecord(SESSION_RESULT, 8);
+  if (payload) {
+    payload[0] = toMillihertz(frequency);
+    payload[1] = toMillihertz(expectedFrequencyForString);
+  }
+}
+
+// bytes of sessionLog to dump: header, index and the data in use
+unsigned int sessionLogBytes() {
+  return (unsigned int)((unsigned char *)sessionLog.data -
+                        (unsigned char *)&sessionLog) +
+         sessionLog.dataBytes;
+}
+
+/*****************************************************************************/
+/* LATENCY */
+/*****************************************************************************/
+// With SW4 on, each KEY3 reading is timestamped at the key interrupt, the
+// start and end of the capture, the end of the analysis and the last frame in
+// which the needle moved. The last LATENCY_HISTORY readings are kept and
+// shown on the bottom left rows: each stage's last, median and worst time and
+// a histogram of the total. host.c runs the same timeline on a simulated
+// clock (tuner-host latency-sim).
+
+#define LATENCY_HISTORY 32   // readings kept, a power of two
+#define LATENCY_BUCKETS 6    // histogram rows, the last one open-ended
+#define LATENCY_BUCKET_MS 250
+#define LATENCY_PANEL_ROW 48
+#define LATENCY_TICKS_PER_MS (TIMER_TICKS_PER_SECOND / 1000)
+
+enum LatencyMark {
+  LATENCY_KEY,            // KEY3 edge seen by the interrupt handler
+  LATENCY_CAPTURE_START,  // countdown over, first sample requested
+  LATENCY_CAPTURE_END,    // last sample read
+  LATENCY_ANALYSIS_END,   // estimate known, spectrum and scale drawn
+  LATENCY_DISPLAY_END,    // last needle frame that moved
+  NUM_LATENCY_MARKS
+};
+
+// stage i runs from mark i to mark i + 1; the last entry is the total
+char *latencyStageNames[NUM_LATENCY_MARKS] = {"countdwn", "capture", "analyse",
+                                              "display", "total"};
+
+struct latencyStruct {
+  unsigned int marks[NUM_LATENCY_MARKS];
+  bool pending;   // marks taken up to the analysis, display still moving
+  bool shown;     // the panel is on screen
+  unsigned int count;  // readings measured
+  unsigned int stages[LATENCY_HISTORY][NUM_LATENCY_MARKS];  // ticks
+};
+
+struct latencyStruct latency;
+struct textWidget latencyPanelLines[1 + NUM_LATENCY_MARKS + LATENCY_BUCKETS];
+
+void latencyMark(enum LatencyMark mark) {
+  if (!latencySelected()) {
+    return;
+  }
+  latency.marks[mark] = readTimerTicks();
+  if (mark == LATENCY_ANALYSIS_END) {
+    // the scale and note were drawn by the analysis; the needle may not move
+    latency.marks[LATENCY_DISPLAY_END] = latency.marks[mark];
+    latency.pending = true;
+  }
+}
+
+unsigned int latencyMedian(int stage) {
+  unsigned int sorted[LATENCY_HISTORY];
+  int n = latency.count < LATENCY_HISTORY ? latency.count : LATENCY_HISTORY;
+  for (int i = 0; i < n; ++i) {  // insertion sort, at most 32 readings
+    unsigned int value = latency.stages[i][stage];
+    int j = i;
+    while (j > 0 && sorted[j - 1] > value) {
+      sorted[j] = sorted[j - 1];
+      --j;
+    }
+    sorted[j] = value;
+  }
+  return n ? sorted[n / 2] : 0;
+}
+
+void drawLatencyPanel() {
+  char line[32];
+  int n = latency.count < LATENCY_HISTORY ? latency.count : LATENCY_HISTORY;
+  int row = 0;
+  snprintf(line, sizeof(line), "%-8s%6s%6s%6s", "ms", "last", "p50", "max");
+  write_text_widget(&latencyPanelLines[row++], line);
+
+  unsigned int last = (latency.count - 1) % LATENCY_HISTORY;
+  for (int stage = 0; stage < NUM_LATENCY_MARKS; ++stage) {
+    unsigned int worst = 0;
+    for (int i = 0; i < n; ++i) {
+      if (latency.stages[i][stage] > worst) {
+        worst = latency.stages[i][stage];
+      }
+    }
+    snprintf(line, sizeof(line), "%-8s%6u%6u%6u", latencyStageNames[stage],
+             n ? latency.stages[last][stage] / LATENCY_TICKS_PER_MS : 0,
+             latencyMedian(stage) / LATENCY_TICKS_PER_MS,
+             worst / LATENCY_TICKS_PER_MS);
+    write_text_widget(&latencyPanelLines[row++], line);
+  }
+
+  // histogram of the total, in buckets from just below the fastest reading
+  unsigned int fastest = 0xFFFFFFFF;
+  for (int i = 0; i < n; ++i) {
+    if (latency.stages[i][NUM_LATENCY_MARKS - 1] < fastest) {
+      fastest = latency.stages[i][NUM_LATENCY_MARKS - 1];
+    }
+  }
+  unsigned int bucketTicks = LATENCY_BUCKET_MS * LATENCY_TICKS_PER_MS;
+  unsigned int base = n ? fastest / bucketTicks * bucketTicks : 0;
+  for (unsigned int bucket = 0; bucket < LATENCY_BUCKETS; ++bucket) {
+    int hits = 0;
+    for (int i = 0; i < n; ++i) {
+      unsigned int b = (latency.stages[i][NUM_LATENCY_MARKS - 1] - base) /
+                       bucketTicks;
+      hits += b == bucket || (bucket == LATENCY_BUCKETS - 1 && b > bucket);
+    }
+    int length = snprintf(line, sizeof(line), "%5u%c ",
+                          (base + bucket * bucketTicks) / LATENCY_TICKS_PER_MS,
+                          bucket == LATENCY_BUCKETS - 1 ? '+' : ' ');
+    for (int i = 0; i < hits && length < 26; ++i) {
+      line[length++] = '#';
+    }
+    line[length] = '\0';
+    write_text_widget(&latencyPanelLines[row++], line);
+  }
+}
+
+void clearLatencyPanel() {
+  for (int row = 0; row < 1 + NUM_LATENCY_MARKS + LATENCY_BUCKETS; ++row) {
+    clear_text_widget(&latencyPanelLines[row]);
+  }
+}
+
+// called once per needle frame with whether the needle moved. Completes the
+// pending measurement once the needle has come to rest
+void latencyFrame(bool drew) {
+  if (!latency.pending) {
+    return;
+  }
+  if (drew) {
+    latency.marks[LATENCY_DISPLAY_END] = readTimerTicks();
+    return;
+  }
+  latency.pending = false;
+  unsigned int *stages = latency.stages[latency.count % LATENCY_HISTORY];
+  for (int stage = 0; stage < NUM_LATENCY_MARKS - 1; ++stage) {
+    stages[stage] = latency.marks[stage + 1] - latency.marks[stage];
+  }
+  stages[NUM_LATENCY_MARKS - 1] =
+      latency.marks[LATENCY_DISPLAY_END] - latency.marks[LATENCY_KEY];
+  latency.count++;
+  if (latency.shown) {
+    drawLatencyPanel();
+  }
+}
+
+// shows or hides the panel as SW4 changes. Called from the main loop
+void serviceLatencyPanel() {
+  if (latencySelected() == latency.shown) {
+    return;
+  }
+  latency.shown = !latency.shown;
+  latency.pending = false;
+  if (latency.shown) {
+    for (int row = 0; row < 1 + NUM_LATENCY_MARKS + LATENCY_BUCKETS; ++row) {
+      latencyPanelLines[row].x = 0;
+      latencyPanelLines[row].y = LATENCY_PANEL_ROW + row;
+    }
+    drawLatencyPanel();
+  } else {
+    clearLatencyPanel();
+  }
+}
+
+/*****************************************************************************/
+/* POLYPHONIC */
+/*****************************************************************************/
+// With SW5 on, KEY3 captures one strum of all six strings and each string is
+// searched for in its own band of the same transform (tuner_find_strings()).
+// The arrow is replaced by a box at every peg, coloured by how far that
+// string is out, and the cents of all six are listed on the cents row.
+
+#define STRUM_IN_TUNE_CENTS 5
+#define STRUM_CLOSE_CENTS 20
+
+struct tuner_string_result strum[6];
+bool strumShown = false;   // the boxes are on screen
+bool strumValid = false;   // strum[] holds a reading
+
+// top-left corner of the arrow at each string's peg, by enum GuitarString
+int pegX[6] = {96, 96, 96, 208, 208, 208};
+int pegY[6] = {98, 125, 151, 98, 125, 151};
+
+void analyseStrum() {
+  tuner_find_strings(analysisRe, analysisIm, NUMSAMPLES, SAMPLE_RATE,
+                     guitarStringFrequencies, 6, strum);
+  strumValid = true;
+  for (int string = 0; string < 6; ++string) {
+    logEvent(LOG_READING, toMillihertz(strum[string].frequency),
+             toMillihertz(guitarStringFrequencies[string]));
+  }
+}
+
+short strumColour(struct tuner_string_result *result) {
+  float cents = fabsf(result->cents);
+  if (!strumValid || result->frequency <= 0) {
+    return 0x4208;  // grey: not heard
+  } else if (cents < STRUM_IN_TUNE_CENTS) {
+    return 0x07E0;  // green
+  } else if (cents < STRUM_CLOSE_CENTS) {
+    return 0xFFE0;  // yellow
+  }
+  return 0xF800;    // red
+}
+
+// boxes at the pegs and the cents of every string, lowest string first
+void drawStrum() {
+  clearArrows();
+  for (int string = 0; string < 6; ++string) {
+    drawBox(pegX[string], pegX[string] + 15, pegY[string], pegY[string] + 15,
+            strumColour(&strum[string]));
+  }
+
+  char summary[81];
+  int length = 0;
+  const int lowToHigh[6] = {E_STRING, A_STRING, D_STRING,
+                            G_STRING, B_STRING, HIGH_E_STRING};
+  for (int i = 0; i < 6; ++i) {
+    struct tuner_string_result *result = &strum[lowToHigh[i]];
+    if (!strumValid || result->frequency <= 0) {
+      length += snprintf(summary + length, sizeof(summary) - length,
+                         "%s%s --", i ? "  " : "",
+                         guitarStringNames[lowToHigh[i]]);
+    } else {
+      length += snprintf(summary + length, sizeof(summary) - length,
+                         "%s%s %+d%s", i ? "  " : "",
+                         guitarStringNames[lowToHigh[i]],
+                         (int)lroundf(result->cents),
+                         result->harmonic ? "?" : "");
+    }
+  }
+  write_text_widget(&noteText, "All strings");
+  write_text_widget(&statusText, "Strum all strings, then KEY3");
+  write_text_widget(&centsText, summary);
+  strumShown = true;
+}
+
+// switches between the boxes and the arrow as SW5 changes. Called from the
+// main loop
+void servicePolyphonicMode() {
+  if (polyphonicSelected() == strumShown) {
+    return;
+  }
+  if (polyphonicSelected()) {
+    drawStrum();
+  } else {
+    strumShown = false;
+    clear_text_widget(&statusText);
+    clear_text_widget(&centsText);
+    selectString(stringState);
+  }
+}
+
+/*****************************************************************************/
+/* AUTO STRING */
+/*****************************************************************************/
+// With SW6 on, each KEY3 reading selects the string nearest to it before it
+// is shown, so the arrow and the scale follow whichever string was played.
+// KEY0 and KEY1 still move the arrow until the next reading.
+
+struct tuner_classifier stringClassifier;
+bool stringClassifierReady = false;
+
+// selects the string nearest frequency. Returns false if there is no pitch,
+// leaving the string as it was
+bool selectNearestString(float frequency) {
+  if (!stringClassifierReady) {
+    stringClassifierReady =
+        tuner_classifier_init(&stringClassifier, guitarStringFrequencies, 6);
+  }
+  int string = tuner_classify(&stringClassifier, frequency);
+  if (string < 0) {
+    return false;
+  }
+  selectString(string);
+  return true;
+}
+
+/*****************************************************************************/
+/* CHROMATIC */
+/*****************************************************************************/
+// With SW7 on, each KEY3 reading is shown against the nearest equal-tempered
+// note from A0 to C6 rather than a string: the note name replaces the string
+// name and arrow, and the band searched for the pitch is widened to match.
+// Finding the note and its cents goes through tables (tuner_classify() and
+// tuner_pitch_millicents()), so there is no log2f per reading.
+
+#define CHROMATIC_NOTES 64        // A0 up to C6
+#define CHROMATIC_LOWEST_HZ 27.5f  // A0
+
+float chromaticFrequencies[CHROMATIC_NOTES];
+struct tuner_classifier chromaticClassifier;
+bool chromaticReady = false;
+bool chromaticShown = false;  // the note name is on screen
+int chromaticNote = -1;       // nearest the latest reading, -1 if none
+
+char *chromaticNames[12] = {"C",  "C#", "D",  "D#", "E",  "F",
+                            "F#", "G",  "G#", "A",  "A#", "B"};
+
+void setupChromatic() {
+  if (chromaticReady) {
+    return;
+  }
+  for (int note = 0; note < CHROMATIC_NOTES; ++note) {
+    chromaticFrequencies[note] =
+        CHROMATIC_LOWEST_HZ * powf(2, note / 12.0f);
+  }
+  chromaticReady = tuner_classifier_init(&chromaticClassifier,
+                                         chromaticFrequencies, CHROMATIC_NOTES);
+}
+
+// shows a reading against the note nearest to it
+void showChromaticReading(float frequency) {
+  setupChromatic();
+  chromaticNote = tuner_classify(&chromaticClassifier, frequency);
+  if (chromaticNote >= 0) {
+    expectedFrequencyForString = chromaticFrequencies[chromaticNote];
+  }
+  showReading(frequency);
+}
 
-// Forward declaration of functions
-void setupKeys();
-void clearKeyEdgeCapture();
-void setupAudio();
-void setupProcessorForInterrupts();
-void interrupt_handler();
-void write_pixel(int x, int y, short colour);
-void draw_vertical_line(int x, int higherYValue, int lowerYValue, short colour);
-void clear_screen();
-void write_char(int x, int y, char c);
-void write_phrase(int x, int y, char *phrase);
-void drawGuitar();
-void drawScale();
-void drawArrow();
-void drawNoteOnScale(float frequencyRecorded, float expectedFrequency);
-void clear_character_buffer();
-void drawBox(int x1, int x2, int y1, int y2, short colour);
-void clearArrows();
+// writes the note of the latest reading where the string name goes
+void drawChromaticNote() {
+  char name[16] = "--";
+  if (chromaticNote >= 0) {
+    int fromC = chromaticNote + 9;  // A0 is 9 semitones above C0
+    snprintf(name, sizeof(name), "%s%d", chromaticNames[fromC % 12],
+             fromC / 12);
+  }
+  clearArrows();
+  write_text_widget(&noteText, name);
+  chromaticShown = true;
+}
 
-// Forward declaration of Fourier Transform functions
-void rearrange(float data_re[], float data_im[], const int N);
-void compute(float data_re[], float data_im[], const int N);
-void fft(float data_re[], float data_im[], const int N);
-int recordAndPrint();
+// follows SW7: widens the pitch band and swaps the string for the note
+void serviceChromaticMode() {
+  bool chromatic = chromaticSelected() && !polyphonicSelected();
+  if (chromatic == chromaticShown) {
+    return;
+  }
+  if (chromatic) {
+    setupChromatic();
+    // half a semitone beyond the lowest and highest notes
+    pitchLowHz = chromaticFrequencies[0] * 0.97f;
+    pitchHighHz = chromaticFrequencies[CHROMATIC_NOTES - 1] * 1.03f;
+    drawChromaticNote();
+  } else {
+    pitchLowHz = PITCH_LOW_HZ;
+    pitchHighHz = PITCH_HIGH_HZ;
+    chromaticShown = false;
+    selectString(stringState);
+  }
+}
 
 /*****************************************************************************/
 /* MAIN */
 /*****************************************************************************/
 
+// the host build (host.c) has its own main() and drives the same code
+#ifndef HOST_BUILD
 int main(void) {
   /******************** SET UP ********************/
   setupKeys();  // clears edge capture register and enables interrupts from all
@@ -83,16 +1230,38 @@ int main(void) {
   setupAudio();  // clears input and output FIFOs for both channels
   setupProcessorForInterrupts();  // enables the processor to be interrupted and
                                   // enables buttons to interrupt
-  clear_screen();
-  clear_character_buffer();
-
-  drawGuitar();
-
-  drawScale();
-  drawArrow();
+  setupIntervalTimer();
+  logEvent(LOG_BOOT, 0, 0);
+  drawInitialScreen();
 
+  bool strobing = false;
   while (/*!areWeTuning*/1) {
     // LEDptr->onoff = *((volatile unsigned long int*) (0xFF200040));
+    serviceTelemetry();
+
+    // SW0 switches between the strobe and the needle
+    if (strobeModeSelected() != strobing) {
+      strobing = !strobing;
+      logEvent(LOG_STROBE_TOGGLED, strobing, 0);
+      if (strobing) {
+        eraseNeedle();
+        resetStrobe(expectedFrequencyForString);
+        setupAudio();
+      } else {
+        eraseStrobe();
+      }
+    }
+
+    serviceLatencyPanel();
+    servicePolyphonicMode();
+    serviceChromaticMode();
+    if (strobing) {
+      // no vsync wait here: the audio FIFO only holds 16 ms of samples
+      serviceStrobe();
+      flushLog(1);  // the FIFO has just been drained
+    } else {
+      needleFrame();
+    }
   }
 
   // exit from while loop to here if we are tuning by pressing pushbutton 3
@@ -121,6 +1290,21 @@ int main(void) {
 
   return 0;
 }
+#endif
+
+// draws everything shown before the first reading
+void drawInitialScreen() {
+  clear_screen();
+  clear_character_buffer();
+
+  drawGuitar();
+
+  drawScale();
+  drawArrow();
+  buildSpectrumColourMap();
+  drawSpectrumPanels();
+  write_text_widget(&noteText, guitarStringNames[stringState]);
+}
 
 /*****************************************************************************/
 /* PUSHBUTTONS */
@@ -189,6 +1373,45 @@ struct LEDstruct {
 
 struct LEDstruct *LEDptr = (struct LEDstruct *)LED_BASE;
 
+/*****************************************************************************/
+/* SWITCHES */
+/*****************************************************************************/
+
+struct switchStruct {
+  volatile unsigned long int data;
+};
+
+struct switchStruct *switchptr = (struct switchStruct *)SWITCHES_BASE;
+
+// SW0 selects the strobe display
+bool strobeModeSelected() { return switchptr->data & 0b1; }
+
+// SW1 streams telemetry over the JTAG UART, SW2 adds the raw captured samples
+bool telemetrySelected() { return switchptr->data & 0b10; }
+bool rawTelemetrySelected() {
+  return telemetrySelected() && (switchptr->data & 0b100);
+}
+
+// SW3 records the session (strings, captures, readings) to sessionLog
+bool sessionSelected() { return switchptr->data & 0b1000; }
+
+// SW4 measures KEY3-to-display latency and shows it on screen
+bool latencySelected() { return switchptr->data & 0b10000; }
+
+// SW5 tunes all six strings from one strum
+bool polyphonicSelected() { return switchptr->data & 0b100000; }
+
+// SW6 picks the string from each reading instead of KEY0 and KEY1
+bool autoStringSelected() { return switchptr->data & 0b1000000; }
+
+// SW7 tunes to the nearest note from A0 to C6 instead of a string
+bool chromaticSelected() { return switchptr->data & 0b10000000; }
+
+// SW8 and SW9 pick the window of each capture, as a tuner_window_type: none,
+// Hann, Blackman-Harris or Kaiser
+int windowSelected() { return (switchptr->data >> 8) & 0b11; }
+
+
 /*****************************************************************************/
 /* Macros for accessing the control registers. */
 /*****************************************************************************/
@@ -249,6 +1472,7 @@ processing. This code should not be modified; instead, the C
 language code in the function interrupt_handler() can be
 modified as needed for a given application.
 */
+#ifndef HOST_BUILD
 void the_exception() __attribute__((section(".exceptions")));
 void the_exception() {
   asm(".set noat");     // Magic, for the C compiler
@@ -328,6 +1552,7 @@ void the_exception() {
   asm("addi sp, sp, 128");
   asm("eret");
 }
+#endif
 
 /*****************************************************************************/
 /* INTERRUPT HANDLER */
@@ -335,6 +1560,7 @@ void the_exception() {
 
 void interrupt_handler() {
   if (__builtin_rdctl(4) == 0b10) {
+    bool selected = false;  // the string and arrow are already drawn
     // if (LEDptr->onoff == 0b1111111111) {
     //   LEDptr->onoff = 0;
     //   clearKeyEdgeCapture();
@@ -357,31 +1583,79 @@ void interrupt_handler() {
       } else {
         stringState--;
       }
-    } else if (buttonptr->edgeCapture & 0b1000) {
+    } else if (buttonptr->edgeCapture & 0b100) {
+      toggleProfileOverlay();  // timing overlay, profiling builds only
+    } else if ((buttonptr->edgeCapture & 0b1000) && !strobeModeSelected()) {
       // areWeTuning = !areWeTuning;
       // printf("areWeTuning = %d\n", areWeTuning);
-      
-      frequencyOfString = recordAndPrint();
-      //clear previous scale
-      drawBox(49, 269, 10, 50, 0x0);
-      drawScale();
-      drawNoteOnScale(frequencyOfString, expectedFrequencyForString);
-      printf("frequency of String: %f and expected frequency: %f\n", frequencyOfString, expectedFrequencyForString);
+      latencyMark(LATENCY_KEY);
+      analysisWindowType = windowSelected();
+      if (polyphonicSelected()) {
+        recordAndPrint();
+        analyseStrum();
+      } else if (chromaticSelected()) {
+        frequencyOfString = recordAndPrint();
+        showChromaticReading(frequencyOfString);
+      } else {
+        frequencyOfString = recordAndPrint();
+        if (autoStringSelected()) {
+          selected = selectNearestString(frequencyOfString);
+        }
+        showReading(frequencyOfString);
+      }
     }
 
-    // assign expectedFrequencyForString the frequency expected for string
-    // selected via pushbuttons 0 and 1
-    expectedFrequencyForString = guitarStringFrequencies[stringState];
-
-    printf("expected frequency for string state: %d: %f\n", stringState,
-           expectedFrequencyForString);
-    clearArrows();
-    drawArrow();
+    if (chromaticSelected() && !polyphonicSelected()) {
+      drawChromaticNote();  // the note stands in for the string and arrow
+    } else if (!selected) {
+      selectString(stringState);
+    }
+    if (polyphonicSelected()) {
+      drawStrum();  // over the arrow
+    }
 
     clearKeyEdgeCapture();
   }
 }
 
+// the string selectString() last made the target, -1 before the first. Every
+// key press redraws the arrow through selectString(), so only a change of it
+// is logged and recorded in the session (whose index gives every record's
+// string anyway)
+int selectedString = -1;
+
+// makes string the target: expected frequency, note name and arrow. Replayed
+// sessions come through here too
+void selectString(unsigned int string) {
+  stringState = string;
+  // assign expectedFrequencyForString the frequency expected for string
+  // selected via pushbuttons 0 and 1
+  expectedFrequencyForString = guitarStringFrequencies[stringState];
+  write_text_widget(&noteText, guitarStringNames[stringState]);
+
+  if ((int)string != selectedString) {
+    logEvent(LOG_STRING_SELECTED, stringState,
+             toMillihertz(expectedFrequencyForString));
+    recordSessionString();
+    selectedString = string;
+  }
+  clearArrows();
+  drawArrow();
+}
+
+// shows a reading against the selected string. Replayed sessions come through
+// here too
+void showReading(float frequency) {
+  // the needle erases itself as it moves, so the scale is not redrawn
+  PROFILE_BEGIN(PROFILE_REDRAW);
+  drawNoteOnScale(frequency, expectedFrequencyForString);
+  PROFILE_END(PROFILE_REDRAW);
+  refreshProfileOverlay();
+  logEvent(LOG_READING, toMillihertz(frequency),
+           toMillihertz(expectedFrequencyForString));
+  recordSessionResult(frequency);
+}
+
 /*****************************************************************************/
 /* VGA */
 /*****************************************************************************/
@@ -390,8 +1664,9 @@ void interrupt_handler() {
  */
 void write_pixel(int x, int y, short colour) {
   volatile short *vga_addr =
-      (volatile short *)(0x08000000 + (y << 10) + (x << 1));
+      (volatile short *)(PIXEL_BUF_BASE + (y << 10) + (x << 1));
   *vga_addr = colour;
+  COUNT_PIXEL_WRITE();
 }
 
 void draw_vertical_line(int x, int higherYValue, int lowerYValue,
@@ -404,6 +1679,24 @@ void draw_vertical_line(int x, int higherYValue, int lowerYValue,
   };
 }
 
+struct pixelBufferControllerStruct {
+  volatile unsigned long int buffer;      // writing 1 requests a buffer swap
+  volatile unsigned long int backBuffer;
+  volatile unsigned long int resolution;
+  volatile unsigned long int status;      // bit 0 stays 1 until the next vsync
+};
+
+struct pixelBufferControllerStruct *pixelctrlptr =
+    (struct pixelBufferControllerStruct *)PIXEL_BUF_CTRL_BASE;
+
+// blocks until the start of the next frame. The front and back buffers are
+// the same, so the swap request is only used to wait for vertical sync
+void wait_for_vsync() {
+  pixelctrlptr->buffer = 1;
+  while (pixelctrlptr->status & 0b1) {
+  }
+}
+
 /* use write_pixel to set entire screen to black (does not clear the character
  * buffer) */
 void clear_screen() {
@@ -420,15 +1713,18 @@ void clear_screen() {
  */
 void write_char(int x, int y, char c) {
   // VGA character buffer
-  volatile char *character_buffer = (char *)(0x09000000 + (y << 7) + x);
+  volatile char *character_buffer = (char *)(CHAR_BUF_BASE + (y << 7) + x);
   *character_buffer = c;
+  COUNT_CHARACTER_WRITE();
 }
 
 void clear_character_buffer() {
   for (int x = 0; x < 80; ++x) {
     for (int y = 0; y < 60; ++y) {
-      volatile char *character_buffer = (char *)(0x09000000 + (y << 7) + x);
+      volatile char *character_buffer =
+          (char *)(CHAR_BUF_BASE + (y << 7) + x);
       *character_buffer = 0;
+      COUNT_CHARACTER_WRITE();
     }
   }
 }
@@ -441,6 +1737,61 @@ void write_phrase(int x, int y, char *phrase) {
   }
 }
 
+/*****************************************************************************/
+/* TEXT LAYER */
+/*****************************************************************************/
+
+// replaces the message shown by a widget. Cells that already hold the right
+// character are skipped, and only cells left over from the old message are
+// blanked
+void write_text_widget(struct textWidget *widget, char *phrase) {
+  int length = 0;
+  while (phrase[length] && length < 80) {
+    ++length;
+  }
+
+  int newStartX = widget->centred ? widget->x - length / 2 : widget->x;
+  if (newStartX < 0) {
+    newStartX = 0;
+  }
+  if (newStartX + length > 80) {
+    length = 80 - newStartX;
+  }
+  int newEndX = newStartX + length;
+
+  int oldStartX = widget->startX;
+  int oldEndX = oldStartX;
+  while (widget->text[oldEndX - oldStartX]) {
+    ++oldEndX;
+  }
+
+  // blank cells covered by the old message but not by the new one
+  for (int x = oldStartX; x < oldEndX; ++x) {
+    if (x < newStartX || x >= newEndX) {
+      write_char(x, widget->y, 0);
+    }
+  }
+
+  // write the new message, skipping cells that already show the same character
+  for (int x = newStartX; x < newEndX; ++x) {
+    char c = phrase[x - newStartX];
+    if (x < oldStartX || x >= oldEndX || widget->text[x - oldStartX] != c) {
+      write_char(x, widget->y, c);
+    }
+  }
+
+  for (int i = 0; i < length; ++i) {
+    widget->text[i] = phrase[i];
+  }
+  widget->text[length] = 0;
+  widget->startX = newStartX;
+}
+
+// blanks only the cells occupied by the widget's current message
+void clear_text_widget(struct textWidget *widget) {
+  write_text_widget(widget, "");
+}
+
 void drawGuitar() {
   for (int x = 0; x < 85; ++x) {
     for (int y = 0; y < 162; ++y) {
@@ -466,6 +1817,20 @@ void drawScale() {
   }
 }
 
+// colour of the scale at x,y without any needle drawn over it. Matches what
+// drawScale() draws, so a needle column can be restored without redrawing
+// the whole scale
+short scalePixelColour(int x, int y) {
+  if (x < 49 || x > 269 || (x - 49) % 10 != 0) {
+    return 0x0;
+  }
+  int lineNumber = (x - 49) / 10;
+  if (lineNumber == 0 || lineNumber == 11 || lineNumber == 22) {
+    return (y >= 10 && y < 50) ? 0xFFFF : 0x0;
+  }
+  return (y >= 25 && y < 35) ? 0xFFFF : 0x0;
+}
+
 void drawBox(int x1, int x2, int y1, int y2, short colour) {
   for (int x = x1; x < x2; ++x) {
     for (int y = y1; y < y2; ++y) {
@@ -538,220 +1903,724 @@ void drawArrow() {
   }
 
   else {
-    printf("Error: stringState is not one of the strings");
+    logEvent(LOG_BAD_STRING_STATE, stringState, 0);
   }
 }
 
+// where the needle falls for a reading, in cents from the target. The scale
+// has a line every centsPerLine cents, 11 either side of the target
+struct centsScaleStruct {
+  int goodCents;     // "Good!" within this many cents
+  int greenCents;    // green needle within this many
+  int yellowCents;   // yellow within this many, red beyond
+  int centsPerLine;  // cents between the lines of the scale, 10 pixels apart
+};
+
+struct centsScaleStruct centsScale = {3, 5, 20, 5};
+
 // draws a line on the scale that represents the frequency of the note recorded
 void drawNoteOnScale(float frequencyRecorded, float expectedFrequency) {
-  int difference_in_frequency = (int)(frequencyRecorded - expectedFrequency);
+  // cents from the log2 table in tuner.c; no log2f here
+  const int32_t fullScale = 11 * centsScale.centsPerLine * 1000;
+  if (frequencyRecorded <= 0 || expectedFrequency <= 0) {
+    // nothing to tune by: no advice, and a grey needle parked at the left
+    // end of the scale (x = 49)
+    clear_text_widget(&statusText);
+    write_text_widget(&centsText, "no pitch");
+    setNeedleTarget(49, 0x8410);  // hex for grey
+    return;
+  }
+  int32_t millicents = tuner_pitch_millicents(frequencyRecorded) -
+                       tuner_pitch_millicents(expectedFrequency);
+  int cents = (millicents + (millicents < 0 ? -500 : 500)) / 1000;
+  int absCents = abs(cents);
   int colour = 0xF81F;  // initialized as purple for debugging
-  int sign = (difference_in_frequency < 0) ? -1 : 1;
+  char *tuningInstructions = (cents > 0) ? "Tune down" : "Tune up";
 
-  int absDifference = abs(difference_in_frequency);
-  char *tuningInstructions;
-
-  // if difference within 16 Hz, line drawn on scale is green
-  if (absDifference < 16) {
+  if (absCents <= centsScale.greenCents) {
     colour = 0x07E0;  // hexadecimal for green
-
-    // if difference is less than 8 Hz, then difference is barely perceptible
-    if (absDifference < 8) {
-      // print "Good!"
-      clear_character_buffer();
+    // close enough not to hear the difference: no direction to tune
+    if (absCents <= centsScale.goodCents) {
       tuningInstructions = "Good!";
-      write_phrase(38, 16, tuningInstructions);
     }
-    // if difference is greater than 8 Hz, but less than 16 Hz, tell which
-    // direction to tune
-    else {
-      // print tune in whatever direction
-      if (sign > 0) {
-        clear_character_buffer();
-        tuningInstructions = "Tune down";
-        write_phrase(36, 16, tuningInstructions);
-      } else {
-        clear_character_buffer();
-        tuningInstructions = "Tune up";
-        write_phrase(37, 16, tuningInstructions);
+  } else if (absCents <= centsScale.yellowCents) {
+    colour = 0xFFC0;  // hex for yellow
+  } else {
+    colour = 0xF800;  // hex for red
+  }
+
+  write_text_widget(&statusText, tuningInstructions);
+
+  // cents readout, e.g. "+12 cents"
+  char centsPhrase[16];
+  snprintf(centsPhrase, sizeof(centsPhrase), "%+d cents", cents);
+  write_text_widget(&centsText, centsPhrase);
+
+  // clamped to the ends of the scale, 110 pixels either side
+  if (millicents > fullScale) {
+    millicents = fullScale;
+  } else if (millicents < -fullScale) {
+    millicents = -fullScale;
+  }
+  setNeedleTarget(159 + millicents * 10 / (centsScale.centsPerLine * 1000),
+                  colour);  // x = 159 is the middle of the scale
+}
+
+/*****************************************************************************/
+/* NEEDLE */
+/*****************************************************************************/
+// The needle is eased towards each new reading once per frame. Positions are
+// kept in fixed point with 8 fractional bits, and the fractional part is used
+// to spread the needle over two neighbouring columns (anti-aliasing). Each
+// frame only the columns covered by the old and new needle are written.
+
+#define NEEDLE_FRACTION_BITS 8
+#define NEEDLE_ONE (1 << NEEDLE_FRACTION_BITS)
+#define NEEDLE_EASING_SHIFT 3  // moves 1/8 of the remaining distance per frame
+#define NEEDLE_TOP 10
+#define NEEDLE_BOTTOM 50
+
+struct needleStruct {
+  volatile int target;     // x of the latest reading, fixed point
+  volatile short colour;   // colour of the latest reading
+  int position;            // x currently on screen, fixed point
+  int drawnX;              // left column on screen, -1 if nothing drawn yet
+  int drawnWeight;         // weight of the right column on screen
+  short drawnColour;
+};
+
+struct needleStruct needle = {159 << NEEDLE_FRACTION_BITS, 0x0,
+                              159 << NEEDLE_FRACTION_BITS, -1, 0, 0x0};
+
+// called when a new reading arrives (from the interrupt handler)
+void setNeedleTarget(int x, short colour) {
+  needle.target = x << NEEDLE_FRACTION_BITS;
+  needle.colour = colour;
+}
+
+// blends colour over the scale at x,y with weight in [0,NEEDLE_ONE]
+short blendNeedleColour(int x, int y, short colour, int weight) {
+  unsigned short fg = (unsigned short)colour;
+  unsigned short bg = (unsigned short)scalePixelColour(x, y);
+  int r = (bg >> 11) +
+          ((((fg >> 11) - (bg >> 11)) * weight) >> NEEDLE_FRACTION_BITS);
+  int g = ((bg >> 5) & 0x3F) +
+          (((((fg >> 5) & 0x3F) - ((bg >> 5) & 0x3F)) * weight) >>
+           NEEDLE_FRACTION_BITS);
+  int b = (bg & 0x1F) +
+          ((((fg & 0x1F) - (bg & 0x1F)) * weight) >> NEEDLE_FRACTION_BITS);
+  return (short)((r << 11) | (g << 5) | b);
+}
+
+// draws one needle column at the given weight (0 restores the scale)
+void drawNeedleColumn(int x, short colour, int weight) {
+  if (x < 0 || x > 319) {
+    return;
+  }
+  for (int y = NEEDLE_TOP; y < NEEDLE_BOTTOM; ++y) {
+    write_pixel(x, y, blendNeedleColour(x, y, colour, weight));
+  }
+}
+
+// advances the needle one frame. Cheap enough to call every vsync
+// returns true if it drew anything
+bool animateNeedle() {
+  short colour = needle.colour;
+  if (colour == 0x0) {
+    return false;  // no reading yet
+  }
+
+  int distance = needle.target - needle.position;
+  if (abs(distance) < (1 << NEEDLE_EASING_SHIFT)) {
+    needle.position = needle.target;  // close enough: snap to the reading
+  } else {
+    needle.position += distance >> NEEDLE_EASING_SHIFT;
+  }
+
+  int x = needle.position >> NEEDLE_FRACTION_BITS;
+  int weight = needle.position & (NEEDLE_ONE - 1);
+  if (x == needle.drawnX && weight == needle.drawnWeight &&
+      colour == needle.drawnColour) {
+    return false;  // nothing moved since the last frame
+  }
+
+  // restore the columns of the old needle that the new one does not cover
+  if (needle.drawnX >= 0) {
+    for (int oldX = needle.drawnX; oldX <= needle.drawnX + 1; ++oldX) {
+      if (oldX != x && oldX != x + 1) {
+        drawNeedleColumn(oldX, 0x0, 0);
       }
     }
   }
-  // else if, difference is within 50 Hz
-  else if (absDifference < 50) {
-    colour = 0xFFC0;  // hex for yellow
-    // print tune in whatever direction
-    if (sign > 0) {
-      clear_character_buffer();
-      tuningInstructions = "Tune down";
-      write_phrase(36, 16, tuningInstructions);
-    } else {
-      clear_character_buffer();
-      tuningInstructions = "Tune up";
-      write_phrase(37, 16, tuningInstructions);
+
+  drawNeedleColumn(x, colour, NEEDLE_ONE - weight);
+  drawNeedleColumn(x + 1, colour, weight);
+
+  needle.drawnX = x;
+  needle.drawnWeight = weight;
+  needle.drawnColour = colour;
+  return true;
+}
+
+// restores the scale under the needle, e.g. before the strobe takes over. The
+// needle is redrawn in full by the next animateNeedle()
+void eraseNeedle() {
+  if (needle.drawnX >= 0) {
+    drawNeedleColumn(needle.drawnX, 0x0, 0);
+    drawNeedleColumn(needle.drawnX + 1, 0x0, 0);
+  }
+  needle.drawnX = -1;
+}
+
+// one frame of the main loop in needle mode
+void needleFrame() {
+  wait_for_vsync();
+  PROFILE_BEGIN(PROFILE_NEEDLE_FRAME);
+  bool drew = animateNeedle();  // ease the needle towards the latest reading
+  PROFILE_END(PROFILE_NEEDLE_FRAME);
+  latencyFrame(drew);
+  flushLog(1);  // the rest of the frame is idle
+}
+
+/*****************************************************************************/
+/* STROBE */
+/*****************************************************************************/
+// Instead of searching for an FFT peak, the strobe demodulates the input at the
+// expected frequency of the string (and two harmonics) one short block at a
+// time. If the string is off by d Hz, harmonic h of the block's complex sum
+// turns by 2 pi h d T radians per block of length T, so the turning rate gives
+// d with far finer resolution than the 0.5 Hz bin spacing. The accumulated
+// turn moves a stripe pattern along the bottom of the scale: stripes drift
+// right when sharp, left when flat and stand still when in tune. Blocks hold
+// a whole number of periods of the reference, so the other harmonics and the
+// mirror image of each harmonic cancel out of the block sums.
+
+#define STROBE_MIN_BLOCK 128    // samples per block, at least 16 ms at 8 kHz
+#define STROBE_MAX_BLOCK 256
+#define STROBE_HARMONICS 3
+#define STROBE_TOP 40           // stripe band, below the short scale lines
+#define STROBE_BOTTOM 48
+#define STROBE_LEFT 49
+#define STROBE_RIGHT 270
+#define STROBE_PERIOD 16        // pixels per dark + light stripe pair
+#define STROBE_AVERAGE_BLOCKS 32  // blocks averaged for the cents readout
+
+struct strobeStruct {
+  float frequency;  // reference frequency being demodulated
+  int blockLength;  // samples per block, a whole number of reference periods
+  // reference oscillator per harmonic, turned by (stepCos, stepSin) per sample
+  float oscCos[STROBE_HARMONICS];
+  float oscSin[STROBE_HARMONICS];
+  float stepCos[STROBE_HARMONICS];
+  float stepSin[STROBE_HARMONICS];
+  // complex sum of the previous block per harmonic
+  float lastRe[STROBE_HARMONICS];
+  float lastIm[STROBE_HARMONICS];
+  bool haveLastBlock;
+  float stripePhase;  // accumulated turn in stripe periods, in [0,1)
+  float offsetSum;    // sum of per-block offsets for the readout, in Hz
+  int offsetCount;
+  int drawnOffset;    // stripe offset on screen in pixels, -1 if not drawn
+};
+
+struct strobeStruct strobe = {.drawnOffset = -1};
+int strobeBlock[STROBE_MAX_BLOCK];
+int strobeBlockFill = 0;
+
+// starts demodulating at a new reference frequency
+void resetStrobe(float frequency) {
+  strobe.frequency = frequency;
+  int periods = (int)ceilf(STROBE_MIN_BLOCK * frequency / SAMPLE_RATE);
+  strobe.blockLength = (int)roundf(periods * SAMPLE_RATE / frequency);
+  if (strobe.blockLength > STROBE_MAX_BLOCK) {
+    strobe.blockLength = STROBE_MAX_BLOCK;
+  }
+  for (int h = 0; h < STROBE_HARMONICS; ++h) {
+    float step = 2 * PI * (h + 1) * frequency / SAMPLE_RATE;
+    strobe.oscCos[h] = 1;
+    strobe.oscSin[h] = 0;
+    tuner_sincosf(step, &strobe.stepSin[h], &strobe.stepCos[h]);
+  }
+  strobe.haveLastBlock = false;
+  strobe.offsetSum = 0;
+  strobe.offsetCount = 0;
+  strobeBlockFill = 0;
+}
+
+// demodulates one block and updates the stripe phase and the readout
+void processStrobeBlock(const int samples[], const int N) {
+  float blockRe[STROBE_HARMONICS] = {0};
+  float blockIm[STROBE_HARMONICS] = {0};
+
+  for (int h = 0; h < STROBE_HARMONICS; ++h) {
+    float c = strobe.oscCos[h];
+    float s = strobe.oscSin[h];
+    const float stepC = strobe.stepCos[h];
+    const float stepS = strobe.stepSin[h];
+    float sumRe = 0;
+    float sumIm = 0;
+    for (int i = 0; i < N; ++i) {
+      // scaled to 16 bits so products of block sums stay within float range
+      const float x = (float)samples[i] * (1.0f / 65536);
+      sumRe += x * c;
+      sumIm -= x * s;
+      const float nextC = c * stepC - s * stepS;
+      s = s * stepC + c * stepS;
+      c = nextC;
     }
+    // pull the oscillator back onto the unit circle once per block
+    const float gain = 1.5f - 0.5f * (c * c + s * s);
+    strobe.oscCos[h] = c * gain;
+    strobe.oscSin[h] = s * gain;
+    blockRe[h] = sumRe;
+    blockIm[h] = sumIm;
   }
-  // if difference greater than 50 Hz, set colour to red
-  else {
-    colour = 0xF800;  // hex for red
-    // else, difference is greater than 110, set the difference to 110 so that
-    // line is drawn within the scale
-    if (absDifference > 110) {
-      difference_in_frequency = sign * 110;
+
+  if (strobe.haveLastBlock) {
+    // turn of each harmonic since the last block, weighted by its strength
+    float weightedOffset = 0;
+    float totalWeight = 0;
+    for (int h = 0; h < STROBE_HARMONICS; ++h) {
+      // this block times the conjugate of the last block
+      const float re =
+          blockRe[h] * strobe.lastRe[h] + blockIm[h] * strobe.lastIm[h];
+      const float im =
+          blockIm[h] * strobe.lastRe[h] - blockRe[h] * strobe.lastIm[h];
+      float weight, turn;  // turn is 2 pi (h + 1) d T
+      tuner_polarf(re, im, &weight, &turn);
+      if (weight > 0) {
+        weightedOffset += weight * turn / (h + 1);
+        totalWeight += weight;
+      }
     }
-    // print tune in whatever direction
-    if (sign > 0) {
-      clear_character_buffer();
-      tuningInstructions = "Tune down";
-      write_phrase(36, 16, tuningInstructions);
-    } else {
-      clear_character_buffer();
-      tuningInstructions = "Tune up";
-      write_phrase(37, 16, tuningInstructions);
+    if (totalWeight > 0) {
+      const float blockSeconds = (float)N / SAMPLE_RATE;
+      const float offset =
+          weightedOffset / totalWeight / (2 * PI * blockSeconds);
+      strobe.offsetSum += offset;
+      strobe.offsetCount++;
+      strobe.stripePhase += offset * blockSeconds;
+      strobe.stripePhase -= floorf(strobe.stripePhase);
+    }
+  }
+
+  for (int h = 0; h < STROBE_HARMONICS; ++h) {
+    strobe.lastRe[h] = blockRe[h];
+    strobe.lastIm[h] = blockIm[h];
+  }
+  strobe.haveLastBlock = true;
+}
+
+int strobeBlockLength() { return strobe.blockLength; }
+
+// average deviation of the blocks since the last readout, in cents
+float strobeCents() {
+  if (strobe.offsetCount == 0) {
+    return 0;
+  }
+  float offset = strobe.offsetSum / strobe.offsetCount;
+  // cents = 1200 log2(1 + d / f), ~1731 d / f for small d
+  return 1731.234f * offset / strobe.frequency;
+}
+
+// true if column x of the stripe band is dark for the given offset
+bool strobeStripeIsDark(int x, int offset) {
+  return ((x + offset) % STROBE_PERIOD) < STROBE_PERIOD / 2;
+}
+
+// moves the stripes to the current phase. Only columns whose stripe changed
+// are drawn, which is two columns per stripe for slow drifts
+void drawStrobe() {
+  int offset = STROBE_PERIOD - 1 -
+               (int)(strobe.stripePhase * STROBE_PERIOD) % STROBE_PERIOD;
+  if (offset == strobe.drawnOffset) {
+    return;
+  }
+  for (int x = STROBE_LEFT; x < STROBE_RIGHT; ++x) {
+    bool dark = strobeStripeIsDark(x, offset);
+    if (strobe.drawnOffset >= 0 &&
+        dark == strobeStripeIsDark(x, strobe.drawnOffset)) {
+      continue;
+    }
+    short colour = dark ? 0x0 : 0x07E0;
+    for (int y = STROBE_TOP; y < STROBE_BOTTOM; ++y) {
+      write_pixel(x, y, colour);
+    }
+  }
+  strobe.drawnOffset = offset;
+}
+
+// restores the scale under the stripe band
+void eraseStrobe() {
+  for (int x = STROBE_LEFT; x < STROBE_RIGHT; ++x) {
+    for (int y = STROBE_TOP; y < STROBE_BOTTOM; ++y) {
+      write_pixel(x, y, scalePixelColour(x, y));
     }
   }
+  strobe.drawnOffset = -1;
+  clear_text_widget(&centsText);
+}
+
+// called from the main loop in strobe mode: drains the audio FIFO and
+// processes every full block
+void serviceStrobe() {
+  volatile int *audio_ptr = (int *)AUDIO_BASE;
+
+  if (strobe.frequency != expectedFrequencyForString) {
+    resetStrobe(expectedFrequencyForString);  // string changed with KEY0/KEY1
+  }
+
+  while ((READ_AUDIO(audio_ptr, 1) & 0x000000FF) > 0) {
+    strobeBlock[strobeBlockFill] = READ_AUDIO(audio_ptr, 2);
+    strobeBlock[strobeBlockFill] = READ_AUDIO(audio_ptr, 3);
+    if (++strobeBlockFill < strobe.blockLength) {
+      continue;
+    }
+    strobeBlockFill = 0;
+    PROFILE_BEGIN(PROFILE_STROBE_BLOCK);
+    processStrobeBlock(strobeBlock, strobe.blockLength);
+    drawStrobe();
+    PROFILE_END(PROFILE_STROBE_BLOCK);
 
-  draw_vertical_line(159 + difference_in_frequency, 10, 50,
-                     colour);  // line is drawn starting at x = 159 (the
-                               // middle of the scale) in red
+    if (strobe.offsetCount == STROBE_AVERAGE_BLOCKS) {
+      float cents = strobeCents();
+      char centsPhrase[24];
+      snprintf(centsPhrase, sizeof(centsPhrase), "%+.1f cents", cents);
+      write_text_widget(&centsText, centsPhrase);
+      char *tuningInstructions = (cents > 0) ? "Tune down" : "Tune up";
+      if (cents > -1 && cents < 1) {
+        tuningInstructions = "Good!";
+      }
+      write_text_widget(&statusText, tuningInstructions);
+      strobe.offsetSum = 0;
+      strobe.offsetCount = 0;
+    }
+  }
 }
 
 /*****************************************************************************/
-/* FOURIER TRANSFORM */
+/* SPECTRUM AND WATERFALL */
 /*****************************************************************************/
+// Shows the 50-400 Hz band of the last transform as a bar spectrum (left of
+// the guitar) and a waterfall (right of the guitar). Bars are updated by
+// drawing only the pixels between the old and new bar heights. The waterfall
+// is a ring of rows: each transform draws one new row at the write offset and
+// moves a cursor line below it, so the panel is never repainted.
+
+#define SPECTRUM_LOW_HZ 50
+#define SPECTRUM_HIGH_HZ 400
+#define SPECTRUM_COLUMNS 80
+#define SPECTRUM_LEFT 8     // bar panel, left of the guitar
+#define SPECTRUM_TOP 100
+#define SPECTRUM_HEIGHT 80
+#define WATERFALL_LEFT 238  // waterfall panel, right of the guitar
+#define WATERFALL_TOP 64
+#define WATERFALL_ROWS 168
+#define SPECTRUM_RANGE_OCTAVES 20  // 60 dB of power maps onto the colour map
 
-void rearrange(float data_re[], float data_im[], const int N) {
-  unsigned int target = 0;
-  for (unsigned int position = 0; position < N; position++) {
-    if (target > position) {
-      const float temp_re = data_re[target];
-      const float temp_im = data_im[target];
-      data_re[target] = data_re[position];
-      data_im[target] = data_im[position];
-      data_re[position] = temp_re;
-      data_im[position] = temp_im;
+short spectrumColourMap[256];
+int spectrumBarHeights[SPECTRUM_COLUMNS];
+int waterfallRow = 0;
+
+// fills the colour map: black -> blue -> red -> yellow -> white
+void buildSpectrumColourMap() {
+  for (int level = 0; level < 256; ++level) {
+    int r, g, b;  // 0-255 each
+    if (level < 64) {
+      r = 0;
+      g = 0;
+      b = level * 4;
+    } else if (level < 128) {
+      r = (level - 64) * 4;
+      g = 0;
+      b = 255 - (level - 64) * 4;
+    } else if (level < 192) {
+      r = 255;
+      g = (level - 128) * 4;
+      b = 0;
+    } else {
+      r = 255;
+      g = 255;
+      b = (level - 192) * 4;
     }
-    unsigned int mask = N;
-    while (target & (mask >>= 1)) target &= ~mask;
-    target |= mask;
-  }
-}
-
-void compute(float data_re[], float data_im[], const int N) {
-  const float pi = -3.14159265358979323846;
-
-  for (unsigned int step = 1; step < N; step <<= 1) {
-    const unsigned int jump = step << 1;
-    const float step_d = (float)step;
-    float twiddle_re = 1.0;
-    float twiddle_im = 0.0;
-    for (unsigned int group = 0; group < step; group++) {
-      for (unsigned int pair = group; pair < N; pair += jump) {
-        const unsigned int match = pair + step;
-        const float product_re =
-            twiddle_re * data_re[match] - twiddle_im * data_im[match];
-        const float product_im =
-            twiddle_im * data_re[match] + twiddle_re * data_im[match];
-        data_re[match] = data_re[pair] - product_re;
-        data_im[match] = data_im[pair] - product_im;
-        data_re[pair] += product_re;
-        data_im[pair] += product_im;
-      }
+    spectrumColourMap[level] =
+        (short)(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3));
+  }
+}
+
+// draws the outlines and labels of the two panels
+void drawSpectrumPanels() {
+  drawBox(SPECTRUM_LEFT - 1, SPECTRUM_LEFT + SPECTRUM_COLUMNS + 1,
+          SPECTRUM_TOP + SPECTRUM_HEIGHT, SPECTRUM_TOP + SPECTRUM_HEIGHT + 1,
+          0x8410);  // grey baseline
+  drawBox(WATERFALL_LEFT - 1, WATERFALL_LEFT + SPECTRUM_COLUMNS + 1,
+          WATERFALL_TOP - 1, WATERFALL_TOP, 0x8410);
+  drawBox(WATERFALL_LEFT - 1, WATERFALL_LEFT + SPECTRUM_COLUMNS + 1,
+          WATERFALL_TOP + WATERFALL_ROWS, WATERFALL_TOP + WATERFALL_ROWS + 1,
+          0x8410);
+
+  // character cells are 4 x 4 pixels
+  write_phrase(SPECTRUM_LEFT / 4 + 6, SPECTRUM_TOP / 4 - 2, "Spectrum");
+  write_phrase(SPECTRUM_LEFT / 4, (SPECTRUM_TOP + SPECTRUM_HEIGHT) / 4 + 1,
+               "50");
+  write_phrase((SPECTRUM_LEFT + SPECTRUM_COLUMNS) / 4 - 5,
+               (SPECTRUM_TOP + SPECTRUM_HEIGHT) / 4 + 1, "400Hz");
+  write_phrase(WATERFALL_LEFT / 4 + 5, WATERFALL_TOP / 4 - 2, "Waterfall");
+}
 
-      // we need the factors below for the next iteration
-      // if we don't iterate then don't compute
-      if (group + 1 == step) {
-        continue;
+// maps a power relative to the loudest column onto [0,255] on a log scale.
+// frexpf() splits the ratio into mantissa and exponent, which gives a cheap
+// piecewise linear log2 without calling log on the soft core
+int spectrumLevel(float power, float maxPower) {
+  if (power <= 0 || maxPower <= 0) {
+    return 0;
+  }
+  int exponent;
+  float mantissa = frexpf(power / maxPower, &exponent);  // in [0.5,1)
+  float octaves = exponent + 2.0f * mantissa - 2.0f;     // ~log2(ratio) <= 0
+  int level = 255 + (int)(octaves * (256 / SPECTRUM_RANGE_OCTAVES));
+  return level < 0 ? 0 : (level > 255 ? 255 : level);
+}
+
+// draws the band of a transform of N samples into both panels
+void updateSpectrumDisplay(float data_re[], float data_im[], const int N) {
+  int firstBin = SPECTRUM_LOW_HZ * N / SAMPLE_RATE;
+  int lastBin = SPECTRUM_HIGH_HZ * N / SAMPLE_RATE;
+  int binsPerColumn = (lastBin - firstBin) / SPECTRUM_COLUMNS + 1;
+
+  // loudest bin of each column (max pooling)
+  float columnPower[SPECTRUM_COLUMNS];
+  float maxPower = 0;
+  for (int column = 0; column < SPECTRUM_COLUMNS; ++column) {
+    columnPower[column] = 0;
+    int bin = firstBin + column * binsPerColumn;
+    for (int k = 0; k < binsPerColumn && bin + k < N / 2; ++k) {
+      float power = data_re[bin + k] * data_re[bin + k] +
+                    data_im[bin + k] * data_im[bin + k];
+      if (power > columnPower[column]) {
+        columnPower[column] = power;
       }
+    }
+    if (columnPower[column] > maxPower) {
+      maxPower = columnPower[column];
+    }
+  }
+
+  int bottom = SPECTRUM_TOP + SPECTRUM_HEIGHT;
+  int rowY = WATERFALL_TOP + waterfallRow;
+  int cursorY = WATERFALL_TOP + (waterfallRow + 1) % WATERFALL_ROWS;
+
+  for (int column = 0; column < SPECTRUM_COLUMNS; ++column) {
+    int level = spectrumLevel(columnPower[column], maxPower);
+
+    // bars: colour depends on height only, so only the difference between the
+    // old and new bar is drawn
+    int x = SPECTRUM_LEFT + column;
+    int height = level * SPECTRUM_HEIGHT / 256;
+    int oldHeight = spectrumBarHeights[column];
+    for (int h = oldHeight; h < height; ++h) {
+      write_pixel(x, bottom - 1 - h,
+                  spectrumColourMap[h * 256 / SPECTRUM_HEIGHT]);
+    }
+    for (int h = height; h < oldHeight; ++h) {
+      write_pixel(x, bottom - 1 - h, 0x0);
+    }
+    spectrumBarHeights[column] = height;
+
+    // waterfall: newest row at the write offset, white cursor below it
+    write_pixel(WATERFALL_LEFT + column, rowY, spectrumColourMap[level]);
+    write_pixel(WATERFALL_LEFT + column, cursorY, 0xFFFF);
+  }
+
+  waterfallRow = (waterfallRow + 1) % WATERFALL_ROWS;
+}
 
-      float angle = pi * ((float)group + 1) / step_d;
-      twiddle_re = cos(angle);
-      twiddle_im = sin(angle);
+/*****************************************************************************/
+/* PITCH ESTIMATION */
+/*****************************************************************************/
+
+// analysis buffers. These are too big for the stack of the interrupt handler
+// and are shared with the spectrum display after each transform
+float analysisRe[NUMSAMPLES];
+float analysisIm[NUMSAMPLES];
+int capturedSamples[NUMSAMPLES];
+
+// pauses of the countdown before a capture and of "Done recording" after it
+#define COUNTDOWN_TICKS (TIMER_TICKS_PER_SECOND / 2)
+#define COUNTDOWN_STEP_TICKS (TIMER_TICKS_PER_SECOND / 4)
+
+// shortest capture a profile can ask for: at 2048 samples E2 is within 5
+// cents only 86% of the time
+#define MIN_CAPTURE_SAMPLES 2048
+
+// the shortest length of at least n samples made of factors 2, 3 and 5, which
+// the mixed-radix transform takes without Bluestein's longer convolution
+int smoothLength(int n) {
+  for (;; ++n) {
+    int rest = n;
+    while (rest % 2 == 0) {
+      rest /= 2;
+    }
+    while (rest % 3 == 0) {
+      rest /= 3;
+    }
+    while (rest % 5 == 0) {
+      rest /= 5;
+    }
+    if (rest == 1) {
+      return n;
     }
   }
 }
 
-void fft(float data_re[], float data_im[], const int N) {
-  rearrange(data_re, data_im, N);
-  compute(data_re, data_im, N);
+// samples in a capture of string: the periods of its profile, rounded up to
+// a smooth length, from MIN_CAPTURE_SAMPLES to NUMSAMPLES
+int stringCaptureLength(int string) {
+  int n = (int)ceilf(stringProfiles[string].periods * SAMPLE_RATE /
+                     guitarStringFrequencies[string]);
+  n = smoothLength(n > MIN_CAPTURE_SAMPLES ? n : MIN_CAPTURE_SAMPLES);
+  return n < NUMSAMPLES ? n : NUMSAMPLES;
+}
+
+// samples between readings of string in a stream, from 1 to its capture
+int stringHopLength(int string) {
+  int hop = (int)roundf(stringProfiles[string].hopPeriods * SAMPLE_RATE /
+                         guitarStringFrequencies[string]);
+  int window = stringCaptureLength(string);
+  return hop < 1 ? 1 : hop < window ? hop : window;
+}
+
+// samples KEY3 captures: the selected string's, or the whole buffer when the
+// string is not known beforehand (auto string, chromatic) or every string is
+// wanted (polyphonic)
+int captureLength() {
+  if (polyphonicSelected() || chromaticSelected() || autoStringSelected()) {
+    return NUMSAMPLES;
+  }
+  return stringCaptureLength(stringState);
 }
 
-int recordAndPrint() {
-  volatile int *LEDS = (int *)0xff200000;
+float recordAndPrint() {
+  volatile int *LEDS = (int *)LED_BASE;
   volatile int *audio_ptr = (int *)AUDIO_BASE;
 
-  write_phrase(30, 16, "Begin recording in...");
-      for (int i = 0; i < 25000000; i++) {
-      }
-      clear_character_buffer();
-      write_phrase(40, 16, "3");
-      for (int i = 0; i < 12500000; i++) {
-      }
-      clear_character_buffer();
-      write_phrase(40, 16, "2");
-      for (int i = 0; i < 12500000; i++) {
-      }
-      clear_character_buffer();
-      write_phrase(40, 16, "1");
-      for (int i = 0; i < 12500000; i++) {
-      }
-      clear_character_buffer();
-      write_phrase(36, 16, "Recording");
+  PROFILE_BEGIN(PROFILE_COUNTDOWN);
+  clear_text_widget(&centsText);
+  write_text_widget(&statusText, "Begin recording in...");
+  delayTicks(COUNTDOWN_TICKS);
+  write_text_widget(&statusText, "3");
+  delayTicks(COUNTDOWN_STEP_TICKS);
+  write_text_widget(&statusText, "2");
+  delayTicks(COUNTDOWN_STEP_TICKS);
+  write_text_widget(&statusText, "1");
+  delayTicks(COUNTDOWN_STEP_TICKS);
+  write_text_widget(&statusText, "Recording");
+  PROFILE_END(PROFILE_COUNTDOWN);
 
   int fifospace;
-  fifospace = *(audio_ptr + 1);  // read the audio port fifospace register
+  fifospace = READ_AUDIO(audio_ptr, 1);  // read the fifospace register
 
   *LEDS = 0;
 
-  float re[NUMSAMPLES] = {0};
-  float im[NUMSAMPLES] = {0};
-
-  int samples[NUMSAMPLES] = {0};
+  int *samples = capturedSamples;
+  const int N = captureLength();
 
   // Clear FIFO Read and Write
 
 setupAudio();
 
+  latencyMark(LATENCY_CAPTURE_START);
+  PROFILE_BEGIN(PROFILE_CAPTURE);
   int i = 0;
-  while (i < NUMSAMPLES) {
-    fifospace = *(audio_ptr + 1);
+  while (i < N) {
+    fifospace = READ_AUDIO(audio_ptr, 1);
     if ((fifospace & 0x000000FF) > 0) {
-      samples[i] = *(audio_ptr + 2);
-      samples[i] = *(audio_ptr + 3);
+      samples[i] = READ_AUDIO(audio_ptr, 2);
+      samples[i] = READ_AUDIO(audio_ptr, 3);
       i++;
     }
   }
+  PROFILE_END(PROFILE_CAPTURE);
+  latencyMark(LATENCY_CAPTURE_END);
 
-  clear_character_buffer();
-  write_phrase(33, 16, "Done recording");
-  for (int i = 0; i < 25000000; ++i){
+  write_text_widget(&statusText, "Done recording");
+  delayTicks(COUNTDOWN_TICKS);
+  write_text_widget(&statusText, "Calculating");
 
-  }
-  clear_character_buffer();
-  write_phrase(35, 16, "Calculating");
+  recordSessionCapture(samples, N);
+  float frequency = analyseCapture(samples, N);
+  latencyMark(LATENCY_ANALYSIS_END);
+  return frequency;
+}
 
-  // Compute RMS of signal:
+// estimates the pitch of a capture, streams it as telemetry and updates the
+// spectrum panels. Replayed sessions come through here too
+float analyseCapture(const int samples[], const int N) {
+  float *re = analysisRe;
+  float *im = analysisIm;
 
-  for (int j = 0; j < NUMSAMPLES; j++) {
-    re[j] = 1.0 * samples[j];
+  float maxAng = estimatePitch(samples, re, im, N);
+  if (telemetrySelected()) {
+    sendReadingTelemetry(samples, re, im, N, maxAng,
+                         expectedFrequencyForString);
   }
 
-  fft(re, im, NUMSAMPLES);
+  PROFILE_BEGIN(PROFILE_SPECTRUM);
+  updateSpectrumDisplay(re, im, N);
+  PROFILE_END(PROFILE_SPECTRUM);
+
+  return maxAng;
+}
 
-  int maxK = 0;
-  float maxAmp = 0;
+// band searched by estimatePitch(): the strings, or every note in chromatic
+// mode
+float pitchLowHz = PITCH_LOW_HZ;
+float pitchHighHz = PITCH_HIGH_HZ;
 
-  for (int i = 0; i < NUMSAMPLES / 2; i++) {
-    if (re[i] > maxAmp && ((1.0) / NUMSAMPLES) * 1.0 * i * 8000.0 > 50 &&
-        ((1.0) / NUMSAMPLES) * 1.0 * i * 8000.0 < 380) {
-      maxK = i;
-      maxAmp = re[i];
-    }
+// window estimatePitch() weights the capture with, and the tables of the
+// windows it has used
+int analysisWindowType = TUNER_WINDOW_RECTANGULAR;
+ANALYSIS_THREAD_LOCAL struct tuner_window_cache analysisWindows;
+
+// transforms of the capture lengths that are not a power of two, one per
+// string in use
+ANALYSIS_THREAD_LOCAL struct tuner_fft_plan_cache analysisPlans;
+
+// estimates the pitch of N captured samples (any N up to TUNER_MAX_FFT):
+// windows them into data_re and data_im, transforms them and returns the
+// fundamental between pitchLowHz and pitchHighHz found by harmonic
+// summation. The spectrum is left in data_re and data_im
+float estimatePitch(const int samples[], float data_re[], float data_im[],
+                    const int N) {
+  float *re = data_re;
+  float *im = data_im;
+
+  PROFILE_BEGIN(PROFILE_CONVERT);
+  const float *window =
+      tuner_window_table(&analysisWindows, analysisWindowType, N);
+  tuner_window_samples(window, samples, re, im, N);
+  PROFILE_END(PROFILE_CONVERT);
+
+  if (N & (N - 1)) {
+    // mixed-radix or Bluestein, with no separate reordering pass
+    PROFILE_BEGIN(PROFILE_COMPUTE);
+    tuner_fft(tuner_fft_plan_for(&analysisPlans, N), re, im);
+    PROFILE_END(PROFILE_COMPUTE);
+  } else {
+    PROFILE_BEGIN(PROFILE_REARRANGE);
+    rearrange(re, im, N);
+    PROFILE_END(PROFILE_REARRANGE);
+    PROFILE_BEGIN(PROFILE_COMPUTE);
+    compute(re, im, N);
+    PROFILE_END(PROFILE_COMPUTE);
   }
 
-  float maxAng = ((1.0) / NUMSAMPLES) * 1.0 * maxK * 8000.0;
+  PROFILE_BEGIN(PROFILE_PEAK);
+  float maxAng =
+      tuner_find_pitch(re, im, N, SAMPLE_RATE, pitchLowHz, pitchHighHz);
+  PROFILE_END(PROFILE_PEAK);
+
   return maxAng;
-  // Clear buffer out of old samples
 }
 
 // Draws triangle to display to user which string is currently selected for
@@ -0,0 +1,111 @@
+/*
+ * What the board program (main.c) shares with the host tools (host.c), so
+ * that both are compiled against one definition.
+ */
+
+#ifndef MAIN_H
+#define MAIN_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "tuner.h"
+
+// header of the log ring (see LOGGING in main.c), checked by decode-log
+#define LOG_MAGIC 0x474F4C54  // "TLOG"
+#define LOG_VERSION 1
+
+enum LogEvent {
+  LOG_BOOT,
+  LOG_STRING_SELECTED,  // string state, expected frequency in mHz
+  LOG_READING,          // recorded frequency in mHz, expected frequency in mHz
+  LOG_BAD_STRING_STATE, // string state
+  LOG_STROBE_TOGGLED,   // 1 if strobe mode is on
+  NUM_LOG_EVENTS
+};
+
+enum GuitarString {
+  D_STRING,
+  A_STRING,
+  E_STRING,
+  G_STRING,
+  B_STRING,
+  HIGH_E_STRING
+};
+
+// how spectrum magnitudes are encoded
+enum SpectrumEncoding {
+  SPECTRUM_FLOAT32 = 0,      // f32 per bin, scale unused
+  SPECTRUM_INT16 = 1,        // u16 per bin, magnitude = value * scale
+  SPECTRUM_INT16_DELTA = 2,  // as INT16, then zigzag varint differences
+};
+
+// Functions and globals of main.c that the host tools drive
+extern enum GuitarString stringState;
+extern float frequencyOfString;
+void serviceChromaticMode();
+void drawInitialScreen();
+void clear_screen();
+void clear_character_buffer();
+void drawGuitar();
+void drawScale();
+void drawArrow();
+void clearArrows();
+void drawSpectrumPanels();
+void drawNoteOnScale(float frequencyRecorded, float expectedFrequency);
+bool animateNeedle();
+void needleFrame();
+void interrupt_handler();
+void serviceLatencyPanel();
+extern struct tuner_string_result strum[6];
+void analyseStrum();
+void drawStrum();
+void updateSpectrumDisplay(float data_re[], float data_im[], const int N);
+void resetStrobe(float frequency);
+int strobeBlockLength();
+void processStrobeBlock(const int samples[], const int N);
+void drawStrobe();
+void eraseStrobe();
+void eraseNeedle();
+float strobeCents();
+extern float guitarStringFrequencies[6];
+extern char *guitarStringNames[6];
+extern float analysisRe[];
+extern float analysisIm[];
+float estimatePitch(const int samples[], float data_re[], float data_im[],
+                    const int N);
+extern int analysisWindowType;  // enum tuner_window_type
+extern float chromaticFrequencies[];
+extern int chromaticNote;
+int windowSelected();
+int stringCaptureLength(int string);
+int stringHopLength(int string);
+int captureLength();
+struct logRingStruct;
+extern struct logRingStruct logRing;
+unsigned int logRingBytes();
+void logEvent(enum LogEvent event, int32_t arg0, int32_t arg1);
+void formatLogEvent(unsigned int event, int32_t arg0, int32_t arg1, char *line,
+                    int size);
+extern enum SpectrumEncoding telemetryEncoding;
+extern unsigned int telemetryDropped;
+extern float expectedFrequencyForString;
+void sendReadingTelemetry(const int samples[], float data_re[],
+                          float data_im[], const int N, float estimate,
+                          float expected);
+void serviceTelemetry();
+struct sessionLogStruct;
+extern struct sessionLogStruct sessionLog;
+unsigned int sessionLogBytes();
+void recordSessionCapture(const int samples[], const int N);
+void selectString(unsigned int string);
+void showReading(float frequency);
+float analyseCapture(const int samples[], const int N);
+int32_t toMillihertz(float frequency);
+unsigned short crc16Update(unsigned short crc, const unsigned char *data,
+                           int length);
+#ifdef TUNER_PROFILE
+void dumpProfileReport();
+#endif
+
+#endif
@@ -0,0 +1,1343 @@
+/*
+ * Pitch analysis library: radix-2, mixed-radix and Bluestein FFTs,
+ * windowing, peak search, harmonic summation, target classification,
+ * fixed-point trigonometry and the streaming front end. See tuner.h.
+ */
+
+#include "tuner.h"
+
+#include <math.h>
+#include <string.h>
+
+#ifndef TUNER_GENERIC_FFT
+#include "fft_16384.h"  // tuner-host gen-fft 16384 -o fft_16384.h
+#endif
+
+/*****************************************************************************/
+/* FOURIER TRANSFORM */
+/*****************************************************************************/
+
+void rearrange_generic(float data_re[], float data_im[], const int N) {
+  unsigned int target = 0;
+  for (unsigned int position = 0; position < N; position++) {
+    if (target > position) {
+      const float temp_re = data_re[target];
+      const float temp_im = data_im[target];
+      data_re[target] = data_re[position];
+      data_im[target] = data_im[position];
+      data_re[position] = temp_re;
+      data_im[position] = temp_im;
+    }
+    unsigned int mask = N;
+    while (target & (mask >>= 1)) target &= ~mask;
+    target |= mask;
+  }
+}
+
+void compute_generic(float data_re[], float data_im[], const int N) {
+  for (unsigned int step = 1; step < N; step <<= 1) {
+    const unsigned int jump = step << 1;
+    // twiddles turn by -1 / (2 step) of a turn, exactly as a binary angle
+    const uint32_t turn = (1u << (TUNER_TURN_BITS - 1)) / step;
+    float twiddle_re = 1.0;
+    float twiddle_im = 0.0;
+    for (unsigned int group = 0; group < step; group++) {
+      for (unsigned int pair = group; pair < N; pair += jump) {
+        const unsigned int match = pair + step;
+        const float product_re =
+            twiddle_re * data_re[match] - twiddle_im * data_im[match];
+        const float product_im =
+            twiddle_im * data_re[match] + twiddle_re * data_im[match];
+        data_re[match] = data_re[pair] - product_re;
+        data_im[match] = data_im[pair] - product_im;
+        data_re[pair] += product_re;
+        data_im[pair] += product_im;
+      }
+
+      // we need the factors below for the next iteration
+      // if we don't iterate then don't compute
+      if (group + 1 == step) {
+        continue;
+      }
+
+      int32_t sine, cosine;
+      tuner_sincos(-(group + 1) * turn, &sine, &cosine);
+      twiddle_re = cosine * (1.0f / TUNER_Q30_ONE);
+      twiddle_im = sine * (1.0f / TUNER_Q30_ONE);
+    }
+  }
+}
+
+void rearrange(float data_re[], float data_im[], const int N) {
+#ifdef TUNER_FFT_FIXED_N
+  if (N == TUNER_FFT_FIXED_N) {
+    fft_fixed_rearrange(data_re, data_im);
+    return;
+  }
+#endif
+  rearrange_generic(data_re, data_im, N);
+}
+
+void compute(float data_re[], float data_im[], const int N) {
+#ifdef TUNER_FFT_FIXED_N
+  if (N == TUNER_FFT_FIXED_N) {
+    fft_fixed_compute(data_re, data_im);
+    return;
+  }
+#endif
+  compute_generic(data_re, data_im, N);
+}
+
+void fft_generic(float data_re[], float data_im[], const int N) {
+  rearrange_generic(data_re, data_im, N);
+  compute_generic(data_re, data_im, N);
+}
+
+void fft(float data_re[], float data_im[], const int N) {
+  rearrange(data_re, data_im, N);
+  compute(data_re, data_im, N);
+}
+
+/*****************************************************************************/
+/* MIXED RADIX AND BLUESTEIN */
+/*****************************************************************************/
+
+// e^(-2 pi i numerator / denominator)
+static void unit_root(uint32_t numerator, uint32_t denominator, float *re,
+                      float *im) {
+  const uint32_t angle =
+      (uint32_t)(((uint64_t)numerator << TUNER_TURN_BITS) / denominator);
+  int32_t sine, cosine;
+  tuner_sincos(0u - angle, &sine, &cosine);
+  *re = cosine * (1.0f / TUNER_Q30_ONE);
+  *im = sine * (1.0f / TUNER_Q30_ONE);
+}
+
+#define TUNER_SIN_60 0.866025403784f   // sin(2 pi / 3)
+#define TUNER_COS_72 0.309016994375f   // cos(2 pi / 5)
+#define TUNER_COS_144 -0.809016994375f // cos(4 pi / 5)
+#define TUNER_SIN_72 0.951056516295f   // sin(2 pi / 5)
+#define TUNER_SIN_144 0.587785252292f  // sin(4 pi / 5)
+
+// one self-sorting (Stockham) stage of radix p over n points at stride s
+// (n s = N): the p-point DFT of x[r + s (q + m j)], j < p, times the twiddles
+// of q, goes to y[r + s (p q + k)], k < p
+static void mixed_radix_stage(const struct tuner_fft_plan *plan, int p,
+                              int n, int s, const float x_re[],
+                              const float x_im[], float y_re[],
+                              float y_im[]) {
+  const int m = n / p;
+  for (int q = 0; q < m; ++q) {
+    // the twiddle of output k is e^(-2 pi i q k / n), entry q k s of the table
+    float w_re[5], w_im[5];
+    for (int k = 1; k < p; ++k) {
+      w_re[k] = plan->twiddle_re[q * k * s];
+      w_im[k] = plan->twiddle_im[q * k * s];
+    }
+    for (int r = 0; r < s; ++r) {
+      float a_re[5], a_im[5], b_re[5], b_im[5];
+      for (int j = 0; j < p; ++j) {
+        a_re[j] = x_re[r + s * (q + m * j)];
+        a_im[j] = x_im[r + s * (q + m * j)];
+      }
+      switch (p) {
+        case 2:
+          b_re[0] = a_re[0] + a_re[1];
+          b_im[0] = a_im[0] + a_im[1];
+          b_re[1] = a_re[0] - a_re[1];
+          b_im[1] = a_im[0] - a_im[1];
+          break;
+        case 3: {
+          const float sum_re = a_re[1] + a_re[2];
+          const float sum_im = a_im[1] + a_im[2];
+          const float mid_re = a_re[0] - 0.5f * sum_re;
+          const float mid_im = a_im[0] - 0.5f * sum_im;
+          // -i sin(2 pi / 3) (a1 - a2)
+          const float rot_re = TUNER_SIN_60 * (a_im[1] - a_im[2]);
+          const float rot_im = -TUNER_SIN_60 * (a_re[1] - a_re[2]);
+          b_re[0] = a_re[0] + sum_re;
+          b_im[0] = a_im[0] + sum_im;
+          b_re[1] = mid_re + rot_re;
+          b_im[1] = mid_im + rot_im;
+          b_re[2] = mid_re - rot_re;
+          b_im[2] = mid_im - rot_im;
+          break;
+        }
+        case 4: {
+          const float even_re = a_re[0] + a_re[2], even_im = a_im[0] + a_im[2];
+          const float odd_re = a_re[1] + a_re[3], odd_im = a_im[1] + a_im[3];
+          const float diff_re = a_re[0] - a_re[2], diff_im = a_im[0] - a_im[2];
+          // -i (a1 - a3)
+          const float rot_re = a_im[1] - a_im[3];
+          const float rot_im = a_re[3] - a_re[1];
+          b_re[0] = even_re + odd_re;
+          b_im[0] = even_im + odd_im;
+          b_re[1] = diff_re + rot_re;
+          b_im[1] = diff_im + rot_im;
+          b_re[2] = even_re - odd_re;
+          b_im[2] = even_im - odd_im;
+          b_re[3] = diff_re - rot_re;
+          b_im[3] = diff_im - rot_im;
+          break;
+        }
+        default: {  // 5
+          const float s1_re = a_re[1] + a_re[4], s1_im = a_im[1] + a_im[4];
+          const float d1_re = a_re[1] - a_re[4], d1_im = a_im[1] - a_im[4];
+          const float s2_re = a_re[2] + a_re[3], s2_im = a_im[2] + a_im[3];
+          const float d2_re = a_re[2] - a_re[3], d2_im = a_im[2] - a_im[3];
+          const float c1_re = a_re[0] + TUNER_COS_72 * s1_re +
+                              TUNER_COS_144 * s2_re;
+          const float c1_im = a_im[0] + TUNER_COS_72 * s1_im +
+                              TUNER_COS_144 * s2_im;
+          const float c2_re = a_re[0] + TUNER_COS_144 * s1_re +
+                              TUNER_COS_72 * s2_re;
+          const float c2_im = a_im[0] + TUNER_COS_144 * s1_im +
+                              TUNER_COS_72 * s2_im;
+          // -i times the sine terms of outputs 1 and 2
+          const float t1_re = TUNER_SIN_72 * d1_im + TUNER_SIN_144 * d2_im;
+          const float t1_im = -(TUNER_SIN_72 * d1_re + TUNER_SIN_144 * d2_re);
+          const float t2_re = TUNER_SIN_144 * d1_im - TUNER_SIN_72 * d2_im;
+          const float t2_im = -(TUNER_SIN_144 * d1_re - TUNER_SIN_72 * d2_re);
+          b_re[0] = a_re[0] + s1_re + s2_re;
+          b_im[0] = a_im[0] + s1_im + s2_im;
+          b_re[1] = c1_re + t1_re;
+          b_im[1] = c1_im + t1_im;
+          b_re[4] = c1_re - t1_re;
+          b_im[4] = c1_im - t1_im;
+          b_re[2] = c2_re + t2_re;
+          b_im[2] = c2_im + t2_im;
+          b_re[3] = c2_re - t2_re;
+          b_im[3] = c2_im - t2_im;
+          break;
+        }
+      }
+      y_re[r + s * p * q] = b_re[0];
+      y_im[r + s * p * q] = b_im[0];
+      for (int k = 1; k < p; ++k) {
+        y_re[r + s * (p * q + k)] = b_re[k] * w_re[k] - b_im[k] * w_im[k];
+        y_im[r + s * (p * q + k)] = b_re[k] * w_im[k] + b_im[k] * w_re[k];
+      }
+    }
+  }
+}
+
+// the filter of a Bluestein plan, the conjugate chirp at lags -(N - 1) to
+// N - 1, wrapped, and transformed, into the plan's scratch
+static void make_filter(const struct tuner_fft_plan *plan) {
+  const int N = plan->N;
+  const int M = plan->M;
+  struct tuner_fft_scratch *scratch = plan->scratch;
+  memset(scratch->filter_re, 0, sizeof(float) * M);
+  memset(scratch->filter_im, 0, sizeof(float) * M);
+  for (int t = 0; t < N; ++t) {
+    scratch->filter_re[t] = plan->twiddle_re[t];
+    scratch->filter_im[t] = -plan->twiddle_im[t];
+    if (t > 0) {
+      scratch->filter_re[M - t] = plan->twiddle_re[t];
+      scratch->filter_im[M - t] = -plan->twiddle_im[t];
+    }
+  }
+  fft(scratch->filter_re, scratch->filter_im, M);
+  scratch->filter_N = N;
+}
+
+bool tuner_fft_plan_init(struct tuner_fft_plan *plan, int N,
+                         struct tuner_fft_scratch *scratch) {
+  if (N < 1 || N > TUNER_MAX_FFT) {
+    return false;
+  }
+  plan->N = N;
+  plan->factor_count = 0;
+  plan->M = 0;
+  plan->scratch = scratch;
+  if ((N & (N - 1)) == 0) {
+    plan->algorithm = TUNER_FFT_RADIX_2;
+    return true;
+  }
+
+  // radix 4 first, as it saves the most passes, then 2, 3 and 5
+  static const int radices[] = {4, 2, 3, 5};
+  int rest = N;
+  for (int i = 0; i < 4; ++i) {
+    while (rest % radices[i] == 0) {
+      plan->factors[plan->factor_count++] = radices[i];
+      rest /= radices[i];
+    }
+  }
+  if (rest == 1) {
+    plan->algorithm = TUNER_FFT_MIXED_RADIX;
+    for (int t = 0; t < N; ++t) {
+      unit_root(t, N, &plan->twiddle_re[t], &plan->twiddle_im[t]);
+    }
+    return true;
+  }
+
+  plan->algorithm = TUNER_FFT_BLUESTEIN;
+  plan->factor_count = 0;
+  int M = 1;
+  while (M < 2 * N - 1) {
+    M <<= 1;
+  }
+  plan->M = M;
+  // chirp e^(-pi i t^2 / N) = e^(-2 pi i (t^2 mod 2N) / 2N)
+  for (int t = 0; t < N; ++t) {
+    const uint32_t square = (uint32_t)(((uint64_t)t * t) % (2 * N));
+    unit_root(square, 2 * N, &plan->twiddle_re[t], &plan->twiddle_im[t]);
+  }
+  make_filter(plan);
+  return true;
+}
+
+static void bluestein(struct tuner_fft_plan *plan, float data_re[],
+                      float data_im[]) {
+  const int N = plan->N;
+  const int M = plan->M;
+  struct tuner_fft_scratch *scratch = plan->scratch;
+  if (scratch->filter_N != N) {  // another length's filter is there
+    make_filter(plan);
+  }
+  float *work_re = scratch->work_re;
+  float *work_im = scratch->work_im;
+  const float *filter_re = scratch->filter_re;
+  const float *filter_im = scratch->filter_im;
+  for (int t = 0; t < N; ++t) {
+    work_re[t] = data_re[t] * plan->twiddle_re[t] -
+                 data_im[t] * plan->twiddle_im[t];
+    work_im[t] = data_re[t] * plan->twiddle_im[t] +
+                 data_im[t] * plan->twiddle_re[t];
+  }
+  memset(work_re + N, 0, sizeof(float) * (M - N));
+  memset(work_im + N, 0, sizeof(float) * (M - N));
+  fft(work_re, work_im, M);
+
+  // convolve with the filter, conjugated so that a forward FFT inverts it
+  for (int t = 0; t < M; ++t) {
+    const float re = work_re[t] * filter_re[t] - work_im[t] * filter_im[t];
+    const float im = work_re[t] * filter_im[t] + work_im[t] * filter_re[t];
+    work_re[t] = re;
+    work_im[t] = -im;
+  }
+  fft(work_re, work_im, M);
+
+  // undo the conjugate, scale the inverse, and apply the chirp again
+  const float scale = 1.0f / M;
+  for (int k = 0; k < N; ++k) {
+    const float re = work_re[k] * scale;
+    const float im = -work_im[k] * scale;
+    data_re[k] = re * plan->twiddle_re[k] - im * plan->twiddle_im[k];
+    data_im[k] = re * plan->twiddle_im[k] + im * plan->twiddle_re[k];
+  }
+}
+
+void tuner_fft(struct tuner_fft_plan *plan, float data_re[],
+               float data_im[]) {
+  const int N = plan->N;
+  if (plan->algorithm == TUNER_FFT_RADIX_2) {
+    fft(data_re, data_im, N);
+    return;
+  }
+  if (plan->algorithm == TUNER_FFT_BLUESTEIN) {
+    bluestein(plan, data_re, data_im);
+    return;
+  }
+
+  // stages alternate between the data and the work buffer
+  float *x_re = data_re, *x_im = data_im;
+  float *y_re = plan->scratch->work_re, *y_im = plan->scratch->work_im;
+  int n = N, s = 1;
+  for (int i = 0; i < plan->factor_count; ++i) {
+    const int p = plan->factors[i];
+    mixed_radix_stage(plan, p, n, s, x_re, x_im, y_re, y_im);
+    float *swap_re = x_re, *swap_im = x_im;
+    x_re = y_re;
+    x_im = y_im;
+    y_re = swap_re;
+    y_im = swap_im;
+    n /= p;
+    s *= p;
+  }
+  if (x_re != data_re) {
+    memcpy(data_re, x_re, sizeof(float) * N);
+    memcpy(data_im, x_im, sizeof(float) * N);
+  }
+}
+
+struct tuner_fft_plan *tuner_fft_plan_for(struct tuner_fft_plan_cache *cache,
+                                          int N) {
+  if (N < 1 || N > TUNER_MAX_FFT) {
+    return 0;
+  }
+  for (int i = 0; i < TUNER_PLAN_CACHE; ++i) {
+    if (cache->plans[i].N == N) {
+      return &cache->plans[i];
+    }
+  }
+  struct tuner_fft_plan *plan =
+      &cache->plans[cache->planned++ % TUNER_PLAN_CACHE];
+  tuner_fft_plan_init(plan, N, &cache->scratch);
+  return plan;
+}
+
+/*****************************************************************************/
+/* WINDOWING */
+/*****************************************************************************/
+
+// Blackman-Harris 4-term coefficients
+#define TUNER_BH_A0 0.35875f
+#define TUNER_BH_A1 0.48829f
+#define TUNER_BH_A2 0.14128f
+#define TUNER_BH_A3 0.01168f
+
+// cosine of 2 pi j k / N from the trig engine
+static float cosine_of_fraction(int j, int k, int N) {
+  const uint32_t angle =
+      (uint32_t)(((uint64_t)j * k << TUNER_TURN_BITS) / (uint64_t)N);
+  int32_t sine, cosine;
+  tuner_sincos(angle, &sine, &cosine);
+  return cosine * (1.0f / TUNER_Q30_ONE);
+}
+
+// modified Bessel function of the first kind, order 0, by its power series
+static float bessel_i0(float x) {
+  const float quarter = x * x / 4;
+  float term = 1;
+  float sum = 1;
+  for (int k = 1; term > sum * 1e-9f; ++k) {
+    term *= quarter / ((float)k * k);
+    sum += term;
+  }
+  return sum;
+}
+
+static void build_window(struct tuner_window_table *table, int type, int N) {
+  const float kaiserScale = 1 / bessel_i0(TUNER_KAISER_BETA);
+  for (int j = 0; j <= N / 2; ++j) {
+    float w = 1;
+    switch (type) {
+      case TUNER_WINDOW_HANN:
+        w = 0.5f - 0.5f * cosine_of_fraction(j, 1, N);
+        break;
+      case TUNER_WINDOW_BLACKMAN_HARRIS:
+        w = TUNER_BH_A0 - TUNER_BH_A1 * cosine_of_fraction(j, 1, N) +
+            TUNER_BH_A2 * cosine_of_fraction(j, 2, N) -
+            TUNER_BH_A3 * cosine_of_fraction(j, 3, N);
+        break;
+      case TUNER_WINDOW_KAISER: {
+        const float r = 2.0f * j / N - 1;
+        w = bessel_i0(TUNER_KAISER_BETA * sqrtf(1 - r * r)) * kaiserScale;
+        break;
+      }
+    }
+    table->half[j] = w;
+  }
+  table->type = type;
+  table->N = N;
+}
+
+const float *tuner_window_table(struct tuner_window_cache *cache, int type,
+                                int N) {
+  if (type < 0 || type >= TUNER_WINDOW_TYPES || N < 1 ||
+      N > TUNER_MAX_WINDOW || type == TUNER_WINDOW_RECTANGULAR) {
+    return 0;  // rectangular: the samples are converted as they are
+  }
+  for (int i = 0; i < TUNER_WINDOW_CACHE; ++i) {
+    if (cache->tables[i].N == N && cache->tables[i].type == type) {
+      return cache->tables[i].half;
+    }
+  }
+  struct tuner_window_table *table =
+      &cache->tables[cache->built++ % TUNER_WINDOW_CACHE];
+  build_window(table, type, N);
+  return table->half;
+}
+
+void tuner_window_samples(const float table[], const int samples[],
+                          float data_re[], float data_im[], const int N) {
+  if (!table) {
+    for (int j = 0; j < N; j++) {
+      data_re[j] = (float)samples[j];
+      data_im[j] = 0;
+    }
+    return;
+  }
+  // w[j] and w[N - j] are the same entry, so each load weights two samples
+  data_re[0] = (float)samples[0] * table[0];
+  data_im[0] = 0;
+  int j = 1;
+  for (; j < N - j; ++j) {
+    const float w = table[j];
+    data_re[j] = (float)samples[j] * w;
+    data_re[N - j] = (float)samples[N - j] * w;
+    data_im[j] = 0;
+    data_im[N - j] = 0;
+  }
+  if (j == N - j) {  // the middle of an even N
+    data_re[j] = (float)samples[j] * table[j];
+    data_im[j] = 0;
+  }
+}
+
+/*****************************************************************************/
+/* PEAK SEARCH */
+/*****************************************************************************/
+
+// first and last of the first N / 2 bins strictly inside (min_hz, max_hz),
+// last < first if there are none. Estimated from the Hz, then settled by the
+// test tuner_find_peak() has always made of each bin
+static void band_bins(const int N, int sample_rate, float min_hz,
+                      float max_hz, int *first, int *last) {
+  int lo = (int)((double)min_hz * N / sample_rate) - 1;
+  lo = lo > 0 ? lo : 0;
+  while (lo < N / 2 && !(((1.0) / N) * 1.0 * lo * sample_rate > min_hz)) {
+    ++lo;
+  }
+  int hi = (int)((double)max_hz * N / sample_rate) + 1;
+  hi = hi < N / 2 - 1 ? hi : N / 2 - 1;
+  while (hi >= lo && !(((1.0) / N) * 1.0 * hi * sample_rate < max_hz)) {
+    --hi;
+  }
+  *first = lo;
+  *last = hi;
+}
+
+// bin of the largest positive data_re[] value from first to last (the lowest
+// of equals), or 0 if none is positive
+static int largest_bin(const float data_re[], int first, int last,
+                       float *largest) {
+  int maxK = 0;
+  float maxAmp = 0;
+  for (int i = first; i <= last; i++) {
+    if (data_re[i] > maxAmp) {
+      maxK = i;
+      maxAmp = data_re[i];
+    }
+  }
+  *largest = maxAmp;
+  return maxK;
+}
+
+int tuner_find_peak(const float data_re[], const int N, int sample_rate,
+                    float min_hz, float max_hz) {
+  int first, last;
+  float largest;
+  band_bins(N, sample_rate, min_hz, max_hz, &first, &last);
+  return largest_bin(data_re, first, last, &largest);
+}
+
+/*****************************************************************************/
+/* STRING SEARCH */
+/*****************************************************************************/
+
+#define TUNER_MAX_STRINGS 12
+#define TUNER_HARMONIC_CENTS 5   // a peak this close to a harmonic is on it
+#define TUNER_HARMONIC_WEIGHT 0.25f  // of a candidate on a lower harmonic
+#define TUNER_HEARD_LEVEL 0.05f   // of the loudest string's score
+
+static float bin_magnitude(const float data_re[], const float data_im[],
+                           int k) {
+  return sqrtf(data_re[k] * data_re[k] + data_im[k] * data_im[k]);
+}
+
+// strongest magnitude within a bin of frequency bin k * multiple
+static float partial_magnitude(const float data_re[], const float data_im[],
+                               const int N, int k, int multiple) {
+  int centre = k * multiple;
+  float best = 0;
+  for (int j = centre - 1; j <= centre + 1; ++j) {
+    if (j > 0 && j < N / 2) {
+      float magnitude = bin_magnitude(data_re, data_im, j);
+      best = magnitude > best ? magnitude : best;
+    }
+  }
+  return best;
+}
+
+void tuner_find_strings(const float data_re[], const float data_im[],
+                        const int N, int sample_rate, const float expected[],
+                        int count, struct tuner_string_result results[]) {
+  if (count > TUNER_MAX_STRINGS) {
+    count = TUNER_MAX_STRINGS;
+  }
+  // resolve from the lowest string up, so lower strings' harmonics are known
+  int order[TUNER_MAX_STRINGS];
+  float scores[TUNER_MAX_STRINGS];
+  for (int i = 0; i < count; ++i) {
+    int j = i;
+    while (j > 0 && expected[order[j - 1]] > expected[i]) {
+      order[j] = order[j - 1];
+      --j;
+    }
+    order[j] = i;
+  }
+
+  const float binHz = (float)sample_rate / N;
+  const float bandRatio = powf(2, TUNER_STRING_BAND_CENTS / 1200.0f);
+  // within TUNER_HARMONIC_CENTS of harmonic h is within h / ratio to h ratio
+  const float harmonicRatio = powf(2, TUNER_HARMONIC_CENTS / 1200.0f);
+  float loudest = 0;
+  for (int o = 0; o < count; ++o) {
+    int s = order[o];
+    struct tuner_string_result *result = &results[s];
+    int low = (int)ceilf(expected[s] / bandRatio / binHz);
+    int high = (int)floorf(expected[s] * bandRatio / binHz);
+    if (low < 1) {
+      low = 1;
+    }
+    if (high > N / 6 - 2) {
+      high = N / 6 - 2;  // room for the third harmonic
+    }
+
+    int bestK = 0;
+    float bestScore = 0;
+    bool bestHarmonic = false;
+    for (int k = low; k <= high; ++k) {
+      float here = bin_magnitude(data_re, data_im, k);
+      if (here <= bin_magnitude(data_re, data_im, k - 1) ||
+          here < bin_magnitude(data_re, data_im, k + 1)) {
+        continue;  // not a local maximum
+      }
+      float score = here +
+                    partial_magnitude(data_re, data_im, N, k, 2) / 2 +
+                    partial_magnitude(data_re, data_im, N, k, 3) / 3;
+      bool harmonic = false;
+      for (int l = 0; l < o; ++l) {
+        float lower = results[order[l]].frequency;
+        if (lower <= 0) {
+          continue;
+        }
+        float multiple = k * binHz / lower;
+        int h = (int)(multiple + 0.5f);
+        if (h >= 2 && multiple < h * harmonicRatio &&
+            multiple * harmonicRatio > h) {
+          harmonic = true;
+        }
+      }
+      if (harmonic) {
+        score *= TUNER_HARMONIC_WEIGHT;
+      }
+      if (score > bestScore) {
+        bestK = k;
+        bestScore = score;
+        bestHarmonic = harmonic;
+      }
+    }
+
+    result->frequency = 0;
+    result->cents = 0;
+    result->harmonic = bestHarmonic;
+    scores[s] = bestScore;
+    if (bestK == 0) {
+      continue;
+    }
+    // parabola through the peak and its neighbours for a fractional bin
+    float a = bin_magnitude(data_re, data_im, bestK - 1);
+    float b = bin_magnitude(data_re, data_im, bestK);
+    float c = bin_magnitude(data_re, data_im, bestK + 1);
+    float curvature = a - 2 * b + c;
+    float offset = curvature < 0 ? 0.5f * (a - c) / curvature : 0;
+    result->frequency = (bestK + offset) * binHz;
+    result->cents = (tuner_pitch_millicents(result->frequency) -
+                     tuner_pitch_millicents(expected[s])) /
+                    1000.0f;
+    loudest = bestScore > loudest ? bestScore : loudest;
+  }
+
+  for (int s = 0; s < count; ++s) {
+    results[s].level = loudest > 0 ? scores[s] / loudest : 0;
+    if (results[s].level < TUNER_HEARD_LEVEL) {
+      results[s].frequency = 0;  // too quiet to be one of the strings played
+      results[s].cents = 0;
+    }
+  }
+}
+
+/*****************************************************************************/
+/* HARMONIC SUMMATION */
+/*****************************************************************************/
+
+#define TUNER_PARTIAL_FLOOR 0.25f  // of the strongest partial, to refine with
+#define TUNER_SUBHARMONIC_RATIO 0.4f  // of the winner's mean partial
+
+// strongest squared magnitude, and its bin, within half a bin of a candidate
+// times multiple, where the candidate is at fractional bin k
+static float partial_peak(const float data_re[], const float data_im[],
+                          const int N, float k, int multiple, int *peak) {
+  int low = (int)ceilf(multiple * (k - 0.5f));
+  int high = (int)floorf(multiple * (k + 0.5f));
+  float best = 0;
+  *peak = 0;
+  for (int j = low < 1 ? 1 : low; j <= high && j < N / 2 - 1; ++j) {
+    float power = data_re[j] * data_re[j] + data_im[j] * data_im[j];
+    if (power > best) {
+      best = power;
+      *peak = j;
+    }
+  }
+  return best;
+}
+
+// mean magnitude of the first harmonics partials of candidate k that are not
+// multiples of skip (every partial if skip is 0)
+static float partial_mean(const float data_re[], const float data_im[],
+                          const int N, float k, int harmonics, int skip) {
+  float sum = 0;
+  int count = 0;
+  for (int h = 1; h <= harmonics && h * k < N / 2 - 1; ++h) {
+    if (skip == 0 || h % skip != 0) {
+      int peak;
+      sum += sqrtf(partial_peak(data_re, data_im, N, k, h, &peak));
+      count++;
+    }
+  }
+  return count ? sum / count : 0;
+}
+
+// first and last candidate bin of the band (min_hz, max_hz)
+static void pitch_band(const int N, int sample_rate, float min_hz,
+                       float max_hz, int *low, int *high) {
+  const float binHz = (float)sample_rate / N;
+  *low = (int)floorf(min_hz / binHz) + 1;
+  *high = (int)ceilf(max_hz / binHz) - 1;
+  if (*low < 1) {
+    *low = 1;
+  }
+  if (*high > N / 2 - 2) {
+    *high = N / 2 - 2;
+  }
+}
+
+float tuner_find_pitch(const float data_re[], const float data_im[],
+                       const int N, int sample_rate, float min_hz,
+                       float max_hz) {
+  const float binHz = (float)sample_rate / N;
+  int low, high;
+  pitch_band(N, sample_rate, min_hz, max_hz, &low, &high);
+
+  // the same number of partials for every candidate, all below Nyquist, or
+  // the high notes would lose to their lower octave for want of partials
+  int harmonics = TUNER_HARMONICS;
+  while (harmonics > 1 && harmonics * high >= N / 2 - 1) {
+    harmonics--;
+  }
+
+  // every candidate in the band scored by the sum of its partials' magnitudes
+  int bestK = 0;
+  float bestScore = 0;
+  for (int k = low; k <= high; ++k) {
+    float score = 0;
+    for (int h = 1; h <= harmonics; ++h) {
+      int peak;
+      score += sqrtf(partial_peak(data_re, data_im, N, k, h, &peak));
+    }
+    if (score > bestScore) {
+      bestK = k;
+      bestScore = score;
+    }
+  }
+  if (bestK == 0) {
+    return 0;
+  }
+
+  // A plucked string can have weak odd partials, and then its octave (or
+  // twelfth) outscores it, having partials 2, 4, 6... to sum. Those of the
+  // winner's half (or third) that the winner lacks are real peaks if so
+  float fundamental = bestK;
+  for (int divisor = 2; divisor <= 3; ++divisor) {
+    float below = fundamental / divisor;
+    if (below < low) {
+      break;
+    }
+    float winner =
+        partial_mean(data_re, data_im, N, fundamental, harmonics, 0);
+    if (partial_mean(data_re, data_im, N, below, harmonics, divisor) >
+        TUNER_SUBHARMONIC_RATIO * winner) {
+      fundamental = below;
+      break;
+    }
+  }
+
+  // each strong partial gives f0 to 1/h of a bin; average them by magnitude
+  float magnitudes[TUNER_HARMONICS];
+  int peaks[TUNER_HARMONICS];
+  float strongest = 0;
+  int partials = 0;
+  for (int h = 1; h <= harmonics; ++h) {
+    magnitudes[h - 1] = sqrtf(
+        partial_peak(data_re, data_im, N, fundamental, h, &peaks[h - 1]));
+    strongest = magnitudes[h - 1] > strongest ? magnitudes[h - 1] : strongest;
+    partials = h;
+  }
+  float sum = 0, weights = 0;
+  for (int h = 1; h <= partials; ++h) {
+    int j = peaks[h - 1];
+    if (j == 0 || magnitudes[h - 1] < TUNER_PARTIAL_FLOOR * strongest) {
+      continue;
+    }
+    // parabola through the partial's peak and its neighbours
+    float a = bin_magnitude(data_re, data_im, j - 1);
+    float b = magnitudes[h - 1];
+    float c = bin_magnitude(data_re, data_im, j + 1);
+    float curvature = a - 2 * b + c;
+    float offset = curvature < 0 ? 0.5f * (a - c) / curvature : 0;
+    sum += magnitudes[h - 1] * (j + offset) / h;
+    weights += magnitudes[h - 1];
+  }
+  return weights > 0 ? sum / weights * binHz : fundamental * binHz;
+}
+
+/*****************************************************************************/
+/* PITCH TRACKING */
+/*****************************************************************************/
+
+void tuner_track_init(struct tuner_pitch_tracker *tracker, const int N,
+                      int sample_rate, float min_hz, float max_hz) {
+  tracker->N = N;
+  tracker->sample_rate = sample_rate;
+  tracker->min_hz = min_hz;
+  tracker->max_hz = max_hz;
+  pitch_band(N, sample_rate, min_hz, max_hz, &tracker->first_bin,
+             &tracker->last_bin);
+  tracker->bin = 0;
+  tracker->frequency = 0;
+  tracker->power = 0;
+  tracker->confidence = 0;
+  tracker->windows = 0;
+  tracker->bins_searched = 0;
+}
+
+float tuner_track_pitch(struct tuner_pitch_tracker *tracker,
+                        const float data_re[], const float data_im[]) {
+  const int N = tracker->N;
+  const float binHz = (float)tracker->sample_rate / N;
+  const int first = tracker->first_bin;
+  const int last = tracker->last_bin;
+  const int previous = tracker->bin;
+  const bool refresh = tracker->windows++ % TUNER_TRACK_REFRESH == 0;
+  // the whole band while unlocked, and on a refresh
+  int radius = tracker->confidence > 0 && !refresh ? TUNER_TRACK_RADIUS
+                                                   : TUNER_MAX_WINDOW;
+  for (;;) {
+    const int lo = previous - radius > first ? previous - radius : first;
+    const int hi = previous + radius < last ? previous + radius : last;
+    const bool whole = lo == first && hi == last;
+    // half a bin beyond lo and hi, so that they are the first and last
+    // candidates
+    const float frequency = tuner_find_pitch(
+        data_re, data_im, N, tracker->sample_rate,
+        lo == first ? tracker->min_hz : (lo - 0.5f) * binHz,
+        hi == last ? tracker->max_hz : (hi + 0.5f) * binHz);
+    tracker->bins_searched += hi >= lo ? hi - lo + 1 : 0;
+    const int bin = (int)(frequency / binHz + 0.5f);
+    const float power =
+        bin > 0 ? data_re[bin] * data_re[bin] + data_im[bin] * data_im[bin]
+                : 0;
+
+    // lost if the pitch is on an edge of the neighbourhood that is not the
+    // band's, where it may lie beyond, or its bin has collapsed
+    const bool lost = bin == 0 || (bin <= lo && lo > first) ||
+                      (bin >= hi && hi < last) ||
+                      power < tracker->power * TUNER_TRACK_COLLAPSE;
+    if (whole || !lost) {
+      const bool moved = bin - previous > TUNER_TRACK_RADIUS ||
+                         previous - bin > TUNER_TRACK_RADIUS;
+      tracker->confidence =
+          bin == 0 ? 0 : moved || previous == 0 ? 1 : tracker->confidence + 1;
+      tracker->bin = bin;
+      tracker->frequency = frequency;
+      tracker->power = power;
+      return frequency;
+    }
+    radius *= 2;  // widen until the neighbourhood is the band
+  }
+}
+
+/*****************************************************************************/
+/* CLASSIFIER */
+/*****************************************************************************/
+
+#define TUNER_MANTISSA_BITS 23
+
+static uint32_t float_bits(float value) {
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+static float bits_float(uint32_t bits) {
+  float value;
+  memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+// 1200000 log2(1 + i / 256): millicents over the top 8 bits of a mantissa
+#define TUNER_LOG_TABLE_BITS 8
+static const int32_t log2_millicents[(1 << TUNER_LOG_TABLE_BITS) + 1] = {
+    0, 6749, 13473, 20170, 26841, 33487, 40108,
+    46703, 53273, 59818, 66339, 72835, 79307, 85755,
+    92179, 98579, 104955, 111309, 117638, 123945, 130229,
+    136491, 142729, 148946, 155140, 161312, 167462, 173590,
+    179697, 185782, 191846, 197888, 203910, 209911, 215891,
+    221850, 227789, 233708, 239607, 245485, 251344, 257183,
+    263002, 268802, 274582, 280344, 286086, 291809, 297513,
+    303199, 308865, 314514, 320144, 325756, 331349, 336925,
+    342483, 348023, 353545, 359050, 364537, 370007, 375460,
+    380895, 386314, 391715, 397100, 402468, 407820, 413155,
+    418474, 423776, 429062, 434333, 439587, 444825, 450047,
+    455254, 460445, 465621, 470781, 475926, 481055, 486170,
+    491269, 496354, 501423, 506478, 511518, 516543, 521554,
+    526550, 531532, 536500, 541453, 546393, 551318, 556229,
+    561127, 566010, 570880, 575736, 580579, 585408, 590224,
+    595026, 599815, 604591, 609354, 614103, 618840, 623564,
+    628274, 632972, 637658, 642330, 646991, 651638, 656273,
+    660896, 665507, 670105, 674691, 679265, 683827, 688377,
+    692915, 697441, 701955, 706458, 710948, 715428, 719895,
+    724352, 728796, 733230, 737652, 742063, 746462, 750851,
+    755228, 759594, 763950, 768294, 772627, 776950, 781262,
+    785563, 789854, 794134, 798403, 802662, 806910, 811148,
+    815376, 819594, 823801, 827998, 832184, 836361, 840528,
+    844684, 848831, 852968, 857095, 861212, 865319, 869417,
+    873505, 877583, 881652, 885711, 889760, 893801, 897831,
+    901853, 905865, 909868, 913861, 917846, 921821, 925787,
+    929744, 933693, 937632, 941562, 945483, 949395, 953299,
+    957194, 961080, 964957, 968826, 972686, 976537, 980380,
+    984215, 988041, 991858, 995667, 999468, 1003260, 1007045,
+    1010820, 1014588, 1018348, 1022099, 1025842, 1029577, 1033304,
+    1037023, 1040734, 1044438, 1048133, 1051820, 1055500, 1059172,
+    1062836, 1066492, 1070140, 1073781, 1077415, 1081040, 1084658,
+    1088269, 1091872, 1095467, 1099055, 1102636, 1106209, 1109775,
+    1113334, 1116885, 1120429, 1123966, 1127495, 1131017, 1134533,
+    1138041, 1141542, 1145036, 1148522, 1152002, 1155475, 1158941,
+    1162400, 1165852, 1169298, 1172736, 1176167, 1179592, 1183010,
+    1186422, 1189826, 1193224, 1196615, 1200000,
+};
+
+int32_t tuner_pitch_millicents(float frequency) {
+  const int fractionBits = TUNER_MANTISSA_BITS - TUNER_LOG_TABLE_BITS;
+  uint32_t bits = float_bits(frequency);
+  int32_t exponent = (int32_t)(bits >> TUNER_MANTISSA_BITS) - 127;
+  uint32_t mantissa = bits & ((1u << TUNER_MANTISSA_BITS) - 1);
+  int32_t low = log2_millicents[mantissa >> fractionBits];
+  int32_t high = log2_millicents[(mantissa >> fractionBits) + 1];
+  int32_t fraction = (int32_t)(mantissa & ((1u << fractionBits) - 1));
+  return exponent * 1200000 + low + (((high - low) * fraction) >> fractionBits);
+}
+
+bool tuner_classifier_init(struct tuner_classifier *classifier,
+                           const float targets[], int count) {
+  if (count < 1 || count > TUNER_MAX_TARGETS) {
+    return false;
+  }
+  float sorted[TUNER_MAX_TARGETS];
+  for (int i = 0; i < count; ++i) {
+    int j = i;
+    while (j > 0 && sorted[j - 1] > targets[i]) {
+      sorted[j] = sorted[j - 1];
+      classifier->order[j] = classifier->order[j - 1];
+      --j;
+    }
+    sorted[j] = targets[i];
+    classifier->order[j] = (uint8_t)i;
+  }
+  if (sorted[0] <= 0 ||
+      sorted[count - 1] >= sorted[0] * (1 << (TUNER_CLASSIFIER_OCTAVES - 2))) {
+    return false;
+  }
+  classifier->count = count;
+  for (int i = 0; i + 1 < count; ++i) {
+    classifier->splits[i] = sqrtf(sorted[i] * sorted[i + 1]);
+  }
+  classifier->splits[count - 1] = INFINITY;
+
+  // the table starts at the power of two an octave below the lowest target
+  const int shift = TUNER_MANTISSA_BITS - TUNER_CLASSIFIER_BITS;
+  uint32_t exponent = float_bits(sorted[0] / 2) >> TUNER_MANTISSA_BITS;
+  classifier->first_cell = exponent << TUNER_CLASSIFIER_BITS;
+  int target = 0;
+  const int cells = TUNER_CLASSIFIER_OCTAVES << TUNER_CLASSIFIER_BITS;
+  for (int cell = 0; cell < cells; ++cell) {
+    float lowerEdge = bits_float((classifier->first_cell + cell) << shift);
+    while (lowerEdge > classifier->splits[target]) {
+      target++;
+    }
+    classifier->cells[cell] = (uint8_t)target;
+  }
+  return true;
+}
+
+int tuner_classify(const struct tuner_classifier *classifier,
+                   float frequency) {
+  if (!(frequency > 0)) {
+    return -1;
+  }
+  const int shift = TUNER_MANTISSA_BITS - TUNER_CLASSIFIER_BITS;
+  int32_t cell = (int32_t)(float_bits(frequency) >> shift) -
+                 (int32_t)classifier->first_cell;
+  const int32_t cells = TUNER_CLASSIFIER_OCTAVES << TUNER_CLASSIFIER_BITS;
+  int target;
+  if (cell < 0) {
+    target = 0;
+  } else if (cell >= cells) {
+    target = classifier->count - 1;
+  } else {
+    target = classifier->cells[cell];
+    target += frequency > classifier->splits[target];
+  }
+  return classifier->order[target];
+}
+
+/*****************************************************************************/
+/* TRIGONOMETRY */
+/*****************************************************************************/
+
+// (1 << 30) sin(i pi / 512): a quarter wave in 256 steps of 0.35 degrees
+#define TUNER_SINE_TABLE_BITS 8
+static const int32_t quarter_sine[(1 << TUNER_SINE_TABLE_BITS) + 1] = {
+    0, 6588356, 13176464, 19764076, 26350943, 32936819,
+    39521455, 46104602, 52686014, 59265442, 65842639, 72417357,
+    78989349, 85558366, 92124163, 98686491, 105245103, 111799753,
+    118350194, 124896179, 131437462, 137973796, 144504935, 151030634,
+    157550647, 164064728, 170572633, 177074115, 183568930, 190056834,
+    196537583, 203010932, 209476638, 215934457, 222384147, 228825464,
+    235258165, 241682010, 248096755, 254502159, 260897982, 267283981,
+    273659918, 280025552, 286380643, 292724951, 299058239, 305380268,
+    311690799, 317989595, 324276419, 330551034, 336813204, 343062693,
+    349299266, 355522689, 361732726, 367929144, 374111709, 380280190,
+    386434353, 392573967, 398698801, 404808624, 410903207, 416982319,
+    423045732, 429093217, 435124548, 441139496, 447137835, 453119340,
+    459083786, 465030947, 470960600, 476872522, 482766489, 488642281,
+    494499676, 500338453, 506158392, 511959275, 517740883, 523502998,
+    529245404, 534967884, 540670223, 546352205, 552013618, 557654248,
+    563273883, 568872310, 574449320, 580004702, 585538248, 591049748,
+    596538995, 602005783, 607449906, 612871159, 618269338, 623644239,
+    628995660, 634323400, 639627258, 644907034, 650162530, 655393548,
+    660599890, 665781362, 670937767, 676068911, 681174602, 686254647,
+    691308855, 696337036, 701339000, 706314559, 711263525, 716185713,
+    721080937, 725949013, 730789757, 735602987, 740388522, 745146182,
+    749875788, 754577161, 759250125, 763894504, 768510122, 773096806,
+    777654384, 782182683, 786681534, 791150767, 795590213, 799999706,
+    804379079, 808728167, 813046808, 817334838, 821592095, 825818421,
+    830013654, 834177638, 838310216, 842411232, 846480531, 850517961,
+    854523370, 858496606, 862437520, 866345964, 870221790, 874064853,
+    877875009, 881652112, 885396022, 889106597, 892783698, 896427186,
+    900036924, 903612776, 907154608, 910662286, 914135678, 917574653,
+    920979082, 924348837, 927683790, 930983817, 934248793, 937478595,
+    940673101, 943832191, 946955747, 950043650, 953095785, 956112036,
+    959092290, 962036435, 964944360, 967815955, 970651112, 973449725,
+    976211688, 978936898, 981625251, 984276646, 986890984, 989468165,
+    992008094, 994510675, 996975812, 999403415, 1001793390, 1004145648,
+    1006460100, 1008736660, 1010975242, 1013175761, 1015338134, 1017462281,
+    1019548121, 1021595575, 1023604567, 1025575020, 1027506862, 1029400018,
+    1031254418, 1033069992, 1034846671, 1036584389, 1038283080, 1039942680,
+    1041563127, 1043144360, 1044686319, 1046188946, 1047652185, 1049075980,
+    1050460278, 1051805027, 1053110176, 1054375676, 1055601479, 1056787540,
+    1057933813, 1059040255, 1060106826, 1061133483, 1062120190, 1063066909,
+    1063973603, 1064840240, 1065666786, 1066453210, 1067199483, 1067905576,
+    1068571464, 1069197120, 1069782521, 1070327646, 1070832474, 1071296985,
+    1071721163, 1072104991, 1072448455, 1072751542, 1073014240, 1073236540,
+    1073418433, 1073559913, 1073660973, 1073721611, 1073741824,
+};
+
+// atan(2^-i) in binary angle units: the rotation of each CORDIC step
+static const uint32_t cordic_angles[TUNER_CORDIC_ITERATIONS] = {
+    536870912u, 316933406u, 167458907u, 85004756u, 42667331u,
+    21354465u, 10679838u, 5340245u, 2670163u, 1335087u,
+    667544u, 333772u, 166886u, 83443u, 41722u,
+    20861u, 10430u, 5215u, 2608u, 1304u,
+    652u, 326u, 163u, 81u, 41u,
+    20u, 10u, 5u, 3u, 1u,
+};
+
+#define TUNER_CORDIC_INVERSE_GAIN 652032874  // Q30 of 1 / 1.64676025812
+#define TUNER_PI_Q30 3373259426u             // Q30 of pi
+#define TUNER_CORDIC_INPUT_BITS 29  // headroom for the gain and the diagonal
+
+static int32_t multiply_q30(int32_t a, int32_t b) {
+  return (int32_t)(((int64_t)a * b + (1 << 29)) >> 30);
+}
+
+void tuner_sincos(uint32_t angle, int32_t *sine, int32_t *cosine) {
+  // quadrant, table step within it and the rest of the angle
+  const int stepShift = TUNER_TURN_BITS - 2 - TUNER_SINE_TABLE_BITS;
+  const uint32_t quadrant = angle >> (TUNER_TURN_BITS - 2);
+  const uint32_t step =
+      (angle >> stepShift) & ((1u << TUNER_SINE_TABLE_BITS) - 1);
+  const uint32_t rest = angle & ((1u << stepShift) - 1);
+
+  // the rest in Q30 radians is under 0.0062, so sin is x - x^3 / 6 and
+  // cos 1 - x^2 / 2 to well inside an LSB
+  const int32_t x =
+      (int32_t)(((uint64_t)rest * TUNER_PI_Q30 + (1u << 30)) >> 31);
+  const int32_t x2 = multiply_q30(x, x);
+  const int32_t restSine = x - multiply_q30(x2, x) / 6;
+  const int32_t restCosine = TUNER_Q30_ONE - x2 / 2;
+
+  const int32_t stepSine = quarter_sine[step];
+  const int32_t stepCosine = quarter_sine[(1 << TUNER_SINE_TABLE_BITS) - step];
+  // each pair of products summed before it is rounded
+  const int32_t s = (int32_t)(((int64_t)stepSine * restCosine +
+                               (int64_t)stepCosine * restSine + (1 << 29)) >>
+                              30);
+  const int32_t c = (int32_t)(((int64_t)stepCosine * restCosine -
+                               (int64_t)stepSine * restSine + (1 << 29)) >>
+                              30);
+  switch (quadrant) {
+    case 0: *sine = s; *cosine = c; break;
+    case 1: *sine = c; *cosine = -s; break;
+    case 2: *sine = -s; *cosine = -c; break;
+    default: *sine = -c; *cosine = s; break;
+  }
+}
+
+// rotates (x, y), both within 2^TUNER_CORDIC_INPUT_BITS, onto the positive x
+// axis. Returns the length times the CORDIC gain, and the angle turned through
+// (that of (x, y)) in *angle
+static int32_t cordic_vector(int32_t x, int32_t y, uint32_t *angle) {
+  uint32_t turned = 0;
+  if (x < 0) {  // into the right half plane, where the steps converge
+    x = -x;
+    y = -y;
+    turned = 1u << (TUNER_TURN_BITS - 1);
+  }
+  for (int i = 0; i < TUNER_CORDIC_ITERATIONS; ++i) {
+    // turn towards the axis: clockwise above it, anticlockwise below. The
+    // sign mask negates without a branch, which the data would mispredict
+    const int32_t below = y >> 31;
+    const int32_t dx = ((y >> i) ^ below) - below;
+    const int32_t dy = ((x >> i) ^ below) - below;
+    x += dx;
+    y -= dy;
+    turned += ((int32_t)cordic_angles[i] ^ below) - below;
+  }
+  *angle = turned;
+  return x;
+}
+
+// left shift (negative for right) that brings the larger of |x| and |y| to
+// just under 2^TUNER_CORDIC_INPUT_BITS
+static int cordic_shift(int32_t x, int32_t y) {
+  uint32_t largest = x < 0 ? -(uint32_t)x : (uint32_t)x;
+  const uint32_t other = y < 0 ? -(uint32_t)y : (uint32_t)y;
+  if (other > largest) largest = other;
+  return __builtin_clz(largest) - (32 - TUNER_CORDIC_INPUT_BITS);
+}
+
+static int32_t shift_signed(int32_t value, int shift) {
+  return shift >= 0 ? (int32_t)((uint32_t)value << shift) : value >> -shift;
+}
+
+uint32_t tuner_atan2(int32_t y, int32_t x) {
+  if (x == 0 && y == 0) {
+    return 0;
+  }
+  const int shift = cordic_shift(x, y);
+  uint32_t angle;
+  cordic_vector(shift_signed(x, shift), shift_signed(y, shift), &angle);
+  return angle;
+}
+
+uint32_t tuner_magnitude(int32_t x, int32_t y) {
+  if (x == 0 && y == 0) {
+    return 0;
+  }
+  const int shift = cordic_shift(x, y);
+  uint32_t angle;
+  const int32_t scaled = multiply_q30(
+      cordic_vector(shift_signed(x, shift), shift_signed(y, shift), &angle),
+      TUNER_CORDIC_INVERSE_GAIN);
+  if (shift > 0) {  // rounded back down to the size of the inputs
+    return ((uint32_t)scaled + (1u << (shift - 1))) >> shift;
+  }
+  return (uint32_t)scaled << -shift;
+}
+
+#define TUNER_RADIANS_TO_TURN 683565275.576f  // 2^32 / 2 pi
+#define TUNER_TURN_TO_RADIANS 1.46291807927e-9f  // 2 pi / 2^32
+#define TUNER_Q30_TO_FLOAT (1.0f / TUNER_Q30_ONE)
+
+// float exponent field of the power of two that brings the larger of |x| and
+// |y| to just under 2^TUNER_CORDIC_INPUT_BITS, or 0 if both are zero or out
+// of range. Powers of two scale exactly, and back again without a divide
+static int32_t cordic_exponent(float x, float y) {
+  uint32_t largest = float_bits(x) & 0x7fffffffu;
+  const uint32_t other = float_bits(y) & 0x7fffffffu;
+  if (other > largest) largest = other;
+  const int32_t exponent = (int32_t)(largest >> TUNER_MANTISSA_BITS);
+  if (exponent == 0) {
+    return 0;
+  }
+  // a float with this exponent is in [2^(exponent - 127), 2^(exponent - 126))
+  const int32_t scaled = 127 + (TUNER_CORDIC_INPUT_BITS - 1) - (exponent - 127);
+  return scaled >= 1 && scaled <= 253 ? scaled : 0;
+}
+
+void tuner_sincosf(float angle, float *sine, float *cosine) {
+  // the float's own 24 bits, not the conversion, limit the result
+  const uint32_t turn = (uint32_t)(int64_t)(angle * TUNER_RADIANS_TO_TURN);
+  int32_t s, c;
+  tuner_sincos(turn, &s, &c);
+  *sine = s * TUNER_Q30_TO_FLOAT;
+  *cosine = c * TUNER_Q30_TO_FLOAT;
+}
+
+void tuner_polarf(float x, float y, float *length, float *angle) {
+  const int32_t exponent = cordic_exponent(x, y);
+  if (exponent == 0) {
+    *length = 0;
+    *angle = 0;
+    return;
+  }
+  const float scale = bits_float((uint32_t)exponent << TUNER_MANTISSA_BITS);
+  const float unscale =
+      bits_float((uint32_t)(254 - exponent) << TUNER_MANTISSA_BITS);
+  uint32_t turned;
+  const int32_t gained =
+      cordic_vector((int32_t)(x * scale), (int32_t)(y * scale), &turned);
+  *length = multiply_q30(gained, TUNER_CORDIC_INVERSE_GAIN) * unscale;
+  *angle = (int32_t)turned * TUNER_TURN_TO_RADIANS;
+}
+
+float tuner_atan2f(float y, float x) {
+  float length, angle;
+  tuner_polarf(x, y, &length, &angle);
+  return angle;
+}
+
+float tuner_hypotf(float x, float y) {
+  float length, angle;
+  tuner_polarf(x, y, &length, &angle);
+  return length;
+}
+
+/*****************************************************************************/
+/* STREAMING */
+/*****************************************************************************/
+
+bool tuner_init(tuner_state *state, const struct tuner_config *config) {
+  int window = config->window;
+  if (window < 2 || window > TUNER_MAX_WINDOW ||
+      config->hop < 1 || config->hop > window || config->sample_rate <= 0 ||
+      config->min_hz >= config->max_hz || config->decimation < 0 ||
+      config->window_type < 0 || config->window_type >= TUNER_WINDOW_TYPES) {
+    return false;
+  }
+  state->config = *config;
+  if (state->config.decimation < 1) {
+    state->config.decimation = 1;
+  }
+  state->decimation_sum = 0;
+  state->decimation_count = 0;
+  state->pushed = 0;
+  state->position = 0;
+  state->until_analysis = window;  // the first analysis needs a full window
+  state->result_head = 0;
+  state->result_tail = 0;
+  state->results_dropped = 0;
+  memset(state->ring, 0, sizeof(int) * 2 * window);
+  tuner_fft_plan_init(&state->plan, window, &state->scratch);
+  // empty the window cache, then build the table now rather than in the
+  // first analysis
+  state->windows.built = 0;
+  for (int i = 0; i < TUNER_WINDOW_CACHE; ++i) {
+    state->windows.tables[i].N = 0;
+  }
+  tuner_window_table(&state->windows, config->window_type, window);
+  tuner_track_init(&state->tracker, window,
+                   state->config.sample_rate / state->config.decimation,
+                   state->config.min_hz, state->config.max_hz);
+  return true;
+}
+
+// transforms the latest window, oldest sample first, and queues its pitch
+static void analyse_window(tuner_state *state) {
+  const int N = state->config.window;
+  tuner_window_samples(
+      tuner_window_table(&state->windows, state->config.window_type, N),
+      state->ring + state->position, state->re, state->im, N);
+
+  tuner_fft(&state->plan, state->re, state->im);
+  if (state->config.full_search) {
+    state->tracker.confidence = 0;  // unlocked: the whole band is searched
+  }
+  const float frequency =
+      tuner_track_pitch(&state->tracker, state->re, state->im);
+
+  if (state->result_head - state->result_tail >= TUNER_RESULT_QUEUE) {
+    state->results_dropped++;
+    return;
+  }
+  struct tuner_result *result =
+      &state->results[state->result_head % TUNER_RESULT_QUEUE];
+  result->bin = state->tracker.bin;
+  result->frequency = frequency;
+  result->magnitude = sqrtf(state->tracker.power);
+  result->end_sample = state->pushed;
+  state->result_head++;
+}
+
+// stores one analysed sample, analysing if that completes a hop
+static void push_analysed_sample(tuner_state *state, int sample) {
+  state->ring[state->position] = sample;
+  state->ring[state->position + state->config.window] = sample;
+  if (++state->position == state->config.window) {
+    state->position = 0;
+  }
+  if (--state->until_analysis == 0) {
+    analyse_window(state);
+    state->until_analysis = state->config.hop;
+  }
+}
+
+void tuner_push_samples(tuner_state *state, const int16_t *samples, int n) {
+  const int decimation = state->config.decimation;
+  if (decimation > 1) {
+    for (int i = 0; i < n; ++i) {
+      state->decimation_sum += samples[i];
+      state->pushed++;
+      if (++state->decimation_count == decimation) {
+        // the mean, rounded to the nearest
+        const int32_t sum = state->decimation_sum;
+        const int32_t half = sum < 0 ? -decimation / 2 : decimation / 2;
+        push_analysed_sample(state, (sum + half) / decimation);
+        state->decimation_sum = 0;
+        state->decimation_count = 0;
+      }
+    }
+    return;
+  }
+
+  const int window = state->config.window;
+  while (n > 0) {
+    int count = n < state->until_analysis ? n : state->until_analysis;
+    // no further than the end of the ring, which then wraps
+    if (count > window - state->position) {
+      count = window - state->position;
+    }
+    int *ring = state->ring + state->position;
+    for (int i = 0; i < count; ++i) {
+      ring[i] = samples[i];
+      ring[i + window] = samples[i];
+    }
+    state->position += count;
+    if (state->position == window) {
+      state->position = 0;
+    }
+    state->pushed += count;
+    state->until_analysis -= count;
+    samples += count;
+    n -= count;
+
+    if (state->until_analysis == 0) {
+      analyse_window(state);
+      state->until_analysis = state->config.hop;
+    }
+  }
+}
+
+bool tuner_poll_result(tuner_state *state, struct tuner_result *result) {
+  if (state->result_tail == state->result_head) {
+    return false;
+  }
+  *result = state->results[state->result_tail % TUNER_RESULT_QUEUE];
+  state->result_tail++;
+  return true;
+}
@@ -0,0 +1,357 @@
+/*
+ * Pitch analysis library shared by the board (main.c) and the host tools
+ * (host.c). It is plain C with no device access and no allocation: a
+ * tuner_state holds every buffer, so the caller decides where it lives
+ * (a static on the board, anywhere on the host) and pushing samples never
+ * allocates.
+ *
+ * Streaming use:
+ *
+ *   static tuner_state tuner;
+ *   struct tuner_config config = {.sample_rate = 8000, .window = 16384,
+ *                                 .hop = 4096, .min_hz = 50, .max_hz = 380,
+ *                                 .window_type = TUNER_WINDOW_HANN};
+ *   tuner_init(&tuner, &config);
+ *   ...
+ *   tuner_push_samples(&tuner, block, n);  // any block size
+ *   struct tuner_result result;
+ *   while (tuner_poll_result(&tuner, &result)) { ... }
+ *
+ * Every hop samples, once a whole window has been pushed, the latest window
+ * is weighted by config.window_type and transformed, and its fundamental in
+ * [min_hz, max_hz] is queued as a result. The fundamental comes from
+ * tuner_find_pitch(), as the board's own readings do, and is tracked from
+ * one window to the next unless config.full_search is set.
+ */
+
+#ifndef TUNER_H
+#define TUNER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define TUNER_MAX_WINDOW 16384  // samples
+#define TUNER_RESULT_QUEUE 8    // results held until polled, a power of two
+
+struct tuner_config {
+  int sample_rate;  // Hz
+  int window;       // samples per analysis, up to the maximum
+  int hop;          // samples between analyses, 1 to window
+  float min_hz;     // band searched for the peak
+  float max_hz;
+  int decimation;   // input samples averaged into each analysed sample, so
+                    // window, hop and bins are at sample_rate / decimation.
+                    // 0 or 1 analyses every sample
+  int window_type;  // enum tuner_window_type, applied to every window
+  bool full_search;  // search the whole band in every window rather than
+                     // near the last pitch
+};
+
+// in-place radix-2 FFT of N points (a power of two), in two stages. For
+// N = TUNER_FFT_FIXED_N these run the generated kernel in fft_16384.h
+// (constant tables and bounds, radix-4 first stages)
+#ifndef TUNER_GENERIC_FFT
+#define TUNER_FFT_FIXED_N 16384
+#endif
+void rearrange(float data_re[], float data_im[], const int N);
+void compute(float data_re[], float data_im[], const int N);
+void fft(float data_re[], float data_im[], const int N);
+
+// the same for any N, with twiddles computed as they are needed
+void rearrange_generic(float data_re[], float data_im[], const int N);
+void compute_generic(float data_re[], float data_im[], const int N);
+void fft_generic(float data_re[], float data_im[], const int N);
+
+// Any N: a plan transforms a length that need not be a power of two, in
+// place and in natural order like fft() (which it calls for a power of two).
+// N made of factors 2, 3 and 5 runs self-sorting mixed-radix stages (radix 4,
+// 2, 3 and 5), so there is no reordering pass; any other N runs Bluestein's
+// algorithm, a chirp convolution through power-of-two FFTs of at least
+// 2N - 1 points. A plan holds its twiddles and a transform's working buffers
+// are in a scratch shared by the plans of one thread, so a transform never
+// allocates, and a plan and its scratch belong to one thread at a time
+#define TUNER_MAX_FFT TUNER_MAX_WINDOW
+#define TUNER_MAX_CONVOLUTION (2 * TUNER_MAX_FFT)
+#define TUNER_MAX_FACTORS 16
+
+enum tuner_fft_algorithm {
+  TUNER_FFT_RADIX_2,
+  TUNER_FFT_MIXED_RADIX,
+  TUNER_FFT_BLUESTEIN,
+};
+
+// what a transform needs only while it runs. Bluestein's filter depends on N
+// alone, so it stays until a plan of another Bluestein length runs
+struct tuner_fft_scratch {
+  int filter_N;  // Bluestein length the filter is for, 0 if none
+  // output of a mixed-radix stage, or Bluestein's convolution
+  float work_re[TUNER_MAX_CONVOLUTION];
+  float work_im[TUNER_MAX_CONVOLUTION];
+  // transform of the conjugate chirp, for Bluestein
+  float filter_re[TUNER_MAX_CONVOLUTION];
+  float filter_im[TUNER_MAX_CONVOLUTION];
+};
+
+struct tuner_fft_plan {
+  int N;
+  int algorithm;
+  int factor_count;
+  int factors[TUNER_MAX_FACTORS];  // radix of each mixed-radix stage
+  int M;                           // Bluestein convolution length
+  struct tuner_fft_scratch *scratch;
+  // e^(-2 pi i t / N) for mixed radix, the chirp e^(-pi i t^2 / N) for
+  // Bluestein
+  float twiddle_re[TUNER_MAX_FFT];
+  float twiddle_im[TUNER_MAX_FFT];
+};
+
+// plans transforms of N points, working in scratch. Returns false unless
+// 1 <= N <= TUNER_MAX_FFT
+bool tuner_fft_plan_init(struct tuner_fft_plan *plan, int N,
+                         struct tuner_fft_scratch *scratch);
+
+// in-place FFT of plan->N points
+void tuner_fft(struct tuner_fft_plan *plan, float data_re[], float data_im[]);
+
+// Plans of the lengths in use, so that moving between a few lengths (one per
+// string) plans each of them once. There is a plan for each of the board's
+// six capture lengths, and one scratch for all of them
+#define TUNER_PLAN_CACHE 6  // plans held by a tuner_fft_plan_cache
+
+// zero-initialised, a cache is empty
+struct tuner_fft_plan_cache {
+  uint32_t planned;  // plans made so far; the next replaces the oldest
+  struct tuner_fft_scratch scratch;
+  struct tuner_fft_plan plans[TUNER_PLAN_CACHE];
+};
+
+// the plan for N points from cache, or else made in it, or 0 if N is out of
+// range. It stays valid until TUNER_PLAN_CACHE more plans are made
+struct tuner_fft_plan *tuner_fft_plan_for(struct tuner_fft_plan_cache *cache,
+                                          int N);
+
+// Windowing: samples are weighted as they are converted to float, in the
+// same pass that clears the imaginary parts, from a table of the window for
+// its type and length built once and kept in a cache
+enum tuner_window_type {
+  TUNER_WINDOW_RECTANGULAR,
+  TUNER_WINDOW_HANN,
+  TUNER_WINDOW_BLACKMAN_HARRIS,  // 4-term, sidelobes below -92 dB
+  TUNER_WINDOW_KAISER,           // with TUNER_KAISER_BETA
+  TUNER_WINDOW_TYPES
+};
+#define TUNER_KAISER_BETA 8.6f
+#define TUNER_WINDOW_CACHE 4  // tables held by a tuner_window_cache
+
+// The windows are periodic (w[j] = w[N - j]), so a table holds w[0] to
+// w[N / 2]
+#define TUNER_WINDOW_TABLE (TUNER_MAX_WINDOW / 2 + 1)
+
+struct tuner_window_table {
+  int type;
+  int N;  // 0 while the entry is empty
+  float half[TUNER_WINDOW_TABLE];
+};
+
+// zero-initialised, a cache is empty
+struct tuner_window_cache {
+  uint32_t built;  // tables built so far; the next replaces the oldest
+  struct tuner_window_table tables[TUNER_WINDOW_CACHE];
+};
+
+// the table of the window of type and N points (up to the maximum window),
+// from cache or else built into it, or 0 if either is out of range or the
+// window is rectangular, which needs no table. It stays valid until
+// TUNER_WINDOW_CACHE more tables are built. Finding a table only reads the
+// cache, so threads may share one once it holds theirs
+const float *tuner_window_table(struct tuner_window_cache *cache, int type,
+                                int N);
+
+// data_re[j] = samples[j] w[j] and data_im[j] = 0 in one pass over the N
+// samples, w being the window whose table is given (none if it is 0)
+void tuner_window_samples(const float table[], const int samples[],
+                          float data_re[], float data_im[], const int N);
+
+// bin of the largest data_re[] value strictly inside (min_hz, max_hz) among
+// the first N / 2 bins, or 0 if none is positive. Only the band's bins are
+// visited
+int tuner_find_peak(const float data_re[], const int N, int sample_rate,
+                    float min_hz, float max_hz);
+
+// Harmonic summation: a fundamental whose own bin is weaker than its
+// partials, as on the low E and A strings, is still found
+#define TUNER_HARMONICS 5  // partials summed for each candidate
+
+// fundamental in (min_hz, max_hz) of the transform of an N-point window, or
+// 0 if the band is silent. Each candidate bin in the band is scored by the
+// magnitudes of its first TUNER_HARMONICS partials (fewer if max_hz's would
+// pass Nyquist), so only the band and its multiples are visited, not the
+// whole spectrum. The winner drops an octave
+// (or a twelfth) if the partials only that lower note has are present too,
+// then is refined from its strong partials, each of which pins f0 to a
+// fraction of a bin
+float tuner_find_pitch(const float data_re[], const float data_im[],
+                       const int N, int sample_rate, float min_hz,
+                       float max_hz);
+
+// Pitch tracking: from one window of a stream to the next the pitch moves
+// little, so a tracker keeps the last fundamental tuner_find_pitch() found
+// and scores only the candidates within TUNER_TRACK_RADIUS bins of it. It is
+// lost if the new one is on an edge of that neighbourhood (the pitch may lie
+// beyond) or the power of its bin has collapsed below TUNER_TRACK_COLLAPSE of
+// the last; the neighbourhood then doubles until the pitch holds or it covers
+// the band. The whole band is searched every TUNER_TRACK_REFRESH windows so
+// that a louder note elsewhere takes over
+#define TUNER_TRACK_RADIUS 8          // bins
+#define TUNER_TRACK_COLLAPSE 0.0625f  // of the power, a quarter of magnitude
+#define TUNER_TRACK_REFRESH 16        // windows
+
+struct tuner_pitch_tracker {
+  int N;
+  int sample_rate;
+  float min_hz;       // the band
+  float max_hz;
+  int first_bin;      // of the band's candidates
+  int last_bin;
+  int bin;            // nearest the last pitch, 0 if there was none
+  float frequency;    // the last pitch, Hz
+  float power;        // of its bin
+  int confidence;     // windows the pitch has held, 0 while unlocked
+  uint32_t windows;        // tracked so far
+  uint32_t bins_searched;  // candidates scored in all of them
+};
+
+// sets tracker up for transforms of N points and the band (min_hz, max_hz),
+// unlocked
+void tuner_track_init(struct tuner_pitch_tracker *tracker, const int N,
+                      int sample_rate, float min_hz, float max_hz);
+
+// fundamental in the band of the transform in data_re and data_im, as
+// tuner_find_pitch() finds it, searched for near the last one while it holds;
+// 0 if the band is silent
+float tuner_track_pitch(struct tuner_pitch_tracker *tracker,
+                        const float data_re[], const float data_im[]);
+
+// Streaming, as at the top of this file
+struct tuner_result {
+  float frequency;      // Hz, 0 if nothing was found in the band
+  float magnitude;      // |X[bin]|
+  int bin;              // of the window's transform nearest frequency
+  uint32_t end_sample;  // input samples pushed when the window was complete
+};
+
+typedef struct tuner_state {
+  struct tuner_config config;
+  uint32_t pushed;      // samples pushed since tuner_init()
+  int position;         // next slot of ring; the oldest sample once full
+  int until_analysis;   // samples to push before the next analysis
+  int32_t decimation_sum;   // of the input samples averaged so far
+  int decimation_count;
+  uint32_t result_head;       // results queued so far
+  uint32_t result_tail;       // results polled so far
+  uint32_t results_dropped;   // queued while the queue was full
+  struct tuner_result results[TUNER_RESULT_QUEUE];
+  // the latest window of samples, each written twice (at position and a
+  // window on), so that from ring + position the window is in order
+  int ring[2 * TUNER_MAX_WINDOW];
+  float re[TUNER_MAX_WINDOW];    // transform of the last window analysed
+  float im[TUNER_MAX_WINDOW];
+  struct tuner_fft_plan plan;    // of the window's transform
+  struct tuner_fft_scratch scratch;
+  struct tuner_window_cache windows;  // holding config.window_type's
+  struct tuner_pitch_tracker tracker;
+} tuner_state;
+
+// checks config and empties state. Returns false if config is not usable
+bool tuner_init(tuner_state *state, const struct tuner_config *config);
+
+// consumes n samples straight from the caller's block, analysing each time a
+// hop completes. The block is not kept
+void tuner_push_samples(tuner_state *state, const int16_t *samples, int n);
+
+// takes the oldest queued result. Returns false if there is none
+bool tuner_poll_result(tuner_state *state, struct tuner_result *result);
+
+// Polyphonic search: one transform of a strum, one result per string
+#define TUNER_STRING_BAND_CENTS 100  // searched either side of each string
+
+struct tuner_string_result {
+  float frequency;  // Hz, 0 if the string was not heard
+  float cents;      // from the expected frequency
+  float level;      // score relative to the loudest string, 0 to 1
+  bool harmonic;    // the peak also lies on a harmonic of a lower string
+};
+
+// finds each of count strings (expected frequencies in any order) in the
+// transform of an N-point window, searching only near its expected frequency.
+// Candidates are the local maxima of the magnitude in the band, scored by
+// their own first three harmonics; a candidate on a harmonic of a lower
+// string that was already found counts a quarter (TUNER_HARMONIC_WEIGHT), so
+// a strong partial of the low E does not pass for a detuned B or high E
+void tuner_find_strings(const float data_re[], const float data_im[],
+                        const int N, int sample_rate, const float expected[],
+                        int count, struct tuner_string_result results[]);
+
+// Classifier: the nearest of a set of target pitches (strings or notes) for
+// a frequency in constant time and without a log. The exponent and top
+// mantissa bits of a float are a piecewise linear log2, so they index a table
+// of cells at most 13.5 cents wide; each cell holds the target nearest its
+// lower edge, and one comparison with the geometric mean of that target and
+// the next settles the cell where the nearest target changes
+#define TUNER_CLASSIFIER_BITS 7      // mantissa bits: 128 cells per octave
+#define TUNER_CLASSIFIER_OCTAVES 8   // covered from an octave below the lowest
+#define TUNER_MAX_TARGETS 96         // target up
+
+struct tuner_classifier {
+  int count;
+  uint32_t first_cell;               // cell index of the table's first entry
+  float splits[TUNER_MAX_TARGETS];   // between target i and i + 1, ascending
+  uint8_t order[TUNER_MAX_TARGETS];  // caller's index of the ith lowest
+  uint8_t cells[TUNER_CLASSIFIER_OCTAVES << TUNER_CLASSIFIER_BITS];
+};
+
+// builds the table for count targets given in any order, at least a
+// semitone apart. Returns false if there are too many or they span more than
+// TUNER_CLASSIFIER_OCTAVES - 2 octaves
+bool tuner_classifier_init(struct tuner_classifier *classifier,
+                           const float targets[], int count);
+
+// index into the targets given to tuner_classifier_init() of the one nearest
+// frequency in cents, or -1 if frequency is not positive
+int tuner_classify(const struct tuner_classifier *classifier,
+                   float frequency);
+
+// pitch of a positive frequency in millicents above 1 Hz (1200000 an
+// octave), so the cents between two frequencies are a subtraction. From the
+// float's exponent and a table of log2 over its mantissa, to 0.01 cents
+int32_t tuner_pitch_millicents(float frequency);
+
+// Trigonometry without libm, for the soft-core build where sin, cos and
+// atan2 are software doubles. Angles are binary, a whole turn being 2^32, so
+// they wrap for free; sines, cosines and their fixed-point ones are Q30
+// (1 << 30 is 1.0). Worst errors against libm in doubles (tuner-host trig):
+//   tuner_sincos      3 LSB (3e-9): 257-entry quarter-wave table, then the
+//                     angle-addition formulas with a two-term Taylor series
+//                     for the remaining step of at most 0.35 degrees
+//   tuner_atan2       4e-8 rad: TUNER_CORDIC_ITERATIONS steps of CORDIC
+//                     vectoring on inputs normalised to 29 bits
+//   tuner_magnitude   5e-8 relative, from the same rotation, and rounded to
+//                     an integer like its inputs
+// The float forms are limited by the float itself: 4e-7 for sines, cosines
+// and angles within [-pi, pi], 1e-7 relative for lengths
+#define TUNER_TURN_BITS 32         // binary angle units in a turn: 2^32
+#define TUNER_Q30_ONE (1 << 30)
+#define TUNER_CORDIC_ITERATIONS 30
+
+void tuner_sincos(uint32_t angle, int32_t *sine, int32_t *cosine);
+uint32_t tuner_atan2(int32_t y, int32_t x);  // of (x, y); 0 for (0, 0)
+uint32_t tuner_magnitude(int32_t x, int32_t y);
+
+// the same on floats in radians, for the float DSP paths
+void tuner_sincosf(float angle, float *sine, float *cosine);
+float tuner_atan2f(float y, float x);  // in (-pi, pi]
+float tuner_hypotf(float x, float y);
+// both from one rotation, for a caller that needs the two
+void tuner_polarf(float x, float y, float *length, float *angle);
+
+#endif  // TUNER_H